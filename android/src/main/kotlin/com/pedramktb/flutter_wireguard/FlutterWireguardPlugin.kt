@@ -10,6 +10,8 @@ import android.os.Handler
 import android.os.IBinder
 import android.os.Looper
 import com.wireguard.android.backend.Tunnel
+import com.wireguard.crypto.Key
+import com.wireguard.crypto.KeyPair
 import io.flutter.embedding.engine.plugins.FlutterPlugin
 import io.flutter.embedding.engine.plugins.activity.ActivityAware
 import io.flutter.embedding.engine.plugins.activity.ActivityPluginBinding
@@ -24,6 +26,9 @@ import org.json.JSONObject
 
 private const val PERMISSION_REQUEST_CODE = 10014
 
+// Same cap as the native plugins (cpp/key_pairs.h, kMaxKeyPairs).
+private const val MAX_KEY_PAIRS = 65536L
+
 /**
  * Lives in the MAIN process. Implements the Pigeon-generated [WireguardHostApi]
  * by delegating to the [IWireguard] AIDL binder exported by [WireguardService]
@@ -185,6 +190,113 @@ class FlutterWireguardPlugin :
             val o = JSONObject(it.backendJson())
             BackendInfo(kind = o.getString("kind").toPigeonBackend(), detail = o.getString("detail"))
         }
+
+    // Android's VpnService carries one tunnel at a time, so batches run in
+    // order on the IO scope; the gain is a single service hop per batch.
+    override fun startMany(specs: List<TunnelSpec>, callback: (Result<List<TunnelResult>>) -> Unit) =
+        withService("START_FAILED", callback) { svc ->
+            specs.map { s -> batchResult(s.name) { svc.start(s.name, s.config) } }
+        }
+
+    override fun stopMany(names: List<String>, callback: (Result<List<TunnelResult>>) -> Unit) =
+        withService("STOP_FAILED", callback) { svc ->
+            names.map { n -> batchResult(n) { svc.stop(n) } }
+        }
+
+    // GoBackend swaps the VpnService's single tunnel in place when [to]
+    // comes up, so there is nothing to stage; the stop only matters on the
+    // kernel backend, where both tunnels can run at once.
+    override fun switchTunnel(from: String, to: String, config: String, callback: (Result<Unit>) -> Unit) =
+        withService("SWITCH_FAILED", callback) { svc ->
+            svc.start(to, config)
+            svc.stop(from)
+        }
+
+    // GoBackend does its work inside the :wireguard process in one binder
+    // call, so there are no native phases to time here.
+    override fun diagnostics(callback: (Result<List<PhaseStats>>) -> Unit) =
+        callback(Result.success(emptyList()))
+
+    // No native trace points on Android; use Perfetto's system tracing.
+    override fun dumpTrace(path: String, callback: (Result<Unit>) -> Unit) =
+        callback(Result.failure(FlutterError("TRACE_FAILED", "tracing is not available on Android")))
+
+    // The AllowedIPs index is native (cpp/allowed_ips.h) and not built for
+    // Android; the app can read the peers from its own config.
+    override fun lookupPeer(name: String, ipAddress: String, callback: (Result<String?>) -> Unit) =
+        callback(Result.failure(FlutterError("LOOKUP_FAILED", "peer lookup is not available on Android")))
+
+    override fun lookupPeers(name: String, ipAddresses: List<String>, callback: (Result<List<String?>>) -> Unit) =
+        callback(Result.failure(FlutterError("LOOKUP_FAILED", "peer lookup is not available on Android")))
+
+    // Same story for the CIDR set library (cpp/cidr_set.h).
+    override fun computeAllowedIps(include: List<String>, exclude: List<String>, callback: (Result<List<String>>) -> Unit) =
+        callback(Result.failure(FlutterError("ALLOWED_IPS_FAILED", "CIDR set algebra is not available on Android")))
+
+    // GoBackend resolves endpoints itself when the tunnel comes up.
+    override fun reresolveEndpoints(name: String, callback: (Result<Long>) -> Unit) =
+        callback(Result.failure(FlutterError("RESOLVE_FAILED", "re-resolving endpoints is not available on Android")))
+
+    // The handshake monitor is native (cpp/handshake_monitor.h); Android
+    // emits no onTunnelHealth events.
+    override fun setStaleAfter(seconds: Long, callback: (Result<Unit>) -> Unit) =
+        callback(Result.failure(FlutterError("HEALTH_FAILED", "tunnel health is not available on Android")))
+
+    // The tunnel library's own Curve25519 (com.wireguard.crypto), which is
+    // what wg-quick on Android uses; the native batch path is not built for
+    // Android. Runs on the IO scope rather than the platform thread.
+    override fun generateKeyPairs(count: Long, callback: (Result<List<KeyPairData>>) -> Unit) =
+        offMain("KEYS_FAILED", callback) {
+            require(count in 0..MAX_KEY_PAIRS) { "count must be between 0 and $MAX_KEY_PAIRS, got $count" }
+            List(count.toInt()) {
+                val pair = KeyPair()
+                KeyPairData(privateKey = pair.privateKey.toBase64(), publicKey = pair.publicKey.toBase64())
+            }
+        }
+
+    override fun publicKeysFromPrivate(privateKeys: List<String>, callback: (Result<List<String>>) -> Unit) =
+        offMain("KEYS_FAILED", callback) {
+            privateKeys.mapIndexed { i, b64 ->
+                val key = try {
+                    Key.fromBase64(b64)
+                } catch (e: Exception) {
+                    throw IllegalArgumentException("private key $i is not a base64 WireGuard key")
+                }
+                KeyPair(key).publicKey.toBase64()
+            }
+        }
+
+    // WireguardService reports tunnel totals only.
+    override fun peerByPublicKey(name: String, publicKey: String, callback: (Result<PeerStatus?>) -> Unit) =
+        callback(Result.failure(FlutterError("PEER_FAILED", "per-peer status is not available on Android")))
+
+    override fun usage(name: String, since: Long, callback: (Result<TunnelUsage>) -> Unit) =
+        callback(Result.failure(FlutterError("USAGE_FAILED", "the usage ledger is not available on Android")))
+
+    override fun setUsageQuota(name: String, limitBytes: Long, since: Long, callback: (Result<Long>) -> Unit) =
+        callback(Result.failure(FlutterError("USAGE_FAILED", "the usage ledger is not available on Android")))
+
+    private inline fun <T> offMain(
+        errorCode: String,
+        crossinline callback: (Result<T>) -> Unit,
+        crossinline block: () -> T,
+    ) {
+        scope.launch {
+            try {
+                val r = block()
+                mainHandler.post { callback(Result.success(r)) }
+            } catch (e: Exception) {
+                mainHandler.post { callback(Result.failure(FlutterError(errorCode, e.message ?: e.javaClass.simpleName))) }
+            }
+        }
+    }
+}
+
+internal inline fun batchResult(name: String, op: () -> Unit): TunnelResult = try {
+    op()
+    TunnelResult(name = name, ok = true)
+} catch (e: Exception) {
+    TunnelResult(name = name, ok = false, error = e.message ?: e.javaClass.simpleName)
 }
 
 internal fun String.toPigeonState(): TunnelState = when (Tunnel.State.valueOf(this)) {
@@ -227,6 +227,28 @@ enum class BackendKind(val raw: Int) {
   }
 }
 
+/**
+ * How a running tunnel's peer is doing, judged by the age of its last
+ * handshake.
+ */
+enum class TunnelHealthState(val raw: Int) {
+  /** First handshake since the tunnel was started. */
+  CONNECTED(0),
+  /**
+   * No handshake for the stale-after age (180 s unless set with
+   * [WireguardHostApi.setStaleAfter]), or none that long after the start.
+   */
+  STALE(1),
+  /** A handshake again after [stale]. */
+  RECOVERED(2);
+
+  companion object {
+    fun ofRaw(raw: Int): TunnelHealthState? {
+      return values().firstOrNull { it.raw == raw }
+    }
+  }
+}
+
 /**
  * A snapshot of a tunnel's runtime status.
  *
@@ -327,206 +349,1211 @@ data class BackendInfo (
     return result
   }
 }
-private open class MessagesPigeonCodec : StandardMessageCodec() {
-  override fun readValueOfType(type: Byte, buffer: ByteBuffer): Any? {
-    return when (type) {
-      129.toByte() -> {
-        return (readValue(buffer) as Long?)?.let {
-          TunnelState.ofRaw(it.toInt())
-        }
-      }
-      130.toByte() -> {
-        return (readValue(buffer) as Long?)?.let {
-          BackendKind.ofRaw(it.toInt())
-        }
-      }
-      131.toByte() -> {
-        return (readValue(buffer) as? List<Any?>)?.let {
-          TunnelStatus.fromList(it)
-        }
-      }
-      132.toByte() -> {
-        return (readValue(buffer) as? List<Any?>)?.let {
-          BackendInfo.fromList(it)
-        }
-      }
-      else -> super.readValueOfType(type, buffer)
+
+/**
+ * One tunnel to bring up in a [WireguardHostApi.startMany] batch.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class TunnelSpec (
+  /** Tunnel/interface name (e.g. "wg0"). */
+  val name: String,
+  /** wg-quick / wg-config string, as for [WireguardHostApi.start]. */
+  val config: String
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): TunnelSpec {
+      val name = pigeonVar_list[0] as String
+      val config = pigeonVar_list[1] as String
+      return TunnelSpec(name, config)
     }
   }
-  override fun writeValue(stream: ByteArrayOutputStream, value: Any?)   {
-    when (value) {
-      is TunnelState -> {
-        stream.write(129)
-        writeValue(stream, value.raw.toLong())
-      }
-      is BackendKind -> {
-        stream.write(130)
-        writeValue(stream, value.raw.toLong())
-      }
-      is TunnelStatus -> {
-        stream.write(131)
-        writeValue(stream, value.toList())
-      }
-      is BackendInfo -> {
-        stream.write(132)
-        writeValue(stream, value.toList())
-      }
-      else -> super.writeValue(stream, value)
+  fun toList(): List<Any?> {
+    return listOf(
+      name,
+      config,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
     }
+    val other = other as TunnelSpec
+    return MessagesPigeonUtils.deepEquals(this.name, other.name) && MessagesPigeonUtils.deepEquals(this.config, other.config)
   }
-}
 
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.name)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.config)
+    return result
+  }
+}
 
 /**
- * Host -> platform calls. All implementations must be reentrant and may be
- * called from any isolate / thread.
+ * Per-tunnel outcome of a batch call.
  *
- * Generated interface from Pigeon that represents a handler of messages from Flutter.
+ * Generated class from Pigeon that represents data sent in messages.
  */
-interface WireguardHostApi {
-  /**
-   * Bring the tunnel up with the given wg-quick / wg-config string.
-   * Throws [PlatformException] with code "START_FAILED" on backend failure.
-   */
-  fun start(name: String, config: String, callback: (Result<Unit>) -> Unit)
-  /** Bring the named tunnel down. No-op if already down. */
-  fun stop(name: String, callback: (Result<Unit>) -> Unit)
-  /** Returns the current status. Throws if the tunnel was never started. */
-  fun status(name: String, callback: (Result<TunnelStatus>) -> Unit)
-  /**
-   * Returns the names of all currently-known tunnels (including DOWN ones
-   * that were started in this process lifetime).
-   */
-  fun tunnelNames(callback: (Result<List<String>>) -> Unit)
-  /** Returns the active backend. */
-  fun backend(callback: (Result<BackendInfo>) -> Unit)
-
+data class TunnelResult (
+  val name: String,
+  /** True if the tunnel reached the requested state. */
+  val ok: Boolean,
+  /** Backend error message when [ok] is false. */
+  val error: String? = null
+)
+ {
   companion object {
-    /** The codec used by WireguardHostApi. */
-    val codec: MessageCodec<Any?> by lazy {
-      MessagesPigeonCodec()
+    fun fromList(pigeonVar_list: List<Any?>): TunnelResult {
+      val name = pigeonVar_list[0] as String
+      val ok = pigeonVar_list[1] as Boolean
+      val error = pigeonVar_list[2] as String?
+      return TunnelResult(name, ok, error)
     }
-    /** Sets up an instance of `WireguardHostApi` to handle messages through the `binaryMessenger`. */
-    @JvmOverloads
-    fun setUp(binaryMessenger: BinaryMessenger, api: WireguardHostApi?, messageChannelSuffix: String = "") {
-      val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
-      run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start$separatedMessageChannelSuffix", codec)
-        if (api != null) {
-          channel.setMessageHandler { message, reply ->
-            val args = message as List<Any?>
-            val nameArg = args[0] as String
-            val configArg = args[1] as String
-            api.start(nameArg, configArg) { result: Result<Unit> ->
-              val error = result.exceptionOrNull()
-              if (error != null) {
-                reply.reply(MessagesPigeonUtils.wrapError(error))
-              } else {
-                reply.reply(MessagesPigeonUtils.wrapResult(null))
-              }
-            }
-          }
-        } else {
-          channel.setMessageHandler(null)
-        }
-      }
-      run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop$separatedMessageChannelSuffix", codec)
-        if (api != null) {
-          channel.setMessageHandler { message, reply ->
-            val args = message as List<Any?>
-            val nameArg = args[0] as String
-            api.stop(nameArg) { result: Result<Unit> ->
-              val error = result.exceptionOrNull()
-              if (error != null) {
-                reply.reply(MessagesPigeonUtils.wrapError(error))
-              } else {
-                reply.reply(MessagesPigeonUtils.wrapResult(null))
-              }
-            }
-          }
-        } else {
-          channel.setMessageHandler(null)
-        }
-      }
-      run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status$separatedMessageChannelSuffix", codec)
-        if (api != null) {
-          channel.setMessageHandler { message, reply ->
-            val args = message as List<Any?>
-            val nameArg = args[0] as String
-            api.status(nameArg) { result: Result<TunnelStatus> ->
-              val error = result.exceptionOrNull()
-              if (error != null) {
-                reply.reply(MessagesPigeonUtils.wrapError(error))
-              } else {
-                val data = result.getOrNull()
-                reply.reply(MessagesPigeonUtils.wrapResult(data))
-              }
-            }
-          }
-        } else {
-          channel.setMessageHandler(null)
-        }
-      }
-      run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames$separatedMessageChannelSuffix", codec)
-        if (api != null) {
-          channel.setMessageHandler { _, reply ->
-            api.tunnelNames{ result: Result<List<String>> ->
-              val error = result.exceptionOrNull()
-              if (error != null) {
-                reply.reply(MessagesPigeonUtils.wrapError(error))
-              } else {
-                val data = result.getOrNull()
-                reply.reply(MessagesPigeonUtils.wrapResult(data))
-              }
-            }
-          }
-        } else {
-          channel.setMessageHandler(null)
-        }
-      }
-      run {
-        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend$separatedMessageChannelSuffix", codec)
-        if (api != null) {
-          channel.setMessageHandler { _, reply ->
-            api.backend{ result: Result<BackendInfo> ->
-              val error = result.exceptionOrNull()
-              if (error != null) {
-                reply.reply(MessagesPigeonUtils.wrapError(error))
-              } else {
-                val data = result.getOrNull()
-                reply.reply(MessagesPigeonUtils.wrapResult(data))
-              }
-            }
-          }
-        } else {
-          channel.setMessageHandler(null)
-        }
-      }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      name,
+      ok,
+      error,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
     }
+    if (this === other) {
+      return true
+    }
+    val other = other as TunnelResult
+    return MessagesPigeonUtils.deepEquals(this.name, other.name) && MessagesPigeonUtils.deepEquals(this.ok, other.ok) && MessagesPigeonUtils.deepEquals(this.error, other.error)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.name)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.ok)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.error)
+    return result
   }
 }
+
 /**
- * Platform -> host events.
+ * Latency percentiles of one step of a tunnel operation.
  *
- * Generated class from Pigeon that represents Flutter messages that can be called from Kotlin.
+ * Generated class from Pigeon that represents data sent in messages.
  */
-class WireguardFlutterApi(private val binaryMessenger: BinaryMessenger, private val messageChannelSuffix: String = "") {
+data class PhaseStats (
+  /** Operation the phase belongs to ("start", "stop", "switch", ...). */
+  val op: String,
+  /** Step within [op] ("wg_quick_up", "create_service", "total", ...). */
+  val phase: String,
+  /** Number of samples recorded since the process started. */
+  val count: Long,
+  val p50Ms: Double,
+  val p95Ms: Double,
+  val p99Ms: Double
+)
+ {
   companion object {
-    /** The codec used by WireguardFlutterApi. */
-    val codec: MessageCodec<Any?> by lazy {
-      MessagesPigeonCodec()
+    fun fromList(pigeonVar_list: List<Any?>): PhaseStats {
+      val op = pigeonVar_list[0] as String
+      val phase = pigeonVar_list[1] as String
+      val count = pigeonVar_list[2] as Long
+      val p50Ms = pigeonVar_list[3] as Double
+      val p95Ms = pigeonVar_list[4] as Double
+      val p99Ms = pigeonVar_list[5] as Double
+      return PhaseStats(op, phase, count, p50Ms, p95Ms, p99Ms)
     }
   }
-  /** Pushed whenever a tunnel changes state or its statistics tick. */
-  fun onTunnelStatus(statusArg: TunnelStatus, callback: (Result<Unit>) -> Unit)
-{
-    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
-    val channelName = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelStatus$separatedMessageChannelSuffix"
-    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
-    channel.send(listOf(statusArg)) {
+  fun toList(): List<Any?> {
+    return listOf(
+      op,
+      phase,
+      count,
+      p50Ms,
+      p95Ms,
+      p99Ms,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as PhaseStats
+    return MessagesPigeonUtils.deepEquals(this.op, other.op) && MessagesPigeonUtils.deepEquals(this.phase, other.phase) && MessagesPigeonUtils.deepEquals(this.count, other.count) && MessagesPigeonUtils.deepEquals(this.p50Ms, other.p50Ms) && MessagesPigeonUtils.deepEquals(this.p95Ms, other.p95Ms) && MessagesPigeonUtils.deepEquals(this.p99Ms, other.p99Ms)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.op)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.phase)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.count)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.p50Ms)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.p95Ms)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.p99Ms)
+    return result
+  }
+}
+
+/**
+ * A peer of a running tunnel crossing the handshake-age threshold.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class TunnelHealth (
+  /** Tunnel/interface name (e.g. "wg0"). */
+  val name: String,
+  /**
+   * Base64 public key of the peer; "" where the platform only reports the
+   * tunnel as a whole (Windows).
+   */
+  val publicKey: String,
+  val state: TunnelHealthState,
+  /** Epoch milliseconds of the handshake [state] was judged by (0 if none). */
+  val lastHandshake: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): TunnelHealth {
+      val name = pigeonVar_list[0] as String
+      val publicKey = pigeonVar_list[1] as String
+      val state = pigeonVar_list[2] as TunnelHealthState
+      val lastHandshake = pigeonVar_list[3] as Long
+      return TunnelHealth(name, publicKey, state, lastHandshake)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      name,
+      publicKey,
+      state,
+      lastHandshake,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as TunnelHealth
+    return MessagesPigeonUtils.deepEquals(this.name, other.name) && MessagesPigeonUtils.deepEquals(this.publicKey, other.publicKey) && MessagesPigeonUtils.deepEquals(this.state, other.state) && MessagesPigeonUtils.deepEquals(this.lastHandshake, other.lastHandshake)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.name)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.publicKey)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.state)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.lastHandshake)
+    return result
+  }
+}
+
+/**
+ * A WireGuard keypair generated natively.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class KeyPairData (
+  /** Base64, as `wg genkey` prints it. */
+  val privateKey: String,
+  /** Base64, as `wg pubkey` prints it. */
+  val publicKey: String
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): KeyPairData {
+      val privateKey = pigeonVar_list[0] as String
+      val publicKey = pigeonVar_list[1] as String
+      return KeyPairData(privateKey, publicKey)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      privateKey,
+      publicKey,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as KeyPairData
+    return MessagesPigeonUtils.deepEquals(this.privateKey, other.privateKey) && MessagesPigeonUtils.deepEquals(this.publicKey, other.publicKey)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.privateKey)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.publicKey)
+    return result
+  }
+}
+
+/**
+ * One peer of a running tunnel, as of the last status poll.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PeerStatus (
+  /** Base64 public key. */
+  val publicKey: String,
+  /** "host:port" the peer was last heard from, null if none yet. */
+  val endpoint: String? = null,
+  /** Bytes received from the peer. */
+  val rx: Long,
+  /** Bytes sent to the peer. */
+  val tx: Long,
+  /** Epoch milliseconds of the latest handshake, 0 if none. */
+  val lastHandshake: Long,
+  /** Seconds; 0 when off. */
+  val persistentKeepalive: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PeerStatus {
+      val publicKey = pigeonVar_list[0] as String
+      val endpoint = pigeonVar_list[1] as String?
+      val rx = pigeonVar_list[2] as Long
+      val tx = pigeonVar_list[3] as Long
+      val lastHandshake = pigeonVar_list[4] as Long
+      val persistentKeepalive = pigeonVar_list[5] as Long
+      return PeerStatus(publicKey, endpoint, rx, tx, lastHandshake, persistentKeepalive)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      publicKey,
+      endpoint,
+      rx,
+      tx,
+      lastHandshake,
+      persistentKeepalive,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as PeerStatus
+    return MessagesPigeonUtils.deepEquals(this.publicKey, other.publicKey) && MessagesPigeonUtils.deepEquals(this.endpoint, other.endpoint) && MessagesPigeonUtils.deepEquals(this.rx, other.rx) && MessagesPigeonUtils.deepEquals(this.tx, other.tx) && MessagesPigeonUtils.deepEquals(this.lastHandshake, other.lastHandshake) && MessagesPigeonUtils.deepEquals(this.persistentKeepalive, other.persistentKeepalive)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.publicKey)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.endpoint)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.rx)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.tx)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.lastHandshake)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.persistentKeepalive)
+    return result
+  }
+}
+
+/**
+ * One peer's share of a [TunnelUsage].
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class PeerUsage (
+  /** Base64 public key. */
+  val publicKey: String,
+  /** Bytes received from the peer. */
+  val rx: Long,
+  /** Bytes sent to the peer. */
+  val tx: Long
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): PeerUsage {
+      val publicKey = pigeonVar_list[0] as String
+      val rx = pigeonVar_list[1] as Long
+      val tx = pigeonVar_list[2] as Long
+      return PeerUsage(publicKey, rx, tx)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      publicKey,
+      rx,
+      tx,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as PeerUsage
+    return MessagesPigeonUtils.deepEquals(this.publicKey, other.publicKey) && MessagesPigeonUtils.deepEquals(this.rx, other.rx) && MessagesPigeonUtils.deepEquals(this.tx, other.tx)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.publicKey)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.rx)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.tx)
+    return result
+  }
+}
+
+/**
+ * Data a tunnel used over a period, across restarts of the tunnel and of
+ * the app.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class TunnelUsage (
+  /** Tunnel/interface name (e.g. "wg0"). */
+  val name: String,
+  /** Epoch milliseconds the usage is counted from, as asked. */
+  val since: Long,
+  /** Bytes received over the tunnel. */
+  val rx: Long,
+  /** Bytes sent over the tunnel. */
+  val tx: Long,
+  /** Peers that carried traffic in the period. */
+  val peers: List<PeerUsage>
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): TunnelUsage {
+      val name = pigeonVar_list[0] as String
+      val since = pigeonVar_list[1] as Long
+      val rx = pigeonVar_list[2] as Long
+      val tx = pigeonVar_list[3] as Long
+      val peers = pigeonVar_list[4] as List<PeerUsage>
+      return TunnelUsage(name, since, rx, tx, peers)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      name,
+      since,
+      rx,
+      tx,
+      peers,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as TunnelUsage
+    return MessagesPigeonUtils.deepEquals(this.name, other.name) && MessagesPigeonUtils.deepEquals(this.since, other.since) && MessagesPigeonUtils.deepEquals(this.rx, other.rx) && MessagesPigeonUtils.deepEquals(this.tx, other.tx) && MessagesPigeonUtils.deepEquals(this.peers, other.peers)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.name)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.since)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.rx)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.tx)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.peers)
+    return result
+  }
+}
+
+/**
+ * A tunnel that reached its usage quota.
+ *
+ * Generated class from Pigeon that represents data sent in messages.
+ */
+data class UsageQuotaExceeded (
+  /** Tunnel/interface name (e.g. "wg0"). */
+  val name: String,
+  /** The quota, in bytes of rx + tx. */
+  val limit: Long,
+  /** Bytes of rx + tx used since [since] when the quota was noticed. */
+  val used: Long,
+  /** Epoch milliseconds the quota counts from. */
+  val since: Long,
+  /** Whether the tunnel was stopped; false if stopping it failed. */
+  val stopped: Boolean
+)
+ {
+  companion object {
+    fun fromList(pigeonVar_list: List<Any?>): UsageQuotaExceeded {
+      val name = pigeonVar_list[0] as String
+      val limit = pigeonVar_list[1] as Long
+      val used = pigeonVar_list[2] as Long
+      val since = pigeonVar_list[3] as Long
+      val stopped = pigeonVar_list[4] as Boolean
+      return UsageQuotaExceeded(name, limit, used, since, stopped)
+    }
+  }
+  fun toList(): List<Any?> {
+    return listOf(
+      name,
+      limit,
+      used,
+      since,
+      stopped,
+    )
+  }
+  override fun equals(other: Any?): Boolean {
+    if (other == null || other.javaClass != javaClass) {
+      return false
+    }
+    if (this === other) {
+      return true
+    }
+    val other = other as UsageQuotaExceeded
+    return MessagesPigeonUtils.deepEquals(this.name, other.name) && MessagesPigeonUtils.deepEquals(this.limit, other.limit) && MessagesPigeonUtils.deepEquals(this.used, other.used) && MessagesPigeonUtils.deepEquals(this.since, other.since) && MessagesPigeonUtils.deepEquals(this.stopped, other.stopped)
+  }
+
+  override fun hashCode(): Int {
+    var result = javaClass.hashCode()
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.name)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.limit)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.used)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.since)
+    result = 31 * result + MessagesPigeonUtils.deepHash(this.stopped)
+    return result
+  }
+}
+private open class MessagesPigeonCodec : StandardMessageCodec() {
+  override fun readValueOfType(type: Byte, buffer: ByteBuffer): Any? {
+    return when (type) {
+      129.toByte() -> {
+        return (readValue(buffer) as Long?)?.let {
+          TunnelState.ofRaw(it.toInt())
+        }
+      }
+      130.toByte() -> {
+        return (readValue(buffer) as Long?)?.let {
+          BackendKind.ofRaw(it.toInt())
+        }
+      }
+      131.toByte() -> {
+        return (readValue(buffer) as Long?)?.let {
+          TunnelHealthState.ofRaw(it.toInt())
+        }
+      }
+      132.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          TunnelStatus.fromList(it)
+        }
+      }
+      133.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          BackendInfo.fromList(it)
+        }
+      }
+      134.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          TunnelSpec.fromList(it)
+        }
+      }
+      135.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          TunnelResult.fromList(it)
+        }
+      }
+      136.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PhaseStats.fromList(it)
+        }
+      }
+      137.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          TunnelHealth.fromList(it)
+        }
+      }
+      138.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          KeyPairData.fromList(it)
+        }
+      }
+      139.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PeerStatus.fromList(it)
+        }
+      }
+      140.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          PeerUsage.fromList(it)
+        }
+      }
+      141.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          TunnelUsage.fromList(it)
+        }
+      }
+      142.toByte() -> {
+        return (readValue(buffer) as? List<Any?>)?.let {
+          UsageQuotaExceeded.fromList(it)
+        }
+      }
+      else -> super.readValueOfType(type, buffer)
+    }
+  }
+  override fun writeValue(stream: ByteArrayOutputStream, value: Any?)   {
+    when (value) {
+      is TunnelState -> {
+        stream.write(129)
+        writeValue(stream, value.raw.toLong())
+      }
+      is BackendKind -> {
+        stream.write(130)
+        writeValue(stream, value.raw.toLong())
+      }
+      is TunnelHealthState -> {
+        stream.write(131)
+        writeValue(stream, value.raw.toLong())
+      }
+      is TunnelStatus -> {
+        stream.write(132)
+        writeValue(stream, value.toList())
+      }
+      is BackendInfo -> {
+        stream.write(133)
+        writeValue(stream, value.toList())
+      }
+      is TunnelSpec -> {
+        stream.write(134)
+        writeValue(stream, value.toList())
+      }
+      is TunnelResult -> {
+        stream.write(135)
+        writeValue(stream, value.toList())
+      }
+      is PhaseStats -> {
+        stream.write(136)
+        writeValue(stream, value.toList())
+      }
+      is TunnelHealth -> {
+        stream.write(137)
+        writeValue(stream, value.toList())
+      }
+      is KeyPairData -> {
+        stream.write(138)
+        writeValue(stream, value.toList())
+      }
+      is PeerStatus -> {
+        stream.write(139)
+        writeValue(stream, value.toList())
+      }
+      is PeerUsage -> {
+        stream.write(140)
+        writeValue(stream, value.toList())
+      }
+      is TunnelUsage -> {
+        stream.write(141)
+        writeValue(stream, value.toList())
+      }
+      is UsageQuotaExceeded -> {
+        stream.write(142)
+        writeValue(stream, value.toList())
+      }
+      else -> super.writeValue(stream, value)
+    }
+  }
+}
+
+
+/**
+ * Host -> platform calls. All implementations must be reentrant and may be
+ * called from any isolate / thread.
+ *
+ * Generated interface from Pigeon that represents a handler of messages from Flutter.
+ */
+interface WireguardHostApi {
+  /**
+   * Bring the tunnel up with the given wg-quick / wg-config string.
+   * Throws [PlatformException] with code "START_FAILED" on backend failure.
+   */
+  fun start(name: String, config: String, callback: (Result<Unit>) -> Unit)
+  /** Bring the named tunnel down. No-op if already down. */
+  fun stop(name: String, callback: (Result<Unit>) -> Unit)
+  /** Returns the current status. Throws if the tunnel was never started. */
+  fun status(name: String, callback: (Result<TunnelStatus>) -> Unit)
+  /**
+   * Returns the names of all currently-known tunnels (including DOWN ones
+   * that were started in this process lifetime).
+   */
+  fun tunnelNames(callback: (Result<List<String>>) -> Unit)
+  /** Returns the active backend. */
+  fun backend(callback: (Result<BackendInfo>) -> Unit)
+  /**
+   * Bring several tunnels up at once. Independent tunnels are brought up
+   * concurrently where the platform allows it; one failure does not abort
+   * the rest. Results come back in input order.
+   */
+  fun startMany(specs: List<TunnelSpec>, callback: (Result<List<TunnelResult>>) -> Unit)
+  /** Bring several tunnels down at once. Unknown names count as success. */
+  fun stopMany(names: List<String>, callback: (Result<List<TunnelResult>>) -> Unit)
+  /**
+   * Replace tunnel [from] with [to] (configured by [config]) without a
+   * connectivity gap: [to] comes up and completes a handshake before
+   * traffic moves over and [from] goes down. If [to] fails, [from] is left
+   * untouched and "SWITCH_FAILED" is thrown.
+   */
+  fun switchTunnel(from: String, to: String, config: String, callback: (Result<Unit>) -> Unit)
+  /**
+   * Per-phase timings of every Start/Stop since the backend started, for
+   * telling where a slow connect spent its time.
+   */
+  fun diagnostics(callback: (Result<List<PhaseStats>>) -> Unit)
+  /**
+   * Write the native trace buffers to [path] as Chrome trace JSON. Only
+   * available in builds with trace points compiled in; throws
+   * "TRACE_FAILED" otherwise.
+   */
+  fun dumpTrace(path: String, callback: (Result<Unit>) -> Unit)
+  /**
+   * Public key of the peer tunnel [name] would route [ipAddress] to: the
+   * longest AllowedIPs prefix containing it, as the kernel picks. Null if no
+   * peer covers it. Throws "LOOKUP_FAILED" for an unknown tunnel or a
+   * malformed address.
+   */
+  fun lookupPeer(name: String, ipAddress: String, callback: (Result<String?>) -> Unit)
+  /**
+   * [lookupPeer] for many addresses at once; results match [ipAddresses] in
+   * order.
+   */
+  fun lookupPeers(name: String, ipAddresses: List<String>, callback: (Result<List<String?>>) -> Unit)
+  /**
+   * The addresses in [include] but not in [exclude], as the fewest CIDR
+   * prefixes (IPv4 first, each family in address order). Throws
+   * "ALLOWED_IPS_FAILED" for a malformed prefix.
+   */
+  fun computeAllowedIps(include: List<String>, exclude: List<String>, callback: (Result<List<String>>) -> Unit)
+  /**
+   * Looks up the hostnames in the peer Endpoints of tunnel [name] again and
+   * moves the peers whose address changed. Returns how many moved. Throws
+   * "RESOLVE_FAILED".
+   */
+  fun reresolveEndpoints(name: String, callback: (Result<Long>) -> Unit)
+  /**
+   * Handshake age, in seconds, after which a peer is reported
+   * [TunnelHealthState.stale]. Defaults to 180; values below 1 are raised to 1.
+   */
+  fun setStaleAfter(seconds: Long, callback: (Result<Unit>) -> Unit)
+  /**
+   * [count] fresh keypairs from the platform CSPRNG, derived off the platform
+   * thread. Throws "KEYS_FAILED" for a negative or too-large [count].
+   */
+  fun generateKeyPairs(count: Long, callback: (Result<List<KeyPairData>>) -> Unit)
+  /**
+   * The public key of each of [privateKeys], in order. Throws "KEYS_FAILED"
+   * naming the first key that is not 32 bytes of base64.
+   */
+  fun publicKeysFromPrivate(privateKeys: List<String>, callback: (Result<List<String>>) -> Unit)
+  /**
+   * The peer of tunnel [name] with [publicKey], as of the last status poll;
+   * null if the tunnel has no such peer. Throws "PEER_FAILED" for an unknown
+   * tunnel or a malformed key.
+   */
+  fun peerByPublicKey(name: String, publicKey: String, callback: (Result<PeerStatus?>) -> Unit)
+  /**
+   * Data tunnel [name] used since [since] (epoch milliseconds), from the
+   * persistent usage ledger. Throws "USAGE_FAILED" for an invalid name or
+   * when the ledger is unavailable.
+   */
+  fun usage(name: String, since: Long, callback: (Result<TunnelUsage>) -> Unit)
+  /**
+   * Stops tunnel [name] once its rx + tx since [since] reaches [limitBytes],
+   * reporting it through [WireguardFlutterApi.onUsageQuota]; a [limitBytes] of
+   * 0 removes the quota. Returns the bytes already used. Throws
+   * "USAGE_FAILED" like [usage].
+   */
+  fun setUsageQuota(name: String, limitBytes: Long, since: Long, callback: (Result<Long>) -> Unit)
+
+  companion object {
+    /** The codec used by WireguardHostApi. */
+    val codec: MessageCodec<Any?> by lazy {
+      MessagesPigeonCodec()
+    }
+    /** Sets up an instance of `WireguardHostApi` to handle messages through the `binaryMessenger`. */
+    @JvmOverloads
+    fun setUp(binaryMessenger: BinaryMessenger, api: WireguardHostApi?, messageChannelSuffix: String = "") {
+      val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val configArg = args[1] as String
+            api.start(nameArg, configArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                reply.reply(MessagesPigeonUtils.wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            api.stop(nameArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                reply.reply(MessagesPigeonUtils.wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            api.status(nameArg) { result: Result<TunnelStatus> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.tunnelNames{ result: Result<List<String>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.backend{ result: Result<BackendInfo> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.startMany$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val specsArg = args[0] as List<TunnelSpec>
+            api.startMany(specsArg) { result: Result<List<TunnelResult>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stopMany$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val namesArg = args[0] as List<String>
+            api.stopMany(namesArg) { result: Result<List<TunnelResult>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.switchTunnel$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val fromArg = args[0] as String
+            val toArg = args[1] as String
+            val configArg = args[2] as String
+            api.switchTunnel(fromArg, toArg, configArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                reply.reply(MessagesPigeonUtils.wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.diagnostics$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { _, reply ->
+            api.diagnostics{ result: Result<List<PhaseStats>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.dumpTrace$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val pathArg = args[0] as String
+            api.dumpTrace(pathArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                reply.reply(MessagesPigeonUtils.wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeer$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val ipAddressArg = args[1] as String
+            api.lookupPeer(nameArg, ipAddressArg) { result: Result<String?> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeers$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val ipAddressesArg = args[1] as List<String>
+            api.lookupPeers(nameArg, ipAddressesArg) { result: Result<List<String?>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.computeAllowedIps$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val includeArg = args[0] as List<String>
+            val excludeArg = args[1] as List<String>
+            api.computeAllowedIps(includeArg, excludeArg) { result: Result<List<String>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.reresolveEndpoints$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            api.reresolveEndpoints(nameArg) { result: Result<Long> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setStaleAfter$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val secondsArg = args[0] as Long
+            api.setStaleAfter(secondsArg) { result: Result<Unit> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                reply.reply(MessagesPigeonUtils.wrapResult(null))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.generateKeyPairs$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val countArg = args[0] as Long
+            api.generateKeyPairs(countArg) { result: Result<List<KeyPairData>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.publicKeysFromPrivate$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val privateKeysArg = args[0] as List<String>
+            api.publicKeysFromPrivate(privateKeysArg) { result: Result<List<String>> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.peerByPublicKey$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val publicKeyArg = args[1] as String
+            api.peerByPublicKey(nameArg, publicKeyArg) { result: Result<PeerStatus?> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.usage$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val sinceArg = args[1] as Long
+            api.usage(nameArg, sinceArg) { result: Result<TunnelUsage> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+      run {
+        val channel = BasicMessageChannel<Any?>(binaryMessenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setUsageQuota$separatedMessageChannelSuffix", codec)
+        if (api != null) {
+          channel.setMessageHandler { message, reply ->
+            val args = message as List<Any?>
+            val nameArg = args[0] as String
+            val limitBytesArg = args[1] as Long
+            val sinceArg = args[2] as Long
+            api.setUsageQuota(nameArg, limitBytesArg, sinceArg) { result: Result<Long> ->
+              val error = result.exceptionOrNull()
+              if (error != null) {
+                reply.reply(MessagesPigeonUtils.wrapError(error))
+              } else {
+                val data = result.getOrNull()
+                reply.reply(MessagesPigeonUtils.wrapResult(data))
+              }
+            }
+          }
+        } else {
+          channel.setMessageHandler(null)
+        }
+      }
+    }
+  }
+}
+/**
+ * Platform -> host events.
+ *
+ * Generated class from Pigeon that represents Flutter messages that can be called from Kotlin.
+ */
+class WireguardFlutterApi(private val binaryMessenger: BinaryMessenger, private val messageChannelSuffix: String = "") {
+  companion object {
+    /** The codec used by WireguardFlutterApi. */
+    val codec: MessageCodec<Any?> by lazy {
+      MessagesPigeonCodec()
+    }
+  }
+  /** Pushed whenever a tunnel changes state or its statistics tick. */
+  fun onTunnelStatus(statusArg: TunnelStatus, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelStatus$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(statusArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(MessagesPigeonUtils.createConnectionError(channelName)))
+      } 
+    }
+  }
+  /**
+   * Pushed the moment a peer of a running tunnel connects, goes stale or
+   * recovers.
+   */
+  fun onTunnelHealth(healthArg: TunnelHealth, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(healthArg)) {
+      if (it is List<*>) {
+        if (it.size > 1) {
+          callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
+        } else {
+          callback(Result.success(Unit))
+        }
+      } else {
+        callback(Result.failure(MessagesPigeonUtils.createConnectionError(channelName)))
+      } 
+    }
+  }
+  /**
+   * Pushed once when a tunnel reaches the quota set with
+   * [WireguardHostApi.setUsageQuota], after it was stopped.
+   */
+  fun onUsageQuota(eventArg: UsageQuotaExceeded, callback: (Result<Unit>) -> Unit)
+{
+    val separatedMessageChannelSuffix = if (messageChannelSuffix.isNotEmpty()) ".$messageChannelSuffix" else ""
+    val channelName = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onUsageQuota$separatedMessageChannelSuffix"
+    val channel = BasicMessageChannel<Any?>(binaryMessenger, channelName, codec)
+    channel.send(listOf(eventArg)) {
       if (it is List<*>) {
         if (it.size > 1) {
           callback(Result.failure(FlutterError(it[0] as String, it[1] as String, it[2] as String?)))
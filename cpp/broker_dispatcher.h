@@ -0,0 +1,344 @@
+// Transport-agnostic request dispatcher for the broker wire protocol in
+// ipc_protocol.h.
+//
+// The elevated side of every desktop backend is the same state machine:
+// decode frames, run HELLO/START/STOP/STATUS/NAMES/BACKEND/SUBSCRIBE against
+// whatever actually manages tunnels, report the process's phase timers
+// (phase_timer.h) for DIAGNOSTICS, and interleave asynchronous status
+// events with responses on one byte stream. That logic lives here; a
+// platform only supplies
+//
+//   * a Transport (Win32 named pipe, Unix domain socket, ...) and
+//   * a TunnelService (SCM-backed TunnelManager, wg-quick, a fake in tests).
+#ifndef FLUTTER_WIREGUARD_BROKER_DISPATCHER_H_
+#define FLUTTER_WIREGUARD_BROKER_DISPATCHER_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ipc_protocol.h"
+#include "name_validator.h"
+#include "phase_timer.h"
+
+namespace flutter_wireguard {
+namespace ipc {
+
+// One connected client. Read() may return fewer bytes than asked for;
+// returning 0 means EOF or a transport error and ends the session.
+// Write() must write everything or fail. The dispatcher serializes writes,
+// but Read() and Write() may run concurrently on different threads.
+class Transport {
+ public:
+  virtual ~Transport() = default;
+  virtual size_t Read(uint8_t* buf, size_t len) = 0;
+  virtual bool Write(const uint8_t* data, size_t len) = 0;
+
+  // Transports that can hand POSIX descriptors to the peer (SCM_RIGHTS)
+  // override both; `fds` travel with the first byte of `data`.
+  virtual bool CanPassFds() const { return false; }
+  virtual bool WriteWithFds(const uint8_t* data, size_t len,
+                            const std::vector<int>& fds) {
+    (void)fds;
+    return Write(data, len);
+  }
+};
+
+struct BackendRecord {
+  uint8_t kind = kBackendUnknown;
+  std::string detail;
+};
+
+// The tunnel side of the broker. Methods throw std::exception on failure;
+// the message is forwarded to the client as a kStatusError response. Names
+// are validated with IsValidTunnelName before any method sees them.
+class TunnelService {
+ public:
+  // Called from a background thread once per poll tick with every tunnel
+  // that changed (or is up). Never called with an empty batch.
+  using StatusCallback = std::function<void(const std::vector<StatusRecord>&)>;
+
+  virtual ~TunnelService() = default;
+  virtual void Start(const std::string& name, const std::string& config) = 0;
+  virtual void Stop(const std::string& name) = 0;
+  virtual StatusRecord Status(const std::string& name) = 0;
+  virtual std::vector<std::string> TunnelNames() = 0;
+  virtual BackendRecord Backend() = 0;
+  // Installs the single tick callback; an empty function removes it.
+  virtual void SetStatusCallback(StatusCallback cb) = 0;
+
+  // Optional shared-memory status segment (status_segment.h). Services that
+  // keep one return its memfd, eventfd, slot count and byte size. The
+  // descriptors stay owned by the service; the transport duplicates them
+  // into the client in reply to kOpMapStatus.
+  virtual bool SharedStatus(int* memfd, int* eventfd, uint32_t* slots,
+                            uint32_t* bytes) {
+    (void)memfd;
+    (void)eventfd;
+    (void)slots;
+    (void)bytes;
+    return false;
+  }
+};
+
+// Serves any number of concurrent connections against one TunnelService.
+// Requests on a connection are handled in order; separate connections run
+// in parallel on whatever threads call Serve(). Status ticks are fanned out
+// to every connection that subscribed, each in the encoding it asked for.
+class Dispatcher {
+ public:
+  explicit Dispatcher(TunnelService* service) : service_(service) {
+    service_->SetStatusCallback(
+        [this](const std::vector<StatusRecord>& tick) { Broadcast(tick); });
+  }
+  ~Dispatcher() { service_->SetStatusCallback({}); }
+
+  Dispatcher(const Dispatcher&) = delete;
+  Dispatcher& operator=(const Dispatcher&) = delete;
+
+  // Blocks until the client disconnects, a write fails or the byte stream
+  // loses framing.
+  void Serve(Transport* transport) {
+    Session session(transport);
+    FrameDecoder decoder;
+    uint8_t chunk[16 * 1024];
+    bool alive = true;
+    while (alive) {
+      size_t got = transport->Read(chunk, sizeof(chunk));
+      if (got == 0) break;
+      try {
+        decoder.Feed(chunk, got, [&](const FrameView& f) {
+          if (!alive) return;
+          std::vector<int> fds;
+          std::vector<uint8_t> resp = Handle(&session, f, &fds);
+          std::vector<uint8_t> frame =
+              BuildFrame(0 /* op unused on resp */, f.seq, kFlagNone, resp);
+          std::lock_guard<std::mutex> lock(session.write_mu);
+          alive = fds.empty()
+                      ? transport->Write(frame.data(), frame.size())
+                      : transport->WriteWithFds(frame.data(), frame.size(), fds);
+        });
+      } catch (...) {
+        break;  // bad length prefix
+      }
+    }
+    Unsubscribe(&session);
+  }
+
+ private:
+  struct Session {
+    explicit Session(Transport* t) : transport(t) {}
+    Transport* transport;
+    // Guards every write on `transport` plus the subscription state below,
+    // since status ticks arrive on the service's poller thread.
+    std::mutex write_mu;
+    bool compact = false;
+    StatusDeltaEncoder encoder;
+  };
+
+  static std::vector<uint8_t> Ok() {
+    Writer w;
+    w.U8(kStatusOk);
+    return w.Take();
+  }
+
+  static std::vector<uint8_t> Err(const std::string& msg) {
+    Writer w;
+    w.U8(kStatusError);
+    w.Str(msg);
+    return w.Take();
+  }
+
+  static std::vector<uint8_t> EncodeStatus(const StatusRecord& s) {
+    Writer w;
+    w.U8(kStatusOk);
+    w.Str(s.name);
+    w.U8(s.state);
+    w.I64(s.rx);
+    w.I64(s.tx);
+    w.I64(s.handshake_ms);
+    return w.Take();
+  }
+
+  // `fds` receives descriptors to attach to the response (kOpMapStatus).
+  std::vector<uint8_t> Handle(Session* session, const FrameView& f,
+                              std::vector<int>* fds) {
+    try {
+      Reader r(f.payload, f.payload_len);
+      switch (f.op) {
+        case kOpHello: {
+          uint32_t client_v = r.U32();
+          if (client_v != kProtocolVersion) return Err("protocol version mismatch");
+          Writer w;
+          w.U8(kStatusOk);
+          w.U32(kProtocolVersion);
+          return w.Take();
+        }
+        case kOpStart: {
+          std::string name = r.Str();
+          std::string config = r.Str();
+          if (!IsValidTunnelName(name)) return Err("invalid tunnel name");
+          if (config.size() > kMaxConfigBytes) return Err("config too large");
+          service_->Start(name, config);
+          return Ok();
+        }
+        case kOpStop: {
+          std::string name = r.Str();
+          if (!IsValidTunnelName(name)) return Err("invalid tunnel name");
+          service_->Stop(name);
+          return Ok();
+        }
+        case kOpStatus: {
+          std::string name = r.Str();
+          if (!IsValidTunnelName(name)) return Err("invalid tunnel name");
+          return EncodeStatus(service_->Status(name));
+        }
+        case kOpTunnelNames: {
+          Writer w;
+          w.U8(kStatusOk);
+          auto names = service_->TunnelNames();
+          w.U32(static_cast<uint32_t>(names.size()));
+          for (const auto& n : names) w.Str(n);
+          return w.Take();
+        }
+        case kOpBackend: {
+          Writer w;
+          w.U8(kStatusOk);
+          BackendRecord b = service_->Backend();
+          w.U8(b.kind);
+          w.Str(b.detail);
+          return w.Take();
+        }
+        case kOpSubscribe:
+        case kOpSubscribeCompact: {
+          {
+            std::lock_guard<std::mutex> lock(session->write_mu);
+            session->compact = f.op == kOpSubscribeCompact;
+            session->encoder.Reset();
+          }
+          std::lock_guard<std::mutex> lock(subscribers_mu_);
+          if (std::find(subscribers_.begin(), subscribers_.end(), session) ==
+              subscribers_.end()) {
+            subscribers_.push_back(session);
+          }
+          return Ok();
+        }
+        case kOpMapStatus: {
+          int memfd = -1, eventfd = -1;
+          uint32_t slots = 0, bytes = 0;
+          if (!session->transport->CanPassFds() ||
+              !service_->SharedStatus(&memfd, &eventfd, &slots, &bytes)) {
+            return Err("shared status unavailable");
+          }
+          fds->push_back(memfd);
+          fds->push_back(eventfd);
+          Writer w;
+          w.U8(kStatusOk);
+          w.U32(slots);
+          w.U32(bytes);
+          return w.Take();
+        }
+        case kOpDiagnostics: {
+          Writer w;
+          w.U8(kStatusOk);
+          auto rows = PhaseRegistry::Instance().Snapshot();
+          w.U32(static_cast<uint32_t>(rows.size()));
+          for (const auto& row : rows) {
+            w.Str(row.op);
+            w.Str(row.phase);
+            w.I64(static_cast<int64_t>(row.count));
+            w.I64(static_cast<int64_t>(row.p50_us));
+            w.I64(static_cast<int64_t>(row.p95_us));
+            w.I64(static_cast<int64_t>(row.p99_us));
+          }
+          return w.Take();
+        }
+        default:
+          return Err("unknown op");
+      }
+    } catch (const std::exception& e) {
+      return Err(e.what() ? e.what() : "");
+    } catch (...) {
+      return Err("unknown error");
+    }
+  }
+
+  void Broadcast(const std::vector<StatusRecord>& tick) {
+    // Held across the writes so Unsubscribe() can't return (and the Session
+    // go away) while a tick is being written to it.
+    std::lock_guard<std::mutex> lock(subscribers_mu_);
+    std::vector<Session*> dropped;
+    for (Session* s : subscribers_) {
+      std::lock_guard<std::mutex> wlock(s->write_mu);
+      // Best-effort: a dead client is noticed by its own Serve() loop.
+      if (s->compact) {
+        std::vector<uint8_t> payload;
+        if (!EncodeDelta(s, tick, &payload)) {
+          // More tunnels in one tick than the codec has ids for. This runs
+          // on the service's poller thread, so nothing may escape; the
+          // session just stops getting ticks.
+          dropped.push_back(s);
+          continue;
+        }
+        if (payload.empty()) continue;
+        std::vector<uint8_t> frame =
+            BuildFrame(kOpEventStatusDelta, 0 /* seq=0 -> event */, kFlagEvent,
+                       payload);
+        s->transport->Write(frame.data(), frame.size());
+      } else {
+        for (const auto& rec : tick) {
+          std::vector<uint8_t> frame = BuildFrame(
+              kOpEventStatus, 0 /* seq=0 -> event */, kFlagEvent, EncodeStatus(rec));
+          if (!s->transport->Write(frame.data(), frame.size())) break;
+        }
+      }
+    }
+    for (Session* s : dropped) {
+      subscribers_.erase(
+          std::remove(subscribers_.begin(), subscribers_.end(), s),
+          subscribers_.end());
+    }
+  }
+
+  // Encodes `tick` with the session's delta encoder. Ids are never reused,
+  // so a long-lived session can run out of them; the encoder then starts
+  // over and re-sends every name, which the client's decoder takes as fresh
+  // definitions. False only if the tick alone needs more ids than exist.
+  static bool EncodeDelta(Session* s, const std::vector<StatusRecord>& tick,
+                          std::vector<uint8_t>* payload) {
+    try {
+      *payload = s->encoder.Encode(tick);
+      return true;
+    } catch (const std::length_error&) {
+      s->encoder.Reset();
+    }
+    try {
+      *payload = s->encoder.Encode(tick);
+      return true;
+    } catch (const std::length_error&) {
+      s->encoder.Reset();
+      return false;
+    }
+  }
+
+  void Unsubscribe(Session* session) {
+    std::lock_guard<std::mutex> lock(subscribers_mu_);
+    subscribers_.erase(
+        std::remove(subscribers_.begin(), subscribers_.end(), session),
+        subscribers_.end());
+  }
+
+  TunnelService* service_;
+  std::mutex subscribers_mu_;
+  std::vector<Session*> subscribers_;
+};
+
+}  // namespace ipc
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_BROKER_DISPATCHER_H_
@@ -0,0 +1,263 @@
+// Set algebra over IPv4 and IPv6 prefixes, for building AllowedIPs.
+//
+// "Everything except my LAN" is 0.0.0.0/0 minus a handful of prefixes,
+// which by hand becomes a list of dozens of CIDRs that nobody can check.
+// CidrSet keeps a set of addresses as sorted, disjoint, non-adjacent ranges
+// of the 128-bit key space (IPv4 in the top 32 bits, as IpKey does), so
+// union and subtraction are linear merges, and Prefixes() turns the ranges
+// back into the fewest prefixes that cover exactly the same addresses.
+// Building a set sorts its input once; 100k prefixes take a few
+// milliseconds.
+#ifndef FLUTTER_WIREGUARD_CIDR_SET_H_
+#define FLUTTER_WIREGUARD_CIDR_SET_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "allowed_ips.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace flutter_wireguard {
+
+struct CidrPrefix {
+  IpKey key;
+  uint8_t bits = 0;
+  bool v6 = false;
+};
+
+// "10.0.0.0/8", "fd00::/16". IPv6 in RFC 5952 form: lowercase, the longest
+// run of zero groups shortened to "::".
+inline std::string FormatIpPrefix(const CidrPrefix& p) {
+  char buf[64];
+  std::string out;
+  if (!p.v6) {
+    const uint32_t a = static_cast<uint32_t>(p.key.hi >> 32);
+    std::snprintf(buf, sizeof(buf), "%u.%u.%u.%u", a >> 24, a >> 16 & 0xff,
+                  a >> 8 & 0xff, a & 0xff);
+    out = buf;
+  } else {
+    uint32_t groups[8];
+    for (int i = 0; i < 8; ++i) {
+      const uint64_t half = i < 4 ? p.key.hi : p.key.lo;
+      groups[i] = static_cast<uint32_t>(half >> (48 - 16 * (i % 4)) & 0xffff);
+    }
+    int run_at = -1, run_len = 1;  // only runs of two or more are shortened
+    for (int i = 0; i < 8;) {
+      int j = i;
+      while (j < 8 && groups[j] == 0) ++j;
+      if (j - i > run_len) {
+        run_at = i;
+        run_len = j - i;
+      }
+      i = j == i ? i + 1 : j;
+    }
+    for (int i = 0; i < 8; ++i) {
+      if (i == run_at) {
+        out += "::";
+        i += run_len - 1;
+        continue;
+      }
+      if (!out.empty() && out.back() != ':') out += ':';
+      std::snprintf(buf, sizeof(buf), "%x", groups[i]);
+      out += buf;
+    }
+  }
+  return out + "/" + std::to_string(p.bits);
+}
+
+namespace cidr_set_internal {
+
+// An inclusive range of keys.
+struct Range {
+  IpKey first;
+  IpKey last;
+};
+
+inline bool Less(const IpKey& a, const IpKey& b) {
+  return a.hi != b.hi ? a.hi < b.hi : a.lo < b.lo;
+}
+
+// The key after `k`; all-ones wraps to zero, which callers check for.
+inline IpKey Next(IpKey k) {
+  if (++k.lo == 0) ++k.hi;
+  return k;
+}
+
+inline IpKey Prev(IpKey k) {
+  if (k.lo-- == 0) --k.hi;
+  return k;
+}
+
+inline bool IsMax(const IpKey& k) { return k.hi == ~uint64_t{0} && k.lo == ~uint64_t{0}; }
+
+// `k` with every bit from `bits` on set: the last key of its /bits.
+inline IpKey LastOf(const IpKey& k, int bits) {
+  const IpKey mask = allowed_ips_internal::Masked(IpKey{~uint64_t{0}, ~uint64_t{0}}, bits);
+  return IpKey{k.hi | ~mask.hi, k.lo | ~mask.lo};
+}
+
+inline int CountTrailingZeros(uint64_t x) {
+#ifdef _MSC_VER
+  unsigned long i;
+  _BitScanForward64(&i, x);
+  return static_cast<int>(i);
+#else
+  return __builtin_ctzll(x);
+#endif
+}
+
+// Trailing zero bits of a 128-bit key, 128 for zero.
+inline int TrailingZeros(const IpKey& k) {
+  if (k.lo != 0) return CountTrailingZeros(k.lo);
+  if (k.hi != 0) return 64 + CountTrailingZeros(k.hi);
+  return 128;
+}
+
+// Merges neighbours of sorted `ranges` that overlap or touch.
+inline void Coalesce(std::vector<Range>* ranges) {
+  size_t out = 0;
+  for (size_t i = 0; i < ranges->size(); ++i) {
+    const Range& r = (*ranges)[i];
+    if (out > 0) {
+      Range& prev = (*ranges)[out - 1];
+      if (IsMax(prev.last) || !Less(Next(prev.last), r.first)) {
+        if (Less(prev.last, r.last)) prev.last = r.last;
+        continue;
+      }
+    }
+    (*ranges)[out++] = r;
+  }
+  ranges->resize(out);
+}
+
+inline void Normalize(std::vector<Range>* ranges) {
+  std::sort(ranges->begin(), ranges->end(),
+            [](const Range& a, const Range& b) { return Less(a.first, b.first); });
+  Coalesce(ranges);
+}
+
+inline std::vector<Range> Union(const std::vector<Range>& a, const std::vector<Range>& b) {
+  std::vector<Range> out;
+  out.reserve(a.size() + b.size());
+  std::merge(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out),
+             [](const Range& x, const Range& y) { return Less(x.first, y.first); });
+  Coalesce(&out);
+  return out;
+}
+
+inline std::vector<Range> Subtract(const std::vector<Range>& a, const std::vector<Range>& b) {
+  std::vector<Range> out;
+  size_t j = 0;
+  for (const Range& r : a) {
+    IpKey lo = r.first;
+    bool left = true;
+    while (j < b.size() && Less(b[j].last, lo)) ++j;
+    // b[k] can reach into the next range of `a`, so only j is kept.
+    for (size_t k = j; left && k < b.size() && !Less(r.last, b[k].first); ++k) {
+      if (Less(lo, b[k].first)) out.push_back({lo, Prev(b[k].first)});
+      if (!Less(b[k].last, r.last)) {
+        left = false;
+      } else {
+        lo = Next(b[k].last);
+      }
+    }
+    if (left) out.push_back({lo, r.last});
+  }
+  return out;
+}
+
+// Fewest prefixes covering exactly `r`: from the front, each time the
+// largest aligned block that starts there and fits.
+inline void AppendPrefixes(const Range& r, bool v6, std::vector<CidrPrefix>* out) {
+  IpKey at = r.first;
+  for (;;) {
+    int bits = 128 - TrailingZeros(at);
+    while (Less(r.last, LastOf(at, bits))) ++bits;
+    out->push_back({at, static_cast<uint8_t>(bits), v6});
+    const IpKey end = LastOf(at, bits);
+    if (end == r.last) return;
+    at = Next(end);
+  }
+}
+
+}  // namespace cidr_set_internal
+
+class CidrSet {
+ public:
+  CidrSet() = default;
+
+  static CidrSet FromPrefixes(const std::vector<CidrPrefix>& prefixes) {
+    CidrSet set;
+    for (const auto& p : prefixes) {
+      const IpKey first = allowed_ips_internal::Masked(p.key, p.bits);
+      (p.v6 ? set.v6_ : set.v4_).push_back({first, cidr_set_internal::LastOf(first, p.bits)});
+    }
+    cidr_set_internal::Normalize(&set.v4_);
+    cidr_set_internal::Normalize(&set.v6_);
+    return set;
+  }
+
+  // AllowedIPs-style text ("10.0.0.0/8", "fd00::1"); host bits are ignored.
+  // Throws std::invalid_argument naming the first entry that is not an IP
+  // prefix.
+  static CidrSet Parse(const std::vector<std::string>& prefixes) {
+    std::vector<CidrPrefix> parsed;
+    parsed.reserve(prefixes.size());
+    for (const auto& s : prefixes) {
+      CidrPrefix p;
+      if (!ParseIpPrefix(allowed_ips_internal::Trim(s), &p.key, &p.bits, &p.v6)) {
+        throw std::invalid_argument("bad IP prefix '" + s + "'");
+      }
+      parsed.push_back(p);
+    }
+    return FromPrefixes(parsed);
+  }
+
+  CidrSet Union(const CidrSet& o) const {
+    CidrSet out;
+    out.v4_ = cidr_set_internal::Union(v4_, o.v4_);
+    out.v6_ = cidr_set_internal::Union(v6_, o.v6_);
+    return out;
+  }
+
+  CidrSet Subtract(const CidrSet& o) const {
+    CidrSet out;
+    out.v4_ = cidr_set_internal::Subtract(v4_, o.v4_);
+    out.v6_ = cidr_set_internal::Subtract(v6_, o.v6_);
+    return out;
+  }
+
+  bool empty() const { return v4_.empty() && v6_.empty(); }
+
+  // The smallest list of prefixes whose union is this set: IPv4 first, each
+  // family in address order, none overlapping.
+  std::vector<CidrPrefix> Prefixes() const {
+    std::vector<CidrPrefix> out;
+    for (const auto& r : v4_) cidr_set_internal::AppendPrefixes(r, false, &out);
+    for (const auto& r : v6_) cidr_set_internal::AppendPrefixes(r, true, &out);
+    return out;
+  }
+
+  std::vector<std::string> ToStrings() const {
+    std::vector<std::string> out;
+    for (const auto& p : Prefixes()) out.push_back(FormatIpPrefix(p));
+    return out;
+  }
+
+ private:
+  std::vector<cidr_set_internal::Range> v4_;
+  std::vector<cidr_set_internal::Range> v6_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_CIDR_SET_H_
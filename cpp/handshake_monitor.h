@@ -0,0 +1,185 @@
+// Per-peer handshake age, turned into connected/stale/recovered events.
+//
+// A tunnel whose peers stopped answering still reads "up": the interface
+// exists and the counters only stop moving. WireGuard itself gives up on a
+// session REJECT_AFTER_TIME (180 s) after its handshake, so a peer whose
+// last handshake is older than that has no working session. The status
+// poller feeds each tick's per-peer handshake times into a HandshakeMonitor,
+// which reports the tick on which a peer crosses that line in either
+// direction:
+//
+//   connected  first handshake since the tunnel was started
+//   stale      no handshake for stale_after (or none at all within
+//              stale_after of the start)
+//   recovered  a fresh handshake after stale
+//
+// A peer without PersistentKeepalive only handshakes while it carries
+// traffic, so on an idle tunnel it goes stale too; that is the same "no
+// live session" the event describes, and the next packet recovers it.
+//
+// The time from Started() to a tunnel's first handshake is recorded as the
+// ("start", "first_handshake") phase, next to the bring-up phases in
+// diagnostics().
+//
+// Times are epoch milliseconds, the unit handshakes are reported in.
+#ifndef FLUTTER_WIREGUARD_HANDSHAKE_MONITOR_H_
+#define FLUTTER_WIREGUARD_HANDSHAKE_MONITOR_H_
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "phase_timer.h"
+
+namespace flutter_wireguard {
+
+enum class TunnelHealthCpp { kConnected, kStale, kRecovered };
+
+struct PeerHandshake {
+  std::string public_key;    // base64; "" for a whole-tunnel figure
+  int64_t handshake_ms = 0;  // epoch ms, 0 = never
+};
+
+struct TunnelHealthEventCpp {
+  std::string name;
+  std::string public_key;
+  TunnelHealthCpp health = TunnelHealthCpp::kConnected;
+  int64_t handshake_ms = 0;  // the handshake that decided it, 0 = never
+};
+
+class HandshakeMonitor {
+ public:
+  // REJECT_AFTER_TIME: past this, WireGuard will not use the session.
+  static constexpr int64_t kDefaultStaleAfterMs = 180 * 1000;
+
+  int64_t stale_after_ms() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    return stale_after_ms_;
+  }
+
+  // Takes effect on the next Observe/Tick. Values below one second are
+  // raised to it.
+  void SetStaleAfter(int64_t ms) {
+    std::lock_guard<std::mutex> lock(mu_);
+    stale_after_ms_ = ms < 1000 ? 1000 : ms;
+  }
+
+  // `name` was just brought up: forget what was known about it and start
+  // the clocks. `public_keys` seeds peers that never handshake (and so
+  // might never be observed with one); the poller fills in the rest.
+  void Started(const std::string& name, int64_t now_ms,
+               const std::vector<std::string>& public_keys = {}) {
+    std::lock_guard<std::mutex> lock(mu_);
+    Tunnel& t = tunnels_[name];
+    t = Tunnel();
+    t.started_ms = now_ms;
+    t.since_ms = now_ms;
+    t.timed = true;
+    for (const auto& k : public_keys) t.peers[k];
+  }
+
+  void Stopped(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mu_);
+    tunnels_.erase(name);
+  }
+
+  // One poll of a running tunnel: `peers` replaces its peer list (peers no
+  // longer listed are forgotten) and any threshold crossed by `now_ms` is
+  // appended to `out`. A tunnel that was never Started (adopted, or started
+  // outside this process) is tracked from its first Observe.
+  void Observe(const std::string& name, const std::vector<PeerHandshake>& peers,
+               int64_t now_ms, std::vector<TunnelHealthEventCpp>* out) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it == tunnels_.end()) {
+      it = tunnels_.emplace(name, Tunnel()).first;
+      it->second.started_ms = now_ms;
+    }
+    Tunnel& t = it->second;
+    std::map<std::string, Peer> next;
+    for (const auto& p : peers) {
+      auto old = t.peers.find(p.public_key);
+      Peer& peer = next[p.public_key];
+      if (old != t.peers.end()) peer = old->second;
+      peer.handshake_ms = p.handshake_ms;
+    }
+    t.peers = std::move(next);
+    Evaluate(name, &t, now_ms, out);
+  }
+
+  // Observe() for a poll whose handshakes are the ones `name` last saw:
+  // only the clock moved, so the peer list is left as it is. False (and
+  // nothing done) if `name` is not tracked; Observe it instead.
+  bool Recheck(const std::string& name, int64_t now_ms,
+               std::vector<TunnelHealthEventCpp>* out) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it == tunnels_.end()) return false;
+    Evaluate(name, &it->second, now_ms, out);
+    return true;
+  }
+
+  // Re-checks every tracked tunnel against `now_ms` with the handshakes it
+  // last saw, for platforms that only report a tunnel when it changes.
+  void Tick(int64_t now_ms, std::vector<TunnelHealthEventCpp>* out) {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (auto& [name, t] : tunnels_) Evaluate(name, &t, now_ms, out);
+  }
+
+ private:
+  enum class State { kPending, kConnected, kStale };
+
+  struct Peer {
+    int64_t handshake_ms = 0;
+    State state = State::kPending;
+    bool ever_connected = false;
+  };
+
+  struct Tunnel {
+    int64_t started_ms = 0;
+    // Handshakes older than this belong to an earlier run of the tunnel.
+    // 0 for a tunnel that was only observed: whatever it has counts.
+    int64_t since_ms = 0;
+    bool timed = false;  // Started() was called and no handshake seen yet
+    std::map<std::string, Peer> peers;
+  };
+
+  void Evaluate(const std::string& name, Tunnel* t, int64_t now_ms,
+                std::vector<TunnelHealthEventCpp>* out) {
+    for (auto& [key, p] : t->peers) {
+      const bool handshook = p.handshake_ms > 0 && p.handshake_ms >= t->since_ms;
+      const int64_t since = handshook ? p.handshake_ms : t->started_ms;
+      const bool fresh = handshook && now_ms - since < stale_after_ms_;
+      TunnelHealthCpp health;
+      if (fresh && p.state != State::kConnected) {
+        health = p.ever_connected ? TunnelHealthCpp::kRecovered
+                                  : TunnelHealthCpp::kConnected;
+        if (t->timed) {
+          PhaseRegistry::Instance().Get("start", "first_handshake").Record(
+              static_cast<uint64_t>(p.handshake_ms - t->started_ms) * 1000);
+          t->timed = false;
+        }
+        p.state = State::kConnected;
+        p.ever_connected = true;
+      } else if (!fresh && p.state != State::kStale &&
+                 now_ms - since >= stale_after_ms_) {
+        health = TunnelHealthCpp::kStale;
+        p.state = State::kStale;
+      } else {
+        continue;
+      }
+      out->push_back({name, key, health, handshook ? p.handshake_ms : 0});
+    }
+  }
+
+  mutable std::mutex mu_;
+  int64_t stale_after_ms_ = kDefaultStaleAfterMs;
+  std::map<std::string, Tunnel> tunnels_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_HANDSHAKE_MONITOR_H_
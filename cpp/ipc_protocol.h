@@ -2,7 +2,8 @@
 // flutter_wireguard_helper.exe broker.
 //
 // Transport: a Windows named pipe in BYTE/MESSAGE mode is fine; we use
-// length-prefixed BYTE frames so the same code works either way.
+// length-prefixed BYTE frames so the same code works either way, and over a
+// Unix domain socket on Linux. Request handling lives in broker_dispatcher.h.
 //
 // Frame (both directions):
 //
@@ -13,6 +14,10 @@
 // Requests carry a non-zero seq; responses echo it. Asynchronous status
 // events use seq=0 and have flags & kFlagEvent set.
 //
+// Compact status events (kOpEventStatusDelta) refer to tunnels by a small
+// integer id assigned per connection and carry LEB128 varint deltas instead
+// of absolute I64 counters; see StatusDeltaEncoder below for the layout.
+//
 // Strings are u32 LE length + UTF-8 bytes. Keeping things explicit avoids
 // pulling JSON / Pigeon into the broker, which must stay tiny and
 // Flutter-free.
@@ -21,6 +26,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <map>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -44,7 +50,13 @@ enum Op : uint32_t {
   kOpTunnelNames = 4,   // req: empty.                resp: u32 count + [str]*.
   kOpBackend = 5,       // req: empty.                resp: u8 kind + str detail.
   kOpSubscribe = 6,     // req: empty. resp: empty; thereafter status events.
+  kOpSubscribeCompact = 7,  // req: empty. resp: empty; thereafter delta events.
+  kOpMapStatus = 8,     // req: empty. resp: u32 slots + u32 bytes; memfd and
+                        // eventfd ride along as SCM_RIGHTS (Unix sockets only).
+  kOpDiagnostics = 9,   // req: empty. resp: u32 count + [str op, str phase,
+                        // I64 count, I64 p50_us, I64 p95_us, I64 p99_us]*.
   kOpEventStatus = 128, // event: TunnelStatusBlob (seq=0, flags=kFlagEvent).
+  kOpEventStatusDelta = 129,  // event: StatusDeltaBlob (seq=0, flags=kFlagEvent).
 };
 
 // Response status. First byte of every response payload.
@@ -78,6 +90,9 @@ enum BackendKindWire : uint8_t {
 inline constexpr uint32_t kMaxNameBytes = 64;
 inline constexpr uint32_t kMaxConfigBytes = 64 * 1024;
 inline constexpr uint32_t kMaxFrameBytes = 128 * 1024;
+// Upper bound on distinct tunnel ids per connection in delta events, so a
+// hostile id can't make the decoder allocate an arbitrarily large table.
+inline constexpr uint32_t kMaxDeltaTunnels = 4096;
 
 // ---------- byte buffer helpers (header-only, no deps) ----------
 
@@ -91,6 +106,18 @@ class Writer {
     auto u = static_cast<uint64_t>(v);
     for (int i = 0; i < 8; ++i) buf_.push_back(static_cast<uint8_t>((u >> (i * 8)) & 0xff));
   }
+  // Unsigned LEB128: 7 bits per byte, high bit set on all but the last.
+  void VarU64(uint64_t v) {
+    while (v >= 0x80) {
+      buf_.push_back(static_cast<uint8_t>(v | 0x80));
+      v >>= 7;
+    }
+    buf_.push_back(static_cast<uint8_t>(v));
+  }
+  // ZigZag-mapped so small negative deltas (counter resets) stay short.
+  void VarI64(int64_t v) {
+    VarU64((static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+  }
   void Str(const std::string& s) {
     if (s.size() > kMaxConfigBytes) throw std::length_error("string too large");
     U32(static_cast<uint32_t>(s.size()));
@@ -125,6 +152,19 @@ class Reader {
     p_ += 8;
     return static_cast<int64_t>(v);
   }
+  uint64_t VarU64() {
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t b = U8();
+      v |= static_cast<uint64_t>(b & 0x7f) << shift;
+      if ((b & 0x80) == 0) return v;
+    }
+    throw std::runtime_error("varint too long");
+  }
+  int64_t VarI64() {
+    uint64_t u = VarU64();
+    return static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+  }
   std::string Str() {
     uint32_t n = U32();
     if (n > kMaxConfigBytes) throw std::length_error("string too large");
@@ -158,6 +198,259 @@ inline std::vector<uint8_t> BuildFrame(uint32_t op, uint32_t seq, uint8_t flags,
   return out;
 }
 
+// ---------- incremental frame decoding ----------
+
+// One decoded frame. `payload` points either into the chunk passed to
+// FrameDecoder::Feed or into the decoder's own buffer, and is only valid
+// for the duration of the callback.
+struct FrameView {
+  uint32_t op = 0;
+  uint32_t seq = 0;
+  uint8_t flags = 0;
+  const uint8_t* payload = nullptr;
+  size_t payload_len = 0;
+};
+
+// Push-style frame decoder. The owner reads whatever the transport has
+// available (a ReadFile completion, a recv() after epoll, a GIOChannel
+// callback...) and hands the bytes to Feed(); every frame they complete is
+// passed to the callback in order. Frames that arrive whole inside one chunk
+// are delivered straight from the chunk; only the trailing partial frame,
+// if any, is copied, so at most one frame (<= kMaxFrameBytes) is ever
+// buffered.
+//
+// A length prefix outside [9, kMaxFrameBytes] throws std::runtime_error and
+// leaves the decoder failed: the stream has lost framing and the connection
+// must be dropped. Further Feed() calls throw until Reset().
+class FrameDecoder {
+ public:
+  template <typename OnFrame>
+  void Feed(const uint8_t* data, size_t len, OnFrame&& on_frame) {
+    if (failed_) throw std::runtime_error("frame decoder failed");
+    while (len > 0) {
+      if (header_got_ < 4) {
+        // Fast path: a whole frame is in the chunk and nothing is pending.
+        if (header_got_ == 0 && len >= 4) {
+          uint32_t total = LoadU32(data);
+          if (len - 4 >= total) {
+            Check(total);
+            Emit(data + 4, total, on_frame);
+            data += 4 + total;
+            len -= 4 + total;
+            continue;
+          }
+        }
+        size_t n = 4 - header_got_;
+        if (n > len) n = len;
+        std::memcpy(header_ + header_got_, data, n);
+        header_got_ += n;
+        data += n;
+        len -= n;
+        if (header_got_ < 4) return;
+        total_ = LoadU32(header_);
+        Check(total_);
+        body_.clear();
+        body_.reserve(total_);
+        continue;
+      }
+      size_t n = total_ - body_.size();
+      if (n > len) n = len;
+      body_.insert(body_.end(), data, data + n);
+      data += n;
+      len -= n;
+      if (body_.size() < total_) return;
+      // Clear the partial state before the callback so a throwing callback
+      // leaves the decoder positioned at the next frame.
+      header_got_ = 0;
+      Emit(body_.data(), total_, on_frame);
+    }
+  }
+
+  // Bytes of the current partial frame held by the decoder (length prefix
+  // included). Zero when positioned on a frame boundary.
+  size_t Buffered() const {
+    return header_got_ < 4 ? header_got_ : 4 + body_.size();
+  }
+
+  bool Failed() const { return failed_; }
+
+  // Drops any partial frame and clears the failed state. Call when the
+  // connection is re-established.
+  void Reset() {
+    header_got_ = 0;
+    total_ = 0;
+    body_.clear();
+    failed_ = false;
+  }
+
+ private:
+  static uint32_t LoadU32(const uint8_t* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= static_cast<uint32_t>(p[i]) << (i * 8);
+    return v;
+  }
+
+  void Check(uint32_t total) {
+    if (total < 9 || total > kMaxFrameBytes) {
+      failed_ = true;
+      header_got_ = 0;
+      body_.clear();
+      throw std::runtime_error("bad frame length");
+    }
+  }
+
+  template <typename OnFrame>
+  static void Emit(const uint8_t* body, size_t total, OnFrame& on_frame) {
+    FrameView f;
+    f.op = LoadU32(body);
+    f.seq = LoadU32(body + 4);
+    f.flags = body[8];
+    f.payload = body + 9;
+    f.payload_len = total - 9;
+    on_frame(static_cast<const FrameView&>(f));
+  }
+
+  uint8_t header_[4] = {};
+  size_t header_got_ = 0;
+  uint32_t total_ = 0;
+  std::vector<uint8_t> body_;
+  bool failed_ = false;
+};
+
+// ---------- compact status events ----------
+
+// Plain status record used by the delta codec. Field meanings and numeric
+// values match TunnelStatusBlob.
+struct StatusRecord {
+  std::string name;
+  uint8_t state = kStateDown;
+  int64_t rx = 0;
+  int64_t tx = 0;
+  int64_t handshake_ms = 0;
+};
+
+// Per-entry field mask in a StatusDeltaBlob.
+enum DeltaField : uint8_t {
+  kDeltaName = 1 << 0,       // first use of this id: str name follows
+  kDeltaState = 1 << 1,      // u8 state follows
+  kDeltaRx = 1 << 2,         // zigzag varint rx delta follows
+  kDeltaTx = 1 << 3,         // zigzag varint tx delta follows
+  kDeltaHandshake = 1 << 4,  // zigzag varint handshake_ms delta follows
+};
+
+// Broker side of kOpEventStatusDelta. One encoder per connection; ids are
+// only meaningful to the StatusDeltaDecoder on the other end of that
+// connection.
+//
+// StatusDeltaBlob:
+//   varint count
+//   count x { varint id, u8 DeltaField mask, [str name], [u8 state],
+//             [varint rx delta], [varint tx delta], [varint handshake delta] }
+//
+// A freshly named id starts from an all-zero DOWN baseline, so its first
+// deltas are the absolute values. Tunnels that did not change since the
+// previous Encode() are omitted entirely.
+class StatusDeltaEncoder {
+ public:
+  // Encodes every record of one poll tick into a single payload. Returns an
+  // empty vector when nothing changed (the caller then sends no frame).
+  std::vector<uint8_t> Encode(const std::vector<StatusRecord>& tick) {
+    Writer body;
+    uint32_t count = 0;
+    for (const auto& s : tick) {
+      auto it = slots_.find(s.name);
+      uint8_t mask = 0;
+      if (it == slots_.end()) {
+        if (next_id_ >= kMaxDeltaTunnels) throw std::length_error("too many tunnels");
+        Slot fresh;
+        fresh.id = next_id_++;
+        fresh.last.name = s.name;
+        it = slots_.emplace(s.name, std::move(fresh)).first;
+        mask |= kDeltaName;
+      }
+      StatusRecord& last = it->second.last;
+      if (s.state != last.state) mask |= kDeltaState;
+      if (s.rx != last.rx) mask |= kDeltaRx;
+      if (s.tx != last.tx) mask |= kDeltaTx;
+      if (s.handshake_ms != last.handshake_ms) mask |= kDeltaHandshake;
+      if (mask == 0) continue;
+
+      body.VarU64(it->second.id);
+      body.U8(mask);
+      if (mask & kDeltaName) body.Str(s.name);
+      if (mask & kDeltaState) body.U8(s.state);
+      if (mask & kDeltaRx) body.VarI64(s.rx - last.rx);
+      if (mask & kDeltaTx) body.VarI64(s.tx - last.tx);
+      if (mask & kDeltaHandshake) body.VarI64(s.handshake_ms - last.handshake_ms);
+      last = s;
+      ++count;
+    }
+    if (count == 0) return {};
+    Writer out;
+    out.VarU64(count);
+    const std::vector<uint8_t>& b = body.Peek();
+    std::vector<uint8_t> payload = out.Take();
+    payload.insert(payload.end(), b.begin(), b.end());
+    return payload;
+  }
+
+  // Forgets every id. Call when the connection is re-established.
+  void Reset() {
+    slots_.clear();
+    next_id_ = 0;
+  }
+
+ private:
+  struct Slot {
+    uint32_t id = 0;
+    StatusRecord last;
+  };
+  std::map<std::string, Slot> slots_;
+  uint32_t next_id_ = 0;
+};
+
+// Client side of kOpEventStatusDelta. Throws std::runtime_error on a
+// malformed payload (unknown id, truncated entry).
+class StatusDeltaDecoder {
+ public:
+  // Applies one StatusDeltaBlob and returns the absolute status of every
+  // tunnel it mentioned, in payload order.
+  std::vector<StatusRecord> Apply(const uint8_t* data, size_t len) {
+    Reader r(data, len);
+    uint64_t count = r.VarU64();
+    if (count > kMaxDeltaTunnels) throw std::runtime_error("bad delta count");
+    std::vector<StatusRecord> out;
+    out.reserve(static_cast<size_t>(count));
+    for (uint64_t i = 0; i < count; ++i) {
+      uint64_t id = r.VarU64();
+      uint8_t mask = r.U8();
+      if (mask & kDeltaName) {
+        if (id >= kMaxDeltaTunnels) throw std::runtime_error("bad delta id");
+        if (id >= by_id_.size()) by_id_.resize(static_cast<size_t>(id) + 1);
+        by_id_[id] = StatusRecord{};
+        by_id_[id].name = r.Str();
+        if (by_id_[id].name.empty()) throw std::runtime_error("empty delta name");
+      } else if (id >= by_id_.size() || by_id_[id].name.empty()) {
+        // Tunnel names are never empty, so an empty slot was never defined.
+        throw std::runtime_error("unknown delta id");
+      }
+      StatusRecord& s = by_id_[id];
+      if (mask & kDeltaState) s.state = r.U8();
+      if (mask & kDeltaRx) s.rx += r.VarI64();
+      if (mask & kDeltaTx) s.tx += r.VarI64();
+      if (mask & kDeltaHandshake) s.handshake_ms += r.VarI64();
+      out.push_back(s);
+    }
+    return out;
+  }
+
+  // Forgets every id. Call when the connection is re-established.
+  void Reset() { by_id_.clear(); }
+
+ private:
+  std::vector<StatusRecord> by_id_;
+};
+
 }  // namespace ipc
 }  // namespace flutter_wireguard
 
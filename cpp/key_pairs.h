@@ -0,0 +1,85 @@
+// The generateKeyPairs / publicKeysFromPrivate host calls, minus the random
+// source: base64 in and out around x25519.h's batched PublicKeys().
+//
+// Header-only so the Linux and Windows plugins share one implementation;
+// each passes its own CSPRNG (getrandom, BCryptGenRandom).
+#ifndef FLUTTER_WIREGUARD_KEY_PAIRS_H_
+#define FLUTTER_WIREGUARD_KEY_PAIRS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "wg_key.h"
+#include "x25519.h"
+
+namespace flutter_wireguard {
+
+// About ten seconds of one core, and a 6 MB reply; more than that is a
+// caller bug, not a provisioning run.
+inline constexpr int64_t kMaxKeyPairs = 65536;
+
+struct KeyPairCpp {
+  std::string private_key;
+  std::string public_key;
+};
+
+namespace key_pairs_internal {
+
+// memset() on memory about to be freed may be dropped as a dead store.
+inline void Wipe(std::vector<uint8_t>* bytes) {
+  volatile uint8_t* p = bytes->data();
+  for (size_t i = 0; i < bytes->size(); ++i) p[i] = 0;
+}
+
+}  // namespace key_pairs_internal
+
+// `count` keypairs, private keys drawn from `fill(uint8_t* out, size_t n)`
+// and clamped as `wg genkey` does. Throws std::invalid_argument for a count
+// outside [0, kMaxKeyPairs]; whatever `fill` throws propagates.
+template <typename RandomFill>
+std::vector<KeyPairCpp> GenerateKeyPairs(int64_t count, RandomFill fill) {
+  if (count < 0 || count > kMaxKeyPairs) {
+    throw std::invalid_argument("count must be between 0 and " +
+                                std::to_string(kMaxKeyPairs) + ", got " +
+                                std::to_string(count));
+  }
+  const size_t n = static_cast<size_t>(count);
+  std::vector<uint8_t> priv(n * kWgKeyLen), pub(n * kWgKeyLen);
+  if (n > 0) fill(priv.data(), priv.size());
+  for (size_t i = 0; i < n; ++i) ClampPrivateKey(&priv[i * kWgKeyLen]);
+  PublicKeys(priv.data(), pub.data(), n);
+  std::vector<KeyPairCpp> out(n);
+  for (size_t i = 0; i < n; ++i) {
+    out[i].private_key = WgKeyToBase64(&priv[i * kWgKeyLen]);
+    out[i].public_key = WgKeyToBase64(&pub[i * kWgKeyLen]);
+  }
+  key_pairs_internal::Wipe(&priv);
+  return out;
+}
+
+// `wg pubkey` for each key, in order. Throws std::invalid_argument naming
+// the first key that isn't one (its index, never its contents).
+inline std::vector<std::string> PublicKeysFromPrivate(
+    const std::vector<std::string>& private_keys) {
+  const size_t n = private_keys.size();
+  std::vector<uint8_t> priv(n * kWgKeyLen), pub(n * kWgKeyLen);
+  for (size_t i = 0; i < n; ++i) {
+    if (!WgKeyFromBase64(private_keys[i], &priv[i * kWgKeyLen])) {
+      key_pairs_internal::Wipe(&priv);
+      throw std::invalid_argument("private key " + std::to_string(i) +
+                                  " is not a base64 WireGuard key");
+    }
+  }
+  PublicKeys(priv.data(), pub.data(), n);
+  key_pairs_internal::Wipe(&priv);
+  std::vector<std::string> out(n);
+  for (size_t i = 0; i < n; ++i) out[i] = WgKeyToBase64(&pub[i * kWgKeyLen]);
+  return out;
+}
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_KEY_PAIRS_H_
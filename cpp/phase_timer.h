@@ -0,0 +1,174 @@
+// Always-on phase timers for tunnel bring-up and teardown.
+//
+// Every step of a Start/Stop (writing the config, the elevation prompt,
+// wg-quick, SCM service churn, ...) is wrapped in a PhaseTimer, which adds
+// its wall time to a fixed-size histogram keyed by (op, phase). Recording is
+// a handful of relaxed atomic increments, so the timers stay enabled in
+// release builds; diagnostics() turns the histograms into p50/p95/p99.
+#ifndef FLUTTER_WIREGUARD_PHASE_TIMER_H_
+#define FLUTTER_WIREGUARD_PHASE_TIMER_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace flutter_wireguard {
+
+// Log-linear latency histogram over microseconds: four sub-buckets per
+// power of two, so a reported percentile is within 25% of the true value
+// from 1 us up to ~50 days. Fixed size, no allocation after construction,
+// safe to Record() from any number of threads.
+class PhaseHistogram {
+ public:
+  static constexpr int kSubBits = 2;
+  static constexpr int kSubBuckets = 1 << kSubBits;
+  static constexpr int kBuckets = 41 * kSubBuckets;
+
+  void Record(uint64_t us) {
+    counts_[BucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    total_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t Count() const { return total_.load(std::memory_order_relaxed); }
+
+  // Upper bound, in microseconds, of the bucket holding the q-quantile
+  // (0 < q <= 1). 0 when nothing has been recorded.
+  uint64_t PercentileUs(double q) const {
+    std::array<uint64_t, kBuckets> snap;
+    uint64_t total = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      snap[i] = counts_[i].load(std::memory_order_relaxed);
+      total += snap[i];
+    }
+    if (total == 0) return 0;
+    uint64_t rank = static_cast<uint64_t>(q * static_cast<double>(total));
+    if (rank < 1) rank = 1;
+    if (rank > total) rank = total;
+    uint64_t seen = 0;
+    for (int i = 0; i < kBuckets; ++i) {
+      seen += snap[i];
+      if (seen >= rank) return UpperBoundOf(i);
+    }
+    return UpperBoundOf(kBuckets - 1);
+  }
+
+  void Reset() {
+    for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+    total_.store(0, std::memory_order_relaxed);
+  }
+
+  static int BucketOf(uint64_t us) {
+    if (us < kSubBuckets) return static_cast<int>(us);
+    int log2 = 63;
+    while ((us >> log2) == 0) --log2;
+    const int sub = static_cast<int>((us >> (log2 - kSubBits)) & (kSubBuckets - 1));
+    const int b = (log2 - kSubBits + 1) * kSubBuckets + sub;
+    return b < kBuckets ? b : kBuckets - 1;
+  }
+
+  static uint64_t UpperBoundOf(int bucket) {
+    if (bucket < kSubBuckets) return static_cast<uint64_t>(bucket);
+    const int log2 = bucket / kSubBuckets + kSubBits - 1;
+    const uint64_t sub = static_cast<uint64_t>(bucket % kSubBuckets);
+    const uint64_t width = uint64_t{1} << (log2 - kSubBits);
+    return (uint64_t{1} << log2) + (sub + 1) * width - 1;
+  }
+
+ private:
+  std::array<std::atomic<uint64_t>, kBuckets> counts_{};
+  std::atomic<uint64_t> total_{0};
+};
+
+// One row of a diagnostics() reply.
+struct PhaseSummary {
+  std::string op;     // "start", "stop", "switch", ...
+  std::string phase;  // "wg_quick_up", "create_service", "total", ...
+  uint64_t count = 0;
+  uint64_t p50_us = 0;
+  uint64_t p95_us = 0;
+  uint64_t p99_us = 0;
+};
+
+// Process-wide (op, phase) -> histogram table. Histograms are created on
+// first use and never move, so callers may keep the reference.
+class PhaseRegistry {
+ public:
+  static PhaseRegistry& Instance() {
+    static PhaseRegistry registry;
+    return registry;
+  }
+
+  PhaseHistogram& Get(const std::string& op, const std::string& phase) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto& slot = histograms_[{op, phase}];
+    if (!slot) slot = std::make_unique<PhaseHistogram>();
+    return *slot;
+  }
+
+  // Every histogram with at least one sample, ordered by (op, phase).
+  std::vector<PhaseSummary> Snapshot() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<PhaseSummary> out;
+    out.reserve(histograms_.size());
+    for (const auto& [key, h] : histograms_) {
+      if (h->Count() == 0) continue;
+      PhaseSummary s;
+      s.op = key.first;
+      s.phase = key.second;
+      s.count = h->Count();
+      s.p50_us = h->PercentileUs(0.50);
+      s.p95_us = h->PercentileUs(0.95);
+      s.p99_us = h->PercentileUs(0.99);
+      out.push_back(std::move(s));
+    }
+    return out;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (auto& [key, h] : histograms_) h->Reset();
+  }
+
+ private:
+  PhaseRegistry() = default;
+
+  mutable std::mutex mu_;
+  std::map<std::pair<std::string, std::string>, std::unique_ptr<PhaseHistogram>>
+      histograms_;
+};
+
+// Records the time from construction to Stop() (or destruction, so a phase
+// that throws is still counted) into the (op, phase) histogram.
+class PhaseTimer {
+ public:
+  PhaseTimer(const char* op, const char* phase)
+      : hist_(&PhaseRegistry::Instance().Get(op, phase)),
+        start_(std::chrono::steady_clock::now()) {}
+  ~PhaseTimer() { Stop(); }
+
+  PhaseTimer(const PhaseTimer&) = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+  void Stop() {
+    if (hist_ == nullptr) return;
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+    hist_->Record(static_cast<uint64_t>(us.count()));
+    hist_ = nullptr;
+  }
+
+ private:
+  PhaseHistogram* hist_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_PHASE_TIMER_H_
@@ -0,0 +1,342 @@
+// Shared-memory status table written by the privileged side and read by the
+// UI process without any syscall.
+//
+// The segment is a flat block of memory (a memfd on Linux; anything mappable
+// into both processes works) laid out as one StatusSegmentHeader followed by
+// `capacity` StatusSlots. Every field is a lock-free std::atomic, which the
+// standard guarantees to be address-free, so the same bytes may be mapped at
+// different addresses in different processes.
+//
+// Concurrency: exactly one writer, any number of readers.
+//   * A slot is claimed once per tunnel name: the writer fills it in and only
+//     then publishes the new `used` count with release ordering. Retain()
+//     frees the slots of stopped tunnels (an all-zero name) once their down
+//     state has been out for a tick, and later claims reuse them before
+//     growing `used`.
+//   * The name and counters are protected by a per-slot seqlock: `seq` is
+//     odd while the writer is mid-update; readers retry until they see the
+//     same even value before and after copying the fields.
+//   * `generation` in the header is bumped after every Publish() that changed
+//     anything, so a reader can tell "nothing new" with one load.
+#ifndef FLUTTER_WIREGUARD_STATUS_SEGMENT_H_
+#define FLUTTER_WIREGUARD_STATUS_SEGMENT_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ipc_protocol.h"
+#include "name_validator.h"
+
+namespace flutter_wireguard {
+namespace ipc {
+
+inline constexpr uint32_t kStatusSegmentMagic = 0x53475746;  // "FWGS"
+inline constexpr uint32_t kStatusSegmentVersion = 2;
+inline constexpr uint32_t kDefaultStatusSlots = 64;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free,
+              "status segment needs address-free 32-bit atomics");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "status segment needs address-free 64-bit atomics");
+
+struct alignas(64) StatusSegmentHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;
+  std::atomic<uint32_t> used;        // slots ever claimed, free ones included
+  std::atomic<uint32_t> generation;  // bumped once per changing Publish()
+};
+
+struct alignas(64) StatusSlot {
+  std::atomic<uint32_t> seq;  // seqlock; odd while being written
+  std::atomic<uint32_t> state;
+  // NUL-padded tunnel name (kMaxTunnelNameLen + 1 bytes); all zero while
+  // the slot is free.
+  std::atomic<uint64_t> name[2];
+  std::atomic<int64_t> rx;
+  std::atomic<int64_t> tx;
+  std::atomic<int64_t> handshake_ms;
+};
+
+static_assert(kMaxTunnelNameLen + 1 <= sizeof(uint64_t) * 2,
+              "tunnel names must fit in StatusSlot::name");
+
+inline constexpr size_t StatusSegmentBytes(uint32_t capacity) {
+  return sizeof(StatusSegmentHeader) + sizeof(StatusSlot) * capacity;
+}
+
+namespace internal {
+
+inline void PackName(const std::string& name, uint64_t out[2]) {
+  char buf[16] = {};
+  std::memcpy(buf, name.data(), name.size());
+  std::memcpy(out, buf, sizeof(buf));
+}
+
+inline std::string UnpackName(const uint64_t words[2]) {
+  char buf[17] = {};
+  std::memcpy(buf, words, 16);
+  return std::string(buf);
+}
+
+}  // namespace internal
+
+// Single writer. `mem` must be zero-filled (a fresh memfd / mapping is) and
+// at least StatusSegmentBytes(capacity) bytes.
+class StatusSegmentWriter {
+ public:
+  StatusSegmentWriter(void* mem, size_t len, uint32_t capacity)
+      : header_(static_cast<StatusSegmentHeader*>(mem)),
+        slots_(reinterpret_cast<StatusSlot*>(header_ + 1)) {
+    if (len < StatusSegmentBytes(capacity)) {
+      throw std::length_error("status segment too small");
+    }
+    header_->magic = kStatusSegmentMagic;
+    header_->version = kStatusSegmentVersion;
+    header_->capacity = capacity;
+  }
+
+  // Writes every record of one poll tick. Records identical to what the slot
+  // already holds are skipped, so their seq does not move. Returns the
+  // number of slots that changed. Records that can't be placed (table full
+  // or invalid name) are appended to `unplaced` if given, so the caller can
+  // deliver them some other way. A down record for a tunnel whose slot
+  // Retain() freed is dropped: that state already went out.
+  size_t Publish(const std::vector<StatusRecord>& tick,
+                 std::vector<StatusRecord>* unplaced = nullptr) {
+    size_t changed = 0;
+    for (const auto& r : tick) {
+      if (!retired_.empty()) {
+        auto it = retired_.find(r.name);
+        if (it != retired_.end()) {
+          if (r.state == kStateDown) continue;
+          retired_.erase(it);
+        }
+      }
+      uint64_t packed[2];
+      bool claimed = false;
+      StatusSlot* slot = FindOrClaim(r.name, packed, &claimed);
+      if (slot == nullptr) {
+        if (unplaced != nullptr) unplaced->push_back(r);
+        continue;
+      }
+      if (!claimed &&
+          slot->state.load(std::memory_order_relaxed) == r.state &&
+          slot->rx.load(std::memory_order_relaxed) == r.rx &&
+          slot->tx.load(std::memory_order_relaxed) == r.tx &&
+          slot->handshake_ms.load(std::memory_order_relaxed) ==
+              r.handshake_ms) {
+        continue;
+      }
+      uint32_t s = slot->seq.load(std::memory_order_relaxed);
+      slot->seq.store(s + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      if (claimed) {
+        slot->name[0].store(packed[0], std::memory_order_relaxed);
+        slot->name[1].store(packed[1], std::memory_order_relaxed);
+      }
+      slot->state.store(r.state, std::memory_order_relaxed);
+      slot->rx.store(r.rx, std::memory_order_relaxed);
+      slot->tx.store(r.tx, std::memory_order_relaxed);
+      slot->handshake_ms.store(r.handshake_ms, std::memory_order_relaxed);
+      slot->seq.store(s + 2, std::memory_order_release);
+      // A fresh slot becomes visible only once it holds a full record.
+      if (slot == &slots_[header_->used.load(std::memory_order_relaxed)]) {
+        header_->used.fetch_add(1, std::memory_order_release);
+      }
+      ++changed;
+    }
+    if (changed > 0) {
+      header_->generation.fetch_add(1, std::memory_order_release);
+    }
+    return changed;
+  }
+
+  // Frees every slot that already holds a down record and whose name is not
+  // in `names` (the tunnels that are up), making room for tunnels claimed
+  // later. A tunnel that just stopped keeps its slot until the first
+  // Retain() after the Publish() that wrote its down state, so readers get
+  // a poll interval to see it. Readers stop seeing the freed names. Returns the number of
+  // slots freed.
+  size_t Retain(const std::vector<std::string>& names) {
+    std::vector<uint64_t> keep;
+    keep.reserve(names.size() * 2);
+    for (const auto& name : names) {
+      if (!IsValidTunnelName(name)) continue;
+      uint64_t packed[2];
+      internal::PackName(name, packed);
+      keep.push_back(packed[0]);
+      keep.push_back(packed[1]);
+    }
+    size_t freed = 0;
+    uint32_t used = header_->used.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < used; ++i) {
+      StatusSlot& slot = slots_[i];
+      const uint64_t n0 = slot.name[0].load(std::memory_order_relaxed);
+      const uint64_t n1 = slot.name[1].load(std::memory_order_relaxed);
+      if (n0 == 0) continue;
+      bool kept = false;
+      for (size_t k = 0; k < keep.size() && !kept; k += 2) {
+        kept = keep[k] == n0 && keep[k + 1] == n1;
+      }
+      if (kept ||
+          slot.state.load(std::memory_order_relaxed) != kStateDown) {
+        continue;
+      }
+      const uint64_t words[2] = {n0, n1};
+      retired_.insert(internal::UnpackName(words));
+      uint32_t s = slot.seq.load(std::memory_order_relaxed);
+      slot.seq.store(s + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      slot.name[0].store(0, std::memory_order_relaxed);
+      slot.name[1].store(0, std::memory_order_relaxed);
+      slot.seq.store(s + 2, std::memory_order_release);
+      ++freed;
+    }
+    if (freed > 0) {
+      header_->generation.fetch_add(1, std::memory_order_release);
+    }
+    return freed;
+  }
+
+ private:
+  // Returns the slot holding `name`, or claims a free one (a recycled slot
+  // first, then the next unused one) and sets `*claimed`. Null if the name
+  // is invalid or the table is full.
+  StatusSlot* FindOrClaim(const std::string& name, uint64_t packed[2],
+                          bool* claimed) {
+    if (!IsValidTunnelName(name)) return nullptr;
+    internal::PackName(name, packed);
+    StatusSlot* free_slot = nullptr;
+    uint32_t used = header_->used.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < used; ++i) {
+      const uint64_t n0 = slots_[i].name[0].load(std::memory_order_relaxed);
+      if (n0 == packed[0] &&
+          slots_[i].name[1].load(std::memory_order_relaxed) == packed[1]) {
+        return &slots_[i];
+      }
+      if (n0 == 0 && free_slot == nullptr) free_slot = &slots_[i];
+    }
+    if (free_slot == nullptr) {
+      if (used >= header_->capacity) return nullptr;
+      free_slot = &slots_[used];
+    }
+    *claimed = true;
+    return free_slot;
+  }
+
+  StatusSegmentHeader* header_;
+  StatusSlot* slots_;
+  // Names whose slot Retain() freed while they were down. Writer-side only.
+  std::set<std::string> retired_;
+};
+
+// Reader over a (possibly read-only) mapping of the same bytes. Never blocks
+// and never makes a syscall.
+class StatusSegmentReader {
+ public:
+  // Throws std::runtime_error if `mem` doesn't hold a compatible segment.
+  StatusSegmentReader(const void* mem, size_t len)
+      : header_(static_cast<const StatusSegmentHeader*>(mem)),
+        slots_(reinterpret_cast<const StatusSlot*>(header_ + 1)) {
+    if (len < sizeof(StatusSegmentHeader) ||
+        header_->magic != kStatusSegmentMagic ||
+        header_->version != kStatusSegmentVersion ||
+        len < StatusSegmentBytes(header_->capacity)) {
+      throw std::runtime_error("bad status segment");
+    }
+  }
+
+  uint32_t Generation() const {
+    return header_->generation.load(std::memory_order_acquire);
+  }
+
+  // Copies the named tunnel's latest consistent record. False if the writer
+  // has never published that name.
+  bool Read(const std::string& name, StatusRecord* out) const {
+    if (!IsValidTunnelName(name)) return false;
+    uint64_t packed[2];
+    internal::PackName(name, packed);
+    uint32_t used = Used();
+    for (uint32_t i = 0; i < used; ++i) {
+      // Cheap unlocked check first; the name is confirmed under the seqlock
+      // since the slot may be freed or reclaimed meanwhile.
+      if (slots_[i].name[0].load(std::memory_order_relaxed) != packed[0]) {
+        continue;
+      }
+      uint64_t words[2];
+      StatusRecord r;
+      ReadSlot(slots_[i], &r, words);
+      if (words[0] != packed[0] || words[1] != packed[1]) continue;
+      r.name = name;
+      *out = r;
+      return true;
+    }
+    return false;
+  }
+
+  // Calls `fn(const StatusRecord&)` for every slot whose seq moved since the
+  // previous call (every slot on the first call); a reclaimed slot reports
+  // its new name. `last_seq` is the caller's memory of what it has already
+  // seen.
+  template <typename Fn>
+  void ForEachChanged(std::vector<uint32_t>* last_seq, Fn&& fn) const {
+    uint32_t used = Used();
+    if (last_seq->size() < used) last_seq->resize(used, 0);
+    for (uint32_t i = 0; i < used; ++i) {
+      StatusRecord r;
+      uint64_t words[2];
+      uint32_t seq = ReadSlot(slots_[i], &r, words);
+      if (seq == (*last_seq)[i]) continue;
+      (*last_seq)[i] = seq;
+      if (words[0] == 0) continue;  // freed
+      r.name = internal::UnpackName(words);
+      fn(static_cast<const StatusRecord&>(r));
+    }
+  }
+
+ private:
+  uint32_t Used() const {
+    uint32_t used = header_->used.load(std::memory_order_acquire);
+    return used < header_->capacity ? used : header_->capacity;
+  }
+
+  // Copies the slot's fields and packed name. Returns the even seq the copy
+  // is consistent with.
+  static uint32_t ReadSlot(const StatusSlot& s, StatusRecord* out,
+                           uint64_t name[2]) {
+    for (;;) {
+      uint32_t before = s.seq.load(std::memory_order_acquire);
+      if (before & 1) continue;  // writer mid-update; it's a handful of stores
+      uint64_t n0 = s.name[0].load(std::memory_order_relaxed);
+      uint64_t n1 = s.name[1].load(std::memory_order_relaxed);
+      uint32_t state = s.state.load(std::memory_order_relaxed);
+      int64_t rx = s.rx.load(std::memory_order_relaxed);
+      int64_t tx = s.tx.load(std::memory_order_relaxed);
+      int64_t hs = s.handshake_ms.load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (s.seq.load(std::memory_order_relaxed) != before) continue;
+      out->state = static_cast<uint8_t>(state);
+      out->rx = rx;
+      out->tx = tx;
+      out->handshake_ms = hs;
+      name[0] = n0;
+      name[1] = n1;
+      return before;
+    }
+  }
+
+  const StatusSegmentHeader* header_;
+  const StatusSlot* slots_;
+};
+
+}  // namespace ipc
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_STATUS_SEGMENT_H_
@@ -0,0 +1,117 @@
+// WireGuard keys as the tools print them: 32 bytes, standard base64 with
+// one '=' of padding (44 characters).
+//
+// Every peer in a config, a `wg show dump` and a status poll carries one,
+// so decoding is branch-free: one lookup per character in a 256-entry
+// table, with invalid characters OR-ed into a single check at the end
+// rather than tested one by one. Encoding is a lookup per character into
+// the 64-character alphabet.
+#ifndef FLUTTER_WIREGUARD_WG_KEY_H_
+#define FLUTTER_WIREGUARD_WG_KEY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace flutter_wireguard {
+
+inline constexpr size_t kWgKeyLen = 32;
+
+// A raw key, for tables keyed by it (wg_key_map.h).
+struct WgKey {
+  uint8_t bytes[kWgKeyLen];
+
+  bool operator==(const WgKey& o) const {
+    return std::memcmp(bytes, o.bytes, kWgKeyLen) == 0;
+  }
+  bool operator!=(const WgKey& o) const { return !(*this == o); }
+};
+
+namespace wg_key_internal {
+
+inline constexpr char kBase64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Character -> 6-bit value, or -1 (all bits set) for anything else.
+struct Base64Table {
+  int8_t value[256];
+  constexpr Base64Table() : value() {
+    for (int c = 0; c < 256; ++c) value[c] = -1;
+    for (int v = 0; v < 64; ++v) {
+      value[static_cast<uint8_t>(kBase64Alphabet[v])] = static_cast<int8_t>(v);
+    }
+  }
+};
+
+inline constexpr Base64Table kBase64Values{};
+
+}  // namespace wg_key_internal
+
+// False on anything that isn't exactly one key.
+inline bool WgKeyFromBase64(const char* b64, size_t len,
+                            uint8_t out[kWgKeyLen]) {
+  using wg_key_internal::kBase64Values;
+  // 32 bytes -> 43 significant characters plus one '=' of padding.
+  if (len != 44 || b64[43] != '=') return false;
+  const auto* p = reinterpret_cast<const uint8_t*>(b64);
+  int invalid = 0;  // negative once any character was
+  uint32_t v = 0;
+  for (size_t i = 0, o = 0; i < 40; i += 4, o += 3) {
+    const int a = kBase64Values.value[p[i]], b = kBase64Values.value[p[i + 1]],
+              c = kBase64Values.value[p[i + 2]], d = kBase64Values.value[p[i + 3]];
+    invalid |= a | b | c | d;
+    v = static_cast<uint32_t>((a & 63) << 18 | (b & 63) << 12 | (c & 63) << 6 |
+                              (d & 63));
+    out[o] = static_cast<uint8_t>(v >> 16);
+    out[o + 1] = static_cast<uint8_t>(v >> 8);
+    out[o + 2] = static_cast<uint8_t>(v);
+  }
+  // 30 bytes done; 3 characters (18 bits) carry the last 2.
+  const int a = kBase64Values.value[p[40]], b = kBase64Values.value[p[41]],
+            c = kBase64Values.value[p[42]];
+  invalid |= a | b | c;
+  v = static_cast<uint32_t>((a & 63) << 12 | (b & 63) << 6 | (c & 63));
+  out[30] = static_cast<uint8_t>(v >> 10);
+  out[31] = static_cast<uint8_t>(v >> 2);
+  // The two left-over bits must be zero, otherwise this is a different
+  // (non-canonical) string for the same key.
+  return invalid >= 0 && (v & 3) == 0;
+}
+
+inline bool WgKeyFromBase64(const std::string& b64, uint8_t out[kWgKeyLen]) {
+  return WgKeyFromBase64(b64.data(), b64.size(), out);
+}
+
+inline bool WgKeyFromBase64(const std::string& b64, WgKey* out) {
+  return WgKeyFromBase64(b64.data(), b64.size(), out->bytes);
+}
+
+inline std::string WgKeyToBase64(const uint8_t key[kWgKeyLen]) {
+  using wg_key_internal::kBase64Alphabet;
+  char s[44];
+  size_t i = 0, o = 0;
+  for (; i + 3 <= kWgKeyLen; i += 3, o += 4) {
+    const uint32_t v = (uint32_t{key[i]} << 16) | (uint32_t{key[i + 1]} << 8) |
+                       key[i + 2];
+    s[o] = kBase64Alphabet[(v >> 18) & 63];
+    s[o + 1] = kBase64Alphabet[(v >> 12) & 63];
+    s[o + 2] = kBase64Alphabet[(v >> 6) & 63];
+    s[o + 3] = kBase64Alphabet[v & 63];
+  }
+  // 32 = 10 * 3 + 2: one short group.
+  const uint32_t v = (uint32_t{key[i]} << 16) | (uint32_t{key[i + 1]} << 8);
+  s[40] = kBase64Alphabet[(v >> 18) & 63];
+  s[41] = kBase64Alphabet[(v >> 12) & 63];
+  s[42] = kBase64Alphabet[(v >> 6) & 63];
+  s[43] = '=';
+  return std::string(s, sizeof(s));
+}
+
+inline std::string WgKeyToBase64(const WgKey& key) {
+  return WgKeyToBase64(key.bytes);
+}
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_WG_KEY_H_
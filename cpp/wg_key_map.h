@@ -0,0 +1,131 @@
+// A hash map from raw WireGuard keys (WgKey) to small values, for peer
+// lookups that would otherwise compare 44-character base64 strings.
+//
+// Open addressing with linear probing in one flat array kept at most half
+// full: a lookup hashes the key once and usually reads one slot, with no
+// node allocation per entry. Public keys are X25519 points, close enough to
+// uniform that two 64-bit words of one, mixed by a multiply, spread them
+// evenly; a crafted config can only make its own lookups slower. Erase
+// shifts the rest of the probe run back (no tombstones), so a table that
+// churns does not degrade.
+//
+// Not thread-safe; callers lock around it.
+#ifndef FLUTTER_WIREGUARD_WG_KEY_MAP_H_
+#define FLUTTER_WIREGUARD_WG_KEY_MAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "wg_key.h"
+
+namespace flutter_wireguard {
+
+template <typename V>
+class WgKeyMap {
+ public:
+  WgKeyMap() = default;
+  explicit WgKeyMap(size_t expected) { Reserve(expected); }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  void clear() {
+    for (auto& s : slots_) s.used = false;
+    size_ = 0;
+  }
+
+  // Room for `n` entries without rehashing.
+  void Reserve(size_t n) {
+    size_t cap = 8;
+    while (cap < 2 * n) cap *= 2;
+    if (cap > slots_.size()) Rehash(cap);
+  }
+
+  V* Find(const WgKey& key) {
+    if (size_ == 0) return nullptr;
+    for (size_t i = Home(key);; i = (i + 1) & mask_) {
+      Slot& s = slots_[i];
+      if (!s.used) return nullptr;
+      if (s.key == key) return &s.value;
+    }
+  }
+
+  const V* Find(const WgKey& key) const {
+    return const_cast<WgKeyMap*>(this)->Find(key);
+  }
+
+  // Adds `key` -> `value` unless `key` is present. Returns its value and
+  // whether it was added.
+  std::pair<V*, bool> Insert(const WgKey& key, V value) {
+    if (2 * (size_ + 1) > slots_.size()) {
+      Rehash(slots_.empty() ? 8 : 2 * slots_.size());
+    }
+    for (size_t i = Home(key);; i = (i + 1) & mask_) {
+      Slot& s = slots_[i];
+      if (!s.used) {
+        s.key = key;
+        s.value = std::move(value);
+        s.used = true;
+        ++size_;
+        return {&s.value, true};
+      }
+      if (s.key == key) return {&s.value, false};
+    }
+  }
+
+  bool Erase(const WgKey& key) {
+    if (size_ == 0) return false;
+    size_t i = Home(key);
+    for (;; i = (i + 1) & mask_) {
+      if (!slots_[i].used) return false;
+      if (slots_[i].key == key) break;
+    }
+    // Pull back every later entry of the run that may sit in the hole.
+    for (size_t j = (i + 1) & mask_; slots_[j].used; j = (j + 1) & mask_) {
+      const size_t home = Home(slots_[j].key);
+      // Movable unless its home lies cyclically in (i, j].
+      const bool stays = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+      if (stays) continue;
+      slots_[i] = std::move(slots_[j]);
+      i = j;
+    }
+    slots_[i].used = false;
+    --size_;
+    return true;
+  }
+
+ private:
+  struct Slot {
+    WgKey key;
+    V value{};
+    bool used = false;
+  };
+
+  size_t Home(const WgKey& key) const {
+    uint64_t a, b;
+    std::memcpy(&a, key.bytes, 8);
+    std::memcpy(&b, key.bytes + 8, 8);
+    return static_cast<size_t>(((a ^ (b << 1)) * 0x9e3779b97f4a7c15) >> 32) & mask_;
+  }
+
+  void Rehash(size_t cap) {
+    std::vector<Slot> old = std::move(slots_);
+    slots_.assign(cap, Slot());
+    mask_ = cap - 1;
+    size_ = 0;
+    for (auto& s : old) {
+      if (s.used) Insert(s.key, std::move(s.value));
+    }
+  }
+
+  std::vector<Slot> slots_;
+  size_t mask_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_WG_KEY_MAP_H_
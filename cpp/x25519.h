@@ -0,0 +1,401 @@
+// X25519 (RFC 7748) for WireGuard keys, in bulk.
+//
+// lib/src/keys.dart derives keys in Dart, one at a time on the calling
+// isolate; provisioning thousands of peers that way takes seconds. This is
+// the same function natively: a Montgomery ladder over GF(2^255 - 19) with
+// five 51-bit limbs, so each field multiplication is 25 64x64->128-bit
+// products (one mul instruction each on x86-64 and arm64) instead of the
+// 16-bit limbs of portable reference code.
+//
+// Everything that touches a private key is constant-time: the ladder runs
+// all 255 steps with a masked conditional swap, and the field arithmetic
+// has no data-dependent branches or table lookups.
+//
+// PublicKeys() derives many public keys at once. The ladder leaves each
+// result as a fraction X/Z, and turning it into bytes takes a field
+// inversion, a tenth of the work per key; the batch shares one inversion
+// between kBatch keys (Montgomery's trick), and spreads batches over
+// threads.
+//
+// Keys are what wg(8) reads and writes: a private key is 32 random bytes,
+// clamped (ClampPrivateKey) as `wg genkey` does, and PublicKey() matches
+// `wg pubkey`.
+#ifndef FLUTTER_WIREGUARD_X25519_H_
+#define FLUTTER_WIREGUARD_X25519_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "wg_key.h"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace flutter_wireguard {
+
+namespace x25519_internal {
+
+constexpr uint64_t kMask51 = (uint64_t{1} << 51) - 1;
+
+// A field element: value = sum(v[i] << 51i). Limbs may exceed 51 bits
+// between operations; Carry() brings them back.
+struct Fe {
+  uint64_t v[5];
+};
+
+#if defined(__SIZEOF_INT128__)
+
+using U128 = unsigned __int128;
+
+inline U128 Mul64(uint64_t a, uint64_t b) { return static_cast<U128>(a) * b; }
+inline void Add(U128* acc, U128 x) { *acc += x; }
+inline uint64_t Lo(U128 x) { return static_cast<uint64_t>(x); }
+inline uint64_t Shr51(U128 x) { return static_cast<uint64_t>(x >> 51); }
+
+#else
+
+// 128-bit accumulator for compilers without __int128 (MSVC).
+struct U128 {
+  uint64_t lo;
+  uint64_t hi;
+};
+
+inline U128 Mul64(uint64_t a, uint64_t b) {
+#if defined(_MSC_VER) && defined(_M_X64)
+  U128 r;
+  r.lo = _umul128(a, b, &r.hi);
+  return r;
+#else
+  const uint64_t a0 = a & 0xffffffff, a1 = a >> 32;
+  const uint64_t b0 = b & 0xffffffff, b1 = b >> 32;
+  const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+  const uint64_t mid = (p00 >> 32) + (p01 & 0xffffffff) + (p10 & 0xffffffff);
+  return {(mid << 32) | (p00 & 0xffffffff),
+          p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32)};
+#endif
+}
+
+// *acc += x. The carry is a comparison, which compiles to a flag, not a
+// branch.
+inline void Add(U128* acc, U128 x) {
+  acc->lo += x.lo;
+  acc->hi += x.hi + static_cast<uint64_t>(acc->lo < x.lo);
+}
+
+inline void Add(U128* acc, uint64_t x) {
+  acc->lo += x;
+  acc->hi += static_cast<uint64_t>(acc->lo < x);
+}
+
+inline uint64_t Lo(U128 x) { return x.lo; }
+inline uint64_t Shr51(U128 x) { return (x.lo >> 51) | (x.hi << 13); }
+
+#endif
+
+inline void Carry(Fe* h) {
+  uint64_t c;
+  c = h->v[0] >> 51; h->v[0] &= kMask51; h->v[1] += c;
+  c = h->v[1] >> 51; h->v[1] &= kMask51; h->v[2] += c;
+  c = h->v[2] >> 51; h->v[2] &= kMask51; h->v[3] += c;
+  c = h->v[3] >> 51; h->v[3] &= kMask51; h->v[4] += c;
+  c = h->v[4] >> 51; h->v[4] &= kMask51; h->v[0] += 19 * c;
+}
+
+// Reduces five 128-bit column sums into h.
+inline void Reduce(U128 r[5], Fe* h) {
+  Add(&r[1], Shr51(r[0]));
+  Add(&r[2], Shr51(r[1]));
+  Add(&r[3], Shr51(r[2]));
+  Add(&r[4], Shr51(r[3]));
+  const uint64_t c = Shr51(r[4]);
+  h->v[0] = (Lo(r[0]) & kMask51) + 19 * c;
+  h->v[1] = Lo(r[1]) & kMask51;
+  h->v[2] = Lo(r[2]) & kMask51;
+  h->v[3] = Lo(r[3]) & kMask51;
+  h->v[4] = Lo(r[4]) & kMask51;
+  h->v[1] += h->v[0] >> 51;
+  h->v[0] &= kMask51;
+}
+
+inline Fe FeAdd(const Fe& f, const Fe& g) {
+  Fe h;
+  for (int i = 0; i < 5; ++i) h.v[i] = f.v[i] + g.v[i];
+  Carry(&h);
+  return h;
+}
+
+// f - g, computed as f + 4p - g so no limb goes negative.
+inline Fe FeSub(const Fe& f, const Fe& g) {
+  Fe h;
+  h.v[0] = f.v[0] + 0x1fffffffffffb4 - g.v[0];
+  for (int i = 1; i < 5; ++i) h.v[i] = f.v[i] + 0x1ffffffffffffc - g.v[i];
+  Carry(&h);
+  return h;
+}
+
+inline Fe FeMul(const Fe& f, const Fe& g) {
+  const uint64_t f0 = f.v[0], f1 = f.v[1], f2 = f.v[2], f3 = f.v[3], f4 = f.v[4];
+  const uint64_t g0 = g.v[0], g1 = g.v[1], g2 = g.v[2], g3 = g.v[3], g4 = g.v[4];
+  const uint64_t g1_19 = 19 * g1, g2_19 = 19 * g2;
+  const uint64_t g3_19 = 19 * g3, g4_19 = 19 * g4;
+  U128 r[5];
+  r[0] = Mul64(f0, g0);
+  Add(&r[0], Mul64(f1, g4_19));
+  Add(&r[0], Mul64(f2, g3_19));
+  Add(&r[0], Mul64(f3, g2_19));
+  Add(&r[0], Mul64(f4, g1_19));
+  r[1] = Mul64(f0, g1);
+  Add(&r[1], Mul64(f1, g0));
+  Add(&r[1], Mul64(f2, g4_19));
+  Add(&r[1], Mul64(f3, g3_19));
+  Add(&r[1], Mul64(f4, g2_19));
+  r[2] = Mul64(f0, g2);
+  Add(&r[2], Mul64(f1, g1));
+  Add(&r[2], Mul64(f2, g0));
+  Add(&r[2], Mul64(f3, g4_19));
+  Add(&r[2], Mul64(f4, g3_19));
+  r[3] = Mul64(f0, g3);
+  Add(&r[3], Mul64(f1, g2));
+  Add(&r[3], Mul64(f2, g1));
+  Add(&r[3], Mul64(f3, g0));
+  Add(&r[3], Mul64(f4, g4_19));
+  r[4] = Mul64(f0, g4);
+  Add(&r[4], Mul64(f1, g3));
+  Add(&r[4], Mul64(f2, g2));
+  Add(&r[4], Mul64(f3, g1));
+  Add(&r[4], Mul64(f4, g0));
+  Fe h;
+  Reduce(r, &h);
+  return h;
+}
+
+// FeMul(f, f) in 15 products instead of 25.
+inline Fe FeSq(const Fe& f) {
+  const uint64_t f0 = f.v[0], f1 = f.v[1], f2 = f.v[2], f3 = f.v[3], f4 = f.v[4];
+  const uint64_t f0_2 = 2 * f0, f1_2 = 2 * f1;
+  const uint64_t f3_19 = 19 * f3, f4_19 = 19 * f4;
+  U128 r[5];
+  r[0] = Mul64(f0, f0);
+  Add(&r[0], Mul64(f1_2, f4_19));
+  Add(&r[0], Mul64(2 * f2, f3_19));
+  r[1] = Mul64(f0_2, f1);
+  Add(&r[1], Mul64(2 * f2, f4_19));
+  Add(&r[1], Mul64(f3, f3_19));
+  r[2] = Mul64(f0_2, f2);
+  Add(&r[2], Mul64(f1, f1));
+  Add(&r[2], Mul64(2 * f3, f4_19));
+  r[3] = Mul64(f0_2, f3);
+  Add(&r[3], Mul64(f1_2, f2));
+  Add(&r[3], Mul64(f4, f4_19));
+  r[4] = Mul64(f0_2, f4);
+  Add(&r[4], Mul64(f1_2, f3));
+  Add(&r[4], Mul64(f2, f2));
+  Fe h;
+  Reduce(r, &h);
+  return h;
+}
+
+inline Fe FeSqTimes(Fe f, int n) {
+  for (int i = 0; i < n; ++i) f = FeSq(f);
+  return f;
+}
+
+inline Fe FeMulSmall(const Fe& f, uint64_t k) {
+  U128 r[5];
+  for (int i = 0; i < 5; ++i) r[i] = Mul64(f.v[i], k);
+  Fe h;
+  Reduce(r, &h);
+  return h;
+}
+
+// z^(p-2) = 1/z, by the usual chain of 254 squarings and 11 products.
+inline Fe FeInvert(const Fe& z) {
+  Fe t0 = FeSq(z);                          // 2
+  Fe t1 = FeMul(z, FeSqTimes(t0, 2));       // 9
+  t0 = FeMul(t0, t1);                       // 11
+  t1 = FeMul(t1, FeSq(t0));                 // 2^5 - 1
+  t1 = FeMul(FeSqTimes(t1, 5), t1);         // 2^10 - 1
+  Fe t2 = FeMul(FeSqTimes(t1, 10), t1);     // 2^20 - 1
+  t2 = FeMul(FeSqTimes(t2, 20), t2);        // 2^40 - 1
+  t1 = FeMul(FeSqTimes(t2, 10), t1);        // 2^50 - 1
+  t2 = FeMul(FeSqTimes(t1, 50), t1);        // 2^100 - 1
+  t2 = FeMul(FeSqTimes(t2, 100), t2);       // 2^200 - 1
+  t1 = FeMul(FeSqTimes(t2, 50), t1);        // 2^250 - 1
+  return FeMul(FeSqTimes(t1, 5), t0);       // 2^255 - 21
+}
+
+inline uint64_t Load64(const uint8_t* s) {
+  uint64_t x = 0;
+  for (int i = 7; i >= 0; --i) x = x << 8 | s[i];
+  return x;
+}
+
+inline void Store64(uint8_t* s, uint64_t x) {
+  for (int i = 0; i < 8; ++i) s[i] = static_cast<uint8_t>(x >> (8 * i));
+}
+
+// Little-endian, top bit ignored (RFC 7748, decodeUCoordinate).
+inline Fe FeFromBytes(const uint8_t s[32]) {
+  Fe h;
+  h.v[0] = Load64(s) & kMask51;
+  h.v[1] = (Load64(s + 6) >> 3) & kMask51;
+  h.v[2] = (Load64(s + 12) >> 6) & kMask51;
+  h.v[3] = (Load64(s + 19) >> 1) & kMask51;
+  h.v[4] = (Load64(s + 24) >> 12) & kMask51;
+  return h;
+}
+
+// Fully reduced mod p, little-endian.
+inline void FeToBytes(uint8_t s[32], Fe h) {
+  Carry(&h);
+  Carry(&h);
+  // q = 1 if h >= p, else 0; then h - q*p = h + 19q - q*2^255.
+  uint64_t q = (h.v[0] + 19) >> 51;
+  q = (h.v[1] + q) >> 51;
+  q = (h.v[2] + q) >> 51;
+  q = (h.v[3] + q) >> 51;
+  q = (h.v[4] + q) >> 51;
+  h.v[0] += 19 * q;
+  uint64_t c;
+  c = h.v[0] >> 51; h.v[0] &= kMask51; h.v[1] += c;
+  c = h.v[1] >> 51; h.v[1] &= kMask51; h.v[2] += c;
+  c = h.v[2] >> 51; h.v[2] &= kMask51; h.v[3] += c;
+  c = h.v[3] >> 51; h.v[3] &= kMask51; h.v[4] += c;
+  h.v[4] &= kMask51;
+  Store64(s, h.v[0] | h.v[1] << 51);
+  Store64(s + 8, h.v[1] >> 13 | h.v[2] << 38);
+  Store64(s + 16, h.v[2] >> 26 | h.v[3] << 25);
+  Store64(s + 24, h.v[3] >> 39 | h.v[4] << 12);
+}
+
+// Swaps f and g if `swap` is 1, leaves them if 0, in the same time.
+inline void CSwap(Fe* f, Fe* g, uint64_t swap) {
+  const uint64_t mask = 0 - swap;
+  for (int i = 0; i < 5; ++i) {
+    const uint64_t t = mask & (f->v[i] ^ g->v[i]);
+    f->v[i] ^= t;
+    g->v[i] ^= t;
+  }
+}
+
+// The ladder of RFC 7748 section 5, stopping short of the inversion:
+// scalar*u = *x / *z.
+inline void Ladder(const uint8_t scalar[32], const Fe& u, Fe* x, Fe* z) {
+  uint8_t k[32];
+  std::memcpy(k, scalar, 32);
+  k[0] &= 248;
+  k[31] &= 127;
+  k[31] |= 64;
+  Fe x2 = {{1, 0, 0, 0, 0}}, z2 = {{0, 0, 0, 0, 0}};
+  Fe x3 = u, z3 = {{1, 0, 0, 0, 0}};
+  uint64_t swap = 0;
+  for (int t = 254; t >= 0; --t) {
+    const uint64_t bit = (k[t >> 3] >> (t & 7)) & 1;
+    swap ^= bit;
+    CSwap(&x2, &x3, swap);
+    CSwap(&z2, &z3, swap);
+    swap = bit;
+    const Fe a = FeAdd(x2, z2);
+    const Fe aa = FeSq(a);
+    const Fe b = FeSub(x2, z2);
+    const Fe bb = FeSq(b);
+    const Fe e = FeSub(aa, bb);
+    const Fe c = FeAdd(x3, z3);
+    const Fe d = FeSub(x3, z3);
+    const Fe da = FeMul(d, a);
+    const Fe cb = FeMul(c, b);
+    x3 = FeSq(FeAdd(da, cb));
+    z3 = FeMul(u, FeSq(FeSub(da, cb)));
+    x2 = FeMul(aa, bb);
+    z2 = FeMul(e, FeAdd(aa, FeMulSmall(e, 121665)));
+  }
+  CSwap(&x2, &x3, swap);
+  CSwap(&z2, &z3, swap);
+  std::memset(k, 0, sizeof(k));
+  *x = x2;
+  *z = z2;
+}
+
+inline const Fe& BasePoint() {
+  static const Fe nine = {{9, 0, 0, 0, 0}};
+  return nine;
+}
+
+// Public keys of `n` private keys, sharing one inversion. For the base
+// point no Z is zero: a clamped scalar is never a multiple of the group
+// order.
+inline void PublicKeysBatch(const uint8_t* priv, uint8_t* pub, size_t n) {
+  std::vector<Fe> x(n), z(n), prefix(n);
+  for (size_t i = 0; i < n; ++i) {
+    Ladder(priv + i * kWgKeyLen, BasePoint(), &x[i], &z[i]);
+    prefix[i] = i == 0 ? z[0] : FeMul(prefix[i - 1], z[i]);
+  }
+  Fe inv = FeInvert(prefix[n - 1]);  // 1 / (z0 z1 ... z(n-1))
+  for (size_t i = n; i-- > 0;) {
+    const Fe zi_inv = i == 0 ? inv : FeMul(inv, prefix[i - 1]);
+    if (i > 0) inv = FeMul(inv, z[i]);
+    FeToBytes(pub + i * kWgKeyLen, FeMul(x[i], zi_inv));
+  }
+}
+
+}  // namespace x25519_internal
+
+// RFC 7748 X25519: `scalar` (clamped here) times the point with
+// u-coordinate `u`.
+inline void X25519(uint8_t out[kWgKeyLen], const uint8_t scalar[kWgKeyLen],
+                   const uint8_t u[kWgKeyLen]) {
+  using namespace x25519_internal;
+  Fe x, z;
+  Ladder(scalar, FeFromBytes(u), &x, &z);
+  FeToBytes(out, FeMul(x, FeInvert(z)));
+}
+
+// What `wg genkey` does to its 32 random bytes.
+inline void ClampPrivateKey(uint8_t key[kWgKeyLen]) {
+  key[0] &= 248;
+  key[31] &= 127;
+  key[31] |= 64;
+}
+
+// `wg pubkey`.
+inline void PublicKey(uint8_t pub[kWgKeyLen], const uint8_t priv[kWgKeyLen]) {
+  using namespace x25519_internal;
+  Fe x, z;
+  Ladder(priv, BasePoint(), &x, &z);
+  FeToBytes(pub, FeMul(x, FeInvert(z)));
+}
+
+// PublicKey for `n` keys laid out back to back in `priv`, written the same
+// way to `pub`. Batches of kBatch keys share an inversion; batches run on
+// up to `max_threads` threads (0: one per core).
+inline void PublicKeys(const uint8_t* priv, uint8_t* pub, size_t n,
+                       unsigned max_threads = 0) {
+  constexpr size_t kBatch = 64;
+  const size_t batches = (n + kBatch - 1) / kBatch;
+  if (batches == 0) return;
+  // No std::min/max: <windows.h> may have defined them as macros.
+  size_t threads =
+      max_threads != 0 ? max_threads : std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+  if (threads > batches) threads = batches;
+  auto run = [&](size_t first, size_t step) {
+    for (size_t b = first; b < batches; b += step) {
+      const size_t at = b * kBatch;
+      x25519_internal::PublicKeysBatch(priv + at * kWgKeyLen,
+                                       pub + at * kWgKeyLen,
+                                       n - at < kBatch ? n - at : kBatch);
+    }
+  };
+  std::vector<std::thread> pool;
+  for (size_t t = 1; t < threads; ++t) pool.emplace_back(run, t, threads);
+  run(0, threads);
+  for (auto& th : pool) th.join();
+}
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_X25519_H_
@@ -1,16 +1,30 @@
 /// flutter_wireguard public API.
 ///
 /// All operations are top-level functions; there is no facade object to
-/// instantiate. Status events are exposed as a single broadcast [Stream] that
-/// any number of listeners can attach to.
+/// instantiate. Status, health and usage-quota events are each exposed as a
+/// broadcast [Stream] that any number of listeners can attach to.
 library;
 
 import 'dart:async';
 
+import 'src/keys.dart';
 import 'src/messages.g.dart';
 
 export 'src/messages.g.dart'
-    show TunnelStatus, TunnelState, BackendInfo, BackendKind;
+    show
+        TunnelStatus,
+        TunnelState,
+        BackendInfo,
+        BackendKind,
+        TunnelSpec,
+        TunnelResult,
+        PhaseStats,
+        TunnelHealth,
+        TunnelHealthState,
+        PeerStatus,
+        PeerUsage,
+        TunnelUsage,
+        UsageQuotaExceeded;
 export 'src/keys.dart';
 
 final WireguardHostApi _host = WireguardHostApi();
@@ -18,21 +32,42 @@ final StreamController<TunnelStatus> _statusController =
     StreamController<TunnelStatus>.broadcast(
   onListen: _ensureFlutterApiRegistered,
 );
+final StreamController<TunnelHealth> _healthController =
+    StreamController<TunnelHealth>.broadcast(
+  onListen: _ensureFlutterApiRegistered,
+);
+final StreamController<UsageQuotaExceeded> _quotaController =
+    StreamController<UsageQuotaExceeded>.broadcast(
+  onListen: _ensureFlutterApiRegistered,
+);
 
 bool _flutterApiRegistered = false;
 void _ensureFlutterApiRegistered() {
   if (_flutterApiRegistered) return;
-  WireguardFlutterApi.setUp(_FlutterApiAdapter(_statusController));
+  WireguardFlutterApi.setUp(_FlutterApiAdapter(
+      _statusController, _healthController, _quotaController));
   _flutterApiRegistered = true;
 }
 
 class _FlutterApiAdapter implements WireguardFlutterApi {
-  _FlutterApiAdapter(this._sink);
+  _FlutterApiAdapter(this._sink, this._healthSink, this._quotaSink);
   final StreamController<TunnelStatus> _sink;
+  final StreamController<TunnelHealth> _healthSink;
+  final StreamController<UsageQuotaExceeded> _quotaSink;
   @override
   void onTunnelStatus(TunnelStatus status) {
     if (!_sink.isClosed) _sink.add(status);
   }
+
+  @override
+  void onTunnelHealth(TunnelHealth health) {
+    if (!_healthSink.isClosed) _healthSink.add(health);
+  }
+
+  @override
+  void onUsageQuota(UsageQuotaExceeded event) {
+    if (!_quotaSink.isClosed) _quotaSink.add(event);
+  }
 }
 
 /// Bring tunnel [name] up using the supplied wg-quick / wg-config string.
@@ -53,8 +88,181 @@ Future<List<String>> tunnelNames() => _host.tunnelNames();
 /// Identifies the active backend (e.g. kernel vs userspace).
 Future<BackendInfo> backend() => _host.backend();
 
+/// Bring several tunnels up in one call.
+///
+/// Independent tunnels come up concurrently where the platform allows it (on
+/// Linux with a single elevation prompt for the whole batch). One failure
+/// does not abort the others; the result list matches [specs] in order.
+Future<List<TunnelResult>> startMany(List<TunnelSpec> specs) =>
+    _host.startMany(specs);
+
+/// Bring several tunnels down in one call. Unknown names report success.
+Future<List<TunnelResult>> stopMany(List<String> names) =>
+    _host.stopMany(names);
+
+/// Replace tunnel [from] with [to] without dropping connectivity.
+///
+/// [to] is brought up alongside [from] and must complete a handshake before
+/// traffic moves to it; only then is [from] stopped. Throws
+/// [PlatformException] with code "SWITCH_FAILED" if [to] cannot be brought
+/// up, in which case [from] keeps running.
+Future<void> switchTunnel(String from, String to, String config) =>
+    _host.switchTunnel(from, to, config);
+
+/// Latency percentiles for each step of start/stop/switch since the native
+/// side started (e.g. `start/wg_quick_up`, `session/elevate`), to find where
+/// a slow connect spent its time. Steps that never ran are omitted.
+Future<List<PhaseStats>> diagnostics() => _host.diagnostics();
+
+/// Writes the native trace points recorded so far (Pigeon call arrival,
+/// worker pickup, elevated pipe I/O, process spawns, event dispatch) to
+/// [path] as Chrome trace JSON, for chrome://tracing or ui.perfetto.dev.
+///
+/// Linux only, and only when the plugin was built with
+/// `-DFLUTTER_WIREGUARD_TRACE=ON`; otherwise throws [PlatformException] with
+/// code "TRACE_FAILED".
+Future<void> dumpTrace(String path) => _host.dumpTrace(path);
+
+/// Public key of the peer tunnel [name] sends [ipAddress] to: the one whose
+/// AllowedIPs contain it with the longest prefix, as the kernel routes. Null
+/// if no peer's AllowedIPs cover it.
+///
+/// Answered from a native index of the config [name] was started with, so
+/// it is cheap enough to call per address. Throws [PlatformException] with
+/// code "LOOKUP_FAILED" for a malformed address, for a tunnel this process
+/// did not start, and on Android.
+Future<String?> lookupPeer(String name, String ipAddress) =>
+    _host.lookupPeer(name, ipAddress);
+
+/// [lookupPeer] for many addresses in one call; results match [ipAddresses]
+/// in order.
+Future<List<String?>> lookupPeers(String name, List<String> ipAddresses) =>
+    _host.lookupPeers(name, ipAddresses);
+
+/// The addresses in [include] but not in [exclude], as the fewest CIDR
+/// prefixes that cover them: IPv4 first, each family in address order.
+/// Overlapping and adjacent prefixes are merged, so the result is also the
+/// way to shrink a long hand-written AllowedIPs list.
+///
+/// ```dart
+/// final allowed = await computeAllowedIps(['0.0.0.0/0', '::/0'], lanPrefixes);
+/// ```
+///
+/// Computed natively on Linux and Windows (100k prefixes in milliseconds).
+/// Throws [PlatformException] with code "ALLOWED_IPS_FAILED" for a
+/// malformed prefix, and on Android.
+Future<List<String>> computeAllowedIps(
+        List<String> include, List<String> exclude) =>
+    _host.computeAllowedIps(include, exclude);
+
+/// Looks up the hostnames in the `Endpoint =` lines of tunnel [name] again
+/// and points every peer whose server moved at its new address. Call it
+/// when the device changes networks or a server behind dynamic DNS moves.
+/// A name that no longer resolves keeps its old address. Returns the number
+/// of peers that moved; 0 if the config has no hostnames.
+///
+/// Linux only. Throws [PlatformException] with code "RESOLVE_FAILED" for a
+/// tunnel this process does not know, if the update fails, and on Android
+/// and Windows, whose tunnel services resolve endpoints themselves.
+Future<int> reresolveEndpoints(String name) => _host.reresolveEndpoints(name);
+
+/// Sets how long a peer may go without a handshake before [healthStream]
+/// reports it [TunnelHealthState.stale]. Defaults to 180 seconds, the age at
+/// which WireGuard itself stops using a session; shorter values notice a
+/// dead server sooner on tunnels with `PersistentKeepalive` set. Durations
+/// under a second are raised to one.
+///
+/// Throws [PlatformException] with code "HEALTH_FAILED" on Android.
+Future<void> setStaleAfter(Duration age) =>
+    _host.setStaleAfter(age.inSeconds);
+
+/// Counters of the peer of tunnel [name] with [publicKey], or null if the
+/// tunnel has none. Answered from the status poller's last snapshot of the
+/// tunnel (about a second old at most, indexed by raw key so the lookup
+/// costs the same with ten peers or ten thousand); before the first poll
+/// the tunnel is read on the spot.
+///
+/// Linux only. Throws [PlatformException] with code "PEER_FAILED" for an
+/// unknown tunnel, a malformed key, and on Android and Windows, which
+/// report tunnels as a whole.
+Future<PeerStatus?> peerByPublicKey(String name, String publicKey) =>
+    _host.peerByPublicKey(name, publicKey);
+
+/// Data tunnel [name] used since [since], per tunnel and per peer. Counted
+/// by the status poller into a ledger file under `$XDG_DATA_HOME`, so it
+/// carries across tunnel restarts (which reset the interface counters) and
+/// app restarts; it covers the time the app was running. Exact to about a
+/// minute, and to the hour for data over a day old.
+///
+/// Linux only. Throws [PlatformException] with code "USAGE_FAILED" for an
+/// invalid name, if the ledger could not be opened (another app holds it),
+/// and on Android and Windows.
+Future<TunnelUsage> usage(String name, DateTime since) =>
+    _host.usage(name, since.millisecondsSinceEpoch);
+
+/// Stops tunnel [name] once its traffic (rx + tx) since [since] reaches
+/// [limitBytes], and reports that once on [usageQuotaStream]. Traffic
+/// already used counts: a quota that is already spent stops the tunnel on
+/// the next poll. A [limitBytes] of 0 removes the quota. Quotas are not
+/// persisted; set them again after the app restarts. Returns the bytes
+/// used so far.
+///
+/// Throws [PlatformException] with code "USAGE_FAILED" like [usage].
+Future<int> setUsageQuota(String name, int limitBytes, DateTime since) =>
+    _host.setUsageQuota(name, limitBytes, since.millisecondsSinceEpoch);
+
+/// [count] fresh keypairs, as [generateKeyPair] would make them one by one,
+/// for provisioning many peers at once. Linux and Windows derive them
+/// natively, in batches spread over the cores; Android uses the WireGuard
+/// tunnel library. Either way the work is off the UI thread.
+///
+/// Throws [PlatformException] with code "KEYS_FAILED" for a negative
+/// [count] or one over 65536.
+Future<List<WireGuardKeyPair>> generateKeyPairs(int count) async {
+  final pairs = await _host.generateKeyPairs(count);
+  return [
+    for (final p in pairs)
+      WireGuardKeyPair(privateKey: p.privateKey, publicKey: p.publicKey),
+  ];
+}
+
+/// [publicKeyFromPrivate] for many keys in one platform call; results match
+/// [privateKeys] in order.
+///
+/// Throws [PlatformException] with code "KEYS_FAILED" whose message gives
+/// the index of the first key that is not 32 bytes of base64.
+Future<List<String>> publicKeysFromPrivate(List<String> privateKeys) =>
+    _host.publicKeysFromPrivate(privateKeys);
+
+/// Private, loopback and link-local ranges: the usual [computeAllowedIps]
+/// `exclude` list for "everything except my LAN".
+const List<String> lanPrefixes = [
+  '10.0.0.0/8',
+  '172.16.0.0/12',
+  '192.168.0.0/16',
+  '127.0.0.0/8',
+  '169.254.0.0/16',
+  'fc00::/7',
+  'fe80::/10',
+];
+
 /// Live status updates pushed by the platform side.
 ///
 /// The stream is broadcast and lazily registers the underlying platform
 /// receiver on first subscription.
 Stream<TunnelStatus> statusStream() => _statusController.stream;
+
+/// Peers of running tunnels connecting, going stale (no handshake for the
+/// [setStaleAfter] age) and recovering, each reported once, on the poll it
+/// happens. A peer without `PersistentKeepalive` only handshakes while it
+/// carries traffic, so an idle one goes stale too and recovers on the next
+/// packet.
+///
+/// Per peer on Linux; per tunnel on Windows, with an empty
+/// [TunnelHealth.publicKey]. Android emits no health events.
+Stream<TunnelHealth> healthStream() => _healthController.stream;
+
+/// Tunnels that reached their [setUsageQuota] limit, each reported once,
+/// after the poll that noticed stopped them. [UsageQuotaExceeded.stopped]
+/// is false if the stop failed and the tunnel is still up. Linux only.
+Stream<UsageQuotaExceeded> usageQuotaStream() => _quotaController.stream;
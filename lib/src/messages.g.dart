@@ -125,6 +125,18 @@ enum BackendKind {
   unknown,
 }
 
+/// How a running tunnel's peer is doing, judged by the age of its last
+/// handshake.
+enum TunnelHealthState {
+  /// First handshake since the tunnel was started.
+  connected,
+  /// No handshake for the stale-after age (180 s unless set with
+  /// [WireguardHostApi.setStaleAfter]), or none that long after the start.
+  stale,
+  /// A handshake again after [stale].
+  recovered,
+}
+
 /// A snapshot of a tunnel's runtime status.
 class TunnelStatus {
   TunnelStatus({
@@ -238,174 +250,1093 @@ class BackendInfo {
   int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
 }
 
+/// One tunnel to bring up in a [WireguardHostApi.startMany] batch.
+class TunnelSpec {
+  TunnelSpec({
+    required this.name,
+    required this.config,
+  });
 
-class _PigeonCodec extends StandardMessageCodec {
-  const _PigeonCodec();
-  @override
-  void writeValue(WriteBuffer buffer, Object? value) {
-    if (value is int) {
-      buffer.putUint8(4);
-      buffer.putInt64(value);
-    }    else if (value is TunnelState) {
-      buffer.putUint8(129);
-      writeValue(buffer, value.index);
-    }    else if (value is BackendKind) {
-      buffer.putUint8(130);
-      writeValue(buffer, value.index);
-    }    else if (value is TunnelStatus) {
-      buffer.putUint8(131);
-      writeValue(buffer, value.encode());
-    }    else if (value is BackendInfo) {
-      buffer.putUint8(132);
-      writeValue(buffer, value.encode());
-    } else {
-      super.writeValue(buffer, value);
-    }
+  /// Tunnel/interface name (e.g. "wg0").
+  String name;
+
+  /// wg-quick / wg-config string, as for [WireguardHostApi.start].
+  String config;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      name,
+      config,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static TunnelSpec decode(Object result) {
+    result as List<Object?>;
+    return TunnelSpec(
+      name: result[0]! as String,
+      config: result[1]! as String,
+    );
   }
 
   @override
-  Object? readValueOfType(int type, ReadBuffer buffer) {
-    switch (type) {
-      case 129:
-        final value = readValue(buffer) as int?;
-        return value == null ? null : TunnelState.values[value];
-      case 130:
-        final value = readValue(buffer) as int?;
-        return value == null ? null : BackendKind.values[value];
-      case 131:
-        return TunnelStatus.decode(readValue(buffer)!);
-      case 132:
-        return BackendInfo.decode(readValue(buffer)!);
-      default:
-        return super.readValueOfType(type, buffer);
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! TunnelSpec || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
     }
+    return _deepEquals(name, other.name) && _deepEquals(config, other.config);
   }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
 }
 
-/// Host -> platform calls. All implementations must be reentrant and may be
-/// called from any isolate / thread.
-class WireguardHostApi {
-  /// Constructor for [WireguardHostApi].  The [binaryMessenger] named argument is
-  /// available for dependency injection.  If it is left null, the default
-  /// BinaryMessenger will be used which routes to the host platform.
-  WireguardHostApi({BinaryMessenger? binaryMessenger, String messageChannelSuffix = ''})
-      : pigeonVar_binaryMessenger = binaryMessenger,
-        pigeonVar_messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
-  final BinaryMessenger? pigeonVar_binaryMessenger;
+/// Per-tunnel outcome of a batch call.
+class TunnelResult {
+  TunnelResult({
+    required this.name,
+    required this.ok,
+    this.error,
+  });
 
-  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+  String name;
 
-  final String pigeonVar_messageChannelSuffix;
+  /// True if the tunnel reached the requested state.
+  bool ok;
 
-  /// Bring the tunnel up with the given wg-quick / wg-config string.
-  /// Throws [PlatformException] with code "START_FAILED" on backend failure.
-  Future<void> start(String name, String config) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start$pigeonVar_messageChannelSuffix';
-    final pigeonVar_channel = BasicMessageChannel<Object?>(
-      pigeonVar_channelName,
-      pigeonChannelCodec,
-      binaryMessenger: pigeonVar_binaryMessenger,
-    );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, config]);
-    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+  /// Backend error message when [ok] is false.
+  String? error;
 
-    _extractReplyValueOrThrow(
-        pigeonVar_replyList,
-        pigeonVar_channelName,
-        isNullValid: true,
-    )
-    ;
+  List<Object?> _toList() {
+    return <Object?>[
+      name,
+      ok,
+      error,
+    ];
   }
 
-  /// Bring the named tunnel down. No-op if already down.
-  Future<void> stop(String name) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop$pigeonVar_messageChannelSuffix';
-    final pigeonVar_channel = BasicMessageChannel<Object?>(
-      pigeonVar_channelName,
-      pigeonChannelCodec,
-      binaryMessenger: pigeonVar_binaryMessenger,
+  Object encode() {
+    return _toList();  }
+
+  static TunnelResult decode(Object result) {
+    result as List<Object?>;
+    return TunnelResult(
+      name: result[0]! as String,
+      ok: result[1]! as bool,
+      error: result[2] as String?,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name]);
-    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+  }
 
-    _extractReplyValueOrThrow(
-        pigeonVar_replyList,
-        pigeonVar_channelName,
-        isNullValid: true,
-    )
-    ;
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! TunnelResult || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(name, other.name) && _deepEquals(ok, other.ok) && _deepEquals(error, other.error);
   }
 
-  /// Returns the current status. Throws if the tunnel was never started.
-  Future<TunnelStatus> status(String name) async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status$pigeonVar_messageChannelSuffix';
-    final pigeonVar_channel = BasicMessageChannel<Object?>(
-      pigeonVar_channelName,
-      pigeonChannelCodec,
-      binaryMessenger: pigeonVar_binaryMessenger,
-    );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name]);
-    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
 
-    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
-        pigeonVar_replyList,
-        pigeonVar_channelName,
-        isNullValid: false,
-    )
-    ;
-    return pigeonVar_replyValue! as TunnelStatus;
+/// Latency percentiles of one step of a tunnel operation.
+class PhaseStats {
+  PhaseStats({
+    required this.op,
+    required this.phase,
+    required this.count,
+    required this.p50Ms,
+    required this.p95Ms,
+    required this.p99Ms,
+  });
+
+  /// Operation the phase belongs to ("start", "stop", "switch", ...).
+  String op;
+
+  /// Step within [op] ("wg_quick_up", "create_service", "total", ...).
+  String phase;
+
+  /// Number of samples recorded since the process started.
+  int count;
+
+  double p50Ms;
+
+  double p95Ms;
+
+  double p99Ms;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      op,
+      phase,
+      count,
+      p50Ms,
+      p95Ms,
+      p99Ms,
+    ];
   }
 
-  /// Returns the names of all currently-known tunnels (including DOWN ones
-  /// that were started in this process lifetime).
-  Future<List<String>> tunnelNames() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames$pigeonVar_messageChannelSuffix';
-    final pigeonVar_channel = BasicMessageChannel<Object?>(
-      pigeonVar_channelName,
-      pigeonChannelCodec,
-      binaryMessenger: pigeonVar_binaryMessenger,
+  Object encode() {
+    return _toList();  }
+
+  static PhaseStats decode(Object result) {
+    result as List<Object?>;
+    return PhaseStats(
+      op: result[0]! as String,
+      phase: result[1]! as String,
+      count: result[2]! as int,
+      p50Ms: result[3]! as double,
+      p95Ms: result[4]! as double,
+      p99Ms: result[5]! as double,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
-    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+  }
 
-    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
-        pigeonVar_replyList,
-        pigeonVar_channelName,
-        isNullValid: false,
-    )
-    ;
-    return (pigeonVar_replyValue! as List<Object?>).cast<String>();
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! PhaseStats || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(op, other.op) && _deepEquals(phase, other.phase) && _deepEquals(count, other.count) && _deepEquals(p50Ms, other.p50Ms) && _deepEquals(p95Ms, other.p95Ms) && _deepEquals(p99Ms, other.p99Ms);
   }
 
-  /// Returns the active backend.
-  Future<BackendInfo> backend() async {
-    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend$pigeonVar_messageChannelSuffix';
-    final pigeonVar_channel = BasicMessageChannel<Object?>(
-      pigeonVar_channelName,
-      pigeonChannelCodec,
-      binaryMessenger: pigeonVar_binaryMessenger,
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+/// A peer of a running tunnel crossing the handshake-age threshold.
+class TunnelHealth {
+  TunnelHealth({
+    required this.name,
+    required this.publicKey,
+    required this.state,
+    required this.lastHandshake,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  String name;
+
+  /// Base64 public key of the peer; "" where the platform only reports the
+  /// tunnel as a whole (Windows).
+  String publicKey;
+
+  TunnelHealthState state;
+
+  /// Epoch milliseconds of the handshake [state] was judged by (0 if none).
+  int lastHandshake;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      name,
+      publicKey,
+      state,
+      lastHandshake,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static TunnelHealth decode(Object result) {
+    result as List<Object?>;
+    return TunnelHealth(
+      name: result[0]! as String,
+      publicKey: result[1]! as String,
+      state: result[2]! as TunnelHealthState,
+      lastHandshake: result[3]! as int,
     );
-    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
-    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+  }
 
-    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
-        pigeonVar_replyList,
-        pigeonVar_channelName,
-        isNullValid: false,
-    )
-    ;
-    return pigeonVar_replyValue! as BackendInfo;
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! TunnelHealth || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(name, other.name) && _deepEquals(publicKey, other.publicKey) && _deepEquals(state, other.state) && _deepEquals(lastHandshake, other.lastHandshake);
   }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
 }
 
-/// Platform -> host events.
-abstract class WireguardFlutterApi {
-  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+/// A WireGuard keypair generated natively.
+class KeyPairData {
+  KeyPairData({
+    required this.privateKey,
+    required this.publicKey,
+  });
 
-  /// Pushed whenever a tunnel changes state or its statistics tick.
-  void onTunnelStatus(TunnelStatus status);
+  /// Base64, as `wg genkey` prints it.
+  String privateKey;
 
-  static void setUp(WireguardFlutterApi? api, {BinaryMessenger? binaryMessenger, String messageChannelSuffix = '',}) {
+  /// Base64, as `wg pubkey` prints it.
+  String publicKey;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      privateKey,
+      publicKey,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static KeyPairData decode(Object result) {
+    result as List<Object?>;
+    return KeyPairData(
+      privateKey: result[0]! as String,
+      publicKey: result[1]! as String,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! KeyPairData || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(privateKey, other.privateKey) && _deepEquals(publicKey, other.publicKey);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+/// One peer of a running tunnel, as of the last status poll.
+class PeerStatus {
+  PeerStatus({
+    required this.publicKey,
+    this.endpoint,
+    required this.rx,
+    required this.tx,
+    required this.lastHandshake,
+    required this.persistentKeepalive,
+  });
+
+  /// Base64 public key.
+  String publicKey;
+
+  /// "host:port" the peer was last heard from, null if none yet.
+  String? endpoint;
+
+  /// Bytes received from the peer.
+  int rx;
+
+  /// Bytes sent to the peer.
+  int tx;
+
+  /// Epoch milliseconds of the latest handshake, 0 if none.
+  int lastHandshake;
+
+  /// Seconds; 0 when off.
+  int persistentKeepalive;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      publicKey,
+      endpoint,
+      rx,
+      tx,
+      lastHandshake,
+      persistentKeepalive,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static PeerStatus decode(Object result) {
+    result as List<Object?>;
+    return PeerStatus(
+      publicKey: result[0]! as String,
+      endpoint: result[1] as String?,
+      rx: result[2]! as int,
+      tx: result[3]! as int,
+      lastHandshake: result[4]! as int,
+      persistentKeepalive: result[5]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! PeerStatus || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(publicKey, other.publicKey) && _deepEquals(endpoint, other.endpoint) && _deepEquals(rx, other.rx) && _deepEquals(tx, other.tx) && _deepEquals(lastHandshake, other.lastHandshake) && _deepEquals(persistentKeepalive, other.persistentKeepalive);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+/// One peer's share of a [TunnelUsage].
+class PeerUsage {
+  PeerUsage({
+    required this.publicKey,
+    required this.rx,
+    required this.tx,
+  });
+
+  /// Base64 public key.
+  String publicKey;
+
+  /// Bytes received from the peer.
+  int rx;
+
+  /// Bytes sent to the peer.
+  int tx;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      publicKey,
+      rx,
+      tx,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static PeerUsage decode(Object result) {
+    result as List<Object?>;
+    return PeerUsage(
+      publicKey: result[0]! as String,
+      rx: result[1]! as int,
+      tx: result[2]! as int,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! PeerUsage || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(publicKey, other.publicKey) && _deepEquals(rx, other.rx) && _deepEquals(tx, other.tx);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+/// Data a tunnel used over a period, across restarts of the tunnel and of
+/// the app.
+class TunnelUsage {
+  TunnelUsage({
+    required this.name,
+    required this.since,
+    required this.rx,
+    required this.tx,
+    required this.peers,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  String name;
+
+  /// Epoch milliseconds the usage is counted from, as asked.
+  int since;
+
+  /// Bytes received over the tunnel.
+  int rx;
+
+  /// Bytes sent over the tunnel.
+  int tx;
+
+  /// Peers that carried traffic in the period.
+  List<PeerUsage> peers;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      name,
+      since,
+      rx,
+      tx,
+      peers,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static TunnelUsage decode(Object result) {
+    result as List<Object?>;
+    return TunnelUsage(
+      name: result[0]! as String,
+      since: result[1]! as int,
+      rx: result[2]! as int,
+      tx: result[3]! as int,
+      peers: (result[4]! as List<Object?>).cast<PeerUsage>(),
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! TunnelUsage || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(name, other.name) && _deepEquals(since, other.since) && _deepEquals(rx, other.rx) && _deepEquals(tx, other.tx) && _deepEquals(peers, other.peers);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+/// A tunnel that reached its usage quota.
+class UsageQuotaExceeded {
+  UsageQuotaExceeded({
+    required this.name,
+    required this.limit,
+    required this.used,
+    required this.since,
+    required this.stopped,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  String name;
+
+  /// The quota, in bytes of rx + tx.
+  int limit;
+
+  /// Bytes of rx + tx used since [since] when the quota was noticed.
+  int used;
+
+  /// Epoch milliseconds the quota counts from.
+  int since;
+
+  /// Whether the tunnel was stopped; false if stopping it failed.
+  bool stopped;
+
+  List<Object?> _toList() {
+    return <Object?>[
+      name,
+      limit,
+      used,
+      since,
+      stopped,
+    ];
+  }
+
+  Object encode() {
+    return _toList();  }
+
+  static UsageQuotaExceeded decode(Object result) {
+    result as List<Object?>;
+    return UsageQuotaExceeded(
+      name: result[0]! as String,
+      limit: result[1]! as int,
+      used: result[2]! as int,
+      since: result[3]! as int,
+      stopped: result[4]! as bool,
+    );
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  bool operator ==(Object other) {
+    if (other is! UsageQuotaExceeded || other.runtimeType != runtimeType) {
+      return false;
+    }
+    if (identical(this, other)) {
+      return true;
+    }
+    return _deepEquals(name, other.name) && _deepEquals(limit, other.limit) && _deepEquals(used, other.used) && _deepEquals(since, other.since) && _deepEquals(stopped, other.stopped);
+  }
+
+  @override
+  // ignore: avoid_equals_and_hash_code_on_mutable_classes
+  int get hashCode => _deepHash(<Object?>[runtimeType, ..._toList()]);
+}
+
+
+class _PigeonCodec extends StandardMessageCodec {
+  const _PigeonCodec();
+  @override
+  void writeValue(WriteBuffer buffer, Object? value) {
+    if (value is int) {
+      buffer.putUint8(4);
+      buffer.putInt64(value);
+    }    else if (value is TunnelState) {
+      buffer.putUint8(129);
+      writeValue(buffer, value.index);
+    }    else if (value is BackendKind) {
+      buffer.putUint8(130);
+      writeValue(buffer, value.index);
+    }    else if (value is TunnelHealthState) {
+      buffer.putUint8(131);
+      writeValue(buffer, value.index);
+    }    else if (value is TunnelStatus) {
+      buffer.putUint8(132);
+      writeValue(buffer, value.encode());
+    }    else if (value is BackendInfo) {
+      buffer.putUint8(133);
+      writeValue(buffer, value.encode());
+    }    else if (value is TunnelSpec) {
+      buffer.putUint8(134);
+      writeValue(buffer, value.encode());
+    }    else if (value is TunnelResult) {
+      buffer.putUint8(135);
+      writeValue(buffer, value.encode());
+    }    else if (value is PhaseStats) {
+      buffer.putUint8(136);
+      writeValue(buffer, value.encode());
+    }    else if (value is TunnelHealth) {
+      buffer.putUint8(137);
+      writeValue(buffer, value.encode());
+    }    else if (value is KeyPairData) {
+      buffer.putUint8(138);
+      writeValue(buffer, value.encode());
+    }    else if (value is PeerStatus) {
+      buffer.putUint8(139);
+      writeValue(buffer, value.encode());
+    }    else if (value is PeerUsage) {
+      buffer.putUint8(140);
+      writeValue(buffer, value.encode());
+    }    else if (value is TunnelUsage) {
+      buffer.putUint8(141);
+      writeValue(buffer, value.encode());
+    }    else if (value is UsageQuotaExceeded) {
+      buffer.putUint8(142);
+      writeValue(buffer, value.encode());
+    } else {
+      super.writeValue(buffer, value);
+    }
+  }
+
+  @override
+  Object? readValueOfType(int type, ReadBuffer buffer) {
+    switch (type) {
+      case 129:
+        final value = readValue(buffer) as int?;
+        return value == null ? null : TunnelState.values[value];
+      case 130:
+        final value = readValue(buffer) as int?;
+        return value == null ? null : BackendKind.values[value];
+      case 131:
+        final value = readValue(buffer) as int?;
+        return value == null ? null : TunnelHealthState.values[value];
+      case 132:
+        return TunnelStatus.decode(readValue(buffer)!);
+      case 133:
+        return BackendInfo.decode(readValue(buffer)!);
+      case 134:
+        return TunnelSpec.decode(readValue(buffer)!);
+      case 135:
+        return TunnelResult.decode(readValue(buffer)!);
+      case 136:
+        return PhaseStats.decode(readValue(buffer)!);
+      case 137:
+        return TunnelHealth.decode(readValue(buffer)!);
+      case 138:
+        return KeyPairData.decode(readValue(buffer)!);
+      case 139:
+        return PeerStatus.decode(readValue(buffer)!);
+      case 140:
+        return PeerUsage.decode(readValue(buffer)!);
+      case 141:
+        return TunnelUsage.decode(readValue(buffer)!);
+      case 142:
+        return UsageQuotaExceeded.decode(readValue(buffer)!);
+      default:
+        return super.readValueOfType(type, buffer);
+    }
+  }
+}
+
+/// Host -> platform calls. All implementations must be reentrant and may be
+/// called from any isolate / thread.
+class WireguardHostApi {
+  /// Constructor for [WireguardHostApi].  The [binaryMessenger] named argument is
+  /// available for dependency injection.  If it is left null, the default
+  /// BinaryMessenger will be used which routes to the host platform.
+  WireguardHostApi({BinaryMessenger? binaryMessenger, String messageChannelSuffix = ''})
+      : pigeonVar_binaryMessenger = binaryMessenger,
+        pigeonVar_messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
+  final BinaryMessenger? pigeonVar_binaryMessenger;
+
+  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+
+  final String pigeonVar_messageChannelSuffix;
+
+  /// Bring the tunnel up with the given wg-quick / wg-config string.
+  /// Throws [PlatformException] with code "START_FAILED" on backend failure.
+  Future<void> start(String name, String config) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, config]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+  }
+
+  /// Bring the named tunnel down. No-op if already down.
+  Future<void> stop(String name) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+  }
+
+  /// Returns the current status. Throws if the tunnel was never started.
+  Future<TunnelStatus> status(String name) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as TunnelStatus;
+  }
+
+  /// Returns the names of all currently-known tunnels (including DOWN ones
+  /// that were started in this process lifetime).
+  Future<List<String>> tunnelNames() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<String>();
+  }
+
+  /// Returns the active backend.
+  Future<BackendInfo> backend() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as BackendInfo;
+  }
+
+  /// Bring several tunnels up at once. Independent tunnels are brought up
+  /// concurrently where the platform allows it; one failure does not abort
+  /// the rest. Results come back in input order.
+  Future<List<TunnelResult>> startMany(List<TunnelSpec> specs) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.startMany$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[specs]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<TunnelResult>();
+  }
+
+  /// Bring several tunnels down at once. Unknown names count as success.
+  Future<List<TunnelResult>> stopMany(List<String> names) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stopMany$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[names]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<TunnelResult>();
+  }
+
+  /// Replace tunnel [from] with [to] (configured by [config]) without a
+  /// connectivity gap: [to] comes up and completes a handshake before
+  /// traffic moves over and [from] goes down. If [to] fails, [from] is left
+  /// untouched and "SWITCH_FAILED" is thrown.
+  Future<void> switchTunnel(String from, String to, String config) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.switchTunnel$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[from, to, config]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+  }
+
+  /// Per-phase timings of every Start/Stop since the backend started, for
+  /// telling where a slow connect spent its time.
+  Future<List<PhaseStats>> diagnostics() async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.diagnostics$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(null);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<PhaseStats>();
+  }
+
+  /// Write the native trace buffers to [path] as Chrome trace JSON. Only
+  /// available in builds with trace points compiled in; throws
+  /// "TRACE_FAILED" otherwise.
+  Future<void> dumpTrace(String path) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.dumpTrace$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[path]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+  }
+
+  /// Public key of the peer tunnel [name] would route [ipAddress] to: the
+  /// longest AllowedIPs prefix containing it, as the kernel picks. Null if no
+  /// peer covers it. Throws "LOOKUP_FAILED" for an unknown tunnel or a
+  /// malformed address.
+  Future<String?> lookupPeer(String name, String ipAddress) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeer$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, ipAddress]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+    return pigeonVar_replyValue as String?;
+  }
+
+  /// [lookupPeer] for many addresses at once; results match [ipAddresses] in
+  /// order.
+  Future<List<String?>> lookupPeers(String name, List<String> ipAddresses) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeers$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, ipAddresses]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<String?>();
+  }
+
+  /// The addresses in [include] but not in [exclude], as the fewest CIDR
+  /// prefixes (IPv4 first, each family in address order). Throws
+  /// "ALLOWED_IPS_FAILED" for a malformed prefix.
+  Future<List<String>> computeAllowedIps(List<String> include, List<String> exclude) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.computeAllowedIps$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[include, exclude]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<String>();
+  }
+
+  /// Looks up the hostnames in the peer Endpoints of tunnel [name] again and
+  /// moves the peers whose address changed. Returns how many moved. Throws
+  /// "RESOLVE_FAILED".
+  Future<int> reresolveEndpoints(String name) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.reresolveEndpoints$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as int;
+  }
+
+  /// Handshake age, in seconds, after which a peer is reported
+  /// [TunnelHealthState.stale]. Defaults to 180; values below 1 are raised to 1.
+  Future<void> setStaleAfter(int seconds) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setStaleAfter$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[seconds]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+  }
+
+  /// [count] fresh keypairs from the platform CSPRNG, derived off the platform
+  /// thread. Throws "KEYS_FAILED" for a negative or too-large [count].
+  Future<List<KeyPairData>> generateKeyPairs(int count) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.generateKeyPairs$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[count]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<KeyPairData>();
+  }
+
+  /// The public key of each of [privateKeys], in order. Throws "KEYS_FAILED"
+  /// naming the first key that is not 32 bytes of base64.
+  Future<List<String>> publicKeysFromPrivate(List<String> privateKeys) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.publicKeysFromPrivate$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[privateKeys]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return (pigeonVar_replyValue! as List<Object?>).cast<String>();
+  }
+
+  /// The peer of tunnel [name] with [publicKey], as of the last status poll;
+  /// null if the tunnel has no such peer. Throws "PEER_FAILED" for an unknown
+  /// tunnel or a malformed key.
+  Future<PeerStatus?> peerByPublicKey(String name, String publicKey) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.peerByPublicKey$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, publicKey]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: true,
+    )
+    ;
+    return pigeonVar_replyValue as PeerStatus?;
+  }
+
+  /// Data tunnel [name] used since [since] (epoch milliseconds), from the
+  /// persistent usage ledger. Throws "USAGE_FAILED" for an invalid name or
+  /// when the ledger is unavailable.
+  Future<TunnelUsage> usage(String name, int since) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.usage$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, since]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as TunnelUsage;
+  }
+
+  /// Stops tunnel [name] once its rx + tx since [since] reaches [limitBytes],
+  /// reporting it through [WireguardFlutterApi.onUsageQuota]; a [limitBytes] of
+  /// 0 removes the quota. Returns the bytes already used. Throws
+  /// "USAGE_FAILED" like [usage].
+  Future<int> setUsageQuota(String name, int limitBytes, int since) async {
+    final pigeonVar_channelName = 'dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setUsageQuota$pigeonVar_messageChannelSuffix';
+    final pigeonVar_channel = BasicMessageChannel<Object?>(
+      pigeonVar_channelName,
+      pigeonChannelCodec,
+      binaryMessenger: pigeonVar_binaryMessenger,
+    );
+    final Future<Object?> pigeonVar_sendFuture = pigeonVar_channel.send(<Object?>[name, limitBytes, since]);
+    final pigeonVar_replyList = await pigeonVar_sendFuture as List<Object?>?;
+
+    final Object? pigeonVar_replyValue = _extractReplyValueOrThrow(
+        pigeonVar_replyList,
+        pigeonVar_channelName,
+        isNullValid: false,
+    )
+    ;
+    return pigeonVar_replyValue! as int;
+  }
+}
+
+/// Platform -> host events.
+abstract class WireguardFlutterApi {
+  static const MessageCodec<Object?> pigeonChannelCodec = _PigeonCodec();
+
+  /// Pushed whenever a tunnel changes state or its statistics tick.
+  void onTunnelStatus(TunnelStatus status);
+
+  /// Pushed the moment a peer of a running tunnel connects, goes stale or
+  /// recovers.
+  void onTunnelHealth(TunnelHealth health);
+
+  /// Pushed once when a tunnel reaches the quota set with
+  /// [WireguardHostApi.setUsageQuota], after it was stopped.
+  void onUsageQuota(UsageQuotaExceeded event);
+
+  static void setUp(WireguardFlutterApi? api, {BinaryMessenger? binaryMessenger, String messageChannelSuffix = '',}) {
     messageChannelSuffix = messageChannelSuffix.isNotEmpty ? '.$messageChannelSuffix' : '';
     {
       final pigeonVar_channel = BasicMessageChannel<Object?>(
@@ -428,5 +1359,47 @@ abstract class WireguardFlutterApi {
         });
       }
     }
+    {
+      final pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          final List<Object?> args = message! as List<Object?>;
+          final TunnelHealth arg_health = args[0]! as TunnelHealth;
+          try {
+            api.onTunnelHealth(arg_health);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
+    {
+      final pigeonVar_channel = BasicMessageChannel<Object?>(
+          'dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onUsageQuota$messageChannelSuffix', pigeonChannelCodec,
+          binaryMessenger: binaryMessenger);
+      if (api == null) {
+        pigeonVar_channel.setMessageHandler(null);
+      } else {
+        pigeonVar_channel.setMessageHandler((Object? message) async {
+          final List<Object?> args = message! as List<Object?>;
+          final UsageQuotaExceeded arg_event = args[0]! as UsageQuotaExceeded;
+          try {
+            api.onUsageQuota(arg_event);
+            return wrapResponse(empty: true);
+          } on PlatformException catch (e) {
+            return wrapResponse(error: e);
+          }          catch (e) {
+            return wrapResponse(error: PlatformException(code: 'error', message: e.toString()));
+          }
+        });
+      }
+    }
   }
 }
@@ -0,0 +1,109 @@
+// Benchmarks for lookupPeer's AllowedIPs index (cpp/allowed_ips.h): lookups
+// against tables of up to 100k prefixes, and the cost of building one from
+// a config at Start.
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "allowed_ips.h"
+
+namespace fwg = flutter_wireguard;
+
+namespace {
+
+constexpr int kPrefixesPerPeer = 10;
+
+// A config with `prefixes` AllowedIPs spread over prefixes/10 peers: /16../32
+// for IPv4, /32../128 for IPv6, random enough that the trie branches the
+// way a real fleet's would.
+std::string MakeConfig(int prefixes, bool v6, uint64_t seed = 1) {
+  std::mt19937_64 rng(seed);
+  std::string out = "[Interface]\nPrivateKey = x\n";
+  for (int i = 0; i < prefixes; ++i) {
+    if (i % kPrefixesPerPeer == 0) {
+      out += "[Peer]\nPublicKey = peer" + std::to_string(i / kPrefixesPerPeer) +
+             "\nAllowedIPs = ";
+    } else {
+      out += ", ";
+    }
+    const uint64_t r = rng();
+    if (v6) {
+      char buf[64];
+      std::snprintf(buf, sizeof(buf), "2001:db8:%x:%x:%x::/%d",
+                    static_cast<unsigned>(r & 0xffff),
+                    static_cast<unsigned>(r >> 16 & 0xffff),
+                    static_cast<unsigned>(r >> 32 & 0xffff),
+                    32 + static_cast<int>(r >> 48) % 49);
+      out += buf;
+    } else {
+      out += "10." + std::to_string(r & 0xff) + "." + std::to_string(r >> 8 & 0xff) +
+             "." + std::to_string(r >> 16 & 0xff) + "/" +
+             std::to_string(16 + static_cast<int>(r >> 24) % 17);
+    }
+    if (i % kPrefixesPerPeer == kPrefixesPerPeer - 1) out += "\n";
+  }
+  return out + "\n";
+}
+
+// Destinations inside 10.0.0.0/8 or 2001:db8::/32, so most lookups descend
+// deep into the trie instead of missing at the root.
+std::vector<fwg::IpKey> MakeProbes(bool v6) {
+  std::mt19937_64 rng(2);
+  std::vector<fwg::IpKey> out(4096);
+  for (auto& k : out) {
+    k = v6 ? fwg::IpKey{0x20010db800000000ULL | (rng() >> 32), rng()}
+           : fwg::IpKey{(0x0a000000ULL | (rng() & 0xffffff)) << 32, 0};
+  }
+  return out;
+}
+
+void BM_AllowedIpsLookup(benchmark::State& state) {
+  const bool v6 = state.range(1) != 0;
+  const auto table = fwg::AllowedIpsTable::FromConfig(
+      MakeConfig(static_cast<int>(state.range(0)), v6));
+  const auto probes = MakeProbes(v6);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.Lookup(probes[i++ & 4095], v6));
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetLabel(v6 ? "ipv6" : "ipv4");
+}
+BENCHMARK(BM_AllowedIpsLookup)
+    ->Args({1000, 0})->Args({100000, 0})
+    ->Args({1000, 1})->Args({100000, 1});
+
+// lookupPeer's per-address cost as seen from Dart: parse the text, then
+// look it up.
+void BM_AllowedIpsLookupText(benchmark::State& state) {
+  const auto table = fwg::AllowedIpsTable::FromConfig(MakeConfig(100000, false));
+  std::vector<std::string> probes;
+  for (const auto& k : MakeProbes(false)) {
+    const uint32_t a = static_cast<uint32_t>(k.hi >> 32);
+    probes.push_back(std::to_string(a >> 24) + "." + std::to_string(a >> 16 & 0xff) +
+                     "." + std::to_string(a >> 8 & 0xff) + "." +
+                     std::to_string(a & 0xff));
+  }
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(table.Lookup(probes[i++ & 4095]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AllowedIpsLookupText);
+
+void BM_AllowedIpsFromConfig(benchmark::State& state) {
+  const std::string config = MakeConfig(static_cast<int>(state.range(0)), false);
+  for (auto _ : state) {
+    auto table = fwg::AllowedIpsTable::FromConfig(config);
+    benchmark::DoNotOptimize(table.prefix_count());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AllowedIpsFromConfig)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,58 @@
+// Benchmarks for computeAllowedIps (cpp/cidr_set.h): aggregating and
+// subtracting 100k-prefix lists, text in and text out as the HostApi does.
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cidr_set.h"
+
+namespace fwg = flutter_wireguard;
+
+namespace {
+
+// `n` random IPv4 prefixes, /12../32, as AllowedIPs text.
+std::vector<std::string> MakePrefixes(int n, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  std::vector<std::string> out;
+  out.reserve(n);
+  for (int i = 0; i < n; ++i) {
+    const uint64_t r = rng();
+    out.push_back(std::to_string(r & 0xff) + "." + std::to_string(r >> 8 & 0xff) + "." +
+                  std::to_string(r >> 16 & 0xff) + "." + std::to_string(r >> 24 & 0xff) +
+                  "/" + std::to_string(12 + static_cast<int>(r >> 32 & 0xffff) % 21));
+  }
+  return out;
+}
+
+void BM_CidrAggregate(benchmark::State& state) {
+  const auto include = MakePrefixes(static_cast<int>(state.range(0)), 1);
+  size_t prefixes = 0;
+  for (auto _ : state) {
+    auto out = fwg::CidrSet::Parse(include).ToStrings();
+    prefixes = out.size();
+    benchmark::DoNotOptimize(out);
+  }
+  state.counters["prefixes_out"] = static_cast<double>(prefixes);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CidrAggregate)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+// computeAllowedIps(include, exclude) with 100k prefixes on each side.
+void BM_CidrSubtract(benchmark::State& state) {
+  const auto include = MakePrefixes(static_cast<int>(state.range(0)), 1);
+  const auto exclude = MakePrefixes(static_cast<int>(state.range(0)), 2);
+  size_t prefixes = 0;
+  for (auto _ : state) {
+    auto out = fwg::CidrSet::Parse(include).Subtract(fwg::CidrSet::Parse(exclude)).ToStrings();
+    prefixes = out.size();
+    benchmark::DoNotOptimize(out);
+  }
+  state.counters["prefixes_out"] = static_cast<double>(prefixes);
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(BM_CidrSubtract)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+}  // namespace
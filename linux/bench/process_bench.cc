@@ -0,0 +1,65 @@
+// Spawn latency: a fresh process per call through RealProcessRunner versus
+// one request on the persistent elevated shell loop.
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "privileged_session.h"
+#include "process_runner.h"
+
+namespace fwg = flutter_wireguard;
+
+namespace {
+
+void BM_ProcessRunnerSpawn(benchmark::State& state) {
+  fwg::RealProcessRunner runner;
+  for (auto _ : state) {
+    auto r = runner.Run({"true"}, {}, std::nullopt);
+    if (r.exit_code != 0) {
+      state.SkipWithError("`true` failed");
+      break;
+    }
+  }
+}
+BENCHMARK(BM_ProcessRunnerSpawn)->UseRealTime();
+
+void BM_ProcessRunnerCapture(benchmark::State& state) {
+  // stdin in, stdout back: the shape of every wg / wg-quick call.
+  fwg::RealProcessRunner runner;
+  const std::string input(static_cast<size_t>(state.range(0)), 'x');
+  for (auto _ : state) {
+    auto r = runner.Run({"cat"}, {}, input);
+    if (r.stdout_data.size() != input.size()) {
+      state.SkipWithError("short read from cat");
+      break;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ProcessRunnerCapture)->Arg(64)->Arg(4096)->UseRealTime();
+
+// FLUTTER_WIREGUARD_ELEVATE=env wraps the shell loop in `env`, which execs
+// straight into `sh`: the full pipe protocol with no prompt. Each SHOW runs
+// `wg show` inside the loop (not installed is fine; the shell still forks),
+// so compare against BM_ProcessRunnerSpawn for the per-call overhead the
+// persistent session saves. As root the session bypasses the loop and execs
+// directly; the label says which path was measured.
+void BM_PrivilegedSessionRoundTrip(benchmark::State& state) {
+  ::setenv("FLUTTER_WIREGUARD_ELEVATE", "env", 1);
+  fwg::RealPrivilegedSession session(
+      std::make_shared<fwg::RealProcessRunner>());
+  ::unsetenv("FLUTTER_WIREGUARD_ELEVATE");
+  session.ShowDump("fwgbench0");  // spawn the loop outside the timed region
+  for (auto _ : state) {
+    auto r = session.ShowDump("fwgbench0");
+    benchmark::DoNotOptimize(r.exit_code);
+  }
+  state.SetLabel(::geteuid() == 0 ? "direct (root)" : "shell loop");
+}
+BENCHMARK(BM_PrivilegedSessionRoundTrip)->UseRealTime();
+
+}  // namespace
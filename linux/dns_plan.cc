@@ -0,0 +1,64 @@
+#include "dns_plan.h"
+
+#include <cctype>
+#include <sstream>
+#include <utility>
+
+namespace flutter_wireguard {
+
+namespace {
+
+std::string Trim(const std::string& s) {
+  const size_t b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos) return "";
+  return s.substr(b, s.find_last_not_of(" \t\r") - b + 1);
+}
+
+std::string Lower(std::string s) {
+  for (char& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return s;
+}
+
+}  // namespace
+
+bool TakeOverDns(const std::string& config, std::string* wg_quick_config,
+                 DnsPlan* plan) {
+  DnsPlan p;
+  bool saw_dns = false;
+  bool in_interface = false;
+  std::string out;
+  std::istringstream in(config);
+  std::string line;
+  while (std::getline(in, line)) {
+    const std::string body = line.substr(0, line.find('#'));
+    const size_t eq = body.find('=');
+    const std::string key = Lower(Trim(body.substr(0, eq)));
+    if (!key.empty() && key[0] == '[') {
+      in_interface = key == "[interface]";
+    } else if (in_interface && (key == "preup" || key == "postup")) {
+      return false;
+    } else if (in_interface && key == "dns" && eq != std::string::npos) {
+      saw_dns = true;
+      std::istringstream items(body.substr(eq + 1));
+      std::string item;
+      while (std::getline(items, item, ',')) {
+        item = Trim(item);
+        if (item.empty()) continue;
+        DnsServer server;
+        if (ParseIpAddress(item, &server.address, &server.v6)) {
+          p.servers.push_back(server);
+        } else {
+          p.domains.push_back(item);
+        }
+      }
+      continue;
+    }
+    out += line + "\n";
+  }
+  if (!saw_dns) return false;
+  *wg_quick_config = std::move(out);
+  *plan = std::move(p);
+  return true;
+}
+
+}  // namespace flutter_wireguard
@@ -0,0 +1,40 @@
+// A tunnel's `DNS =` settings, taken away from wg-quick.
+//
+// For `DNS =` wg-quick pipes the servers into `resolvconf -a tun.<iface>
+// -m 0 -x`, which on most desktops is systemd's resolvectl shim: another
+// fork and exec chain on every Start, and a matching `resolvconf -d` on
+// Stop. When systemd-resolved is reachable over D-Bus, WgBackend strips the
+// DNS lines before wg-quick sees them and hands the DnsPlan to
+// ResolvedDns (resolved_dns.h) once the link exists. Otherwise the config
+// goes to wg-quick unchanged and resolvconf does the work as before.
+#ifndef FLUTTER_WIREGUARD_DNS_PLAN_H_
+#define FLUTTER_WIREGUARD_DNS_PLAN_H_
+
+#include <string>
+#include <vector>
+
+#include "allowed_ips.h"
+
+namespace flutter_wireguard {
+
+struct DnsServer {
+  IpKey address;
+  bool v6 = false;
+};
+
+struct DnsPlan {
+  std::vector<DnsServer> servers;
+  std::vector<std::string> domains;  // search domains, in config order
+};
+
+// If `config`'s [Interface] has DNS lines, splits them into *plan the way
+// wg-quick does (IP addresses are servers, anything else a search domain),
+// sets *wg_quick_config to `config` without them and returns true.
+// Declines a config without DNS, and one with PreUp/PostUp hooks, which
+// may expect resolvconf to have run. `wg_quick_config` may be `&config`.
+bool TakeOverDns(const std::string& config, std::string* wg_quick_config,
+                 DnsPlan* plan);
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_DNS_PLAN_H_
@@ -0,0 +1,71 @@
+#include "endpoint_failover.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace flutter_wireguard {
+
+void EndpointFailover::Track(
+    const std::string& name,
+    std::map<std::string, std::vector<std::string>> candidates) {
+  std::map<std::string, Peer> peers;
+  for (auto& [key, list] : candidates) {
+    if (list.size() > 1) peers[key].candidates = std::move(list);
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  if (peers.empty()) {
+    tunnels_.erase(name);
+  } else {
+    tunnels_[name] = std::move(peers);
+  }
+}
+
+void EndpointFailover::Forget(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mu_);
+  tunnels_.erase(name);
+}
+
+std::vector<PeerEndpoint> EndpointFailover::Next(
+    const std::string& name, const std::vector<std::string>& stale,
+    const std::vector<PeerHandshake>& peers, int64_t now_ms) {
+  std::vector<PeerEndpoint> out;
+  std::lock_guard<std::mutex> lock(mu_);
+  auto t = tunnels_.find(name);
+  if (t == tunnels_.end()) return out;
+  for (auto& [key, peer] : t->second) {
+    int64_t handshake = 0;
+    for (const auto& p : peers) {
+      if (p.public_key == key) handshake = p.handshake_ms;
+    }
+    if (peer.moved_ms != 0 && handshake >= peer.moved_ms) {
+      peer.moved_ms = 0;  // the server it was moved to answered
+      peer.moves = 0;
+    }
+    bool move;
+    if (std::find(stale.begin(), stale.end(), key) != stale.end()) {
+      peer.moves = 0;
+      move = true;
+    } else {
+      move = peer.moved_ms != 0 && peer.moves < peer.candidates.size() &&
+             now_ms - peer.moved_ms >= kRetryAfterMs;
+    }
+    if (!move) continue;
+    peer.current = (peer.current + 1) % peer.candidates.size();
+    peer.moved_ms = now_ms;
+    ++peer.moves;
+    out.push_back({key, peer.candidates[peer.current]});
+  }
+  return out;
+}
+
+std::string EndpointFailover::Current(const std::string& name,
+                                      const std::string& public_key) const {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto t = tunnels_.find(name);
+  if (t == tunnels_.end()) return "";
+  auto p = t->second.find(public_key);
+  if (p == t->second.end()) return "";
+  return p->second.candidates[p->second.current];
+}
+
+}  // namespace flutter_wireguard
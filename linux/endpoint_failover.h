@@ -0,0 +1,75 @@
+// Moving a peer to its next server when the current one stops answering.
+//
+// A [Peer] may list several endpoints, most preferred first:
+//
+//   Endpoint = vpn1.example.com:51820, vpn2.example.com:51820, 192.0.2.7:51820
+//
+// wg-quick is given the first (WithPrimaryEndpoints). When the handshake
+// monitor reports the peer stale, the status poller asks EndpointFailover
+// for the next candidate and WgBackend::FailOver applies it with one UAPI
+// set (userspace) or one `wg set` (kernel) for all of the tunnel's moving
+// peers. The link stays up throughout, so addresses, routes, DNS and the
+// other peers are untouched; the next packet, or keepalive, handshakes with
+// the new server.
+//
+// A candidate that has not produced a handshake kRetryAfterMs after it was
+// applied gives way to the one after it. After one pass through the list
+// the peer is back on the candidate that went stale and stays there until
+// it handshakes or goes stale again, so an idle peer (no traffic, no
+// PersistentKeepalive) is not rotated forever.
+#ifndef FLUTTER_WIREGUARD_ENDPOINT_FAILOVER_H_
+#define FLUTTER_WIREGUARD_ENDPOINT_FAILOVER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "endpoint_resolver.h"
+#include "handshake_monitor.h"
+
+namespace flutter_wireguard {
+
+class EndpointFailover {
+ public:
+  // REKEY_TIMEOUT (5 s) is how long WireGuard waits for a handshake answer
+  // before it retries; one missed answer, plus a poll, and we move on.
+  static constexpr int64_t kRetryAfterMs = 6000;
+
+  // `name` came up with `candidates` (CandidateEndpoints), the first of
+  // each applied. Replaces whatever was tracked for it.
+  void Track(const std::string& name,
+             std::map<std::string, std::vector<std::string>> candidates);
+  void Forget(const std::string& name);
+
+  // One poll of running tunnel `name`. Every peer in `stale` starts a pass
+  // on its next candidate; a peer already in a pass moves on if it has not
+  // handshaken within kRetryAfterMs of its last move. `peers` are this
+  // poll's handshakes. Returns the moves to make, endpoints as written in
+  // the config, in public-key order; empty for untracked tunnels and peers.
+  std::vector<PeerEndpoint> Next(const std::string& name,
+                                 const std::vector<std::string>& stale,
+                                 const std::vector<PeerHandshake>& peers,
+                                 int64_t now_ms);
+
+  // The candidate `public_key` of `name` is on, or "" if it has none.
+  std::string Current(const std::string& name,
+                      const std::string& public_key) const;
+
+ private:
+  struct Peer {
+    std::vector<std::string> candidates;
+    size_t current = 0;
+    int64_t moved_ms = 0;  // 0 = not in a pass
+    size_t moves = 0;      // in this pass
+  };
+
+  mutable std::mutex mu_;
+  std::map<std::string, std::map<std::string, Peer>> tunnels_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_ENDPOINT_FAILOVER_H_
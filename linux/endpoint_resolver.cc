@@ -0,0 +1,278 @@
+#include "endpoint_resolver.h"
+
+#include <netdb.h>
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "allowed_ips.h"
+#include "trace_buffer.h"
+
+namespace flutter_wireguard {
+
+namespace {
+
+std::string Trim(const std::string& s) {
+  const size_t b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos) return "";
+  return s.substr(b, s.find_last_not_of(" \t\r") - b + 1);
+}
+
+std::string Lower(std::string s) {
+  for (char& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return s;
+}
+
+class GetAddrInfoResolver : public HostResolver {
+ public:
+  std::string Resolve(const std::string& host, const std::string& port) override {
+    // wg's own hints, so the answer is the one it would have picked.
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_protocol = IPPROTO_UDP;
+    addrinfo* res = nullptr;
+    const int rc = ::getaddrinfo(host.c_str(), port.c_str(), &hints, &res);
+    if (rc != 0) throw std::runtime_error(host + ": " + ::gai_strerror(rc));
+    char addr[NI_MAXHOST];
+    char serv[NI_MAXSERV];
+    const int nrc = ::getnameinfo(res->ai_addr, res->ai_addrlen, addr, sizeof(addr),
+                                  serv, sizeof(serv), NI_NUMERICHOST | NI_NUMERICSERV);
+    const bool v6 = res->ai_family == AF_INET6;
+    ::freeaddrinfo(res);
+    if (nrc != 0) throw std::runtime_error(host + ": " + ::gai_strerror(nrc));
+    return v6 ? "[" + std::string(addr) + "]:" + serv : std::string(addr) + ":" + serv;
+  }
+};
+
+// Calls `fn(line_begin, line_end, key, value)` for each section header
+// (key "[peer]", "[interface]", ...) and each `key = value` line inside a
+// [Peer] section of `config`, keys lower-cased and comments dropped. A
+// final "[end]" header closes the last section.
+template <typename Fn>
+void ForEachLine(const std::string& config, Fn fn) {
+  bool in_peer = false;
+  size_t at = 0;
+  while (at < config.size()) {
+    size_t end = config.find('\n', at);
+    if (end == std::string::npos) end = config.size();
+    const std::string line = config.substr(at, end - at);
+    const std::string body = line.substr(0, line.find('#'));
+    const size_t eq = body.find('=');
+    const std::string key = Lower(Trim(body.substr(0, eq)));
+    if (!key.empty() && key[0] == '[') {
+      in_peer = key == "[peer]";
+      fn(at, end, key, std::string());
+    } else if (in_peer && eq != std::string::npos) {
+      fn(at, end, key, Trim(body.substr(eq + 1)));
+    }
+    at = end + 1;
+  }
+  fn(config.size(), config.size(), std::string("[end]"), std::string());
+}
+
+}  // namespace
+
+std::unique_ptr<HostResolver> SystemHostResolver() {
+  return std::make_unique<GetAddrInfoResolver>();
+}
+
+bool SplitEndpoint(const std::string& endpoint, std::string* host,
+                   std::string* port) {
+  size_t colon;
+  if (!endpoint.empty() && endpoint[0] == '[') {
+    const size_t close = endpoint.find(']');
+    if (close == std::string::npos || close + 1 >= endpoint.size() ||
+        endpoint[close + 1] != ':') {
+      return false;
+    }
+    *host = endpoint.substr(1, close - 1);
+    colon = close + 1;
+  } else {
+    colon = endpoint.rfind(':');
+    if (colon == std::string::npos) return false;
+    *host = endpoint.substr(0, colon);
+  }
+  *port = endpoint.substr(colon + 1);
+  return !host->empty() && !port->empty();
+}
+
+bool IsNumericEndpoint(const std::string& endpoint) {
+  std::string host, port;
+  IpKey key;
+  bool v6;
+  return SplitEndpoint(endpoint, &host, &port) && ParseIpAddress(host, &key, &v6);
+}
+
+std::vector<PeerEndpoint> NamedEndpoints(const std::string& config) {
+  std::vector<PeerEndpoint> out;
+  PeerEndpoint peer;
+  ForEachLine(config, [&](size_t, size_t, const std::string& key,
+                          const std::string& value) {
+    if (!key.empty() && key[0] == '[') {
+      std::string host, port;
+      if (!peer.endpoint.empty() && !IsNumericEndpoint(peer.endpoint) &&
+          SplitEndpoint(peer.endpoint, &host, &port)) {
+        out.push_back(peer);
+      }
+      peer = PeerEndpoint();
+    } else if (key == "publickey") {
+      peer.public_key = value;
+    } else if (key == "endpoint") {
+      peer.endpoint = value;
+    }
+  });
+  return out;
+}
+
+std::string WithNumericEndpoints(const std::string& config,
+                                 const std::map<std::string, std::string>& numeric) {
+  std::string out;
+  size_t copied = 0;
+  ForEachLine(config, [&](size_t begin, size_t end, const std::string& key,
+                          const std::string& value) {
+    if (key != "endpoint") return;
+    auto it = numeric.find(value);
+    if (it == numeric.end()) return;
+    out.append(config, copied, begin - copied);
+    out += "Endpoint = " + it->second;
+    copied = end;
+  });
+  out.append(config, copied, std::string::npos);
+  return out;
+}
+
+std::map<std::string, std::vector<std::string>> CandidateEndpoints(
+    const std::string& config) {
+  std::map<std::string, std::vector<std::string>> out;
+  std::string public_key;
+  std::vector<std::string> candidates;
+  ForEachLine(config, [&](size_t, size_t, const std::string& key,
+                          const std::string& value) {
+    if (!key.empty() && key[0] == '[') {
+      if (candidates.size() > 1 && !public_key.empty()) {
+        out[public_key] = std::move(candidates);
+      }
+      public_key.clear();
+      candidates.clear();
+    } else if (key == "publickey") {
+      public_key = value;
+    } else if (key == "endpoint") {
+      candidates.clear();
+      size_t at = 0;
+      while (at <= value.size()) {
+        size_t comma = value.find(',', at);
+        if (comma == std::string::npos) comma = value.size();
+        const std::string one = Trim(value.substr(at, comma - at));
+        if (!one.empty()) candidates.push_back(one);
+        at = comma + 1;
+      }
+    }
+  });
+  return out;
+}
+
+std::string WithPrimaryEndpoints(const std::string& config) {
+  std::string out;
+  size_t copied = 0;
+  ForEachLine(config, [&](size_t begin, size_t end, const std::string& key,
+                          const std::string& value) {
+    if (key != "endpoint" || value.find(',') == std::string::npos) return;
+    out.append(config, copied, begin - copied);
+    out += "Endpoint = " + Trim(value.substr(0, value.find(',')));
+    copied = end;
+  });
+  out.append(config, copied, std::string::npos);
+  return out;
+}
+
+EndpointResolver::EndpointResolver(std::unique_ptr<HostResolver> resolver,
+                                   std::chrono::seconds ttl, Clock clock)
+    : resolver_(std::move(resolver)), ttl_(ttl), clock_(std::move(clock)) {}
+
+std::map<std::string, std::string> EndpointResolver::Resolve(
+    const std::vector<std::string>& endpoints, bool fresh) {
+  std::map<std::string, std::string> out;
+  std::vector<std::string> todo;
+  {
+    std::set<std::string> seen;
+    std::lock_guard<std::mutex> lock(mu_);
+    const auto now = clock_();
+    for (const auto& e : endpoints) {
+      std::string host, port;
+      if (!seen.insert(e).second || IsNumericEndpoint(e) ||
+          !SplitEndpoint(e, &host, &port)) {
+        continue;
+      }
+      auto it = cache_.find(e);
+      if (!fresh && it != cache_.end() && now < it->second.expires) {
+        out[e] = it->second.numeric;
+      } else {
+        todo.push_back(e);
+      }
+    }
+  }
+  if (todo.empty()) return out;
+
+  FWG_TRACE_SCOPE("endpoints.resolve");
+  std::vector<std::string> answers(todo.size());
+  std::atomic<size_t> next{0};
+  auto work = [&] {
+    for (size_t i; (i = next++) < todo.size();) {
+      std::string host, port;
+      SplitEndpoint(todo[i], &host, &port);
+      try {
+        answers[i] = resolver_->Resolve(host, port);
+      } catch (const std::exception&) {
+        // Left for wg, which retries and reports.
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  const size_t n = std::min(todo.size(), kMaxParallel);
+  for (size_t i = 1; i < n; ++i) workers.emplace_back(work);
+  work();
+  for (auto& w : workers) w.join();
+
+  std::lock_guard<std::mutex> lock(mu_);
+  const auto now = clock_();
+  for (auto it = cache_.begin(); it != cache_.end();) {
+    it = now < it->second.expires ? std::next(it) : cache_.erase(it);
+  }
+  lookups_ += todo.size();
+  for (size_t i = 0; i < todo.size(); ++i) {
+    if (answers[i].empty()) {
+      cache_.erase(todo[i]);
+      continue;
+    }
+    cache_[todo[i]] = {answers[i], now + ttl_};
+    out[todo[i]] = std::move(answers[i]);
+  }
+  return out;
+}
+
+std::map<std::string, std::string> EndpointResolver::ResolveConfigs(
+    std::vector<std::string*> configs) {
+  std::vector<std::string> endpoints;
+  for (const std::string* c : configs) {
+    for (auto& p : NamedEndpoints(*c)) endpoints.push_back(std::move(p.endpoint));
+  }
+  if (endpoints.empty()) return {};
+  auto numeric = Resolve(endpoints);
+  if (numeric.empty()) return numeric;
+  for (std::string* c : configs) *c = WithNumericEndpoints(*c, numeric);
+  return numeric;
+}
+
+size_t EndpointResolver::lookups() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return lookups_;
+}
+
+}  // namespace flutter_wireguard
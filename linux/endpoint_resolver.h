@@ -0,0 +1,126 @@
+// Parallel, cached resolution of peer Endpoint hostnames.
+//
+// wg(8) resolves `Endpoint = vpn.example.com:51820` itself while wg-quick
+// configures the link: one blocking getaddrinfo per peer, one after the
+// other, so a config naming ten servers waits for ten lookups in a row.
+// Start resolves every distinct host:port of the config (of the whole
+// batch, for StartMany) up front instead, up to kMaxParallel lookups at
+// once, and hands wg-quick numeric endpoints. Answers are kept for a short
+// TTL, so a reconnect or a batch that repeats a server does not ask again.
+//
+// A name that does not resolve is left as written; wg then retries it the
+// way it always has and reports the failure if it persists.
+//
+// DNS answers change while a tunnel runs (dynamic DNS, a server moving, a
+// network with a different resolver view); WgBackend::ReresolveEndpoints
+// looks the names up again and moves only the peers whose address changed.
+//
+// A peer may also list several endpoints; wg-quick gets the first and the
+// rest are kept for failover (endpoint_failover.h).
+#ifndef FLUTTER_WIREGUARD_ENDPOINT_RESOLVER_H_
+#define FLUTTER_WIREGUARD_ENDPOINT_RESOLVER_H_
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace flutter_wireguard {
+
+// Turns one host and port into a numeric endpoint. Abstract so tests can
+// answer without a network. Called from several threads at once.
+class HostResolver {
+ public:
+  virtual ~HostResolver() = default;
+  // "192.0.2.1:51820" or "[2001:db8::1]:51820". Throws std::runtime_error.
+  virtual std::string Resolve(const std::string& host, const std::string& port) = 0;
+};
+
+// getaddrinfo, taking the first answer as wg does.
+std::unique_ptr<HostResolver> SystemHostResolver();
+
+// Splits "host:port" or "[v6]:port" the way wg does. False without a port.
+bool SplitEndpoint(const std::string& endpoint, std::string* host,
+                   std::string* port);
+
+// True if `endpoint`'s host is an IP literal, i.e. there is nothing to
+// resolve.
+bool IsNumericEndpoint(const std::string& endpoint);
+
+// One peer's endpoint: "host:port" as a config wrote it, or the numeric
+// form that is applied to the link.
+struct PeerEndpoint {
+  std::string public_key;  // base64
+  std::string endpoint;
+};
+
+// The peers of `config` whose Endpoint names a host rather than an
+// address, in config order.
+std::vector<PeerEndpoint> NamedEndpoints(const std::string& config);
+
+// `config` with every [Peer] Endpoint that is a key of `numeric` replaced
+// by its value. A replaced line loses its trailing comment; every other
+// line is kept byte for byte.
+std::string WithNumericEndpoints(const std::string& config,
+                                 const std::map<std::string, std::string>& numeric);
+
+// The peers of `config` whose Endpoint lists more than one candidate
+// (`Endpoint = a.example:51820, 192.0.2.7:51820`), keyed by public key,
+// candidates in the order written. See endpoint_failover.h.
+std::map<std::string, std::vector<std::string>> CandidateEndpoints(
+    const std::string& config);
+
+// `config` with every Endpoint list cut to its first candidate, the form wg
+// accepts. Every other line is kept byte for byte.
+std::string WithPrimaryEndpoints(const std::string& config);
+
+class EndpointResolver {
+ public:
+  using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+  // Lookups in flight at once. Each holds a thread blocked in the resolver,
+  // and a config rarely names more servers than this.
+  static constexpr size_t kMaxParallel = 16;
+
+  explicit EndpointResolver(std::unique_ptr<HostResolver> resolver,
+                            std::chrono::seconds ttl = std::chrono::seconds(30),
+                            Clock clock = std::chrono::steady_clock::now);
+
+  // Numeric form of each distinct named endpoint in `endpoints`, keyed by
+  // the endpoint as given. Names that fail to resolve, endpoints without a
+  // port and IP literals are absent. Cached answers younger than the TTL
+  // are reused unless `fresh`, in which case every name is looked up again
+  // and the cache refreshed. Never throws.
+  std::map<std::string, std::string> Resolve(const std::vector<std::string>& endpoints,
+                                             bool fresh = false);
+
+  // Resolves the named endpoints of every config in one fan-out and
+  // rewrites each config with the answers (WithNumericEndpoints). Returns
+  // the answers, as Resolve.
+  std::map<std::string, std::string> ResolveConfigs(std::vector<std::string*> configs);
+
+  // Calls that reached the HostResolver so far.
+  size_t lookups() const;
+
+ private:
+  struct Entry {
+    std::string numeric;
+    std::chrono::steady_clock::time_point expires;
+  };
+
+  std::unique_ptr<HostResolver> resolver_;
+  std::chrono::seconds ttl_;
+  Clock clock_;
+
+  mutable std::mutex mu_;
+  std::map<std::string, Entry> cache_;
+  size_t lookups_ = 0;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_ENDPOINT_RESOLVER_H_
@@ -4,15 +4,31 @@
 #include "include/flutter_wireguard/flutter_wireguard_plugin.h"
 
 #include <flutter_linux/flutter_linux.h>
+#include <glib-unix.h>
 #include <gtk/gtk.h>
+#include <sys/random.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
+#include <system_error>
 #include <thread>
 #include <utility>
 #include <vector>
 
+#include "cidr_set.h"
+#include "key_pairs.h"
 #include "messages.g.h"
+#include "metrics_exporter.h"
+#include "phase_timer.h"
 #include "process_runner.h"
+#include "status_poller.h"
+#include "status_shm.h"
+#include "trace_buffer.h"
+#include "usage_ledger.h"
 #include "wg_backend.h"
 
 #define FLUTTER_WIREGUARD_PLUGIN(obj)                                        \
@@ -30,6 +46,21 @@ struct _FlutterWireguardPlugin {
   // the tick instead of queueing another worker, so a slow pkexec call
   // can't cause unbounded thread growth.
   bool poll_in_flight;
+  // Shared status table (memfd + seqlock). The poller publishes into
+  // `status_segment`; status() and onTunnelStatus read through `status_view`
+  // without leaving userspace, and the view's eventfd wakes the main loop
+  // when a tick changed something. All null if memfd is unavailable, in
+  // which case the old per-call paths are used.
+  fwg::SharedStatusSegment* status_segment;      // owned (raw)
+  fwg::StatusSegmentView* status_view;           // owned (raw)
+  std::vector<uint32_t>* status_seen;            // owned (raw)
+  guint status_watch_id;
+  // Prometheus exporter, fed by the poller. Null unless
+  // FLUTTER_WIREGUARD_METRICS names a listen address.
+  fwg::MetricsExporter* metrics;                 // owned (raw)
+  // Persistent usage ledger, fed by the poller. Null if it can't be opened
+  // (another process has it, or the data dir isn't writable).
+  fwg::UsageLedger* usage;                       // owned (raw)
 };
 
 G_DEFINE_TYPE(FlutterWireguardPlugin, flutter_wireguard_plugin, g_object_get_type())
@@ -59,6 +90,20 @@ FlutterWireguardTunnelStatus* ToPigeonStatus(const fwg::TunnelStatusCpp& s) {
       s.name.c_str(), ToPigeonState(s.state), s.rx, s.tx, s.handshake);
 }
 
+FlutterWireguardTunnelStatus* ToPigeonStatus(const fwg::ipc::StatusRecord& r) {
+  FlutterWireguardTunnelState state = FLUTTER_WIREGUARD_TUNNEL_STATE_DOWN;
+  if (r.state == fwg::ipc::kStateUp) state = FLUTTER_WIREGUARD_TUNNEL_STATE_UP;
+  if (r.state == fwg::ipc::kStateToggle) state = FLUTTER_WIREGUARD_TUNNEL_STATE_TOGGLE;
+  return flutter_wireguard_tunnel_status_new(r.name.c_str(), state, r.rx,
+                                             r.tx, r.handshake_ms);
+}
+
+// Best-effort: keeps status() reads from the segment in step with Start/Stop
+// instead of waiting up to a second for the next poll tick.
+void PublishStatus(FlutterWireguardPlugin* self, const fwg::TunnelStatusCpp& s) {
+  fwg::PublishStatuses(self->status_segment, {s});
+}
+
 // ---- Async dispatch helpers ----------------------------------------------
 //
 // HostApi vtable callbacks fire on the GLib main thread. Any blocking work
@@ -76,6 +121,7 @@ struct StartCtx {
 };
 
 gboolean StartReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.start");
   auto* c = static_cast<StartCtx*>(data);
   if (c->ok) {
     flutter_wireguard_wireguard_host_api_respond_start(c->handle);
@@ -92,11 +138,13 @@ gboolean StartReply(gpointer data) {
 void HandleStart(const gchar* name, const gchar* config,
                  FlutterWireguardWireguardHostApiResponseHandle* handle,
                  gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.start");
   auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
   g_object_ref(plugin);
   g_object_ref(handle);
   auto* ctx = new StartCtx{plugin, handle, name, config, "", false};
   std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.start");
     try {
       ctx->plugin->backend->Start(ctx->name, ctx->config);
       ctx->ok = true;
@@ -104,6 +152,13 @@ void HandleStart(const gchar* name, const gchar* config,
       ctx->error = e.what();
       ctx->ok = false;
     }
+    if (ctx->ok) {
+      try {
+        PublishStatus(ctx->plugin, ctx->plugin->backend->Status(ctx->name));
+      } catch (...) {
+      }
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
     g_idle_add(StartReply, ctx);
   }).detach();
 }
@@ -117,6 +172,7 @@ struct StopCtx {
 };
 
 gboolean StopReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.stop");
   auto* c = static_cast<StopCtx*>(data);
   if (c->ok) {
     flutter_wireguard_wireguard_host_api_respond_stop(c->handle);
@@ -133,11 +189,13 @@ gboolean StopReply(gpointer data) {
 void HandleStop(const gchar* name,
                 FlutterWireguardWireguardHostApiResponseHandle* handle,
                 gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.stop");
   auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
   g_object_ref(plugin);
   g_object_ref(handle);
   auto* ctx = new StopCtx{plugin, handle, name, "", false};
   std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.stop");
     try {
       ctx->plugin->backend->Stop(ctx->name);
       ctx->ok = true;
@@ -145,6 +203,12 @@ void HandleStop(const gchar* name,
       ctx->error = e.what();
       ctx->ok = false;
     }
+    if (ctx->ok) {
+      fwg::TunnelStatusCpp down;
+      down.name = ctx->name;
+      PublishStatus(ctx->plugin, down);
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
     g_idle_add(StopReply, ctx);
   }).detach();
 }
@@ -159,6 +223,7 @@ struct StatusCtx {
 };
 
 gboolean StatusReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.status");
   auto* c = static_cast<StatusCtx*>(data);
   if (c->ok) {
     FlutterWireguardTunnelStatus* status = ToPigeonStatus(c->result);
@@ -177,11 +242,22 @@ gboolean StatusReply(gpointer data) {
 void HandleStatus(const gchar* name,
                   FlutterWireguardWireguardHostApiResponseHandle* handle,
                   gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.status");
   auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  // Fast path: a seqlock read from the shared segment, answered inline.
+  fwg::ipc::StatusRecord rec;
+  if (plugin->status_view != nullptr &&
+      plugin->status_view->reader().Read(name, &rec)) {
+    FlutterWireguardTunnelStatus* status = ToPigeonStatus(rec);
+    flutter_wireguard_wireguard_host_api_respond_status(handle, status);
+    g_object_unref(status);
+    return;
+  }
   g_object_ref(plugin);
   g_object_ref(handle);
   auto* ctx = new StatusCtx{plugin, handle, name, {}, "", false};
   std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.status");
     try {
       ctx->result = ctx->plugin->backend->Status(ctx->name);
       ctx->ok = true;
@@ -189,12 +265,14 @@ void HandleStatus(const gchar* name,
       ctx->error = e.what();
       ctx->ok = false;
     }
+    FWG_TRACE_INSTANT("worker.idle_add");
     g_idle_add(StatusReply, ctx);
   }).detach();
 }
 
 void HandleTunnelNames(FlutterWireguardWireguardHostApiResponseHandle* handle,
                        gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.tunnel_names");
   auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
   auto names = plugin->backend->TunnelNames();
   g_autoptr(FlValue) list = fl_value_new_list();
@@ -206,6 +284,7 @@ void HandleTunnelNames(FlutterWireguardWireguardHostApiResponseHandle* handle,
 
 void HandleBackend(FlutterWireguardWireguardHostApiResponseHandle* handle,
                    gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.backend");
   auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
   auto info = plugin->backend->Backend();
   FlutterWireguardBackendInfo* bi = flutter_wireguard_backend_info_new(
@@ -214,35 +293,735 @@ void HandleBackend(FlutterWireguardWireguardHostApiResponseHandle* handle,
   g_object_unref(bi);
 }
 
+// Shared by startMany / stopMany: the batch runs on a worker thread and the
+// per-tunnel results are turned into Pigeon objects back on the main loop.
+struct BatchCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  bool start;
+  std::vector<fwg::TunnelSpecCpp> specs;  // startMany
+  std::vector<std::string> names;         // stopMany
+  std::vector<fwg::TunnelResultCpp> results;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean BatchReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.batch");
+  auto* c = static_cast<BatchCtx*>(data);
+  if (c->ok) {
+    g_autoptr(FlValue) list = fl_value_new_list();
+    for (const auto& r : c->results) {
+      FlutterWireguardTunnelResult* result = flutter_wireguard_tunnel_result_new(
+          r.name.c_str(), r.ok, r.ok ? nullptr : r.error.c_str());
+      fl_value_append_take(
+          list, fl_value_new_custom_object(flutter_wireguard_tunnel_result_type_id,
+                                           G_OBJECT(result)));
+      g_object_unref(result);
+    }
+    if (c->start) {
+      flutter_wireguard_wireguard_host_api_respond_start_many(c->handle, list);
+    } else {
+      flutter_wireguard_wireguard_host_api_respond_stop_many(c->handle, list);
+    }
+  } else if (c->start) {
+    flutter_wireguard_wireguard_host_api_respond_error_start_many(
+        c->handle, "START_FAILED", c->error.c_str(), nullptr);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_stop_many(
+        c->handle, "STOP_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+void RunBatch(BatchCtx* ctx) {
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.batch");
+    try {
+      ctx->results = ctx->start ? ctx->plugin->backend->StartMany(ctx->specs)
+                                : ctx->plugin->backend->StopMany(ctx->names);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+      ctx->ok = false;
+    }
+    for (const auto& r : ctx->results) {
+      if (!r.ok) continue;
+      if (ctx->start) {
+        try {
+          PublishStatus(ctx->plugin, ctx->plugin->backend->Status(r.name));
+        } catch (...) {
+        }
+      } else {
+        fwg::TunnelStatusCpp down;
+        down.name = r.name;
+        PublishStatus(ctx->plugin, down);
+      }
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(BatchReply, ctx);
+  }).detach();
+}
+
+void HandleStartMany(FlValue* specs,
+                     FlutterWireguardWireguardHostApiResponseHandle* handle,
+                     gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.start_many");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new BatchCtx{plugin, handle, true, {}, {}, {}, "", false};
+  for (size_t i = 0; i < fl_value_get_length(specs); ++i) {
+    auto* spec = FLUTTER_WIREGUARD_TUNNEL_SPEC(
+        fl_value_get_custom_value_object(fl_value_get_list_value(specs, i)));
+    ctx->specs.push_back({flutter_wireguard_tunnel_spec_get_name(spec),
+                          flutter_wireguard_tunnel_spec_get_config(spec)});
+  }
+  RunBatch(ctx);
+}
+
+void HandleStopMany(FlValue* names,
+                    FlutterWireguardWireguardHostApiResponseHandle* handle,
+                    gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.stop_many");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new BatchCtx{plugin, handle, false, {}, {}, {}, "", false};
+  for (size_t i = 0; i < fl_value_get_length(names); ++i) {
+    ctx->names.push_back(fl_value_get_string(fl_value_get_list_value(names, i)));
+  }
+  RunBatch(ctx);
+}
+
+struct SwitchCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::string from;
+  std::string to;
+  std::string config;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean SwitchReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.switch_tunnel");
+  auto* c = static_cast<SwitchCtx*>(data);
+  if (c->ok) {
+    flutter_wireguard_wireguard_host_api_respond_switch_tunnel(c->handle);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_switch_tunnel(
+        c->handle, "SWITCH_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+void HandleSwitchTunnel(const gchar* from, const gchar* to, const gchar* config,
+                        FlutterWireguardWireguardHostApiResponseHandle* handle,
+                        gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.switch_tunnel");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new SwitchCtx{plugin, handle, from, to, config, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.switch_tunnel");
+    try {
+      ctx->plugin->backend->SwitchTunnel(ctx->from, ctx->to, ctx->config);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+      ctx->ok = false;
+    }
+    if (ctx->ok) {
+      try {
+        PublishStatus(ctx->plugin, ctx->plugin->backend->Status(ctx->to));
+      } catch (...) {
+      }
+      fwg::TunnelStatusCpp down;
+      down.name = ctx->from;
+      PublishStatus(ctx->plugin, down);
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(SwitchReply, ctx);
+  }).detach();
+}
+
+// Histogram snapshots are cheap (no I/O), so this answers on the main loop.
+void HandleDiagnostics(FlutterWireguardWireguardHostApiResponseHandle* handle,
+                       gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.diagnostics");
+  (void)user_data;
+  g_autoptr(FlValue) list = fl_value_new_list();
+  for (const auto& row : fwg::PhaseRegistry::Instance().Snapshot()) {
+    FlutterWireguardPhaseStats* stats = flutter_wireguard_phase_stats_new(
+        row.op.c_str(), row.phase.c_str(), static_cast<int64_t>(row.count),
+        row.p50_us / 1000.0, row.p95_us / 1000.0, row.p99_us / 1000.0);
+    fl_value_append_take(
+        list, fl_value_new_custom_object(flutter_wireguard_phase_stats_type_id,
+                                         G_OBJECT(stats)));
+    g_object_unref(stats);
+  }
+  flutter_wireguard_wireguard_host_api_respond_diagnostics(handle, list);
+}
+
+void HandleDumpTrace(const gchar* path,
+                     FlutterWireguardWireguardHostApiResponseHandle* handle,
+                     gpointer user_data) {
+  (void)user_data;
+#ifdef FLUTTER_WIREGUARD_TRACE
+  try {
+    fwg::TraceDump(path);
+    flutter_wireguard_wireguard_host_api_respond_dump_trace(handle);
+  } catch (const std::exception& e) {
+    flutter_wireguard_wireguard_host_api_respond_error_dump_trace(
+        handle, "TRACE_FAILED", e.what(), nullptr);
+  }
+#else
+  (void)path;
+  flutter_wireguard_wireguard_host_api_respond_error_dump_trace(
+      handle, "TRACE_FAILED",
+      "trace points not compiled in (configure with "
+      "-DFLUTTER_WIREGUARD_TRACE=ON)",
+      nullptr);
+#endif
+}
+
+// Lookups read an in-memory index built at Start and never touch the
+// backend, so these answer on the main loop too.
+void HandleLookupPeer(const gchar* name, const gchar* ip_address,
+                      FlutterWireguardWireguardHostApiResponseHandle* handle,
+                      gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.lookup_peer");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  try {
+    const std::string key = plugin->backend->LookupPeer(name, ip_address);
+    flutter_wireguard_wireguard_host_api_respond_lookup_peer(
+        handle, key.empty() ? nullptr : key.c_str());
+  } catch (const std::exception& e) {
+    flutter_wireguard_wireguard_host_api_respond_error_lookup_peer(
+        handle, "LOOKUP_FAILED", e.what(), nullptr);
+  }
+}
+
+void HandleLookupPeers(const gchar* name, FlValue* ip_addresses,
+                       FlutterWireguardWireguardHostApiResponseHandle* handle,
+                       gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.lookup_peers");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  std::vector<std::string> ips;
+  ips.reserve(fl_value_get_length(ip_addresses));
+  for (size_t i = 0; i < fl_value_get_length(ip_addresses); ++i) {
+    ips.emplace_back(fl_value_get_string(fl_value_get_list_value(ip_addresses, i)));
+  }
+  try {
+    g_autoptr(FlValue) list = fl_value_new_list();
+    for (const auto& key : plugin->backend->LookupPeers(name, ips)) {
+      fl_value_append_take(list, key.empty() ? fl_value_new_null()
+                                             : fl_value_new_string(key.c_str()));
+    }
+    flutter_wireguard_wireguard_host_api_respond_lookup_peers(handle, list);
+  } catch (const std::exception& e) {
+    flutter_wireguard_wireguard_host_api_respond_error_lookup_peers(
+        handle, "LOOKUP_FAILED", e.what(), nullptr);
+  }
+}
+
+struct AllowedIpsCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::vector<std::string> include;
+  std::vector<std::string> exclude;
+  std::vector<std::string> result;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean AllowedIpsReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.compute_allowed_ips");
+  auto* c = static_cast<AllowedIpsCtx*>(data);
+  if (c->ok) {
+    g_autoptr(FlValue) list = fl_value_new_list();
+    for (const auto& prefix : c->result) {
+      fl_value_append_take(list, fl_value_new_string(prefix.c_str()));
+    }
+    flutter_wireguard_wireguard_host_api_respond_compute_allowed_ips(c->handle, list);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_compute_allowed_ips(
+        c->handle, "ALLOWED_IPS_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+std::vector<std::string> StringList(FlValue* list) {
+  std::vector<std::string> out;
+  out.reserve(fl_value_get_length(list));
+  for (size_t i = 0; i < fl_value_get_length(list); ++i) {
+    out.emplace_back(fl_value_get_string(fl_value_get_list_value(list, i)));
+  }
+  return out;
+}
+
+// Pure computation, but 100k-prefix lists take tens of milliseconds, so it
+// runs off the main loop.
+void HandleComputeAllowedIps(FlValue* include, FlValue* exclude,
+                             FlutterWireguardWireguardHostApiResponseHandle* handle,
+                             gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.compute_allowed_ips");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new AllowedIpsCtx{plugin, handle, StringList(include), StringList(exclude),
+                                {}, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.compute_allowed_ips");
+    try {
+      ctx->result = fwg::CidrSet::Parse(ctx->include)
+                        .Subtract(fwg::CidrSet::Parse(ctx->exclude))
+                        .ToStrings();
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(AllowedIpsReply, ctx);
+  }).detach();
+}
+
+struct ReresolveCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::string name;
+  size_t moved = 0;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean ReresolveReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.reresolve_endpoints");
+  auto* c = static_cast<ReresolveCtx*>(data);
+  if (c->ok) {
+    flutter_wireguard_wireguard_host_api_respond_reresolve_endpoints(
+        c->handle, static_cast<int64_t>(c->moved));
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_reresolve_endpoints(
+        c->handle, "RESOLVE_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+// DNS lookups and possibly a privileged `wg set`: off the main loop.
+void HandleReresolveEndpoints(const gchar* name,
+                              FlutterWireguardWireguardHostApiResponseHandle* handle,
+                              gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.reresolve_endpoints");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new ReresolveCtx{plugin, handle, name, 0, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.reresolve_endpoints");
+    try {
+      ctx->moved = ctx->plugin->backend->ReresolveEndpoints(ctx->name);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(ReresolveReply, ctx);
+  }).detach();
+}
+
+// Only moves a threshold under a lock; answered on the main loop.
+void HandleSetStaleAfter(int64_t seconds,
+                         FlutterWireguardWireguardHostApiResponseHandle* handle,
+                         gpointer user_data) {
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  if (plugin->backend != nullptr) {
+    const int64_t capped = std::min<int64_t>(std::max<int64_t>(seconds, 1),
+                                             INT64_MAX / 1000);
+    plugin->backend->health().SetStaleAfter(capped * 1000);
+  }
+  flutter_wireguard_wireguard_host_api_respond_set_stale_after(handle);
+}
+
+void GetRandom(uint8_t* out, size_t n) {
+  while (n > 0) {
+    const ssize_t got = getrandom(out, n, 0);
+    if (got < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(), "getrandom");
+    }
+    out += got;
+    n -= static_cast<size_t>(got);
+  }
+}
+
+struct KeyPairsCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  int64_t count = 0;
+  std::vector<fwg::KeyPairCpp> result;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean KeyPairsReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.generate_key_pairs");
+  auto* c = static_cast<KeyPairsCtx*>(data);
+  if (c->ok) {
+    g_autoptr(FlValue) list = fl_value_new_list();
+    for (const auto& pair : c->result) {
+      FlutterWireguardKeyPairData* keys = flutter_wireguard_key_pair_data_new(
+          pair.private_key.c_str(), pair.public_key.c_str());
+      fl_value_append_take(
+          list, fl_value_new_custom_object(flutter_wireguard_key_pair_data_type_id,
+                                           G_OBJECT(keys)));
+      g_object_unref(keys);
+    }
+    flutter_wireguard_wireguard_host_api_respond_generate_key_pairs(c->handle, list);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_generate_key_pairs(
+        c->handle, "KEYS_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+// ~130 us of ladder per key: off the main loop, spread over the cores.
+void HandleGenerateKeyPairs(int64_t count,
+                            FlutterWireguardWireguardHostApiResponseHandle* handle,
+                            gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.generate_key_pairs");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new KeyPairsCtx{plugin, handle, count, {}, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.generate_key_pairs");
+    try {
+      ctx->result = fwg::GenerateKeyPairs(ctx->count, GetRandom);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(KeyPairsReply, ctx);
+  }).detach();
+}
+
+struct PublicKeysCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::vector<std::string> private_keys;
+  std::vector<std::string> result;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean PublicKeysReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.public_keys_from_private");
+  auto* c = static_cast<PublicKeysCtx*>(data);
+  if (c->ok) {
+    g_autoptr(FlValue) list = fl_value_new_list();
+    for (const auto& key : c->result) {
+      fl_value_append_take(list, fl_value_new_string(key.c_str()));
+    }
+    flutter_wireguard_wireguard_host_api_respond_public_keys_from_private(c->handle, list);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_error_public_keys_from_private(
+        c->handle, "KEYS_FAILED", c->error.c_str(), nullptr);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+void HandlePublicKeysFromPrivate(FlValue* private_keys,
+                                 FlutterWireguardWireguardHostApiResponseHandle* handle,
+                                 gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.public_keys_from_private");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new PublicKeysCtx{plugin, handle, StringList(private_keys), {}, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.public_keys_from_private");
+    try {
+      ctx->result = fwg::PublicKeysFromPrivate(ctx->private_keys);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(PublicKeysReply, ctx);
+  }).detach();
+}
+
+struct PeerCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::string name;
+  std::string public_key;
+  fwg::PeerStatsCpp peer;
+  bool found = false;
+  std::string error;
+  bool ok = false;
+};
+
+gboolean PeerReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.peer_by_public_key");
+  auto* c = static_cast<PeerCtx*>(data);
+  if (!c->ok) {
+    flutter_wireguard_wireguard_host_api_respond_error_peer_by_public_key(
+        c->handle, "PEER_FAILED", c->error.c_str(), nullptr);
+  } else if (!c->found) {
+    flutter_wireguard_wireguard_host_api_respond_peer_by_public_key(c->handle, nullptr);
+  } else {
+    const fwg::PeerStatsCpp& p = c->peer;
+    FlutterWireguardPeerStatus* status = flutter_wireguard_peer_status_new(
+        p.public_key.c_str(), p.endpoint.empty() ? nullptr : p.endpoint.c_str(),
+        p.rx, p.tx, p.handshake, p.keepalive);
+    flutter_wireguard_wireguard_host_api_respond_peer_by_public_key(c->handle, status);
+    g_object_unref(status);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+// Usually one probe of the last poll's snapshot, but before the first poll
+// it reads the tunnel (maybe through pkexec): off the main loop.
+void HandlePeerByPublicKey(const gchar* name, const gchar* public_key,
+                           FlutterWireguardWireguardHostApiResponseHandle* handle,
+                           gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.peer_by_public_key");
+  auto* plugin = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new PeerCtx{plugin, handle, name, public_key, {}, false, "", false};
+  std::thread([ctx]() {
+    FWG_TRACE_SCOPE("worker.peer_by_public_key");
+    try {
+      ctx->found = ctx->plugin->backend->PeerByPublicKey(ctx->name, ctx->public_key,
+                                                         &ctx->peer);
+      ctx->ok = true;
+    } catch (const std::exception& e) {
+      ctx->error = e.what();
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(PeerReply, ctx);
+  }).detach();
+}
+
+struct UsageCtx {
+  FlutterWireguardPlugin* plugin;
+  FlutterWireguardWireguardHostApiResponseHandle* handle;
+  std::string name;
+  int64_t since;
+  int64_t limit;  // setUsageQuota only
+  fwg::TunnelUsageCpp usage;
+  int64_t used = 0;
+  std::string error;
+  bool ok = false;
+};
+
+FlValue* ToPigeonPeerUsages(const std::vector<fwg::PeerUsageCpp>& peers) {
+  FlValue* list = fl_value_new_list();
+  for (const auto& p : peers) {
+    FlutterWireguardPeerUsage* usage =
+        flutter_wireguard_peer_usage_new(p.public_key.c_str(), p.rx, p.tx);
+    fl_value_append_take(list, fl_value_new_custom_object(
+                                   flutter_wireguard_peer_usage_type_id,
+                                   G_OBJECT(usage)));
+    g_object_unref(usage);
+  }
+  return list;
+}
+
+gboolean UsageReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.usage");
+  auto* c = static_cast<UsageCtx*>(data);
+  if (!c->ok) {
+    flutter_wireguard_wireguard_host_api_respond_error_usage(
+        c->handle, "USAGE_FAILED", c->error.c_str(), nullptr);
+  } else {
+    g_autoptr(FlValue) peers = ToPigeonPeerUsages(c->usage.peers);
+    FlutterWireguardTunnelUsage* usage = flutter_wireguard_tunnel_usage_new(
+        c->usage.name.c_str(), c->usage.since, c->usage.rx, c->usage.tx, peers);
+    flutter_wireguard_wireguard_host_api_respond_usage(c->handle, usage);
+    g_object_unref(usage);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+gboolean SetUsageQuotaReply(gpointer data) {
+  FWG_TRACE_SCOPE("main.reply.set_usage_quota");
+  auto* c = static_cast<UsageCtx*>(data);
+  if (!c->ok) {
+    flutter_wireguard_wireguard_host_api_respond_error_set_usage_quota(
+        c->handle, "USAGE_FAILED", c->error.c_str(), nullptr);
+  } else {
+    flutter_wireguard_wireguard_host_api_respond_set_usage_quota(c->handle, c->used);
+  }
+  g_object_unref(c->handle);
+  g_object_unref(c->plugin);
+  delete c;
+  return G_SOURCE_REMOVE;
+}
+
+// Both scan the ledger file (a read per record of the period): off the
+// main loop.
+void RunUsage(FlutterWireguardPlugin* plugin, const gchar* name, int64_t since,
+              int64_t limit, bool set_quota,
+              FlutterWireguardWireguardHostApiResponseHandle* handle) {
+  g_object_ref(plugin);
+  g_object_ref(handle);
+  auto* ctx = new UsageCtx{plugin, handle, name, since, limit, {}, 0, "", false};
+  std::thread([ctx, set_quota]() {
+    FWG_TRACE_SCOPE("worker.usage");
+    if (!fwg::WgBackend::IsValidName(ctx->name)) {
+      ctx->error = "invalid tunnel name: " + ctx->name;
+    } else if (ctx->plugin->usage == nullptr) {
+      ctx->error = "the usage ledger is unavailable";
+    } else {
+      try {
+        if (set_quota) {
+          ctx->used = ctx->plugin->usage->SetQuota(ctx->name, ctx->limit, ctx->since);
+        } else {
+          ctx->usage = ctx->plugin->usage->Usage(ctx->name, ctx->since);
+        }
+        ctx->ok = true;
+      } catch (const std::exception& e) {
+        ctx->error = e.what();
+      }
+    }
+    FWG_TRACE_INSTANT("worker.idle_add");
+    g_idle_add(set_quota ? SetUsageQuotaReply : UsageReply, ctx);
+  }).detach();
+}
+
+void HandleUsage(const gchar* name, int64_t since,
+                 FlutterWireguardWireguardHostApiResponseHandle* handle,
+                 gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.usage");
+  RunUsage(FLUTTER_WIREGUARD_PLUGIN(user_data), name, since, 0, false, handle);
+}
+
+void HandleSetUsageQuota(const gchar* name, int64_t limit_bytes, int64_t since,
+                         FlutterWireguardWireguardHostApiResponseHandle* handle,
+                         gpointer user_data) {
+  FWG_TRACE_SCOPE("pigeon.set_usage_quota");
+  RunUsage(FLUTTER_WIREGUARD_PLUGIN(user_data), name, since, limit_bytes, true,
+           handle);
+}
+
 const FlutterWireguardWireguardHostApiVTable kVTable = {
     /*start=*/HandleStart,
     /*stop=*/HandleStop,
     /*status=*/HandleStatus,
     /*tunnel_names=*/HandleTunnelNames,
     /*backend=*/HandleBackend,
+    /*start_many=*/HandleStartMany,
+    /*stop_many=*/HandleStopMany,
+    /*switch_tunnel=*/HandleSwitchTunnel,
+    /*diagnostics=*/HandleDiagnostics,
+    /*dump_trace=*/HandleDumpTrace,
+    /*lookup_peer=*/HandleLookupPeer,
+    /*lookup_peers=*/HandleLookupPeers,
+    /*compute_allowed_ips=*/HandleComputeAllowedIps,
+    /*reresolve_endpoints=*/HandleReresolveEndpoints,
+    /*set_stale_after=*/HandleSetStaleAfter,
+    /*generate_key_pairs=*/HandleGenerateKeyPairs,
+    /*public_keys_from_private=*/HandlePublicKeysFromPrivate,
+    /*peer_by_public_key=*/HandlePeerByPublicKey,
+    /*usage=*/HandleUsage,
+    /*set_usage_quota=*/HandleSetUsageQuota,
 };
 
 // One-second status poller. The GLib timer fires on the main loop, but the
 // actual `Status()` calls reach into PrivilegedSession (blocking I/O on the
-// pkexec pipe) so we hand the work to a worker thread and post the per-tunnel
-// updates back via g_idle_add. A simple in-flight flag prevents queueing.
+// pkexec pipe) so we hand the work to a worker thread. With a shared segment
+// the worker publishes into it and the eventfd watch below emits events for
+// whatever changed; otherwise, and for records the segment had no slot for,
+// the per-tunnel results are posted back via g_idle_add. A simple in-flight
+// flag prevents queueing.
 struct StatusPollContext {
   FlutterWireguardPlugin* plugin;
-  std::vector<std::pair<std::string, fwg::TunnelStatusCpp>> results;
+  std::vector<fwg::TunnelStatusCpp> results;
+  std::vector<fwg::ipc::StatusRecord> unplaced;
+  std::vector<fwg::TunnelHealthEventCpp> health;
+  std::vector<fwg::UsageQuotaEventCpp> quota;
 };
 
+FlutterWireguardTunnelHealthState ToPigeonHealth(fwg::TunnelHealthCpp h) {
+  switch (h) {
+    case fwg::TunnelHealthCpp::kConnected: return FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_CONNECTED;
+    case fwg::TunnelHealthCpp::kStale:     return FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_STALE;
+    case fwg::TunnelHealthCpp::kRecovered: return FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_RECOVERED;
+  }
+  return FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_STALE;
+}
+
 gboolean StatusPollDispatch(gpointer user_data) {
   std::unique_ptr<StatusPollContext> ctx(
       static_cast<StatusPollContext*>(user_data));
   auto* self = ctx->plugin;
-  if (self->flutter_api != nullptr) {
-    for (auto& [_, s] : ctx->results) {
+  if (self->flutter_api != nullptr && self->status_segment == nullptr) {
+    for (const auto& s : ctx->results) {
+      FWG_TRACE_SCOPE("main.on_tunnel_status");
       FlutterWireguardTunnelStatus* status = ToPigeonStatus(s);
       flutter_wireguard_wireguard_flutter_api_on_tunnel_status(
           self->flutter_api, status, nullptr, nullptr, nullptr);
       g_object_unref(status);
     }
   }
+  if (self->flutter_api != nullptr) {
+    for (const auto& r : ctx->unplaced) {
+      FWG_TRACE_SCOPE("main.on_tunnel_status");
+      FlutterWireguardTunnelStatus* status = ToPigeonStatus(r);
+      flutter_wireguard_wireguard_flutter_api_on_tunnel_status(
+          self->flutter_api, status, nullptr, nullptr, nullptr);
+      g_object_unref(status);
+    }
+    for (const auto& e : ctx->health) {
+      FWG_TRACE_SCOPE("main.on_tunnel_health");
+      FlutterWireguardTunnelHealth* health = flutter_wireguard_tunnel_health_new(
+          e.name.c_str(), e.public_key.c_str(), ToPigeonHealth(e.health),
+          e.handshake_ms);
+      flutter_wireguard_wireguard_flutter_api_on_tunnel_health(
+          self->flutter_api, health, nullptr, nullptr, nullptr);
+      g_object_unref(health);
+    }
+    for (const auto& e : ctx->quota) {
+      FWG_TRACE_SCOPE("main.on_usage_quota");
+      FlutterWireguardUsageQuotaExceeded* event =
+          flutter_wireguard_usage_quota_exceeded_new(
+              e.name.c_str(), e.limit, e.used, e.since, e.stopped);
+      flutter_wireguard_wireguard_flutter_api_on_usage_quota(
+          self->flutter_api, event, nullptr, nullptr, nullptr);
+      g_object_unref(event);
+    }
+  }
   self->poll_in_flight = false;
   g_object_unref(self);
   return G_SOURCE_REMOVE;
@@ -260,19 +1039,55 @@ gboolean StatusPollCallback(gpointer user_data) {
   self->poll_in_flight = true;
   g_object_ref(self);
   std::thread([self] {
-    auto* ctx = new StatusPollContext{self, {}};
-    for (const auto& name : self->backend->TunnelNames()) {
-      try {
-        ctx->results.emplace_back(name, self->backend->Status(name));
-      } catch (...) {
-        // skip this tunnel
-      }
-    }
+    FWG_TRACE_SCOPE("worker.poll");
+    auto* ctx = new StatusPollContext{self, {}, {}, {}, {}};
+    // The per-peer handshakes come out of the same query as the totals.
+    std::vector<std::vector<fwg::PeerStatsCpp>> peers;
+    std::vector<fwg::PeerSetDiff> diffs;
+    ctx->results = fwg::PollTunnelStatuses(self->backend, &peers, &diffs);
+    if (self->metrics != nullptr) self->metrics->Update(ctx->results, peers);
+    // Slots of stopped tunnels are handed to new ones; whatever still
+    // doesn't fit is emitted directly.
+    fwg::PublishPollTick(self->status_segment, ctx->results, &ctx->unplaced);
+    const int64_t now_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    ctx->health = fwg::ObserveHandshakes(&self->backend->health(), ctx->results,
+                                         peers, now_ms, &diffs);
+    // Stale peers with candidate endpoints move in this same tick.
+    fwg::FailOverStalePeers(self->backend, ctx->results, peers, ctx->health,
+                            now_ms);
+    // Usage is a memcpy per tick; a tunnel over its quota stops here.
+    ctx->quota = fwg::RecordUsage(self->usage, self->backend, ctx->results,
+                                  peers, now_ms);
+    FWG_TRACE_INSTANT("worker.idle_add");
     g_idle_add(StatusPollDispatch, ctx);
   }).detach();
   return G_SOURCE_CONTINUE;
 }
 
+// Main-loop watch on the segment's eventfd: emits onTunnelStatus for every
+// slot whose seqlock moved since the last wake-up.
+gboolean StatusSegmentNotify(gint /*fd*/, GIOCondition /*condition*/,
+                             gpointer user_data) {
+  auto* self = FLUTTER_WIREGUARD_PLUGIN(user_data);
+  FWG_TRACE_INSTANT("main.status_eventfd");
+  if (!self->status_view->ConsumeNotification() ||
+      self->flutter_api == nullptr) {
+    return G_SOURCE_CONTINUE;
+  }
+  self->status_view->reader().ForEachChanged(
+      self->status_seen, [self](const fwg::ipc::StatusRecord& r) {
+        FWG_TRACE_SCOPE("main.on_tunnel_status");
+        FlutterWireguardTunnelStatus* status = ToPigeonStatus(r);
+        flutter_wireguard_wireguard_flutter_api_on_tunnel_status(
+            self->flutter_api, status, nullptr, nullptr, nullptr);
+        g_object_unref(status);
+      });
+  return G_SOURCE_CONTINUE;
+}
+
 }  // namespace
 
 static void flutter_wireguard_plugin_dispose(GObject* object) {
@@ -281,9 +1096,23 @@ static void flutter_wireguard_plugin_dispose(GObject* object) {
     g_source_remove(self->poll_timer_id);
     self->poll_timer_id = 0;
   }
+  if (self->status_watch_id != 0) {
+    g_source_remove(self->status_watch_id);
+    self->status_watch_id = 0;
+  }
   g_clear_object(&self->flutter_api);
   delete self->backend;
   self->backend = nullptr;
+  delete self->status_view;
+  self->status_view = nullptr;
+  delete self->status_segment;
+  self->status_segment = nullptr;
+  delete self->status_seen;
+  self->status_seen = nullptr;
+  delete self->metrics;
+  self->metrics = nullptr;
+  delete self->usage;  // flushes the pending batch
+  self->usage = nullptr;
   G_OBJECT_CLASS(flutter_wireguard_plugin_parent_class)->dispose(object);
 }
 
@@ -296,6 +1125,12 @@ static void flutter_wireguard_plugin_init(FlutterWireguardPlugin* self) {
   self->flutter_api = nullptr;
   self->poll_timer_id = 0;
   self->poll_in_flight = false;
+  self->status_segment = nullptr;
+  self->status_view = nullptr;
+  self->status_seen = nullptr;
+  self->status_watch_id = 0;
+  self->metrics = nullptr;
+  self->usage = nullptr;
 }
 
 void flutter_wireguard_plugin_register_with_registrar(FlPluginRegistrar* registrar) {
@@ -304,6 +1139,9 @@ void flutter_wireguard_plugin_register_with_registrar(FlPluginRegistrar* registr
 
   auto runner = std::make_unique<fwg::RealProcessRunner>();
   plugin->backend = new fwg::WgBackend(std::move(runner));
+  // Tunnels left running by a previous session come back as known, so the
+  // first poll tick reports them and status()/stop() work without start().
+  plugin->backend->AdoptRunningTunnels();
 
   FlBinaryMessenger* messenger = fl_plugin_registrar_get_messenger(registrar);
   // Hand strong ownership of `plugin` to the method handlers; the engine will
@@ -312,5 +1150,38 @@ void flutter_wireguard_plugin_register_with_registrar(FlPluginRegistrar* registr
       messenger, /*suffix=*/nullptr, &kVTable, plugin, g_object_unref);
   plugin->flutter_api = flutter_wireguard_wireguard_flutter_api_new(messenger, nullptr);
 
+  try {
+    plugin->status_segment = new fwg::SharedStatusSegment();
+    plugin->status_view = fwg::MapLocalView(*plugin->status_segment).release();
+    plugin->status_seen = new std::vector<uint32_t>();
+    plugin->status_watch_id = g_unix_fd_add(
+        plugin->status_view->eventfd(), G_IO_IN, StatusSegmentNotify, plugin);
+  } catch (const std::exception& e) {
+    g_warning("flutter_wireguard: shared status segment unavailable: %s",
+              e.what());
+    delete plugin->status_segment;
+    plugin->status_segment = nullptr;
+  }
+
+  if (const char* address = std::getenv("FLUTTER_WIREGUARD_METRICS")) {
+    if (*address != '\0') {
+      try {
+        auto metrics = std::make_unique<fwg::MetricsExporter>(address);
+        metrics->Start();
+        g_message("flutter_wireguard: metrics on %s",
+                  metrics->address().c_str());
+        plugin->metrics = metrics.release();
+      } catch (const std::exception& e) {
+        g_warning("flutter_wireguard: metrics exporter disabled: %s", e.what());
+      }
+    }
+  }
+
+  try {
+    plugin->usage = new fwg::UsageLedger(fwg::UsageLedger::DefaultPath());
+  } catch (const std::exception& e) {
+    g_warning("flutter_wireguard: usage ledger disabled: %s", e.what());
+  }
+
   plugin->poll_timer_id = g_timeout_add_seconds(1, StatusPollCallback, plugin);
 }
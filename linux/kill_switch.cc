@@ -0,0 +1,600 @@
+#include "kill_switch.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+#include "endpoint_resolver.h"
+
+namespace flutter_wireguard {
+
+namespace {
+
+using kill_switch_internal::Rule;
+
+std::string Trim(const std::string& s) {
+  const size_t b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos) return "";
+  return s.substr(b, s.find_last_not_of(" \t\r") - b + 1);
+}
+
+std::string Lower(std::string s) {
+  for (char& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return s;
+}
+
+bool ParseSwitch(const std::string& value, bool* on) {
+  const std::string v = Lower(value);
+  if (v == "on" || v == "true" || v == "yes" || v == "1") {
+    *on = true;
+  } else if (v == "off" || v == "false" || v == "no" || v == "0") {
+    *on = false;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool SameEntry(const RouteEntry& a, const RouteEntry& b) {
+  return a.v6 == b.v6 && a.bits == b.bits && a.key == b.key;
+}
+
+size_t AddressBytes(const IpKey& key, bool v6, uint8_t out[16]) {
+  for (int i = 0; i < 8; ++i) {
+    out[i] = static_cast<uint8_t>(key.hi >> (56 - 8 * i));
+    out[8 + i] = static_cast<uint8_t>(key.lo >> (56 - 8 * i));
+  }
+  return v6 ? 16 : 4;
+}
+
+// ----- nft -f -----
+
+std::string NftRule(const Rule& r) {
+  std::string out = "\t\t";
+  if (!r.ifname.empty()) {
+    out += (r.input ? "iifname \"" : "oifname \"") + r.ifname + "\" ";
+  }
+  if (r.has_address) {
+    out += std::string(r.address.v6 ? "ip6" : "ip") +
+           (r.input ? " saddr " : " daddr ") + FormatRouteEntry(r.address) + " ";
+  } else if (r.family != 0) {
+    out += r.family == NFPROTO_IPV6 ? "meta nfproto ipv6 " : "meta nfproto ipv4 ";
+  }
+  if (r.l4 == IPPROTO_UDP) {
+    out += "udp";
+    if (r.remote_port != 0) {
+      out += (r.input ? " sport " : " dport ") + std::to_string(r.remote_port);
+    }
+    if (r.local_port != 0) {
+      out += (r.input ? " dport " : " sport ") + std::to_string(r.local_port);
+    }
+    out += " ";
+  } else if (r.l4 == IPPROTO_ICMPV6) {
+    out += "icmpv6 type " + std::to_string(r.icmp_min) + "-" +
+           std::to_string(r.icmp_max) + " ";
+  }
+  return out + "accept\n";
+}
+
+// ----- NFNL -----
+
+void Put(std::string* b, const void* data, size_t len) {
+  b->append(static_cast<const char*>(data), len);
+}
+
+void PutAttr(std::string* b, uint16_t type, const void* data, size_t len) {
+  nlattr a{};
+  a.nla_len = static_cast<uint16_t>(NLA_HDRLEN + len);
+  a.nla_type = type;
+  Put(b, &a, sizeof(a));
+  Put(b, data, len);
+  b->append(NLA_ALIGN(len) - len, '\0');
+}
+
+void PutU32(std::string* b, uint16_t type, uint32_t host_order) {
+  const uint32_t v = htonl(host_order);
+  PutAttr(b, type, &v, sizeof(v));
+}
+
+void PutString(std::string* b, uint16_t type, const std::string& s) {
+  PutAttr(b, type, s.c_str(), s.size() + 1);
+}
+
+size_t BeginNest(std::string* b, uint16_t type) {
+  const size_t start = b->size();
+  nlattr a{};
+  a.nla_type = type | NLA_F_NESTED;
+  Put(b, &a, sizeof(a));
+  return start;
+}
+
+void EndNest(std::string* b, size_t start) {
+  const uint16_t len = static_cast<uint16_t>(b->size() - start);
+  std::memcpy(&(*b)[start] + offsetof(nlattr, nla_len), &len, sizeof(len));
+}
+
+// NFTA_DATA_VALUE inside a nest of `type`.
+void PutData(std::string* b, uint16_t type, const void* data, size_t len) {
+  const size_t nest = BeginNest(b, type);
+  PutAttr(b, NFTA_DATA_VALUE, data, len);
+  EndNest(b, nest);
+}
+
+// The expressions of one rule, written into NFTA_RULE_EXPRESSIONS. All
+// matching goes through register 1, which holds 16 bytes.
+class ExprWriter {
+ public:
+  explicit ExprWriter(std::string* b) : b_(b) {}
+
+  void Meta(uint32_t key) {
+    Expr("meta", [&] {
+      PutU32(b_, NFTA_META_DREG, NFT_REG_1);
+      PutU32(b_, NFTA_META_KEY, key);
+    });
+  }
+
+  void Payload(uint32_t base, uint32_t offset, uint32_t len) {
+    Expr("payload", [&] {
+      PutU32(b_, NFTA_PAYLOAD_DREG, NFT_REG_1);
+      PutU32(b_, NFTA_PAYLOAD_BASE, base);
+      PutU32(b_, NFTA_PAYLOAD_OFFSET, offset);
+      PutU32(b_, NFTA_PAYLOAD_LEN, len);
+    });
+  }
+
+  // Register 1 &= mask (^ 0).
+  void Mask(const uint8_t* mask, size_t len) {
+    const uint8_t zero[16] = {};
+    Expr("bitwise", [&] {
+      PutU32(b_, NFTA_BITWISE_SREG, NFT_REG_1);
+      PutU32(b_, NFTA_BITWISE_DREG, NFT_REG_1);
+      PutU32(b_, NFTA_BITWISE_LEN, static_cast<uint32_t>(len));
+      PutData(b_, NFTA_BITWISE_MASK, mask, len);
+      PutData(b_, NFTA_BITWISE_XOR, zero, len);
+    });
+  }
+
+  void Cmp(uint32_t op, const void* data, size_t len) {
+    Expr("cmp", [&] {
+      PutU32(b_, NFTA_CMP_SREG, NFT_REG_1);
+      PutU32(b_, NFTA_CMP_OP, op);
+      PutData(b_, NFTA_CMP_DATA, data, len);
+    });
+  }
+
+  void Accept() {
+    Expr("immediate", [&] {
+      PutU32(b_, NFTA_IMMEDIATE_DREG, NFT_REG_VERDICT);
+      const size_t data = BeginNest(b_, NFTA_IMMEDIATE_DATA);
+      const size_t verdict = BeginNest(b_, NFTA_DATA_VERDICT);
+      PutU32(b_, NFTA_VERDICT_CODE, NF_ACCEPT);
+      EndNest(b_, verdict);
+      EndNest(b_, data);
+    });
+  }
+
+ private:
+  template <typename Fn>
+  void Expr(const char* name, Fn body) {
+    const size_t elem = BeginNest(b_, NFTA_LIST_ELEM);
+    PutString(b_, NFTA_EXPR_NAME, name);
+    const size_t data = BeginNest(b_, NFTA_EXPR_DATA);
+    body();
+    EndNest(b_, data);
+    EndNest(b_, elem);
+  }
+
+  std::string* b_;
+};
+
+// The same matches NftRule spells out, as nft itself compiles them.
+void WriteRule(std::string* b, const Rule& r) {
+  ExprWriter w(b);
+  if (!r.ifname.empty()) {
+    char name[IFNAMSIZ] = {};
+    std::memcpy(name, r.ifname.data(), std::min(r.ifname.size(), sizeof(name) - 1));
+    w.Meta(r.input ? NFT_META_IIFNAME : NFT_META_OIFNAME);
+    w.Cmp(NFT_CMP_EQ, name, sizeof(name));
+  }
+  if (r.family != 0) {
+    w.Meta(NFT_META_NFPROTO);
+    w.Cmp(NFT_CMP_EQ, &r.family, 1);
+  }
+  if (r.has_address && r.address.bits > 0) {
+    uint8_t addr[16];
+    const size_t len = AddressBytes(r.address.key, r.address.v6, addr);
+    // saddr / daddr: 12 / 16 in IPv4, 8 / 24 in IPv6.
+    const uint32_t offset = r.address.v6 ? (r.input ? 8 : 24) : (r.input ? 12 : 16);
+    w.Payload(NFT_PAYLOAD_NETWORK_HEADER, offset, static_cast<uint32_t>(len));
+    if (r.address.bits < len * 8) {
+      uint8_t mask[16];
+      AddressBytes(allowed_ips_internal::Masked(IpKey{~uint64_t{0}, ~uint64_t{0}},
+                                                r.address.bits),
+                   true, mask);
+      w.Mask(mask, len);
+    }
+    w.Cmp(NFT_CMP_EQ, addr, len);
+  }
+  if (r.l4 != 0) {
+    w.Meta(NFT_META_L4PROTO);
+    w.Cmp(NFT_CMP_EQ, &r.l4, 1);
+  }
+  // sport / dport: 0 / 2 in both TCP and UDP.
+  const uint16_t ports[2] = {r.input ? r.remote_port : r.local_port,
+                             r.input ? r.local_port : r.remote_port};
+  for (uint32_t i = 0; i < 2; ++i) {
+    if (ports[i] == 0) continue;
+    const uint16_t port = htons(ports[i]);
+    w.Payload(NFT_PAYLOAD_TRANSPORT_HEADER, 2 * i, 2);
+    w.Cmp(NFT_CMP_EQ, &port, 2);
+  }
+  if (r.l4 == IPPROTO_ICMPV6) {
+    w.Payload(NFT_PAYLOAD_TRANSPORT_HEADER, 0, 1);  // type
+    w.Cmp(NFT_CMP_GTE, &r.icmp_min, 1);
+    w.Cmp(NFT_CMP_LTE, &r.icmp_max, 1);
+  }
+  w.Accept();
+}
+
+// Appends a message header and nfgenmsg; EndMessage fills in the length.
+size_t BeginMessage(std::string* b, uint16_t type, uint16_t flags, uint32_t seq,
+                    uint8_t family, uint16_t res_id) {
+  const size_t start = b->size();
+  nlmsghdr nh{};
+  nh.nlmsg_type = type;
+  nh.nlmsg_flags = NLM_F_REQUEST | flags;
+  nh.nlmsg_seq = seq;
+  Put(b, &nh, sizeof(nh));
+  nfgenmsg g{};
+  g.nfgen_family = family;
+  g.version = NFNETLINK_V0;
+  g.res_id = htons(res_id);
+  Put(b, &g, NLMSG_ALIGN(sizeof(g)));
+  return start;
+}
+
+void EndMessage(std::string* b, size_t start) {
+  const uint32_t len = static_cast<uint32_t>(b->size() - start);
+  std::memcpy(&(*b)[start] + offsetof(nlmsghdr, nlmsg_len), &len, sizeof(len));
+}
+
+constexpr uint16_t NftType(int msg) {
+  return static_cast<uint16_t>((NFNL_SUBSYS_NFTABLES << 8) | msg);
+}
+
+}  // namespace
+
+bool TakeOverKillSwitch(const std::string& config, std::string* wg_quick_config,
+                        KillSwitchPlan* plan) {
+  bool on = false;
+  KillSwitchPlan p;
+  std::vector<std::string> endpoints;
+  bool in_interface = false;
+  bool in_peer = false;
+  std::string out;
+  std::istringstream in(config);
+  std::string line;
+  while (std::getline(in, line)) {
+    const std::string body = line.substr(0, line.find('#'));
+    const size_t eq = body.find('=');
+    const std::string key = Lower(Trim(body.substr(0, eq)));
+    const std::string value = eq == std::string::npos ? "" : Trim(body.substr(eq + 1));
+    if (!key.empty() && key[0] == '[') {
+      in_interface = key == "[interface]";
+      in_peer = key == "[peer]";
+    } else if (in_interface && key == "killswitch") {
+      if (!ParseSwitch(value, &on)) {
+        throw std::invalid_argument("KillSwitch must be on or off, not '" + value + "'");
+      }
+      continue;
+    } else if (in_interface && key == "killswitchbypass") {
+      std::istringstream items(value);
+      std::string item;
+      while (std::getline(items, item, ',')) {
+        item = Trim(item);
+        if (item.empty()) continue;
+        RouteEntry e;
+        if (!ParseIpPrefix(item, &e.key, &e.bits, &e.v6)) {
+          throw std::invalid_argument("KillSwitchBypass: '" + item +
+                                      "' is not an IP prefix");
+        }
+        p.bypass.push_back(e);
+      }
+      continue;
+    } else if (in_peer && key == "endpoint") {
+      std::istringstream items(value);
+      std::string item;
+      while (std::getline(items, item, ',')) endpoints.push_back(Trim(item));
+    }
+    out += line + "\n";
+  }
+  *wg_quick_config = std::move(out);
+  if (!on) return false;
+  for (const auto& e : endpoints) AddKillSwitchEndpoint(e, &p);
+  *plan = std::move(p);
+  return true;
+}
+
+bool AddKillSwitchEndpoint(const std::string& endpoint, KillSwitchPlan* plan) {
+  std::string host, port;
+  KillSwitchEndpoint e;
+  if (!SplitEndpoint(endpoint, &host, &port) ||
+      !ParseIpAddress(host, &e.address.key, &e.address.v6) || port.size() > 5 ||
+      port.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  const unsigned long n = std::stoul(port);
+  if (n == 0 || n > 65535) return false;
+  e.address.bits = e.address.v6 ? 128 : 32;
+  e.port = static_cast<uint16_t>(n);
+  for (const auto& have : plan->endpoints) {
+    if (have.port == e.port && SameEntry(have.address, e.address)) return true;
+  }
+  plan->endpoints.push_back(e);
+  return true;
+}
+
+namespace kill_switch_internal {
+
+std::vector<Rule> Rules(const KillSwitchSet& tunnels) {
+  std::vector<Rule> out;
+  for (const bool input : {false, true}) {
+    Rule r;
+    r.input = input;
+    Rule lo = r;
+    lo.ifname = "lo";
+    out.push_back(lo);
+    for (const auto& [iface, plan] : tunnels) {
+      Rule tunnel = r;
+      tunnel.ifname = iface;
+      out.push_back(tunnel);
+      for (const auto& e : plan.endpoints) {
+        Rule peer = r;
+        peer.family = e.address.v6 ? NFPROTO_IPV6 : NFPROTO_IPV4;
+        peer.has_address = true;
+        peer.address = e.address;
+        peer.l4 = IPPROTO_UDP;
+        peer.remote_port = e.port;
+        out.push_back(peer);
+      }
+      for (const auto& b : plan.bypass) {
+        Rule lan = r;
+        lan.family = b.v6 ? NFPROTO_IPV6 : NFPROTO_IPV4;
+        lan.has_address = true;
+        lan.address = b;
+        out.push_back(lan);
+      }
+    }
+    // A lease has to be renewed, from an address no bypass may cover.
+    Rule dhcp4 = r;
+    dhcp4.family = NFPROTO_IPV4;
+    dhcp4.l4 = IPPROTO_UDP;
+    Rule dhcp6 = dhcp4;
+    dhcp6.family = NFPROTO_IPV6;
+    if (input) {
+      dhcp4.local_port = 68;
+      dhcp6.local_port = 546;
+    } else {
+      dhcp4.remote_port = 67;
+      dhcp6.remote_port = 547;
+    }
+    out.push_back(dhcp4);
+    out.push_back(dhcp6);
+    // Router and neighbour solicitation and advertisement, without which
+    // IPv6 on the physical link stops resolving the next hop.
+    Rule nd = r;
+    nd.family = NFPROTO_IPV6;
+    nd.l4 = IPPROTO_ICMPV6;
+    nd.icmp_min = 133;
+    nd.icmp_max = 136;
+    out.push_back(nd);
+  }
+  return out;
+}
+
+}  // namespace kill_switch_internal
+
+std::string KillSwitchRecords(const KillSwitchSet& tunnels) {
+  std::string out;
+  for (const auto& [iface, plan] : tunnels) {
+    out += iface + " on\n";
+    for (const auto& e : plan.endpoints) {
+      out += iface + " endpoint " + FormatRouteEntry(e.address) + " " +
+             std::to_string(e.port) + "\n";
+    }
+    for (const auto& b : plan.bypass) {
+      out += iface + " bypass " + FormatRouteEntry(b) + "\n";
+    }
+  }
+  return out;
+}
+
+KillSwitchSet ParseKillSwitchRecords(const std::string& records) {
+  KillSwitchSet out;
+  std::istringstream in(records);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string iface, kind, prefix;
+    unsigned long port = 0;
+    if (!(fields >> iface >> kind)) continue;
+    if (kind == "on") {
+      out[iface];
+      continue;
+    }
+    auto it = out.find(iface);
+    if (it == out.end() || !(fields >> prefix)) continue;
+    RouteEntry e;
+    if (!ParseIpPrefix(prefix, &e.key, &e.bits, &e.v6)) continue;
+    if (kind == "bypass") {
+      it->second.bypass.push_back(e);
+    } else if (kind == "endpoint" && (fields >> port) && port > 0 && port <= 65535) {
+      it->second.endpoints.push_back({e, static_cast<uint16_t>(port)});
+    }
+  }
+  return out;
+}
+
+void SaveKillSwitchRecords(const std::string& path, const KillSwitchSet& tunnels) {
+  if (tunnels.empty()) {
+    if (::unlink(path.c_str()) != 0 && errno != ENOENT) {
+      throw std::runtime_error(path + ": " + std::strerror(errno));
+    }
+    return;
+  }
+  const std::string tmp = path + ".tmp";
+  const std::string records = KillSwitchRecords(tunnels);
+  const int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) throw std::runtime_error(tmp + ": " + std::strerror(errno));
+  // open() applies the umask; the unprivileged plugin has to read it.
+  const bool ok = ::fchmod(fd, 0644) == 0 &&
+                  ::write(fd, records.data(), records.size()) ==
+                      static_cast<ssize_t>(records.size());
+  const int error = errno;
+  ::close(fd);
+  if (!ok || ::rename(tmp.c_str(), path.c_str()) != 0) {
+    const int e = ok ? errno : error;
+    ::unlink(tmp.c_str());
+    throw std::runtime_error(path + ": " + std::strerror(e));
+  }
+}
+
+std::string NftScript(const KillSwitchSet& tunnels) {
+  // Declaring the table first makes deleting it safe when there is none.
+  const std::string table = std::string("table inet ") + kKillSwitchTable;
+  std::string out = table + "\ndelete " + table + "\n";
+  if (tunnels.empty()) return out;
+  out += table + " {\n";
+  const auto rules = kill_switch_internal::Rules(tunnels);
+  for (const bool input : {false, true}) {
+    const char* hook = input ? "input" : "output";
+    out += std::string("\tchain ") + hook + " {\n\t\ttype filter hook " + hook +
+           " priority 0; policy drop;\n";
+    for (const auto& r : rules) {
+      if (r.input == input) out += NftRule(r);
+    }
+    out += "\t}\n";
+  }
+  return out + "}\n";
+}
+
+std::unique_ptr<NetlinkChannel> OpenNetfilterChannel() {
+  return OpenNetlinkChannel(NETLINK_NETFILTER);
+}
+
+KillSwitchInstaller::KillSwitchInstaller(std::unique_ptr<NetlinkChannel> channel)
+    : channel_(std::move(channel)) {}
+
+size_t KillSwitchInstaller::Begin(int type, uint16_t flags, const std::string& what) {
+  what_.push_back(what);
+  return BeginMessage(&buf_, NftType(type), flags | NLM_F_ACK,
+                      seq_ + static_cast<uint32_t>(what_.size()), NFPROTO_INET, 0);
+}
+
+void KillSwitchInstaller::Install(const KillSwitchSet& tunnels) {
+  const std::string table = kKillSwitchTable;
+  buf_.clear();
+  what_.clear();
+  // Created if missing, so that deleting it cannot fail, then (unless the
+  // set is empty) created anew.
+  std::vector<int> tables = {NFT_MSG_NEWTABLE, NFT_MSG_DELTABLE};
+  if (!tunnels.empty()) tables.push_back(NFT_MSG_NEWTABLE);
+  for (int type : tables) {
+    const size_t m = Begin(type, type == NFT_MSG_NEWTABLE ? NLM_F_CREATE : 0,
+                           "table " + table);
+    PutString(&buf_, NFTA_TABLE_NAME, table);
+    EndMessage(&buf_, m);
+  }
+  if (!tunnels.empty()) {
+    for (const bool input : {false, true}) {
+      const char* chain = input ? "input" : "output";
+      const size_t m = Begin(NFT_MSG_NEWCHAIN, NLM_F_CREATE, std::string("chain ") + chain);
+      PutString(&buf_, NFTA_CHAIN_TABLE, table);
+      PutString(&buf_, NFTA_CHAIN_NAME, chain);
+      const size_t hook = BeginNest(&buf_, NFTA_CHAIN_HOOK);
+      PutU32(&buf_, NFTA_HOOK_HOOKNUM, input ? NF_INET_LOCAL_IN : NF_INET_LOCAL_OUT);
+      PutU32(&buf_, NFTA_HOOK_PRIORITY, 0);
+      EndNest(&buf_, hook);
+      PutU32(&buf_, NFTA_CHAIN_POLICY, NF_DROP);
+      PutString(&buf_, NFTA_CHAIN_TYPE, "filter");
+      EndMessage(&buf_, m);
+    }
+    for (const auto& r : kill_switch_internal::Rules(tunnels)) {
+      const char* chain = r.input ? "input" : "output";
+      std::string rule = NftRule(r);
+      rule = rule.substr(2, rule.size() - 3);  // the tabs and newline
+      const size_t m = Begin(NFT_MSG_NEWRULE, NLM_F_CREATE | NLM_F_APPEND,
+                             std::string("rule ") + chain + " '" + rule + "'");
+      PutString(&buf_, NFTA_RULE_TABLE, table);
+      PutString(&buf_, NFTA_RULE_CHAIN, chain);
+      const size_t exprs = BeginNest(&buf_, NFTA_RULE_EXPRESSIONS);
+      WriteRule(&buf_, r);
+      EndNest(&buf_, exprs);
+      EndMessage(&buf_, m);
+    }
+  }
+  Commit();
+}
+
+void KillSwitchInstaller::Commit() {
+  // The batch markers carry sequence 0: the kernel answers one only when
+  // it refuses the batch as a whole.
+  std::string batch;
+  EndMessage(&batch, BeginMessage(&batch, NFNL_MSG_BATCH_BEGIN, 0, 0, AF_UNSPEC,
+                                  NFNL_SUBSYS_NFTABLES));
+  batch += buf_;
+  EndMessage(&batch, BeginMessage(&batch, NFNL_MSG_BATCH_END, 0, 0, AF_UNSPEC,
+                                  NFNL_SUBSYS_NFTABLES));
+  const uint32_t first_seq = seq_ + 1;
+  seq_ += static_cast<uint32_t>(what_.size());
+  channel_->Send(batch);
+  ++batches_sent_;
+
+  // Every message is acked, refused or not, so a failed batch still names
+  // its first bad message.
+  std::vector<int> errors(what_.size(), 1);
+  size_t pending = what_.size();
+  while (pending > 0) {
+    const std::string reply = channel_->Receive();
+    int left = static_cast<int>(reply.size());
+    for (auto* nh = reinterpret_cast<const nlmsghdr*>(reply.data());
+         NLMSG_OK(nh, left); nh = NLMSG_NEXT(nh, left)) {
+      if (nh->nlmsg_type != NLMSG_ERROR ||
+          nh->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr))) {
+        continue;
+      }
+      const int error = static_cast<const nlmsgerr*>(NLMSG_DATA(nh))->error;
+      const uint32_t offset = nh->nlmsg_seq - first_seq;
+      if (offset >= what_.size()) {
+        if (error != 0) {
+          throw std::runtime_error(std::string("nftables: ") + std::strerror(-error));
+        }
+        continue;
+      }
+      if (errors[offset] != 1) continue;
+      errors[offset] = error;
+      --pending;
+    }
+  }
+  for (size_t i = 0; i < what_.size(); ++i) {
+    if (errors[i] < 0) {
+      throw std::runtime_error(what_[i] + ": " + std::strerror(-errors[i]));
+    }
+  }
+}
+
+}  // namespace flutter_wireguard
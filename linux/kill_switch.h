@@ -0,0 +1,155 @@
+// Kill switches for tunnels, as one nftables table committed in one
+// transaction.
+//
+// The usual recipe is a handful of `PostUp = iptables ...` lines, which
+// wg-quick forks one at a time after the link is already up: until the last
+// of them has run some traffic still leaves outside the tunnel, and a
+// failing one leaves half a firewall behind. Instead a config may say
+//
+//   [Interface]
+//   KillSwitch = on
+//   KillSwitchBypass = 192.168.1.0/24, fd00:1::/64
+//
+// and WgBackend strips those lines (wg-quick rejects keys it does not know)
+// and, before wg-quick runs, arms table `inet flutter_wireguard`: an input
+// and an output chain whose policy is drop, accepting loopback, the tunnel
+// interface, UDP to and from each peer endpoint (every failover candidate
+// included), the bypass prefixes, DHCP and ICMPv6 neighbour discovery, and
+// nothing else.
+//
+// nftables drops a packet that any base chain drops, so a table per tunnel
+// would have each kill switch block every other tunnel. There is one table
+// instead, holding the rules of every tunnel that has a kill switch
+// (KillSwitchSet), and every change to that set (a Start, a Stop, an
+// endpoint that moved) replaces it whole:
+//
+//   * With CAP_NET_ADMIN in-process KillSwitchInstaller sends the new table
+//     as one NFNL batch over NETLINK_NETFILTER, with the old one deleted at
+//     its head. The kernel applies every message of a batch or none, so
+//     there is no moment with half a ruleset, or with none.
+//   * Through the pkexec shell the same ruleset goes to a single
+//     `nft -f -` (NftScript), which nft also commits as one batch.
+//
+// Stop brings the link down first and then drops its rules, deleting the
+// table with the last of them. A crash leaves the table in place, i.e.
+// fails closed. Whoever commits the table also records the set it holds in
+// /run/flutter_wireguard/killswitch (KillSwitchRecords), readable without
+// privileges: a restarted plugin takes back the plans of the tunnels it
+// adopts, and rebuilds the table without those that are gone, deleting it
+// if none are left.
+#ifndef FLUTTER_WIREGUARD_KILL_SWITCH_H_
+#define FLUTTER_WIREGUARD_KILL_SWITCH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "route_installer.h"
+
+namespace flutter_wireguard {
+
+struct KillSwitchEndpoint {
+  RouteEntry address;  // a host prefix
+  uint16_t port = 0;
+};
+
+struct KillSwitchPlan {
+  std::vector<KillSwitchEndpoint> endpoints;  // peers, UDP both ways
+  std::vector<RouteEntry> bypass;             // KillSwitchBypass
+};
+
+// Splits KillSwitch and KillSwitchBypass out of `config`'s [Interface] and
+// sets *wg_quick_config to the rest, whether or not the switch is on. If it
+// is, fills *plan with the bypass prefixes and every numeric [Peer]
+// Endpoint and returns true. Throws std::invalid_argument for a KillSwitch
+// value other than on/off (true/false, yes/no, 1/0) or a bypass entry that
+// is not an IP prefix. `wg_quick_config` may be `&config`.
+bool TakeOverKillSwitch(const std::string& config, std::string* wg_quick_config,
+                        KillSwitchPlan* plan);
+
+// Adds numeric "host:port" `endpoint` to *plan unless it is there already.
+// False if `endpoint` is not numeric.
+bool AddKillSwitchEndpoint(const std::string& endpoint, KillSwitchPlan* plan);
+
+// Interface name -> that tunnel's plan.
+using KillSwitchSet = std::map<std::string, KillSwitchPlan>;
+
+// The nftables table, family inet, that holds every kill switch.
+inline constexpr char kKillSwitchTable[] = "flutter_wireguard";
+
+namespace kill_switch_internal {
+
+// One accept rule. Every field left at its default matches anything.
+struct Rule {
+  bool input = false;     // the input chain, else output
+  std::string ifname;     // iifname / oifname
+  uint8_t family = 0;     // NFPROTO_IPV4 / NFPROTO_IPV6
+  bool has_address = false;
+  RouteEntry address;     // saddr on input, daddr on output
+  uint8_t l4 = 0;         // IPPROTO_*
+  uint16_t remote_port = 0;  // sport on input, dport on output
+  uint16_t local_port = 0;   // dport on input, sport on output
+  uint8_t icmp_min = 0;   // ICMPv6 type range, with l4 = IPPROTO_ICMPV6
+  uint8_t icmp_max = 0;
+};
+
+// The table's accept rules for `tunnels`, in order, both chains.
+std::vector<Rule> Rules(const KillSwitchSet& tunnels);
+
+}  // namespace kill_switch_internal
+
+// Next to the staged configs, holding KillSwitchRecords of the table's set.
+// World-readable: it has endpoints and prefixes, no keys.
+inline constexpr char kKillSwitchStateFile[] = "killswitch";
+
+// `tunnels` as text, one line per item: "<iface> on" for each tunnel, then
+// "<iface> endpoint <address>/<bits> <port>" and "<iface> bypass <prefix>".
+std::string KillSwitchRecords(const KillSwitchSet& tunnels);
+
+// The inverse of KillSwitchRecords. Lines it can't parse are skipped.
+KillSwitchSet ParseKillSwitchRecords(const std::string& records);
+
+// Writes KillSwitchRecords(tunnels) to `path` (0644, by rename), or removes
+// `path` if `tunnels` is empty. Throws std::runtime_error.
+void SaveKillSwitchRecords(const std::string& path, const KillSwitchSet& tunnels);
+
+// `nft -f` input that replaces the table with one for `tunnels`, or
+// deletes it if `tunnels` is empty, in one transaction. Also fine when
+// there is no table yet.
+std::string NftScript(const KillSwitchSet& tunnels);
+
+// A NETLINK_NETFILTER socket. Throws std::runtime_error.
+std::unique_ptr<NetlinkChannel> OpenNetfilterChannel();
+
+class KillSwitchInstaller {
+ public:
+  explicit KillSwitchInstaller(std::unique_ptr<NetlinkChannel> channel);
+
+  // Replaces the table with one for `tunnels`, or deletes it if `tunnels`
+  // is empty, in one batch. Throws std::runtime_error naming the first
+  // message the kernel refused, in which case nothing changed.
+  void Install(const KillSwitchSet& tunnels);
+
+  // Batches sent so far.
+  size_t batches_sent() const { return batches_sent_; }
+
+ private:
+  // Appends a message to buf_ for Commit; `what` names it in errors.
+  size_t Begin(int type, uint16_t flags, const std::string& what);
+
+  // Frames buf_'s messages as one batch, sends it and waits for every ack.
+  void Commit();
+
+  std::unique_ptr<NetlinkChannel> channel_;
+  uint32_t seq_ = 0;
+  size_t batches_sent_ = 0;
+  std::string buf_;
+  std::vector<std::string> what_;  // one per message in buf_
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_KILL_SWITCH_H_
@@ -381,569 +381,2930 @@ guint flutter_wireguard_backend_info_hash(FlutterWireguardBackendInfo* self) {
   return result;
 }
 
-struct _FlutterWireguardMessageCodec {
-  FlStandardMessageCodec parent_instance;
+struct _FlutterWireguardTunnelSpec {
+  GObject parent_instance;
 
+  gchar* name;
+  gchar* config;
 };
 
-G_DEFINE_TYPE(FlutterWireguardMessageCodec, flutter_wireguard_message_codec, fl_standard_message_codec_get_type())
-
-const int flutter_wireguard_tunnel_state_type_id = 129;
-const int flutter_wireguard_backend_kind_type_id = 130;
-const int flutter_wireguard_tunnel_status_type_id = 131;
-const int flutter_wireguard_backend_info_type_id = 132;
+G_DEFINE_TYPE(FlutterWireguardTunnelSpec, flutter_wireguard_tunnel_spec, G_TYPE_OBJECT)
 
-static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_state(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
-  uint8_t type = flutter_wireguard_tunnel_state_type_id;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+static void flutter_wireguard_tunnel_spec_dispose(GObject* object) {
+  FlutterWireguardTunnelSpec* self = FLUTTER_WIREGUARD_TUNNEL_SPEC(object);
+  g_clear_pointer(&self->name, g_free);
+  g_clear_pointer(&self->config, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_tunnel_spec_parent_class)->dispose(object);
 }
 
-static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_backend_kind(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
-  uint8_t type = flutter_wireguard_backend_kind_type_id;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+static void flutter_wireguard_tunnel_spec_init(FlutterWireguardTunnelSpec* self) {
 }
 
-static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_status(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelStatus* value, GError** error) {
-  uint8_t type = flutter_wireguard_tunnel_status_type_id;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  g_autoptr(FlValue) values = flutter_wireguard_tunnel_status_to_list(value);
-  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+static void flutter_wireguard_tunnel_spec_class_init(FlutterWireguardTunnelSpecClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_tunnel_spec_dispose;
 }
 
-static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_backend_info(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardBackendInfo* value, GError** error) {
-  uint8_t type = flutter_wireguard_backend_info_type_id;
-  g_byte_array_append(buffer, &type, sizeof(uint8_t));
-  g_autoptr(FlValue) values = flutter_wireguard_backend_info_to_list(value);
-  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+FlutterWireguardTunnelSpec* flutter_wireguard_tunnel_spec_new(const gchar* name, const gchar* config) {
+  FlutterWireguardTunnelSpec* self = FLUTTER_WIREGUARD_TUNNEL_SPEC(g_object_new(flutter_wireguard_tunnel_spec_get_type(), nullptr));
+  self->name = g_strdup(name);
+  self->config = g_strdup(config);
+  return self;
 }
 
-static gboolean flutter_wireguard_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
-  if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
-    switch (fl_value_get_custom_type(value)) {
-      case flutter_wireguard_tunnel_state_type_id:
-        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_state(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
-      case flutter_wireguard_backend_kind_type_id:
-        return flutter_wireguard_message_codec_write_flutter_wireguard_backend_kind(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
-      case flutter_wireguard_tunnel_status_type_id:
-        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_status(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_STATUS(fl_value_get_custom_value_object(value)), error);
-      case flutter_wireguard_backend_info_type_id:
-        return flutter_wireguard_message_codec_write_flutter_wireguard_backend_info(codec, buffer, FLUTTER_WIREGUARD_BACKEND_INFO(fl_value_get_custom_value_object(value)), error);
-    }
-  }
+const gchar* flutter_wireguard_tunnel_spec_get_name(FlutterWireguardTunnelSpec* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_SPEC(self), nullptr);
+  return self->name;
+}
 
-  return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_wireguard_message_codec_parent_class)->write_value(codec, buffer, value, error);
+const gchar* flutter_wireguard_tunnel_spec_get_config(FlutterWireguardTunnelSpec* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_SPEC(self), nullptr);
+  return self->config;
 }
 
-static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_state(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  return fl_value_new_custom(flutter_wireguard_tunnel_state_type_id, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+static FlValue* flutter_wireguard_tunnel_spec_to_list(FlutterWireguardTunnelSpec* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->name));
+  fl_value_append_take(values, fl_value_new_string(self->config));
+  return values;
 }
 
-static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_backend_kind(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  return fl_value_new_custom(flutter_wireguard_backend_kind_type_id, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+static FlutterWireguardTunnelSpec* flutter_wireguard_tunnel_spec_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* config = fl_value_get_string(value1);
+  return flutter_wireguard_tunnel_spec_new(name, config);
 }
 
-static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_status(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
-  if (values == nullptr) {
-    return nullptr;
+gboolean flutter_wireguard_tunnel_spec_equals(FlutterWireguardTunnelSpec* a, FlutterWireguardTunnelSpec* b) {
+  if (a == b) {
+    return TRUE;
   }
-
-  g_autoptr(FlutterWireguardTunnelStatus) value = flutter_wireguard_tunnel_status_new_from_list(values);
-  if (value == nullptr) {
-    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
-    return nullptr;
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->name, b->name) != 0) {
+    return FALSE;
   }
+  if (g_strcmp0(a->config, b->config) != 0) {
+    return FALSE;
+  }
+  return TRUE;
+}
 
-  return fl_value_new_custom_object(flutter_wireguard_tunnel_status_type_id, G_OBJECT(value));
+guint flutter_wireguard_tunnel_spec_hash(FlutterWireguardTunnelSpec* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_SPEC(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->name != nullptr ? g_str_hash(self->name) : 0);
+  result = result * 31 + (self->config != nullptr ? g_str_hash(self->config) : 0);
+  return result;
 }
 
-static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_backend_info(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
-  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
-  if (values == nullptr) {
-    return nullptr;
-  }
+struct _FlutterWireguardTunnelResult {
+  GObject parent_instance;
 
-  g_autoptr(FlutterWireguardBackendInfo) value = flutter_wireguard_backend_info_new_from_list(values);
-  if (value == nullptr) {
-    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
-    return nullptr;
-  }
+  gchar* name;
+  gboolean ok;
+  gchar* error;
+};
 
-  return fl_value_new_custom_object(flutter_wireguard_backend_info_type_id, G_OBJECT(value));
-}
+G_DEFINE_TYPE(FlutterWireguardTunnelResult, flutter_wireguard_tunnel_result, G_TYPE_OBJECT)
 
-static FlValue* flutter_wireguard_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
-  switch (type) {
-    case flutter_wireguard_tunnel_state_type_id:
-      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_state(codec, buffer, offset, error);
-    case flutter_wireguard_backend_kind_type_id:
-      return flutter_wireguard_message_codec_read_flutter_wireguard_backend_kind(codec, buffer, offset, error);
-    case flutter_wireguard_tunnel_status_type_id:
-      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_status(codec, buffer, offset, error);
-    case flutter_wireguard_backend_info_type_id:
-      return flutter_wireguard_message_codec_read_flutter_wireguard_backend_info(codec, buffer, offset, error);
-    default:
-      return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_wireguard_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
-  }
+static void flutter_wireguard_tunnel_result_dispose(GObject* object) {
+  FlutterWireguardTunnelResult* self = FLUTTER_WIREGUARD_TUNNEL_RESULT(object);
+  g_clear_pointer(&self->name, g_free);
+  g_clear_pointer(&self->error, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_tunnel_result_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_message_codec_init(FlutterWireguardMessageCodec* self) {
+static void flutter_wireguard_tunnel_result_init(FlutterWireguardTunnelResult* self) {
 }
 
-static void flutter_wireguard_message_codec_class_init(FlutterWireguardMessageCodecClass* klass) {
-  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->write_value = flutter_wireguard_message_codec_write_value;
-  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->read_value_of_type = flutter_wireguard_message_codec_read_value_of_type;
+static void flutter_wireguard_tunnel_result_class_init(FlutterWireguardTunnelResultClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_tunnel_result_dispose;
 }
 
-static FlutterWireguardMessageCodec* flutter_wireguard_message_codec_new() {
-  FlutterWireguardMessageCodec* self = FLUTTER_WIREGUARD_MESSAGE_CODEC(g_object_new(flutter_wireguard_message_codec_get_type(), nullptr));
+FlutterWireguardTunnelResult* flutter_wireguard_tunnel_result_new(const gchar* name, gboolean ok, const gchar* error) {
+  FlutterWireguardTunnelResult* self = FLUTTER_WIREGUARD_TUNNEL_RESULT(g_object_new(flutter_wireguard_tunnel_result_get_type(), nullptr));
+  self->name = g_strdup(name);
+  self->ok = ok;
+  if (error != nullptr) {
+    self->error = g_strdup(error);
+  }
+  else {
+    self->error = nullptr;
+  }
   return self;
 }
 
-struct _FlutterWireguardWireguardHostApiResponseHandle {
-  GObject parent_instance;
-
-  FlBasicMessageChannel* channel;
-  FlBasicMessageChannelResponseHandle* response_handle;
-};
+const gchar* flutter_wireguard_tunnel_result_get_name(FlutterWireguardTunnelResult* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_RESULT(self), nullptr);
+  return self->name;
+}
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiResponseHandle, flutter_wireguard_wireguard_host_api_response_handle, G_TYPE_OBJECT)
+gboolean flutter_wireguard_tunnel_result_get_ok(FlutterWireguardTunnelResult* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_RESULT(self), FALSE);
+  return self->ok;
+}
 
-static void flutter_wireguard_wireguard_host_api_response_handle_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiResponseHandle* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RESPONSE_HANDLE(object);
-  g_clear_object(&self->channel);
-  g_clear_object(&self->response_handle);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_response_handle_parent_class)->dispose(object);
+const gchar* flutter_wireguard_tunnel_result_get_error(FlutterWireguardTunnelResult* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_RESULT(self), nullptr);
+  return self->error;
 }
 
-static void flutter_wireguard_wireguard_host_api_response_handle_init(FlutterWireguardWireguardHostApiResponseHandle* self) {
+static FlValue* flutter_wireguard_tunnel_result_to_list(FlutterWireguardTunnelResult* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->name));
+  fl_value_append_take(values, fl_value_new_bool(self->ok));
+  fl_value_append_take(values, self->error != nullptr ? fl_value_new_string(self->error) : fl_value_new_null());
+  return values;
 }
 
-static void flutter_wireguard_wireguard_host_api_response_handle_class_init(FlutterWireguardWireguardHostApiResponseHandleClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_response_handle_dispose;
+static FlutterWireguardTunnelResult* flutter_wireguard_tunnel_result_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  gboolean ok = fl_value_get_bool(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  const gchar* error = nullptr;
+  if (fl_value_get_type(value2) != FL_VALUE_TYPE_NULL) {
+    error = fl_value_get_string(value2);
+  }
+  return flutter_wireguard_tunnel_result_new(name, ok, error);
 }
 
-static FlutterWireguardWireguardHostApiResponseHandle* flutter_wireguard_wireguard_host_api_response_handle_new(FlBasicMessageChannel* channel, FlBasicMessageChannelResponseHandle* response_handle) {
-  FlutterWireguardWireguardHostApiResponseHandle* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RESPONSE_HANDLE(g_object_new(flutter_wireguard_wireguard_host_api_response_handle_get_type(), nullptr));
-  self->channel = FL_BASIC_MESSAGE_CHANNEL(g_object_ref(channel));
-  self->response_handle = FL_BASIC_MESSAGE_CHANNEL_RESPONSE_HANDLE(g_object_ref(response_handle));
-  return self;
+gboolean flutter_wireguard_tunnel_result_equals(FlutterWireguardTunnelResult* a, FlutterWireguardTunnelResult* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->name, b->name) != 0) {
+    return FALSE;
+  }
+  if (a->ok != b->ok) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->error, b->error) != 0) {
+    return FALSE;
+  }
+  return TRUE;
 }
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStartResponse, flutter_wireguard_wireguard_host_api_start_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_START_RESPONSE, GObject)
+guint flutter_wireguard_tunnel_result_hash(FlutterWireguardTunnelResult* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_RESULT(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->name != nullptr ? g_str_hash(self->name) : 0);
+  result = result * 31 + static_cast<guint>(self->ok);
+  result = result * 31 + (self->error != nullptr ? g_str_hash(self->error) : 0);
+  return result;
+}
 
-struct _FlutterWireguardWireguardHostApiStartResponse {
+struct _FlutterWireguardPhaseStats {
   GObject parent_instance;
 
-  FlValue* value;
+  gchar* op;
+  gchar* phase;
+  int64_t count;
+  double p50_ms;
+  double p95_ms;
+  double p99_ms;
 };
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStartResponse, flutter_wireguard_wireguard_host_api_start_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterWireguardPhaseStats, flutter_wireguard_phase_stats, G_TYPE_OBJECT)
 
-static void flutter_wireguard_wireguard_host_api_start_response_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_start_response_parent_class)->dispose(object);
+static void flutter_wireguard_phase_stats_dispose(GObject* object) {
+  FlutterWireguardPhaseStats* self = FLUTTER_WIREGUARD_PHASE_STATS(object);
+  g_clear_pointer(&self->op, g_free);
+  g_clear_pointer(&self->phase, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_phase_stats_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_wireguard_host_api_start_response_init(FlutterWireguardWireguardHostApiStartResponse* self) {
+static void flutter_wireguard_phase_stats_init(FlutterWireguardPhaseStats* self) {
 }
 
-static void flutter_wireguard_wireguard_host_api_start_response_class_init(FlutterWireguardWireguardHostApiStartResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_start_response_dispose;
+static void flutter_wireguard_phase_stats_class_init(FlutterWireguardPhaseStatsClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_phase_stats_dispose;
 }
 
-static FlutterWireguardWireguardHostApiStartResponse* flutter_wireguard_wireguard_host_api_start_response_new() {
-  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_null());
+FlutterWireguardPhaseStats* flutter_wireguard_phase_stats_new(const gchar* op, const gchar* phase, int64_t count, double p50_ms, double p95_ms, double p99_ms) {
+  FlutterWireguardPhaseStats* self = FLUTTER_WIREGUARD_PHASE_STATS(g_object_new(flutter_wireguard_phase_stats_get_type(), nullptr));
+  self->op = g_strdup(op);
+  self->phase = g_strdup(phase);
+  self->count = count;
+  self->p50_ms = p50_ms;
+  self->p95_ms = p95_ms;
+  self->p99_ms = p99_ms;
   return self;
 }
 
-static FlutterWireguardWireguardHostApiStartResponse* flutter_wireguard_wireguard_host_api_start_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+const gchar* flutter_wireguard_phase_stats_get_op(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), nullptr);
+  return self->op;
 }
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStopResponse, flutter_wireguard_wireguard_host_api_stop_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_STOP_RESPONSE, GObject)
-
-struct _FlutterWireguardWireguardHostApiStopResponse {
-  GObject parent_instance;
+const gchar* flutter_wireguard_phase_stats_get_phase(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), nullptr);
+  return self->phase;
+}
 
-  FlValue* value;
-};
+int64_t flutter_wireguard_phase_stats_get_count(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), 0);
+  return self->count;
+}
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStopResponse, flutter_wireguard_wireguard_host_api_stop_response, G_TYPE_OBJECT)
+double flutter_wireguard_phase_stats_get_p50_ms(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), 0);
+  return self->p50_ms;
+}
 
-static void flutter_wireguard_wireguard_host_api_stop_response_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_stop_response_parent_class)->dispose(object);
+double flutter_wireguard_phase_stats_get_p95_ms(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), 0);
+  return self->p95_ms;
 }
 
-static void flutter_wireguard_wireguard_host_api_stop_response_init(FlutterWireguardWireguardHostApiStopResponse* self) {
+double flutter_wireguard_phase_stats_get_p99_ms(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), 0);
+  return self->p99_ms;
 }
 
-static void flutter_wireguard_wireguard_host_api_stop_response_class_init(FlutterWireguardWireguardHostApiStopResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_stop_response_dispose;
+static FlValue* flutter_wireguard_phase_stats_to_list(FlutterWireguardPhaseStats* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->op));
+  fl_value_append_take(values, fl_value_new_string(self->phase));
+  fl_value_append_take(values, fl_value_new_int(self->count));
+  fl_value_append_take(values, fl_value_new_float(self->p50_ms));
+  fl_value_append_take(values, fl_value_new_float(self->p95_ms));
+  fl_value_append_take(values, fl_value_new_float(self->p99_ms));
+  return values;
 }
 
-static FlutterWireguardWireguardHostApiStopResponse* flutter_wireguard_wireguard_host_api_stop_response_new() {
-  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_null());
-  return self;
+static FlutterWireguardPhaseStats* flutter_wireguard_phase_stats_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* op = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* phase = fl_value_get_string(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t count = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  double p50_ms = fl_value_get_float(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  double p95_ms = fl_value_get_float(value4);
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  double p99_ms = fl_value_get_float(value5);
+  return flutter_wireguard_phase_stats_new(op, phase, count, p50_ms, p95_ms, p99_ms);
 }
 
-static FlutterWireguardWireguardHostApiStopResponse* flutter_wireguard_wireguard_host_api_stop_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+gboolean flutter_wireguard_phase_stats_equals(FlutterWireguardPhaseStats* a, FlutterWireguardPhaseStats* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->op, b->op) != 0) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->phase, b->phase) != 0) {
+    return FALSE;
+  }
+  if (a->count != b->count) {
+    return FALSE;
+  }
+  if (!flpigeon_equals_double(a->p50_ms, b->p50_ms)) {
+    return FALSE;
+  }
+  if (!flpigeon_equals_double(a->p95_ms, b->p95_ms)) {
+    return FALSE;
+  }
+  if (!flpigeon_equals_double(a->p99_ms, b->p99_ms)) {
+    return FALSE;
+  }
+  return TRUE;
 }
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStatusResponse, flutter_wireguard_wireguard_host_api_status_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_STATUS_RESPONSE, GObject)
+guint flutter_wireguard_phase_stats_hash(FlutterWireguardPhaseStats* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PHASE_STATS(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->op != nullptr ? g_str_hash(self->op) : 0);
+  result = result * 31 + (self->phase != nullptr ? g_str_hash(self->phase) : 0);
+  result = result * 31 + static_cast<guint>(self->count);
+  result = result * 31 + flpigeon_hash_double(self->p50_ms);
+  result = result * 31 + flpigeon_hash_double(self->p95_ms);
+  result = result * 31 + flpigeon_hash_double(self->p99_ms);
+  return result;
+}
 
-struct _FlutterWireguardWireguardHostApiStatusResponse {
+struct _FlutterWireguardTunnelHealth {
   GObject parent_instance;
 
-  FlValue* value;
+  gchar* name;
+  gchar* public_key;
+  FlutterWireguardTunnelHealthState state;
+  int64_t last_handshake;
 };
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStatusResponse, flutter_wireguard_wireguard_host_api_status_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterWireguardTunnelHealth, flutter_wireguard_tunnel_health, G_TYPE_OBJECT)
 
-static void flutter_wireguard_wireguard_host_api_status_response_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_status_response_parent_class)->dispose(object);
+static void flutter_wireguard_tunnel_health_dispose(GObject* object) {
+  FlutterWireguardTunnelHealth* self = FLUTTER_WIREGUARD_TUNNEL_HEALTH(object);
+  g_clear_pointer(&self->name, g_free);
+  g_clear_pointer(&self->public_key, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_tunnel_health_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_wireguard_host_api_status_response_init(FlutterWireguardWireguardHostApiStatusResponse* self) {
+static void flutter_wireguard_tunnel_health_init(FlutterWireguardTunnelHealth* self) {
 }
 
-static void flutter_wireguard_wireguard_host_api_status_response_class_init(FlutterWireguardWireguardHostApiStatusResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_status_response_dispose;
+static void flutter_wireguard_tunnel_health_class_init(FlutterWireguardTunnelHealthClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_tunnel_health_dispose;
 }
 
-static FlutterWireguardWireguardHostApiStatusResponse* flutter_wireguard_wireguard_host_api_status_response_new(FlutterWireguardTunnelStatus* return_value) {
-  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_status_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_custom_object(flutter_wireguard_tunnel_status_type_id, G_OBJECT(return_value)));
+FlutterWireguardTunnelHealth* flutter_wireguard_tunnel_health_new(const gchar* name, const gchar* public_key, FlutterWireguardTunnelHealthState state, int64_t last_handshake) {
+  FlutterWireguardTunnelHealth* self = FLUTTER_WIREGUARD_TUNNEL_HEALTH(g_object_new(flutter_wireguard_tunnel_health_get_type(), nullptr));
+  self->name = g_strdup(name);
+  self->public_key = g_strdup(public_key);
+  self->state = state;
+  self->last_handshake = last_handshake;
   return self;
 }
 
-static FlutterWireguardWireguardHostApiStatusResponse* flutter_wireguard_wireguard_host_api_status_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_status_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+const gchar* flutter_wireguard_tunnel_health_get_name(FlutterWireguardTunnelHealth* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_HEALTH(self), nullptr);
+  return self->name;
 }
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiTunnelNamesResponse, flutter_wireguard_wireguard_host_api_tunnel_names_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE, GObject)
+const gchar* flutter_wireguard_tunnel_health_get_public_key(FlutterWireguardTunnelHealth* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_HEALTH(self), nullptr);
+  return self->public_key;
+}
 
-struct _FlutterWireguardWireguardHostApiTunnelNamesResponse {
+FlutterWireguardTunnelHealthState flutter_wireguard_tunnel_health_get_state(FlutterWireguardTunnelHealth* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_HEALTH(self), static_cast<FlutterWireguardTunnelHealthState>(0));
+  return self->state;
+}
+
+int64_t flutter_wireguard_tunnel_health_get_last_handshake(FlutterWireguardTunnelHealth* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_HEALTH(self), 0);
+  return self->last_handshake;
+}
+
+static FlValue* flutter_wireguard_tunnel_health_to_list(FlutterWireguardTunnelHealth* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->name));
+  fl_value_append_take(values, fl_value_new_string(self->public_key));
+  fl_value_append_take(values, fl_value_new_custom(flutter_wireguard_tunnel_health_state_type_id, fl_value_new_int(self->state), (GDestroyNotify)fl_value_unref));
+  fl_value_append_take(values, fl_value_new_int(self->last_handshake));
+  return values;
+}
+
+static FlutterWireguardTunnelHealth* flutter_wireguard_tunnel_health_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* public_key = fl_value_get_string(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  FlutterWireguardTunnelHealthState state = static_cast<FlutterWireguardTunnelHealthState>(fl_value_get_int(reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value2)))));
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t last_handshake = fl_value_get_int(value3);
+  return flutter_wireguard_tunnel_health_new(name, public_key, state, last_handshake);
+}
+
+gboolean flutter_wireguard_tunnel_health_equals(FlutterWireguardTunnelHealth* a, FlutterWireguardTunnelHealth* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->name, b->name) != 0) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->public_key, b->public_key) != 0) {
+    return FALSE;
+  }
+  if (a->state != b->state) {
+    return FALSE;
+  }
+  if (a->last_handshake != b->last_handshake) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+guint flutter_wireguard_tunnel_health_hash(FlutterWireguardTunnelHealth* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_HEALTH(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->name != nullptr ? g_str_hash(self->name) : 0);
+  result = result * 31 + (self->public_key != nullptr ? g_str_hash(self->public_key) : 0);
+  result = result * 31 + static_cast<guint>(self->state);
+  result = result * 31 + static_cast<guint>(self->last_handshake);
+  return result;
+}
+
+struct _FlutterWireguardKeyPairData {
   GObject parent_instance;
 
-  FlValue* value;
+  gchar* private_key;
+  gchar* public_key;
 };
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiTunnelNamesResponse, flutter_wireguard_wireguard_host_api_tunnel_names_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterWireguardKeyPairData, flutter_wireguard_key_pair_data, G_TYPE_OBJECT)
 
-static void flutter_wireguard_wireguard_host_api_tunnel_names_response_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_tunnel_names_response_parent_class)->dispose(object);
+static void flutter_wireguard_key_pair_data_dispose(GObject* object) {
+  FlutterWireguardKeyPairData* self = FLUTTER_WIREGUARD_KEY_PAIR_DATA(object);
+  g_clear_pointer(&self->private_key, g_free);
+  g_clear_pointer(&self->public_key, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_key_pair_data_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_wireguard_host_api_tunnel_names_response_init(FlutterWireguardWireguardHostApiTunnelNamesResponse* self) {
+static void flutter_wireguard_key_pair_data_init(FlutterWireguardKeyPairData* self) {
 }
 
-static void flutter_wireguard_wireguard_host_api_tunnel_names_response_class_init(FlutterWireguardWireguardHostApiTunnelNamesResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_tunnel_names_response_dispose;
+static void flutter_wireguard_key_pair_data_class_init(FlutterWireguardKeyPairDataClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_key_pair_data_dispose;
 }
 
-static FlutterWireguardWireguardHostApiTunnelNamesResponse* flutter_wireguard_wireguard_host_api_tunnel_names_response_new(FlValue* return_value) {
-  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_tunnel_names_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_ref(return_value));
+FlutterWireguardKeyPairData* flutter_wireguard_key_pair_data_new(const gchar* private_key, const gchar* public_key) {
+  FlutterWireguardKeyPairData* self = FLUTTER_WIREGUARD_KEY_PAIR_DATA(g_object_new(flutter_wireguard_key_pair_data_get_type(), nullptr));
+  self->private_key = g_strdup(private_key);
+  self->public_key = g_strdup(public_key);
   return self;
 }
 
-static FlutterWireguardWireguardHostApiTunnelNamesResponse* flutter_wireguard_wireguard_host_api_tunnel_names_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_tunnel_names_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+const gchar* flutter_wireguard_key_pair_data_get_private_key(FlutterWireguardKeyPairData* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_KEY_PAIR_DATA(self), nullptr);
+  return self->private_key;
 }
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiBackendResponse, flutter_wireguard_wireguard_host_api_backend_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_BACKEND_RESPONSE, GObject)
+const gchar* flutter_wireguard_key_pair_data_get_public_key(FlutterWireguardKeyPairData* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_KEY_PAIR_DATA(self), nullptr);
+  return self->public_key;
+}
 
-struct _FlutterWireguardWireguardHostApiBackendResponse {
+static FlValue* flutter_wireguard_key_pair_data_to_list(FlutterWireguardKeyPairData* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->private_key));
+  fl_value_append_take(values, fl_value_new_string(self->public_key));
+  return values;
+}
+
+static FlutterWireguardKeyPairData* flutter_wireguard_key_pair_data_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* private_key = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* public_key = fl_value_get_string(value1);
+  return flutter_wireguard_key_pair_data_new(private_key, public_key);
+}
+
+gboolean flutter_wireguard_key_pair_data_equals(FlutterWireguardKeyPairData* a, FlutterWireguardKeyPairData* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->private_key, b->private_key) != 0) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->public_key, b->public_key) != 0) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+guint flutter_wireguard_key_pair_data_hash(FlutterWireguardKeyPairData* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_KEY_PAIR_DATA(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->private_key != nullptr ? g_str_hash(self->private_key) : 0);
+  result = result * 31 + (self->public_key != nullptr ? g_str_hash(self->public_key) : 0);
+  return result;
+}
+
+struct _FlutterWireguardPeerStatus {
   GObject parent_instance;
 
-  FlValue* value;
+  gchar* public_key;
+  gchar* endpoint;
+  int64_t rx;
+  int64_t tx;
+  int64_t last_handshake;
+  int64_t persistent_keepalive;
 };
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApiBackendResponse, flutter_wireguard_wireguard_host_api_backend_response, G_TYPE_OBJECT)
+G_DEFINE_TYPE(FlutterWireguardPeerStatus, flutter_wireguard_peer_status, G_TYPE_OBJECT)
 
-static void flutter_wireguard_wireguard_host_api_backend_response_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(object);
-  g_clear_pointer(&self->value, fl_value_unref);
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_backend_response_parent_class)->dispose(object);
+static void flutter_wireguard_peer_status_dispose(GObject* object) {
+  FlutterWireguardPeerStatus* self = FLUTTER_WIREGUARD_PEER_STATUS(object);
+  g_clear_pointer(&self->public_key, g_free);
+  g_clear_pointer(&self->endpoint, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_peer_status_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_wireguard_host_api_backend_response_init(FlutterWireguardWireguardHostApiBackendResponse* self) {
+static void flutter_wireguard_peer_status_init(FlutterWireguardPeerStatus* self) {
 }
 
-static void flutter_wireguard_wireguard_host_api_backend_response_class_init(FlutterWireguardWireguardHostApiBackendResponseClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_backend_response_dispose;
+static void flutter_wireguard_peer_status_class_init(FlutterWireguardPeerStatusClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_peer_status_dispose;
 }
 
-static FlutterWireguardWireguardHostApiBackendResponse* flutter_wireguard_wireguard_host_api_backend_response_new(FlutterWireguardBackendInfo* return_value) {
-  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_backend_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_custom_object(flutter_wireguard_backend_info_type_id, G_OBJECT(return_value)));
+FlutterWireguardPeerStatus* flutter_wireguard_peer_status_new(const gchar* public_key, const gchar* endpoint, int64_t rx, int64_t tx, int64_t last_handshake, int64_t persistent_keepalive) {
+  FlutterWireguardPeerStatus* self = FLUTTER_WIREGUARD_PEER_STATUS(g_object_new(flutter_wireguard_peer_status_get_type(), nullptr));
+  self->public_key = g_strdup(public_key);
+  if (endpoint != nullptr) {
+    self->endpoint = g_strdup(endpoint);
+  }
+  else {
+    self->endpoint = nullptr;
+  }
+  self->rx = rx;
+  self->tx = tx;
+  self->last_handshake = last_handshake;
+  self->persistent_keepalive = persistent_keepalive;
   return self;
 }
 
-static FlutterWireguardWireguardHostApiBackendResponse* flutter_wireguard_wireguard_host_api_backend_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
-  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_backend_response_get_type(), nullptr));
-  self->value = fl_value_new_list();
-  fl_value_append_take(self->value, fl_value_new_string(code));
-  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
-  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
-  return self;
+const gchar* flutter_wireguard_peer_status_get_public_key(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), nullptr);
+  return self->public_key;
 }
 
-struct _FlutterWireguardWireguardHostApi {
-  GObject parent_instance;
-
-  const FlutterWireguardWireguardHostApiVTable* vtable;
-  gpointer user_data;
-  GDestroyNotify user_data_free_func;
-};
+const gchar* flutter_wireguard_peer_status_get_endpoint(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), nullptr);
+  return self->endpoint;
+}
 
-G_DEFINE_TYPE(FlutterWireguardWireguardHostApi, flutter_wireguard_wireguard_host_api, G_TYPE_OBJECT)
+int64_t flutter_wireguard_peer_status_get_rx(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), 0);
+  return self->rx;
+}
 
-static void flutter_wireguard_wireguard_host_api_dispose(GObject* object) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(object);
-  if (self->user_data != nullptr) {
-    self->user_data_free_func(self->user_data);
-  }
-  self->user_data = nullptr;
-  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_parent_class)->dispose(object);
+int64_t flutter_wireguard_peer_status_get_tx(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), 0);
+  return self->tx;
 }
 
-static void flutter_wireguard_wireguard_host_api_init(FlutterWireguardWireguardHostApi* self) {
+int64_t flutter_wireguard_peer_status_get_last_handshake(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), 0);
+  return self->last_handshake;
 }
 
-static void flutter_wireguard_wireguard_host_api_class_init(FlutterWireguardWireguardHostApiClass* klass) {
-  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_dispose;
+int64_t flutter_wireguard_peer_status_get_persistent_keepalive(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), 0);
+  return self->persistent_keepalive;
 }
 
-static FlutterWireguardWireguardHostApi* flutter_wireguard_wireguard_host_api_new(const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(g_object_new(flutter_wireguard_wireguard_host_api_get_type(), nullptr));
-  self->vtable = vtable;
-  self->user_data = user_data;
-  self->user_data_free_func = user_data_free_func;
-  return self;
+static FlValue* flutter_wireguard_peer_status_to_list(FlutterWireguardPeerStatus* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->public_key));
+  fl_value_append_take(values, self->endpoint != nullptr ? fl_value_new_string(self->endpoint) : fl_value_new_null());
+  fl_value_append_take(values, fl_value_new_int(self->rx));
+  fl_value_append_take(values, fl_value_new_int(self->tx));
+  fl_value_append_take(values, fl_value_new_int(self->last_handshake));
+  fl_value_append_take(values, fl_value_new_int(self->persistent_keepalive));
+  return values;
 }
 
-static void flutter_wireguard_wireguard_host_api_start_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+static FlutterWireguardPeerStatus* flutter_wireguard_peer_status_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* public_key = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  const gchar* endpoint = nullptr;
+  if (fl_value_get_type(value1) != FL_VALUE_TYPE_NULL) {
+    endpoint = fl_value_get_string(value1);
+  }
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t rx = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t tx = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  int64_t last_handshake = fl_value_get_int(value4);
+  FlValue* value5 = fl_value_get_list_value(values, 5);
+  int64_t persistent_keepalive = fl_value_get_int(value5);
+  return flutter_wireguard_peer_status_new(public_key, endpoint, rx, tx, last_handshake, persistent_keepalive);
+}
 
-  if (self->vtable == nullptr || self->vtable->start == nullptr) {
-    return;
+gboolean flutter_wireguard_peer_status_equals(FlutterWireguardPeerStatus* a, FlutterWireguardPeerStatus* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->public_key, b->public_key) != 0) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->endpoint, b->endpoint) != 0) {
+    return FALSE;
+  }
+  if (a->rx != b->rx) {
+    return FALSE;
+  }
+  if (a->tx != b->tx) {
+    return FALSE;
+  }
+  if (a->last_handshake != b->last_handshake) {
+    return FALSE;
+  }
+  if (a->persistent_keepalive != b->persistent_keepalive) {
+    return FALSE;
   }
+  return TRUE;
+}
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  const gchar* name = fl_value_get_string(value0);
-  FlValue* value1 = fl_value_get_list_value(message_, 1);
-  const gchar* config = fl_value_get_string(value1);
-  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
-  self->vtable->start(name, config, handle, self->user_data);
+guint flutter_wireguard_peer_status_hash(FlutterWireguardPeerStatus* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_STATUS(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->public_key != nullptr ? g_str_hash(self->public_key) : 0);
+  result = result * 31 + (self->endpoint != nullptr ? g_str_hash(self->endpoint) : 0);
+  result = result * 31 + static_cast<guint>(self->rx);
+  result = result * 31 + static_cast<guint>(self->tx);
+  result = result * 31 + static_cast<guint>(self->last_handshake);
+  result = result * 31 + static_cast<guint>(self->persistent_keepalive);
+  return result;
 }
 
-static void flutter_wireguard_wireguard_host_api_stop_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+struct _FlutterWireguardPeerUsage {
+  GObject parent_instance;
 
-  if (self->vtable == nullptr || self->vtable->stop == nullptr) {
-    return;
-  }
+  gchar* public_key;
+  int64_t rx;
+  int64_t tx;
+};
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  const gchar* name = fl_value_get_string(value0);
-  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
-  self->vtable->stop(name, handle, self->user_data);
+G_DEFINE_TYPE(FlutterWireguardPeerUsage, flutter_wireguard_peer_usage, G_TYPE_OBJECT)
+
+static void flutter_wireguard_peer_usage_dispose(GObject* object) {
+  FlutterWireguardPeerUsage* self = FLUTTER_WIREGUARD_PEER_USAGE(object);
+  g_clear_pointer(&self->public_key, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_peer_usage_parent_class)->dispose(object);
 }
 
-static void flutter_wireguard_wireguard_host_api_status_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+static void flutter_wireguard_peer_usage_init(FlutterWireguardPeerUsage* self) {
+}
 
-  if (self->vtable == nullptr || self->vtable->status == nullptr) {
-    return;
-  }
+static void flutter_wireguard_peer_usage_class_init(FlutterWireguardPeerUsageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_peer_usage_dispose;
+}
 
-  FlValue* value0 = fl_value_get_list_value(message_, 0);
-  const gchar* name = fl_value_get_string(value0);
-  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
-  self->vtable->status(name, handle, self->user_data);
+FlutterWireguardPeerUsage* flutter_wireguard_peer_usage_new(const gchar* public_key, int64_t rx, int64_t tx) {
+  FlutterWireguardPeerUsage* self = FLUTTER_WIREGUARD_PEER_USAGE(g_object_new(flutter_wireguard_peer_usage_get_type(), nullptr));
+  self->public_key = g_strdup(public_key);
+  self->rx = rx;
+  self->tx = tx;
+  return self;
 }
 
-static void flutter_wireguard_wireguard_host_api_tunnel_names_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+const gchar* flutter_wireguard_peer_usage_get_public_key(FlutterWireguardPeerUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_USAGE(self), nullptr);
+  return self->public_key;
+}
 
-  if (self->vtable == nullptr || self->vtable->tunnel_names == nullptr) {
-    return;
+int64_t flutter_wireguard_peer_usage_get_rx(FlutterWireguardPeerUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_USAGE(self), 0);
+  return self->rx;
+}
+
+int64_t flutter_wireguard_peer_usage_get_tx(FlutterWireguardPeerUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_USAGE(self), 0);
+  return self->tx;
+}
+
+static FlValue* flutter_wireguard_peer_usage_to_list(FlutterWireguardPeerUsage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->public_key));
+  fl_value_append_take(values, fl_value_new_int(self->rx));
+  fl_value_append_take(values, fl_value_new_int(self->tx));
+  return values;
+}
+
+static FlutterWireguardPeerUsage* flutter_wireguard_peer_usage_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* public_key = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t rx = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t tx = fl_value_get_int(value2);
+  return flutter_wireguard_peer_usage_new(public_key, rx, tx);
+}
+
+gboolean flutter_wireguard_peer_usage_equals(FlutterWireguardPeerUsage* a, FlutterWireguardPeerUsage* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->public_key, b->public_key) != 0) {
+    return FALSE;
+  }
+  if (a->rx != b->rx) {
+    return FALSE;
+  }
+  if (a->tx != b->tx) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+guint flutter_wireguard_peer_usage_hash(FlutterWireguardPeerUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_PEER_USAGE(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->public_key != nullptr ? g_str_hash(self->public_key) : 0);
+  result = result * 31 + static_cast<guint>(self->rx);
+  result = result * 31 + static_cast<guint>(self->tx);
+  return result;
+}
+
+struct _FlutterWireguardTunnelUsage {
+  GObject parent_instance;
+
+  gchar* name;
+  int64_t since;
+  int64_t rx;
+  int64_t tx;
+  FlValue* peers;
+};
+
+G_DEFINE_TYPE(FlutterWireguardTunnelUsage, flutter_wireguard_tunnel_usage, G_TYPE_OBJECT)
+
+static void flutter_wireguard_tunnel_usage_dispose(GObject* object) {
+  FlutterWireguardTunnelUsage* self = FLUTTER_WIREGUARD_TUNNEL_USAGE(object);
+  g_clear_pointer(&self->name, g_free);
+  g_clear_pointer(&self->peers, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_tunnel_usage_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_tunnel_usage_init(FlutterWireguardTunnelUsage* self) {
+}
+
+static void flutter_wireguard_tunnel_usage_class_init(FlutterWireguardTunnelUsageClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_tunnel_usage_dispose;
+}
+
+FlutterWireguardTunnelUsage* flutter_wireguard_tunnel_usage_new(const gchar* name, int64_t since, int64_t rx, int64_t tx, FlValue* peers) {
+  FlutterWireguardTunnelUsage* self = FLUTTER_WIREGUARD_TUNNEL_USAGE(g_object_new(flutter_wireguard_tunnel_usage_get_type(), nullptr));
+  self->name = g_strdup(name);
+  self->since = since;
+  self->rx = rx;
+  self->tx = tx;
+  self->peers = fl_value_ref(peers);
+  return self;
+}
+
+const gchar* flutter_wireguard_tunnel_usage_get_name(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), nullptr);
+  return self->name;
+}
+
+int64_t flutter_wireguard_tunnel_usage_get_since(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), 0);
+  return self->since;
+}
+
+int64_t flutter_wireguard_tunnel_usage_get_rx(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), 0);
+  return self->rx;
+}
+
+int64_t flutter_wireguard_tunnel_usage_get_tx(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), 0);
+  return self->tx;
+}
+
+FlValue* flutter_wireguard_tunnel_usage_get_peers(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), nullptr);
+  return self->peers;
+}
+
+static FlValue* flutter_wireguard_tunnel_usage_to_list(FlutterWireguardTunnelUsage* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->name));
+  fl_value_append_take(values, fl_value_new_int(self->since));
+  fl_value_append_take(values, fl_value_new_int(self->rx));
+  fl_value_append_take(values, fl_value_new_int(self->tx));
+  fl_value_append_take(values, fl_value_ref(self->peers));
+  return values;
+}
+
+static FlutterWireguardTunnelUsage* flutter_wireguard_tunnel_usage_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t since = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t rx = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t tx = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  FlValue* peers = value4;
+  return flutter_wireguard_tunnel_usage_new(name, since, rx, tx, peers);
+}
+
+gboolean flutter_wireguard_tunnel_usage_equals(FlutterWireguardTunnelUsage* a, FlutterWireguardTunnelUsage* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->name, b->name) != 0) {
+    return FALSE;
+  }
+  if (a->since != b->since) {
+    return FALSE;
+  }
+  if (a->rx != b->rx) {
+    return FALSE;
+  }
+  if (a->tx != b->tx) {
+    return FALSE;
+  }
+  if (!flpigeon_deep_equals(a->peers, b->peers)) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+guint flutter_wireguard_tunnel_usage_hash(FlutterWireguardTunnelUsage* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_TUNNEL_USAGE(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->name != nullptr ? g_str_hash(self->name) : 0);
+  result = result * 31 + static_cast<guint>(self->since);
+  result = result * 31 + static_cast<guint>(self->rx);
+  result = result * 31 + static_cast<guint>(self->tx);
+  result = result * 31 + flpigeon_deep_hash(self->peers);
+  return result;
+}
+
+struct _FlutterWireguardUsageQuotaExceeded {
+  GObject parent_instance;
+
+  gchar* name;
+  int64_t limit;
+  int64_t used;
+  int64_t since;
+  gboolean stopped;
+};
+
+G_DEFINE_TYPE(FlutterWireguardUsageQuotaExceeded, flutter_wireguard_usage_quota_exceeded, G_TYPE_OBJECT)
+
+static void flutter_wireguard_usage_quota_exceeded_dispose(GObject* object) {
+  FlutterWireguardUsageQuotaExceeded* self = FLUTTER_WIREGUARD_USAGE_QUOTA_EXCEEDED(object);
+  g_clear_pointer(&self->name, g_free);
+  G_OBJECT_CLASS(flutter_wireguard_usage_quota_exceeded_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_usage_quota_exceeded_init(FlutterWireguardUsageQuotaExceeded* self) {
+}
+
+static void flutter_wireguard_usage_quota_exceeded_class_init(FlutterWireguardUsageQuotaExceededClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_usage_quota_exceeded_dispose;
+}
+
+FlutterWireguardUsageQuotaExceeded* flutter_wireguard_usage_quota_exceeded_new(const gchar* name, int64_t limit, int64_t used, int64_t since, gboolean stopped) {
+  FlutterWireguardUsageQuotaExceeded* self = FLUTTER_WIREGUARD_USAGE_QUOTA_EXCEEDED(g_object_new(flutter_wireguard_usage_quota_exceeded_get_type(), nullptr));
+  self->name = g_strdup(name);
+  self->limit = limit;
+  self->used = used;
+  self->since = since;
+  self->stopped = stopped;
+  return self;
+}
+
+const gchar* flutter_wireguard_usage_quota_exceeded_get_name(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), nullptr);
+  return self->name;
+}
+
+int64_t flutter_wireguard_usage_quota_exceeded_get_limit(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), 0);
+  return self->limit;
+}
+
+int64_t flutter_wireguard_usage_quota_exceeded_get_used(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), 0);
+  return self->used;
+}
+
+int64_t flutter_wireguard_usage_quota_exceeded_get_since(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), 0);
+  return self->since;
+}
+
+gboolean flutter_wireguard_usage_quota_exceeded_get_stopped(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), FALSE);
+  return self->stopped;
+}
+
+static FlValue* flutter_wireguard_usage_quota_exceeded_to_list(FlutterWireguardUsageQuotaExceeded* self) {
+  FlValue* values = fl_value_new_list();
+  fl_value_append_take(values, fl_value_new_string(self->name));
+  fl_value_append_take(values, fl_value_new_int(self->limit));
+  fl_value_append_take(values, fl_value_new_int(self->used));
+  fl_value_append_take(values, fl_value_new_int(self->since));
+  fl_value_append_take(values, fl_value_new_bool(self->stopped));
+  return values;
+}
+
+static FlutterWireguardUsageQuotaExceeded* flutter_wireguard_usage_quota_exceeded_new_from_list(FlValue* values) {
+  FlValue* value0 = fl_value_get_list_value(values, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(values, 1);
+  int64_t limit = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(values, 2);
+  int64_t used = fl_value_get_int(value2);
+  FlValue* value3 = fl_value_get_list_value(values, 3);
+  int64_t since = fl_value_get_int(value3);
+  FlValue* value4 = fl_value_get_list_value(values, 4);
+  gboolean stopped = fl_value_get_bool(value4);
+  return flutter_wireguard_usage_quota_exceeded_new(name, limit, used, since, stopped);
+}
+
+gboolean flutter_wireguard_usage_quota_exceeded_equals(FlutterWireguardUsageQuotaExceeded* a, FlutterWireguardUsageQuotaExceeded* b) {
+  if (a == b) {
+    return TRUE;
+  }
+  if (a == nullptr || b == nullptr) {
+    return FALSE;
+  }
+  if (g_strcmp0(a->name, b->name) != 0) {
+    return FALSE;
+  }
+  if (a->limit != b->limit) {
+    return FALSE;
+  }
+  if (a->used != b->used) {
+    return FALSE;
+  }
+  if (a->since != b->since) {
+    return FALSE;
+  }
+  if (a->stopped != b->stopped) {
+    return FALSE;
+  }
+  return TRUE;
+}
+
+guint flutter_wireguard_usage_quota_exceeded_hash(FlutterWireguardUsageQuotaExceeded* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_USAGE_QUOTA_EXCEEDED(self), 0);
+  guint result = 0;
+  result = result * 31 + (self->name != nullptr ? g_str_hash(self->name) : 0);
+  result = result * 31 + static_cast<guint>(self->limit);
+  result = result * 31 + static_cast<guint>(self->used);
+  result = result * 31 + static_cast<guint>(self->since);
+  result = result * 31 + static_cast<guint>(self->stopped);
+  return result;
+}
+
+struct _FlutterWireguardMessageCodec {
+  FlStandardMessageCodec parent_instance;
+
+};
+
+G_DEFINE_TYPE(FlutterWireguardMessageCodec, flutter_wireguard_message_codec, fl_standard_message_codec_get_type())
+
+const int flutter_wireguard_tunnel_state_type_id = 129;
+const int flutter_wireguard_backend_kind_type_id = 130;
+const int flutter_wireguard_tunnel_health_state_type_id = 131;
+const int flutter_wireguard_tunnel_status_type_id = 132;
+const int flutter_wireguard_backend_info_type_id = 133;
+const int flutter_wireguard_tunnel_spec_type_id = 134;
+const int flutter_wireguard_tunnel_result_type_id = 135;
+const int flutter_wireguard_phase_stats_type_id = 136;
+const int flutter_wireguard_tunnel_health_type_id = 137;
+const int flutter_wireguard_key_pair_data_type_id = 138;
+const int flutter_wireguard_peer_status_type_id = 139;
+const int flutter_wireguard_peer_usage_type_id = 140;
+const int flutter_wireguard_tunnel_usage_type_id = 141;
+const int flutter_wireguard_usage_quota_exceeded_type_id = 142;
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_state(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_state_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_backend_kind(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = flutter_wireguard_backend_kind_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_health_state(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_health_state_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  return fl_standard_message_codec_write_value(codec, buffer, value, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_status(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelStatus* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_status_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_tunnel_status_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_backend_info(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardBackendInfo* value, GError** error) {
+  uint8_t type = flutter_wireguard_backend_info_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_backend_info_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_spec(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelSpec* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_spec_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_tunnel_spec_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_result(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelResult* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_result_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_tunnel_result_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_phase_stats(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardPhaseStats* value, GError** error) {
+  uint8_t type = flutter_wireguard_phase_stats_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_phase_stats_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_health(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelHealth* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_health_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_tunnel_health_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_key_pair_data(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardKeyPairData* value, GError** error) {
+  uint8_t type = flutter_wireguard_key_pair_data_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_key_pair_data_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_peer_status(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardPeerStatus* value, GError** error) {
+  uint8_t type = flutter_wireguard_peer_status_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_peer_status_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_peer_usage(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardPeerUsage* value, GError** error) {
+  uint8_t type = flutter_wireguard_peer_usage_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_peer_usage_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_usage(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardTunnelUsage* value, GError** error) {
+  uint8_t type = flutter_wireguard_tunnel_usage_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_tunnel_usage_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_flutter_wireguard_usage_quota_exceeded(FlStandardMessageCodec* codec, GByteArray* buffer, FlutterWireguardUsageQuotaExceeded* value, GError** error) {
+  uint8_t type = flutter_wireguard_usage_quota_exceeded_type_id;
+  g_byte_array_append(buffer, &type, sizeof(uint8_t));
+  g_autoptr(FlValue) values = flutter_wireguard_usage_quota_exceeded_to_list(value);
+  return fl_standard_message_codec_write_value(codec, buffer, values, error);
+}
+
+static gboolean flutter_wireguard_message_codec_write_value(FlStandardMessageCodec* codec, GByteArray* buffer, FlValue* value, GError** error) {
+  if (fl_value_get_type(value) == FL_VALUE_TYPE_CUSTOM) {
+    switch (fl_value_get_custom_type(value)) {
+      case flutter_wireguard_tunnel_state_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_state(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case flutter_wireguard_backend_kind_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_backend_kind(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case flutter_wireguard_tunnel_health_state_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_health_state(codec, buffer, reinterpret_cast<FlValue*>(const_cast<gpointer>(fl_value_get_custom_value(value))), error);
+      case flutter_wireguard_tunnel_status_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_status(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_STATUS(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_backend_info_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_backend_info(codec, buffer, FLUTTER_WIREGUARD_BACKEND_INFO(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_tunnel_spec_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_spec(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_SPEC(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_tunnel_result_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_result(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_RESULT(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_phase_stats_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_phase_stats(codec, buffer, FLUTTER_WIREGUARD_PHASE_STATS(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_tunnel_health_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_health(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_HEALTH(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_key_pair_data_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_key_pair_data(codec, buffer, FLUTTER_WIREGUARD_KEY_PAIR_DATA(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_peer_status_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_peer_status(codec, buffer, FLUTTER_WIREGUARD_PEER_STATUS(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_peer_usage_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_peer_usage(codec, buffer, FLUTTER_WIREGUARD_PEER_USAGE(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_tunnel_usage_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_tunnel_usage(codec, buffer, FLUTTER_WIREGUARD_TUNNEL_USAGE(fl_value_get_custom_value_object(value)), error);
+      case flutter_wireguard_usage_quota_exceeded_type_id:
+        return flutter_wireguard_message_codec_write_flutter_wireguard_usage_quota_exceeded(codec, buffer, FLUTTER_WIREGUARD_USAGE_QUOTA_EXCEEDED(fl_value_get_custom_value_object(value)), error);
+    }
+  }
+
+  return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_wireguard_message_codec_parent_class)->write_value(codec, buffer, value, error);
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_state(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(flutter_wireguard_tunnel_state_type_id, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_backend_kind(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(flutter_wireguard_backend_kind_type_id, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_health_state(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  return fl_value_new_custom(flutter_wireguard_tunnel_health_state_type_id, fl_standard_message_codec_read_value(codec, buffer, offset, error), (GDestroyNotify)fl_value_unref);
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_status(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardTunnelStatus) value = flutter_wireguard_tunnel_status_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_tunnel_status_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_backend_info(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardBackendInfo) value = flutter_wireguard_backend_info_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_backend_info_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_spec(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardTunnelSpec) value = flutter_wireguard_tunnel_spec_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_tunnel_spec_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_result(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardTunnelResult) value = flutter_wireguard_tunnel_result_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_tunnel_result_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_phase_stats(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardPhaseStats) value = flutter_wireguard_phase_stats_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_phase_stats_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_health(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardTunnelHealth) value = flutter_wireguard_tunnel_health_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_tunnel_health_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_key_pair_data(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardKeyPairData) value = flutter_wireguard_key_pair_data_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_key_pair_data_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_peer_status(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardPeerStatus) value = flutter_wireguard_peer_status_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_peer_status_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_peer_usage(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardPeerUsage) value = flutter_wireguard_peer_usage_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_peer_usage_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_usage(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardTunnelUsage) value = flutter_wireguard_tunnel_usage_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_tunnel_usage_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_flutter_wireguard_usage_quota_exceeded(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, GError** error) {
+  g_autoptr(FlValue) values = fl_standard_message_codec_read_value(codec, buffer, offset, error);
+  if (values == nullptr) {
+    return nullptr;
+  }
+
+  g_autoptr(FlutterWireguardUsageQuotaExceeded) value = flutter_wireguard_usage_quota_exceeded_new_from_list(values);
+  if (value == nullptr) {
+    g_set_error(error, FL_MESSAGE_CODEC_ERROR, FL_MESSAGE_CODEC_ERROR_FAILED, "Invalid data received for MessageData");
+    return nullptr;
+  }
+
+  return fl_value_new_custom_object(flutter_wireguard_usage_quota_exceeded_type_id, G_OBJECT(value));
+}
+
+static FlValue* flutter_wireguard_message_codec_read_value_of_type(FlStandardMessageCodec* codec, GBytes* buffer, size_t* offset, int type, GError** error) {
+  switch (type) {
+    case flutter_wireguard_tunnel_state_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_state(codec, buffer, offset, error);
+    case flutter_wireguard_backend_kind_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_backend_kind(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_health_state_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_health_state(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_status_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_status(codec, buffer, offset, error);
+    case flutter_wireguard_backend_info_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_backend_info(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_spec_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_spec(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_result_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_result(codec, buffer, offset, error);
+    case flutter_wireguard_phase_stats_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_phase_stats(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_health_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_health(codec, buffer, offset, error);
+    case flutter_wireguard_key_pair_data_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_key_pair_data(codec, buffer, offset, error);
+    case flutter_wireguard_peer_status_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_peer_status(codec, buffer, offset, error);
+    case flutter_wireguard_peer_usage_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_peer_usage(codec, buffer, offset, error);
+    case flutter_wireguard_tunnel_usage_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_tunnel_usage(codec, buffer, offset, error);
+    case flutter_wireguard_usage_quota_exceeded_type_id:
+      return flutter_wireguard_message_codec_read_flutter_wireguard_usage_quota_exceeded(codec, buffer, offset, error);
+    default:
+      return FL_STANDARD_MESSAGE_CODEC_CLASS(flutter_wireguard_message_codec_parent_class)->read_value_of_type(codec, buffer, offset, type, error);
+  }
+}
+
+static void flutter_wireguard_message_codec_init(FlutterWireguardMessageCodec* self) {
+}
+
+static void flutter_wireguard_message_codec_class_init(FlutterWireguardMessageCodecClass* klass) {
+  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->write_value = flutter_wireguard_message_codec_write_value;
+  FL_STANDARD_MESSAGE_CODEC_CLASS(klass)->read_value_of_type = flutter_wireguard_message_codec_read_value_of_type;
+}
+
+static FlutterWireguardMessageCodec* flutter_wireguard_message_codec_new() {
+  FlutterWireguardMessageCodec* self = FLUTTER_WIREGUARD_MESSAGE_CODEC(g_object_new(flutter_wireguard_message_codec_get_type(), nullptr));
+  return self;
+}
+
+struct _FlutterWireguardWireguardHostApiResponseHandle {
+  GObject parent_instance;
+
+  FlBasicMessageChannel* channel;
+  FlBasicMessageChannelResponseHandle* response_handle;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiResponseHandle, flutter_wireguard_wireguard_host_api_response_handle, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_response_handle_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiResponseHandle* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RESPONSE_HANDLE(object);
+  g_clear_object(&self->channel);
+  g_clear_object(&self->response_handle);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_response_handle_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_response_handle_init(FlutterWireguardWireguardHostApiResponseHandle* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_response_handle_class_init(FlutterWireguardWireguardHostApiResponseHandleClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_response_handle_dispose;
+}
+
+static FlutterWireguardWireguardHostApiResponseHandle* flutter_wireguard_wireguard_host_api_response_handle_new(FlBasicMessageChannel* channel, FlBasicMessageChannelResponseHandle* response_handle) {
+  FlutterWireguardWireguardHostApiResponseHandle* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RESPONSE_HANDLE(g_object_new(flutter_wireguard_wireguard_host_api_response_handle_get_type(), nullptr));
+  self->channel = FL_BASIC_MESSAGE_CHANNEL(g_object_ref(channel));
+  self->response_handle = FL_BASIC_MESSAGE_CHANNEL_RESPONSE_HANDLE(g_object_ref(response_handle));
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStartResponse, flutter_wireguard_wireguard_host_api_start_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_START_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiStartResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStartResponse, flutter_wireguard_wireguard_host_api_start_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_start_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_start_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_start_response_init(FlutterWireguardWireguardHostApiStartResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_start_response_class_init(FlutterWireguardWireguardHostApiStartResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_start_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiStartResponse* flutter_wireguard_wireguard_host_api_start_response_new() {
+  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiStartResponse* flutter_wireguard_wireguard_host_api_start_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiStartResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStopResponse, flutter_wireguard_wireguard_host_api_stop_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_STOP_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiStopResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStopResponse, flutter_wireguard_wireguard_host_api_stop_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_stop_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_stop_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_response_init(FlutterWireguardWireguardHostApiStopResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_response_class_init(FlutterWireguardWireguardHostApiStopResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_stop_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiStopResponse* flutter_wireguard_wireguard_host_api_stop_response_new() {
+  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiStopResponse* flutter_wireguard_wireguard_host_api_stop_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiStopResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStatusResponse, flutter_wireguard_wireguard_host_api_status_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_STATUS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiStatusResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStatusResponse, flutter_wireguard_wireguard_host_api_status_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_status_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_status_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_status_response_init(FlutterWireguardWireguardHostApiStatusResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_status_response_class_init(FlutterWireguardWireguardHostApiStatusResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_status_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiStatusResponse* flutter_wireguard_wireguard_host_api_status_response_new(FlutterWireguardTunnelStatus* return_value) {
+  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_status_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(flutter_wireguard_tunnel_status_type_id, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiStatusResponse* flutter_wireguard_wireguard_host_api_status_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiStatusResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STATUS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_status_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiTunnelNamesResponse, flutter_wireguard_wireguard_host_api_tunnel_names_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiTunnelNamesResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiTunnelNamesResponse, flutter_wireguard_wireguard_host_api_tunnel_names_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_tunnel_names_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_tunnel_names_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_tunnel_names_response_init(FlutterWireguardWireguardHostApiTunnelNamesResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_tunnel_names_response_class_init(FlutterWireguardWireguardHostApiTunnelNamesResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_tunnel_names_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiTunnelNamesResponse* flutter_wireguard_wireguard_host_api_tunnel_names_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_tunnel_names_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiTunnelNamesResponse* flutter_wireguard_wireguard_host_api_tunnel_names_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiTunnelNamesResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_TUNNEL_NAMES_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_tunnel_names_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiBackendResponse, flutter_wireguard_wireguard_host_api_backend_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_BACKEND_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiBackendResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiBackendResponse, flutter_wireguard_wireguard_host_api_backend_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_backend_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_backend_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_backend_response_init(FlutterWireguardWireguardHostApiBackendResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_backend_response_class_init(FlutterWireguardWireguardHostApiBackendResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_backend_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiBackendResponse* flutter_wireguard_wireguard_host_api_backend_response_new(FlutterWireguardBackendInfo* return_value) {
+  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_backend_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(flutter_wireguard_backend_info_type_id, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiBackendResponse* flutter_wireguard_wireguard_host_api_backend_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiBackendResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_BACKEND_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_backend_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStartManyResponse, flutter_wireguard_wireguard_host_api_start_many_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_START_MANY_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiStartManyResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStartManyResponse, flutter_wireguard_wireguard_host_api_start_many_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_start_many_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiStartManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_MANY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_start_many_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_start_many_response_init(FlutterWireguardWireguardHostApiStartManyResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_start_many_response_class_init(FlutterWireguardWireguardHostApiStartManyResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_start_many_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiStartManyResponse* flutter_wireguard_wireguard_host_api_start_many_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiStartManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_MANY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_many_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiStartManyResponse* flutter_wireguard_wireguard_host_api_start_many_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiStartManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_START_MANY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_start_many_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiStopManyResponse, flutter_wireguard_wireguard_host_api_stop_many_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_STOP_MANY_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiStopManyResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiStopManyResponse, flutter_wireguard_wireguard_host_api_stop_many_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_stop_many_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiStopManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_MANY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_stop_many_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_many_response_init(FlutterWireguardWireguardHostApiStopManyResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_many_response_class_init(FlutterWireguardWireguardHostApiStopManyResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_stop_many_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiStopManyResponse* flutter_wireguard_wireguard_host_api_stop_many_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiStopManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_MANY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_many_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiStopManyResponse* flutter_wireguard_wireguard_host_api_stop_many_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiStopManyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_STOP_MANY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_stop_many_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiSwitchTunnelResponse, flutter_wireguard_wireguard_host_api_switch_tunnel_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_SWITCH_TUNNEL_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiSwitchTunnelResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiSwitchTunnelResponse, flutter_wireguard_wireguard_host_api_switch_tunnel_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_switch_tunnel_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiSwitchTunnelResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SWITCH_TUNNEL_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_switch_tunnel_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_switch_tunnel_response_init(FlutterWireguardWireguardHostApiSwitchTunnelResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_switch_tunnel_response_class_init(FlutterWireguardWireguardHostApiSwitchTunnelResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_switch_tunnel_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiSwitchTunnelResponse* flutter_wireguard_wireguard_host_api_switch_tunnel_response_new() {
+  FlutterWireguardWireguardHostApiSwitchTunnelResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SWITCH_TUNNEL_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_switch_tunnel_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiSwitchTunnelResponse* flutter_wireguard_wireguard_host_api_switch_tunnel_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiSwitchTunnelResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SWITCH_TUNNEL_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_switch_tunnel_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiDiagnosticsResponse, flutter_wireguard_wireguard_host_api_diagnostics_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_DIAGNOSTICS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiDiagnosticsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiDiagnosticsResponse, flutter_wireguard_wireguard_host_api_diagnostics_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_diagnostics_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiDiagnosticsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DIAGNOSTICS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_diagnostics_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_diagnostics_response_init(FlutterWireguardWireguardHostApiDiagnosticsResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_diagnostics_response_class_init(FlutterWireguardWireguardHostApiDiagnosticsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_diagnostics_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiDiagnosticsResponse* flutter_wireguard_wireguard_host_api_diagnostics_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiDiagnosticsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DIAGNOSTICS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_diagnostics_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiDiagnosticsResponse* flutter_wireguard_wireguard_host_api_diagnostics_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiDiagnosticsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DIAGNOSTICS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_diagnostics_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiDumpTraceResponse, flutter_wireguard_wireguard_host_api_dump_trace_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_DUMP_TRACE_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiDumpTraceResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiDumpTraceResponse, flutter_wireguard_wireguard_host_api_dump_trace_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_dump_trace_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiDumpTraceResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DUMP_TRACE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_dump_trace_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_dump_trace_response_init(FlutterWireguardWireguardHostApiDumpTraceResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_dump_trace_response_class_init(FlutterWireguardWireguardHostApiDumpTraceResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_dump_trace_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiDumpTraceResponse* flutter_wireguard_wireguard_host_api_dump_trace_response_new() {
+  FlutterWireguardWireguardHostApiDumpTraceResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DUMP_TRACE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_dump_trace_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiDumpTraceResponse* flutter_wireguard_wireguard_host_api_dump_trace_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiDumpTraceResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_DUMP_TRACE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_dump_trace_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiLookupPeerResponse, flutter_wireguard_wireguard_host_api_lookup_peer_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_LOOKUP_PEER_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiLookupPeerResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiLookupPeerResponse, flutter_wireguard_wireguard_host_api_lookup_peer_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_lookup_peer_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiLookupPeerResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEER_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_lookup_peer_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peer_response_init(FlutterWireguardWireguardHostApiLookupPeerResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peer_response_class_init(FlutterWireguardWireguardHostApiLookupPeerResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_lookup_peer_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiLookupPeerResponse* flutter_wireguard_wireguard_host_api_lookup_peer_response_new(const gchar* return_value) {
+  FlutterWireguardWireguardHostApiLookupPeerResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEER_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_lookup_peer_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, return_value != nullptr ? fl_value_new_string(return_value) : fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiLookupPeerResponse* flutter_wireguard_wireguard_host_api_lookup_peer_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiLookupPeerResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEER_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_lookup_peer_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiLookupPeersResponse, flutter_wireguard_wireguard_host_api_lookup_peers_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_LOOKUP_PEERS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiLookupPeersResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiLookupPeersResponse, flutter_wireguard_wireguard_host_api_lookup_peers_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_lookup_peers_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiLookupPeersResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEERS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_lookup_peers_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peers_response_init(FlutterWireguardWireguardHostApiLookupPeersResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peers_response_class_init(FlutterWireguardWireguardHostApiLookupPeersResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_lookup_peers_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiLookupPeersResponse* flutter_wireguard_wireguard_host_api_lookup_peers_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiLookupPeersResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEERS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_lookup_peers_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiLookupPeersResponse* flutter_wireguard_wireguard_host_api_lookup_peers_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiLookupPeersResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_LOOKUP_PEERS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_lookup_peers_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiComputeAllowedIpsResponse, flutter_wireguard_wireguard_host_api_compute_allowed_ips_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_COMPUTE_ALLOWED_IPS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiComputeAllowedIpsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiComputeAllowedIpsResponse, flutter_wireguard_wireguard_host_api_compute_allowed_ips_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_COMPUTE_ALLOWED_IPS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_init(FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_class_init(FlutterWireguardWireguardHostApiComputeAllowedIpsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_COMPUTE_ALLOWED_IPS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiComputeAllowedIpsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_COMPUTE_ALLOWED_IPS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiReresolveEndpointsResponse, flutter_wireguard_wireguard_host_api_reresolve_endpoints_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_RERESOLVE_ENDPOINTS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiReresolveEndpointsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiReresolveEndpointsResponse, flutter_wireguard_wireguard_host_api_reresolve_endpoints_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiReresolveEndpointsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RERESOLVE_ENDPOINTS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_init(FlutterWireguardWireguardHostApiReresolveEndpointsResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_class_init(FlutterWireguardWireguardHostApiReresolveEndpointsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiReresolveEndpointsResponse* flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_new(int64_t return_value) {
+  FlutterWireguardWireguardHostApiReresolveEndpointsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RERESOLVE_ENDPOINTS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_int(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiReresolveEndpointsResponse* flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiReresolveEndpointsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_RERESOLVE_ENDPOINTS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiSetStaleAfterResponse, flutter_wireguard_wireguard_host_api_set_stale_after_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_SET_STALE_AFTER_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiSetStaleAfterResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiSetStaleAfterResponse, flutter_wireguard_wireguard_host_api_set_stale_after_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_set_stale_after_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiSetStaleAfterResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_STALE_AFTER_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_set_stale_after_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_set_stale_after_response_init(FlutterWireguardWireguardHostApiSetStaleAfterResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_set_stale_after_response_class_init(FlutterWireguardWireguardHostApiSetStaleAfterResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_set_stale_after_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiSetStaleAfterResponse* flutter_wireguard_wireguard_host_api_set_stale_after_response_new() {
+  FlutterWireguardWireguardHostApiSetStaleAfterResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_STALE_AFTER_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_set_stale_after_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiSetStaleAfterResponse* flutter_wireguard_wireguard_host_api_set_stale_after_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiSetStaleAfterResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_STALE_AFTER_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_set_stale_after_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiGenerateKeyPairsResponse, flutter_wireguard_wireguard_host_api_generate_key_pairs_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_GENERATE_KEY_PAIRS_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiGenerateKeyPairsResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiGenerateKeyPairsResponse, flutter_wireguard_wireguard_host_api_generate_key_pairs_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_generate_key_pairs_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_GENERATE_KEY_PAIRS_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_generate_key_pairs_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_generate_key_pairs_response_init(FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_generate_key_pairs_response_class_init(FlutterWireguardWireguardHostApiGenerateKeyPairsResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_generate_key_pairs_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* flutter_wireguard_wireguard_host_api_generate_key_pairs_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_GENERATE_KEY_PAIRS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_generate_key_pairs_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* flutter_wireguard_wireguard_host_api_generate_key_pairs_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiGenerateKeyPairsResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_GENERATE_KEY_PAIRS_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_generate_key_pairs_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse, flutter_wireguard_wireguard_host_api_public_keys_from_private_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_PUBLIC_KEYS_FROM_PRIVATE_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse, flutter_wireguard_wireguard_host_api_public_keys_from_private_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_public_keys_from_private_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PUBLIC_KEYS_FROM_PRIVATE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_public_keys_from_private_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_public_keys_from_private_response_init(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_public_keys_from_private_response_class_init(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_public_keys_from_private_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* flutter_wireguard_wireguard_host_api_public_keys_from_private_response_new(FlValue* return_value) {
+  FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PUBLIC_KEYS_FROM_PRIVATE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_public_keys_from_private_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_ref(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* flutter_wireguard_wireguard_host_api_public_keys_from_private_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PUBLIC_KEYS_FROM_PRIVATE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_public_keys_from_private_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiPeerByPublicKeyResponse, flutter_wireguard_wireguard_host_api_peer_by_public_key_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_PEER_BY_PUBLIC_KEY_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiPeerByPublicKeyResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiPeerByPublicKeyResponse, flutter_wireguard_wireguard_host_api_peer_by_public_key_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_peer_by_public_key_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PEER_BY_PUBLIC_KEY_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_peer_by_public_key_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_peer_by_public_key_response_init(FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_peer_by_public_key_response_class_init(FlutterWireguardWireguardHostApiPeerByPublicKeyResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_peer_by_public_key_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* flutter_wireguard_wireguard_host_api_peer_by_public_key_response_new(FlutterWireguardPeerStatus* return_value) {
+  FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PEER_BY_PUBLIC_KEY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_peer_by_public_key_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, return_value != nullptr ? fl_value_new_custom_object(flutter_wireguard_peer_status_type_id, G_OBJECT(return_value)) : fl_value_new_null());
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* flutter_wireguard_wireguard_host_api_peer_by_public_key_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiPeerByPublicKeyResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_PEER_BY_PUBLIC_KEY_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_peer_by_public_key_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiUsageResponse, flutter_wireguard_wireguard_host_api_usage_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_USAGE_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiUsageResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiUsageResponse, flutter_wireguard_wireguard_host_api_usage_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_usage_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiUsageResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_USAGE_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_usage_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_usage_response_init(FlutterWireguardWireguardHostApiUsageResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_usage_response_class_init(FlutterWireguardWireguardHostApiUsageResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_usage_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiUsageResponse* flutter_wireguard_wireguard_host_api_usage_response_new(FlutterWireguardTunnelUsage* return_value) {
+  FlutterWireguardWireguardHostApiUsageResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_USAGE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_usage_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_custom_object(flutter_wireguard_tunnel_usage_type_id, G_OBJECT(return_value)));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiUsageResponse* flutter_wireguard_wireguard_host_api_usage_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiUsageResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_USAGE_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_usage_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiSetUsageQuotaResponse, flutter_wireguard_wireguard_host_api_set_usage_quota_response, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_SET_USAGE_QUOTA_RESPONSE, GObject)
+
+struct _FlutterWireguardWireguardHostApiSetUsageQuotaResponse {
+  GObject parent_instance;
+
+  FlValue* value;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApiSetUsageQuotaResponse, flutter_wireguard_wireguard_host_api_set_usage_quota_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_set_usage_quota_response_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApiSetUsageQuotaResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_USAGE_QUOTA_RESPONSE(object);
+  g_clear_pointer(&self->value, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_set_usage_quota_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_set_usage_quota_response_init(FlutterWireguardWireguardHostApiSetUsageQuotaResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_set_usage_quota_response_class_init(FlutterWireguardWireguardHostApiSetUsageQuotaResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_set_usage_quota_response_dispose;
+}
+
+static FlutterWireguardWireguardHostApiSetUsageQuotaResponse* flutter_wireguard_wireguard_host_api_set_usage_quota_response_new(int64_t return_value) {
+  FlutterWireguardWireguardHostApiSetUsageQuotaResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_USAGE_QUOTA_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_set_usage_quota_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_int(return_value));
+  return self;
+}
+
+static FlutterWireguardWireguardHostApiSetUsageQuotaResponse* flutter_wireguard_wireguard_host_api_set_usage_quota_response_new_error(const gchar* code, const gchar* message, FlValue* details) {
+  FlutterWireguardWireguardHostApiSetUsageQuotaResponse* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API_SET_USAGE_QUOTA_RESPONSE(g_object_new(flutter_wireguard_wireguard_host_api_set_usage_quota_response_get_type(), nullptr));
+  self->value = fl_value_new_list();
+  fl_value_append_take(self->value, fl_value_new_string(code));
+  fl_value_append_take(self->value, fl_value_new_string(message != nullptr ? message : ""));
+  fl_value_append_take(self->value, details != nullptr ? fl_value_ref(details) : fl_value_new_null());
+  return self;
+}
+
+struct _FlutterWireguardWireguardHostApi {
+  GObject parent_instance;
+
+  const FlutterWireguardWireguardHostApiVTable* vtable;
+  gpointer user_data;
+  GDestroyNotify user_data_free_func;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardHostApi, flutter_wireguard_wireguard_host_api, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_host_api_dispose(GObject* object) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(object);
+  if (self->user_data != nullptr) {
+    self->user_data_free_func(self->user_data);
+  }
+  self->user_data = nullptr;
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_host_api_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_host_api_init(FlutterWireguardWireguardHostApi* self) {
+}
+
+static void flutter_wireguard_wireguard_host_api_class_init(FlutterWireguardWireguardHostApiClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_host_api_dispose;
+}
+
+static FlutterWireguardWireguardHostApi* flutter_wireguard_wireguard_host_api_new(const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(g_object_new(flutter_wireguard_wireguard_host_api_get_type(), nullptr));
+  self->vtable = vtable;
+  self->user_data = user_data;
+  self->user_data_free_func = user_data_free_func;
+  return self;
+}
+
+static void flutter_wireguard_wireguard_host_api_start_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->start == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* config = fl_value_get_string(value1);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->start(name, config, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->stop == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->stop(name, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_status_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->status == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->status(name, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_tunnel_names_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->tunnel_names == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->tunnel_names(handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_backend_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->backend == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->backend(handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_start_many_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->start_many == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlValue* specs = value0;
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->start_many(specs, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_stop_many_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->stop_many == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlValue* names = value0;
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->stop_many(names, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_switch_tunnel_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->switch_tunnel == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* from = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* to = fl_value_get_string(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  const gchar* config = fl_value_get_string(value2);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->switch_tunnel(from, to, config, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_diagnostics_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->diagnostics == nullptr) {
+    return;
+  }
+
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->diagnostics(handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_dump_trace_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->dump_trace == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* path = fl_value_get_string(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->dump_trace(path, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peer_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->lookup_peer == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* ip_address = fl_value_get_string(value1);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->lookup_peer(name, ip_address, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_lookup_peers_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->lookup_peers == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  FlValue* ip_addresses = value1;
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->lookup_peers(name, ip_addresses, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_compute_allowed_ips_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->compute_allowed_ips == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlValue* include = value0;
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  FlValue* exclude = value1;
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->compute_allowed_ips(include, exclude, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_reresolve_endpoints_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->reresolve_endpoints == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->reresolve_endpoints(name, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_set_stale_after_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_stale_after == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t seconds = fl_value_get_int(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_stale_after(seconds, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_generate_key_pairs_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->generate_key_pairs == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  int64_t count = fl_value_get_int(value0);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->generate_key_pairs(count, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_public_keys_from_private_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->public_keys_from_private == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  FlValue* private_keys = value0;
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->public_keys_from_private(private_keys, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_peer_by_public_key_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->peer_by_public_key == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  const gchar* public_key = fl_value_get_string(value1);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->peer_by_public_key(name, public_key, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_usage_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->usage == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t since = fl_value_get_int(value1);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->usage(name, since, handle, self->user_data);
+}
+
+static void flutter_wireguard_wireguard_host_api_set_usage_quota_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
+  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+
+  if (self->vtable == nullptr || self->vtable->set_usage_quota == nullptr) {
+    return;
+  }
+
+  FlValue* value0 = fl_value_get_list_value(message_, 0);
+  const gchar* name = fl_value_get_string(value0);
+  FlValue* value1 = fl_value_get_list_value(message_, 1);
+  int64_t limit_bytes = fl_value_get_int(value1);
+  FlValue* value2 = fl_value_get_list_value(message_, 2);
+  int64_t since = fl_value_get_int(value2);
+  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
+  self->vtable->set_usage_quota(name, limit_bytes, since, handle, self->user_data);
+}
+
+void flutter_wireguard_wireguard_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
+  g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
+  g_autoptr(FlutterWireguardWireguardHostApi) api_data = flutter_wireguard_wireguard_host_api_new(vtable, user_data, user_data_free_func);
+
+  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
+  g_autofree gchar* start_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_channel = fl_basic_message_channel_new(messenger, start_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_channel, flutter_wireguard_wireguard_host_api_start_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* stop_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_channel = fl_basic_message_channel_new(messenger, stop_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_channel, flutter_wireguard_wireguard_host_api_stop_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* status_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) status_channel = fl_basic_message_channel_new(messenger, status_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(status_channel, flutter_wireguard_wireguard_host_api_status_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* tunnel_names_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) tunnel_names_channel = fl_basic_message_channel_new(messenger, tunnel_names_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(tunnel_names_channel, flutter_wireguard_wireguard_host_api_tunnel_names_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* backend_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) backend_channel = fl_basic_message_channel_new(messenger, backend_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(backend_channel, flutter_wireguard_wireguard_host_api_backend_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* start_many_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.startMany%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_many_channel = fl_basic_message_channel_new(messenger, start_many_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_many_channel, flutter_wireguard_wireguard_host_api_start_many_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* stop_many_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stopMany%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_many_channel = fl_basic_message_channel_new(messenger, stop_many_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_many_channel, flutter_wireguard_wireguard_host_api_stop_many_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* switch_tunnel_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.switchTunnel%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) switch_tunnel_channel = fl_basic_message_channel_new(messenger, switch_tunnel_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(switch_tunnel_channel, flutter_wireguard_wireguard_host_api_switch_tunnel_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* diagnostics_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.diagnostics%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) diagnostics_channel = fl_basic_message_channel_new(messenger, diagnostics_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(diagnostics_channel, flutter_wireguard_wireguard_host_api_diagnostics_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* dump_trace_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.dumpTrace%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) dump_trace_channel = fl_basic_message_channel_new(messenger, dump_trace_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(dump_trace_channel, flutter_wireguard_wireguard_host_api_dump_trace_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* lookup_peer_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeer%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) lookup_peer_channel = fl_basic_message_channel_new(messenger, lookup_peer_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(lookup_peer_channel, flutter_wireguard_wireguard_host_api_lookup_peer_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* lookup_peers_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeers%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) lookup_peers_channel = fl_basic_message_channel_new(messenger, lookup_peers_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(lookup_peers_channel, flutter_wireguard_wireguard_host_api_lookup_peers_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* compute_allowed_ips_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.computeAllowedIps%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) compute_allowed_ips_channel = fl_basic_message_channel_new(messenger, compute_allowed_ips_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(compute_allowed_ips_channel, flutter_wireguard_wireguard_host_api_compute_allowed_ips_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* reresolve_endpoints_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.reresolveEndpoints%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) reresolve_endpoints_channel = fl_basic_message_channel_new(messenger, reresolve_endpoints_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(reresolve_endpoints_channel, flutter_wireguard_wireguard_host_api_reresolve_endpoints_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_stale_after_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setStaleAfter%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_stale_after_channel = fl_basic_message_channel_new(messenger, set_stale_after_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_stale_after_channel, flutter_wireguard_wireguard_host_api_set_stale_after_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* generate_key_pairs_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.generateKeyPairs%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) generate_key_pairs_channel = fl_basic_message_channel_new(messenger, generate_key_pairs_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(generate_key_pairs_channel, flutter_wireguard_wireguard_host_api_generate_key_pairs_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* public_keys_from_private_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.publicKeysFromPrivate%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) public_keys_from_private_channel = fl_basic_message_channel_new(messenger, public_keys_from_private_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(public_keys_from_private_channel, flutter_wireguard_wireguard_host_api_public_keys_from_private_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* peer_by_public_key_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.peerByPublicKey%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) peer_by_public_key_channel = fl_basic_message_channel_new(messenger, peer_by_public_key_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(peer_by_public_key_channel, flutter_wireguard_wireguard_host_api_peer_by_public_key_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* usage_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.usage%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) usage_channel = fl_basic_message_channel_new(messenger, usage_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(usage_channel, flutter_wireguard_wireguard_host_api_usage_cb, g_object_ref(api_data), g_object_unref);
+  g_autofree gchar* set_usage_quota_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setUsageQuota%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_usage_quota_channel = fl_basic_message_channel_new(messenger, set_usage_quota_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_usage_quota_channel, flutter_wireguard_wireguard_host_api_set_usage_quota_cb, g_object_ref(api_data), g_object_unref);
+}
+
+void flutter_wireguard_wireguard_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix) {
+  g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
+
+  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
+  g_autofree gchar* start_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_channel = fl_basic_message_channel_new(messenger, start_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* stop_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_channel = fl_basic_message_channel_new(messenger, stop_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* status_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) status_channel = fl_basic_message_channel_new(messenger, status_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(status_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* tunnel_names_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) tunnel_names_channel = fl_basic_message_channel_new(messenger, tunnel_names_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(tunnel_names_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* backend_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) backend_channel = fl_basic_message_channel_new(messenger, backend_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(backend_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* start_many_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.startMany%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) start_many_channel = fl_basic_message_channel_new(messenger, start_many_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(start_many_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* stop_many_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stopMany%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) stop_many_channel = fl_basic_message_channel_new(messenger, stop_many_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(stop_many_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* switch_tunnel_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.switchTunnel%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) switch_tunnel_channel = fl_basic_message_channel_new(messenger, switch_tunnel_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(switch_tunnel_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* diagnostics_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.diagnostics%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) diagnostics_channel = fl_basic_message_channel_new(messenger, diagnostics_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(diagnostics_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* dump_trace_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.dumpTrace%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) dump_trace_channel = fl_basic_message_channel_new(messenger, dump_trace_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(dump_trace_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* lookup_peer_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeer%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) lookup_peer_channel = fl_basic_message_channel_new(messenger, lookup_peer_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(lookup_peer_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* lookup_peers_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeers%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) lookup_peers_channel = fl_basic_message_channel_new(messenger, lookup_peers_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(lookup_peers_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* compute_allowed_ips_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.computeAllowedIps%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) compute_allowed_ips_channel = fl_basic_message_channel_new(messenger, compute_allowed_ips_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(compute_allowed_ips_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* reresolve_endpoints_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.reresolveEndpoints%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) reresolve_endpoints_channel = fl_basic_message_channel_new(messenger, reresolve_endpoints_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(reresolve_endpoints_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_stale_after_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setStaleAfter%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_stale_after_channel = fl_basic_message_channel_new(messenger, set_stale_after_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_stale_after_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* generate_key_pairs_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.generateKeyPairs%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) generate_key_pairs_channel = fl_basic_message_channel_new(messenger, generate_key_pairs_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(generate_key_pairs_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* public_keys_from_private_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.publicKeysFromPrivate%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) public_keys_from_private_channel = fl_basic_message_channel_new(messenger, public_keys_from_private_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(public_keys_from_private_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* peer_by_public_key_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.peerByPublicKey%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) peer_by_public_key_channel = fl_basic_message_channel_new(messenger, peer_by_public_key_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(peer_by_public_key_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* usage_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.usage%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) usage_channel = fl_basic_message_channel_new(messenger, usage_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(usage_channel, nullptr, nullptr, nullptr);
+  g_autofree gchar* set_usage_quota_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setUsageQuota%s", dot_suffix);
+  g_autoptr(FlBasicMessageChannel) set_usage_quota_channel = fl_basic_message_channel_new(messenger, set_usage_quota_channel_name, FL_MESSAGE_CODEC(codec));
+  fl_basic_message_channel_set_message_handler(set_usage_quota_channel, nullptr, nullptr, nullptr);
+}
+
+void flutter_wireguard_wireguard_host_api_respond_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterWireguardWireguardHostApiStartResponse) response = flutter_wireguard_wireguard_host_api_start_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "start", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiStartResponse) response = flutter_wireguard_wireguard_host_api_start_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "start", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterWireguardWireguardHostApiStopResponse) response = flutter_wireguard_wireguard_host_api_stop_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stop", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiStopResponse) response = flutter_wireguard_wireguard_host_api_stop_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stop", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelStatus* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiStatusResponse) response = flutter_wireguard_wireguard_host_api_status_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "status", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiStatusResponse) response = flutter_wireguard_wireguard_host_api_status_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "status", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiTunnelNamesResponse) response = flutter_wireguard_wireguard_host_api_tunnel_names_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "tunnelNames", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiTunnelNamesResponse) response = flutter_wireguard_wireguard_host_api_tunnel_names_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "tunnelNames", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardBackendInfo* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiBackendResponse) response = flutter_wireguard_wireguard_host_api_backend_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "backend", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiBackendResponse) response = flutter_wireguard_wireguard_host_api_backend_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "backend", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_start_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiStartManyResponse) response = flutter_wireguard_wireguard_host_api_start_many_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "startMany", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_start_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiStartManyResponse) response = flutter_wireguard_wireguard_host_api_start_many_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "startMany", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_stop_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiStopManyResponse) response = flutter_wireguard_wireguard_host_api_stop_many_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stopMany", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_stop_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiStopManyResponse) response = flutter_wireguard_wireguard_host_api_stop_many_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stopMany", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_switch_tunnel(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterWireguardWireguardHostApiSwitchTunnelResponse) response = flutter_wireguard_wireguard_host_api_switch_tunnel_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "switchTunnel", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_switch_tunnel(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiSwitchTunnelResponse) response = flutter_wireguard_wireguard_host_api_switch_tunnel_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "switchTunnel", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_diagnostics(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiDiagnosticsResponse) response = flutter_wireguard_wireguard_host_api_diagnostics_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "diagnostics", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_diagnostics(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiDiagnosticsResponse) response = flutter_wireguard_wireguard_host_api_diagnostics_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "diagnostics", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_dump_trace(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterWireguardWireguardHostApiDumpTraceResponse) response = flutter_wireguard_wireguard_host_api_dump_trace_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "dumpTrace", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_dump_trace(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiDumpTraceResponse) response = flutter_wireguard_wireguard_host_api_dump_trace_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "dumpTrace", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_lookup_peer(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiLookupPeerResponse) response = flutter_wireguard_wireguard_host_api_lookup_peer_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "lookupPeer", error->message);
+  }
+}
+
+void flutter_wireguard_wireguard_host_api_respond_error_lookup_peer(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiLookupPeerResponse) response = flutter_wireguard_wireguard_host_api_lookup_peer_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "lookupPeer", error->message);
   }
+}
 
-  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
-  self->vtable->tunnel_names(handle, self->user_data);
+void flutter_wireguard_wireguard_host_api_respond_lookup_peers(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiLookupPeersResponse) response = flutter_wireguard_wireguard_host_api_lookup_peers_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "lookupPeers", error->message);
+  }
 }
 
-static void flutter_wireguard_wireguard_host_api_backend_cb(FlBasicMessageChannel* channel, FlValue* message_, FlBasicMessageChannelResponseHandle* response_handle, gpointer user_data) {
-  FlutterWireguardWireguardHostApi* self = FLUTTER_WIREGUARD_WIREGUARD_HOST_API(user_data);
+void flutter_wireguard_wireguard_host_api_respond_error_lookup_peers(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiLookupPeersResponse) response = flutter_wireguard_wireguard_host_api_lookup_peers_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "lookupPeers", error->message);
+  }
+}
 
-  if (self->vtable == nullptr || self->vtable->backend == nullptr) {
-    return;
+void flutter_wireguard_wireguard_host_api_respond_compute_allowed_ips(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiComputeAllowedIpsResponse) response = flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "computeAllowedIps", error->message);
   }
+}
 
-  g_autoptr(FlutterWireguardWireguardHostApiResponseHandle) handle = flutter_wireguard_wireguard_host_api_response_handle_new(channel, response_handle);
-  self->vtable->backend(handle, self->user_data);
+void flutter_wireguard_wireguard_host_api_respond_error_compute_allowed_ips(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiComputeAllowedIpsResponse) response = flutter_wireguard_wireguard_host_api_compute_allowed_ips_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "computeAllowedIps", error->message);
+  }
 }
 
-void flutter_wireguard_wireguard_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func) {
-  g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
-  g_autoptr(FlutterWireguardWireguardHostApi) api_data = flutter_wireguard_wireguard_host_api_new(vtable, user_data, user_data_free_func);
+void flutter_wireguard_wireguard_host_api_respond_reresolve_endpoints(FlutterWireguardWireguardHostApiResponseHandle* response_handle, int64_t return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiReresolveEndpointsResponse) response = flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_new(return_value);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "reresolveEndpoints", error->message);
+  }
+}
 
-  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
-  g_autofree gchar* start_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) start_channel = fl_basic_message_channel_new(messenger, start_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(start_channel, flutter_wireguard_wireguard_host_api_start_cb, g_object_ref(api_data), g_object_unref);
-  g_autofree gchar* stop_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) stop_channel = fl_basic_message_channel_new(messenger, stop_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(stop_channel, flutter_wireguard_wireguard_host_api_stop_cb, g_object_ref(api_data), g_object_unref);
-  g_autofree gchar* status_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) status_channel = fl_basic_message_channel_new(messenger, status_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(status_channel, flutter_wireguard_wireguard_host_api_status_cb, g_object_ref(api_data), g_object_unref);
-  g_autofree gchar* tunnel_names_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) tunnel_names_channel = fl_basic_message_channel_new(messenger, tunnel_names_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(tunnel_names_channel, flutter_wireguard_wireguard_host_api_tunnel_names_cb, g_object_ref(api_data), g_object_unref);
-  g_autofree gchar* backend_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) backend_channel = fl_basic_message_channel_new(messenger, backend_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(backend_channel, flutter_wireguard_wireguard_host_api_backend_cb, g_object_ref(api_data), g_object_unref);
+void flutter_wireguard_wireguard_host_api_respond_error_reresolve_endpoints(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiReresolveEndpointsResponse) response = flutter_wireguard_wireguard_host_api_reresolve_endpoints_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "reresolveEndpoints", error->message);
+  }
 }
 
-void flutter_wireguard_wireguard_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix) {
-  g_autofree gchar* dot_suffix = suffix != nullptr ? g_strdup_printf(".%s", suffix) : g_strdup("");
+void flutter_wireguard_wireguard_host_api_respond_set_stale_after(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
+  g_autoptr(FlutterWireguardWireguardHostApiSetStaleAfterResponse) response = flutter_wireguard_wireguard_host_api_set_stale_after_response_new();
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "setStaleAfter", error->message);
+  }
+}
 
-  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
-  g_autofree gchar* start_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) start_channel = fl_basic_message_channel_new(messenger, start_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(start_channel, nullptr, nullptr, nullptr);
-  g_autofree gchar* stop_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) stop_channel = fl_basic_message_channel_new(messenger, stop_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(stop_channel, nullptr, nullptr, nullptr);
-  g_autofree gchar* status_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) status_channel = fl_basic_message_channel_new(messenger, status_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(status_channel, nullptr, nullptr, nullptr);
-  g_autofree gchar* tunnel_names_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) tunnel_names_channel = fl_basic_message_channel_new(messenger, tunnel_names_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(tunnel_names_channel, nullptr, nullptr, nullptr);
-  g_autofree gchar* backend_channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend%s", dot_suffix);
-  g_autoptr(FlBasicMessageChannel) backend_channel = fl_basic_message_channel_new(messenger, backend_channel_name, FL_MESSAGE_CODEC(codec));
-  fl_basic_message_channel_set_message_handler(backend_channel, nullptr, nullptr, nullptr);
+void flutter_wireguard_wireguard_host_api_respond_error_set_stale_after(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiSetStaleAfterResponse) response = flutter_wireguard_wireguard_host_api_set_stale_after_response_new_error(code, message, details);
+  g_autoptr(GError) error = nullptr;
+  if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "setStaleAfter", error->message);
+  }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
-  g_autoptr(FlutterWireguardWireguardHostApiStartResponse) response = flutter_wireguard_wireguard_host_api_start_response_new();
+void flutter_wireguard_wireguard_host_api_respond_generate_key_pairs(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiGenerateKeyPairsResponse) response = flutter_wireguard_wireguard_host_api_generate_key_pairs_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "start", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "generateKeyPairs", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_error_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
-  g_autoptr(FlutterWireguardWireguardHostApiStartResponse) response = flutter_wireguard_wireguard_host_api_start_response_new_error(code, message, details);
+void flutter_wireguard_wireguard_host_api_respond_error_generate_key_pairs(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiGenerateKeyPairsResponse) response = flutter_wireguard_wireguard_host_api_generate_key_pairs_response_new_error(code, message, details);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "start", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "generateKeyPairs", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle) {
-  g_autoptr(FlutterWireguardWireguardHostApiStopResponse) response = flutter_wireguard_wireguard_host_api_stop_response_new();
+void flutter_wireguard_wireguard_host_api_respond_public_keys_from_private(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse) response = flutter_wireguard_wireguard_host_api_public_keys_from_private_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stop", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "publicKeysFromPrivate", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_error_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
-  g_autoptr(FlutterWireguardWireguardHostApiStopResponse) response = flutter_wireguard_wireguard_host_api_stop_response_new_error(code, message, details);
+void flutter_wireguard_wireguard_host_api_respond_error_public_keys_from_private(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiPublicKeysFromPrivateResponse) response = flutter_wireguard_wireguard_host_api_public_keys_from_private_response_new_error(code, message, details);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "stop", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "publicKeysFromPrivate", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelStatus* return_value) {
-  g_autoptr(FlutterWireguardWireguardHostApiStatusResponse) response = flutter_wireguard_wireguard_host_api_status_response_new(return_value);
+void flutter_wireguard_wireguard_host_api_respond_peer_by_public_key(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardPeerStatus* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiPeerByPublicKeyResponse) response = flutter_wireguard_wireguard_host_api_peer_by_public_key_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "status", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "peerByPublicKey", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_error_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
-  g_autoptr(FlutterWireguardWireguardHostApiStatusResponse) response = flutter_wireguard_wireguard_host_api_status_response_new_error(code, message, details);
+void flutter_wireguard_wireguard_host_api_respond_error_peer_by_public_key(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiPeerByPublicKeyResponse) response = flutter_wireguard_wireguard_host_api_peer_by_public_key_response_new_error(code, message, details);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "status", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "peerByPublicKey", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value) {
-  g_autoptr(FlutterWireguardWireguardHostApiTunnelNamesResponse) response = flutter_wireguard_wireguard_host_api_tunnel_names_response_new(return_value);
+void flutter_wireguard_wireguard_host_api_respond_usage(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelUsage* return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiUsageResponse) response = flutter_wireguard_wireguard_host_api_usage_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "tunnelNames", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "usage", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_error_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
-  g_autoptr(FlutterWireguardWireguardHostApiTunnelNamesResponse) response = flutter_wireguard_wireguard_host_api_tunnel_names_response_new_error(code, message, details);
+void flutter_wireguard_wireguard_host_api_respond_error_usage(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiUsageResponse) response = flutter_wireguard_wireguard_host_api_usage_response_new_error(code, message, details);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "tunnelNames", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "usage", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardBackendInfo* return_value) {
-  g_autoptr(FlutterWireguardWireguardHostApiBackendResponse) response = flutter_wireguard_wireguard_host_api_backend_response_new(return_value);
+void flutter_wireguard_wireguard_host_api_respond_set_usage_quota(FlutterWireguardWireguardHostApiResponseHandle* response_handle, int64_t return_value) {
+  g_autoptr(FlutterWireguardWireguardHostApiSetUsageQuotaResponse) response = flutter_wireguard_wireguard_host_api_set_usage_quota_response_new(return_value);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "backend", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "setUsageQuota", error->message);
   }
 }
 
-void flutter_wireguard_wireguard_host_api_respond_error_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
-  g_autoptr(FlutterWireguardWireguardHostApiBackendResponse) response = flutter_wireguard_wireguard_host_api_backend_response_new_error(code, message, details);
+void flutter_wireguard_wireguard_host_api_respond_error_set_usage_quota(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details) {
+  g_autoptr(FlutterWireguardWireguardHostApiSetUsageQuotaResponse) response = flutter_wireguard_wireguard_host_api_set_usage_quota_response_new_error(code, message, details);
   g_autoptr(GError) error = nullptr;
   if (!fl_basic_message_channel_respond(response_handle->channel, response_handle->response_handle, response->value, &error)) {
-    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "backend", error->message);
+    g_warning("Failed to send response to %s.%s: %s", "WireguardHostApi", "setUsageQuota", error->message);
   }
 }
 
@@ -1055,3 +3416,240 @@ FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* flutter_wireguard_wir
   }
   return flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_new(response);
 }
+
+struct _FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse, flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_dispose(GObject* object) {
+  FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_init(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_class_init(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_dispose;
+}
+
+static FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_new(FlValue* response) {
+  FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(g_object_new(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_code(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_message(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_details(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void flutter_wireguard_wireguard_flutter_api_on_tunnel_health(FlutterWireguardWireguardFlutterApi* self, FlutterWireguardTunnelHealth* health, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(flutter_wireguard_tunnel_health_type_id, G_OBJECT(health)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth%s", self->suffix);
+  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, flutter_wireguard_wireguard_flutter_api_on_tunnel_health_cb, task);
+}
+
+FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_finish(FlutterWireguardWireguardFlutterApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_new(response);
+}
+
+struct _FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse, flutter_wireguard_wireguard_flutter_api_on_usage_quota_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_dispose(GObject* object) {
+  FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_init(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_class_init(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_dispose;
+}
+
+static FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_new(FlValue* response) {
+  FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(g_object_new(flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_code(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_message(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_details(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_usage_quota_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void flutter_wireguard_wireguard_flutter_api_on_usage_quota(FlutterWireguardWireguardFlutterApi* self, FlutterWireguardUsageQuotaExceeded* event, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(flutter_wireguard_usage_quota_exceeded_type_id, G_OBJECT(event)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onUsageQuota%s", self->suffix);
+  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, flutter_wireguard_wireguard_flutter_api_on_usage_quota_cb, task);
+}
+
+FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* flutter_wireguard_wireguard_flutter_api_on_usage_quota_finish(FlutterWireguardWireguardFlutterApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_new(response);
+}
+
+struct _FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse {
+  GObject parent_instance;
+
+  FlValue* error;
+};
+
+G_DEFINE_TYPE(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse, flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response, G_TYPE_OBJECT)
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_dispose(GObject* object) {
+  FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(object);
+  g_clear_pointer(&self->error, fl_value_unref);
+  G_OBJECT_CLASS(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_parent_class)->dispose(object);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_init(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_class_init(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponseClass* klass) {
+  G_OBJECT_CLASS(klass)->dispose = flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_dispose;
+}
+
+static FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_new(FlValue* response) {
+  FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self = FLUTTER_WIREGUARD_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(g_object_new(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_type(), nullptr));
+  if (fl_value_get_length(response) > 1) {
+    self->error = fl_value_ref(response);
+  }
+  return self;
+}
+
+gboolean flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), FALSE);
+  return self->error != nullptr;
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_code(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 0));
+}
+
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_message(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_string(fl_value_get_list_value(self->error, 1));
+}
+
+FlValue* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_details(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* self) {
+  g_return_val_if_fail(FLUTTER_WIREGUARD_IS_WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE(self), nullptr);
+  g_assert(flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(self));
+  return fl_value_get_list_value(self->error, 2);
+}
+
+static void flutter_wireguard_wireguard_flutter_api_on_tunnel_health_cb(GObject* object, GAsyncResult* result, gpointer user_data) {
+  GTask* task = G_TASK(user_data);
+  g_task_return_pointer(task, result, g_object_unref);
+}
+
+void flutter_wireguard_wireguard_flutter_api_on_tunnel_health(FlutterWireguardWireguardFlutterApi* self, FlutterWireguardTunnelHealth* health, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data) {
+  g_autoptr(FlValue) args = fl_value_new_list();
+  fl_value_append_take(args, fl_value_new_custom_object(flutter_wireguard_tunnel_health_type_id, G_OBJECT(health)));
+  g_autofree gchar* channel_name = g_strdup_printf("dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth%s", self->suffix);
+  g_autoptr(FlutterWireguardMessageCodec) codec = flutter_wireguard_message_codec_new();
+  FlBasicMessageChannel* channel = fl_basic_message_channel_new(self->messenger, channel_name, FL_MESSAGE_CODEC(codec));
+  GTask* task = g_task_new(self, cancellable, callback, user_data);
+  g_task_set_task_data(task, channel, g_object_unref);
+  fl_basic_message_channel_send(channel, args, cancellable, flutter_wireguard_wireguard_flutter_api_on_tunnel_health_cb, task);
+}
+
+FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_finish(FlutterWireguardWireguardFlutterApi* self, GAsyncResult* result, GError** error) {
+  g_autoptr(GTask) task = G_TASK(result);
+  GAsyncResult* r = G_ASYNC_RESULT(g_task_propagate_pointer(task, nullptr));
+  FlBasicMessageChannel* channel = FL_BASIC_MESSAGE_CHANNEL(g_task_get_task_data(task));
+  g_autoptr(FlValue) response = fl_basic_message_channel_send_finish(channel, r, error);
+  if (response == nullptr) { 
+    return nullptr;
+  }
+  return flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_new(response);
+}
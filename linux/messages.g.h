@@ -40,6 +40,25 @@ typedef enum {
   FLUTTER_WIREGUARD_BACKEND_KIND_UNKNOWN = 2
 } FlutterWireguardBackendKind;
 
+/**
+ * FlutterWireguardTunnelHealthState:
+ * FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_CONNECTED:
+ * First handshake since the tunnel was started.
+ * FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_STALE:
+ * No handshake for the stale-after age (180 s unless set with
+ * [WireguardHostApi.setStaleAfter]), or none that long after the start.
+ * FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_RECOVERED:
+ * A handshake again after [stale].
+ *
+ * How a running tunnel's peer is doing, judged by the age of its last
+ * handshake.
+ */
+typedef enum {
+  FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_CONNECTED = 0,
+  FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_STALE = 1,
+  FLUTTER_WIREGUARD_TUNNEL_HEALTH_STATE_RECOVERED = 2
+} FlutterWireguardTunnelHealthState;
+
 /**
  * FlutterWireguardTunnelStatus:
  *
@@ -193,242 +212,1438 @@ gboolean flutter_wireguard_backend_info_equals(FlutterWireguardBackendInfo* a, F
  */
 guint flutter_wireguard_backend_info_hash(FlutterWireguardBackendInfo* object);
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardMessageCodec, flutter_wireguard_message_codec, FLUTTER_WIREGUARD, MESSAGE_CODEC, FlStandardMessageCodec)
+/**
+ * FlutterWireguardTunnelSpec:
+ *
+ * One tunnel to bring up in a [WireguardHostApi.startMany] batch.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardTunnelSpec, flutter_wireguard_tunnel_spec, FLUTTER_WIREGUARD, TUNNEL_SPEC, GObject)
 
 /**
- * Custom type ID constants:
+ * flutter_wireguard_tunnel_spec_new:
+ * name: field in this object.
+ * config: field in this object.
  *
- * Constants used to identify custom types in the codec.
- * They are used in the codec to encode and decode custom types.
- * They may be used in custom object creation functions to identify the type.
+ * Creates a new #TunnelSpec object.
+ *
+ * Returns: a new #FlutterWireguardTunnelSpec
  */
-extern const int flutter_wireguard_tunnel_state_type_id;
-extern const int flutter_wireguard_backend_kind_type_id;
-extern const int flutter_wireguard_tunnel_status_type_id;
-extern const int flutter_wireguard_backend_info_type_id;
+FlutterWireguardTunnelSpec* flutter_wireguard_tunnel_spec_new(const gchar* name, const gchar* config);
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApi, flutter_wireguard_wireguard_host_api, FLUTTER_WIREGUARD, WIREGUARD_HOST_API, GObject)
+/**
+ * flutter_wireguard_tunnel_spec_get_name
+ * @object: a #FlutterWireguardTunnelSpec.
+ *
+ * Tunnel/interface name (e.g. "wg0").
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_tunnel_spec_get_name(FlutterWireguardTunnelSpec* object);
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiResponseHandle, flutter_wireguard_wireguard_host_api_response_handle, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_RESPONSE_HANDLE, GObject)
+/**
+ * flutter_wireguard_tunnel_spec_get_config
+ * @object: a #FlutterWireguardTunnelSpec.
+ *
+ * wg-quick / wg-config string, as for [WireguardHostApi.start].
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_tunnel_spec_get_config(FlutterWireguardTunnelSpec* object);
 
 /**
- * FlutterWireguardWireguardHostApiVTable:
+ * flutter_wireguard_tunnel_spec_equals:
+ * @a: a #FlutterWireguardTunnelSpec.
+ * @b: another #FlutterWireguardTunnelSpec.
  *
- * Table of functions exposed by WireguardHostApi to be implemented by the API provider.
+ * Checks if two #FlutterWireguardTunnelSpec objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
  */
-typedef struct {
-  void (*start)(const gchar* name, const gchar* config, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
-  void (*stop)(const gchar* name, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
-  void (*status)(const gchar* name, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
-  void (*tunnel_names)(FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
-  void (*backend)(FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
-} FlutterWireguardWireguardHostApiVTable;
+gboolean flutter_wireguard_tunnel_spec_equals(FlutterWireguardTunnelSpec* a, FlutterWireguardTunnelSpec* b);
 
 /**
- * flutter_wireguard_wireguard_host_api_set_method_handlers:
+ * flutter_wireguard_tunnel_spec_hash:
+ * @object: a #FlutterWireguardTunnelSpec.
  *
- * @messenger: an #FlBinaryMessenger.
- * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
- * @vtable: implementations of the methods in this API.
- * @user_data: (closure): user data to pass to the functions in @vtable.
- * @user_data_free_func: (allow-none): a function which gets called to free @user_data, or %NULL.
+ * Calculates a hash code for a #FlutterWireguardTunnelSpec object.
  *
- * Connects the method handlers in the WireguardHostApi API.
+ * Returns: the hash code.
  */
-void flutter_wireguard_wireguard_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func);
+guint flutter_wireguard_tunnel_spec_hash(FlutterWireguardTunnelSpec* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_clear_method_handlers:
+ * FlutterWireguardTunnelResult:
  *
- * @messenger: an #FlBinaryMessenger.
- * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ * Per-tunnel outcome of a batch call.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardTunnelResult, flutter_wireguard_tunnel_result, FLUTTER_WIREGUARD, TUNNEL_RESULT, GObject)
+
+/**
+ * flutter_wireguard_tunnel_result_new:
+ * name: field in this object.
+ * ok: field in this object.
+ * error: field in this object.
  *
- * Clears the method handlers in the WireguardHostApi API.
+ * Creates a new #TunnelResult object.
+ *
+ * Returns: a new #FlutterWireguardTunnelResult
  */
-void flutter_wireguard_wireguard_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix);
+FlutterWireguardTunnelResult* flutter_wireguard_tunnel_result_new(const gchar* name, gboolean ok, const gchar* error);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_start:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * flutter_wireguard_tunnel_result_get_name
+ * @object: a #FlutterWireguardTunnelResult.
  *
- * Responds to WireguardHostApi.start. 
+ * Gets the value of the name field of @object.
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+const gchar* flutter_wireguard_tunnel_result_get_name(FlutterWireguardTunnelResult* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_error_start:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * flutter_wireguard_tunnel_result_get_ok
+ * @object: a #FlutterWireguardTunnelResult.
  *
- * Responds with an error to WireguardHostApi.start. 
+ * True if the tunnel reached the requested state.
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_error_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+gboolean flutter_wireguard_tunnel_result_get_ok(FlutterWireguardTunnelResult* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_stop:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * flutter_wireguard_tunnel_result_get_error
+ * @object: a #FlutterWireguardTunnelResult.
  *
- * Responds to WireguardHostApi.stop. 
+ * Backend error message when [ok] is false.
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+const gchar* flutter_wireguard_tunnel_result_get_error(FlutterWireguardTunnelResult* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_error_stop:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * flutter_wireguard_tunnel_result_equals:
+ * @a: a #FlutterWireguardTunnelResult.
+ * @b: another #FlutterWireguardTunnelResult.
  *
- * Responds with an error to WireguardHostApi.stop. 
+ * Checks if two #FlutterWireguardTunnelResult objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
  */
-void flutter_wireguard_wireguard_host_api_respond_error_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+gboolean flutter_wireguard_tunnel_result_equals(FlutterWireguardTunnelResult* a, FlutterWireguardTunnelResult* b);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_status:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @return_value: location to write the value returned by this method.
+ * flutter_wireguard_tunnel_result_hash:
+ * @object: a #FlutterWireguardTunnelResult.
  *
- * Responds to WireguardHostApi.status. 
+ * Calculates a hash code for a #FlutterWireguardTunnelResult object.
+ *
+ * Returns: the hash code.
  */
-void flutter_wireguard_wireguard_host_api_respond_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelStatus* return_value);
+guint flutter_wireguard_tunnel_result_hash(FlutterWireguardTunnelResult* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_error_status:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * FlutterWireguardPhaseStats:
  *
- * Responds with an error to WireguardHostApi.status. 
+ * Latency percentiles of one step of a tunnel operation.
  */
-void flutter_wireguard_wireguard_host_api_respond_error_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardPhaseStats, flutter_wireguard_phase_stats, FLUTTER_WIREGUARD, PHASE_STATS, GObject)
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_tunnel_names:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @return_value: location to write the value returned by this method.
+ * flutter_wireguard_phase_stats_new:
+ * op: field in this object.
+ * phase: field in this object.
+ * count: field in this object.
+ * p50_ms: field in this object.
+ * p95_ms: field in this object.
+ * p99_ms: field in this object.
  *
- * Responds to WireguardHostApi.tunnelNames. 
+ * Creates a new #PhaseStats object.
+ *
+ * Returns: a new #FlutterWireguardPhaseStats
  */
-void flutter_wireguard_wireguard_host_api_respond_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+FlutterWireguardPhaseStats* flutter_wireguard_phase_stats_new(const gchar* op, const gchar* phase, int64_t count, double p50_ms, double p95_ms, double p99_ms);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_error_tunnel_names:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * flutter_wireguard_phase_stats_get_op
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Responds with an error to WireguardHostApi.tunnelNames. 
+ * Operation the phase belongs to ("start", "stop", "switch", ...).
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_error_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+const gchar* flutter_wireguard_phase_stats_get_op(FlutterWireguardPhaseStats* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_backend:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @return_value: location to write the value returned by this method.
+ * flutter_wireguard_phase_stats_get_phase
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Responds to WireguardHostApi.backend. 
+ * Step within [op] ("wg_quick_up", "create_service", "total", ...).
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardBackendInfo* return_value);
+const gchar* flutter_wireguard_phase_stats_get_phase(FlutterWireguardPhaseStats* object);
 
 /**
- * flutter_wireguard_wireguard_host_api_respond_error_backend:
- * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
- * @code: error code.
- * @message: error message.
- * @details: (allow-none): error details or %NULL.
+ * flutter_wireguard_phase_stats_get_count
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Responds with an error to WireguardHostApi.backend. 
+ * Number of samples recorded since the process started.
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_host_api_respond_error_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+int64_t flutter_wireguard_phase_stats_get_count(FlutterWireguardPhaseStats* object);
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse, flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API_ON_TUNNEL_STATUS_RESPONSE, GObject)
+/**
+ * flutter_wireguard_phase_stats_get_p50_ms
+ * @object: a #FlutterWireguardPhaseStats.
+ *
+ * Gets the value of the p50Ms field of @object.
+ *
+ * Returns: the field value.
+ */
+double flutter_wireguard_phase_stats_get_p50_ms(FlutterWireguardPhaseStats* object);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_is_error:
- * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ * flutter_wireguard_phase_stats_get_p95_ms
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Checks if a response to WireguardFlutterApi.onTunnelStatus is an error.
+ * Gets the value of the p95Ms field of @object.
  *
- * Returns: a %TRUE if this response is an error.
+ * Returns: the field value.
  */
-gboolean flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_is_error(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+double flutter_wireguard_phase_stats_get_p95_ms(FlutterWireguardPhaseStats* object);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_code:
- * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ * flutter_wireguard_phase_stats_get_p99_ms
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Get the error code for this response.
+ * Gets the value of the p99Ms field of @object.
  *
- * Returns: an error code or %NULL if not an error.
+ * Returns: the field value.
  */
-const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_code(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+double flutter_wireguard_phase_stats_get_p99_ms(FlutterWireguardPhaseStats* object);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_message:
- * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ * flutter_wireguard_phase_stats_equals:
+ * @a: a #FlutterWireguardPhaseStats.
+ * @b: another #FlutterWireguardPhaseStats.
  *
- * Get the error message for this response.
+ * Checks if two #FlutterWireguardPhaseStats objects are equal.
  *
- * Returns: an error message.
+ * Returns: TRUE if @a and @b are equal.
  */
-const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_message(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+gboolean flutter_wireguard_phase_stats_equals(FlutterWireguardPhaseStats* a, FlutterWireguardPhaseStats* b);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_details:
- * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ * flutter_wireguard_phase_stats_hash:
+ * @object: a #FlutterWireguardPhaseStats.
  *
- * Get the error details for this response.
+ * Calculates a hash code for a #FlutterWireguardPhaseStats object.
  *
- * Returns: (allow-none): an error details or %NULL.
+ * Returns: the hash code.
  */
-FlValue* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_details(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+guint flutter_wireguard_phase_stats_hash(FlutterWireguardPhaseStats* object);
 
 /**
- * FlutterWireguardWireguardFlutterApi:
+ * FlutterWireguardTunnelHealth:
  *
- * Platform -> host events.
+ * A peer of a running tunnel crossing the handshake-age threshold.
  */
 
-G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApi, flutter_wireguard_wireguard_flutter_api, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API, GObject)
+G_DECLARE_FINAL_TYPE(FlutterWireguardTunnelHealth, flutter_wireguard_tunnel_health, FLUTTER_WIREGUARD, TUNNEL_HEALTH, GObject)
 
 /**
- * flutter_wireguard_wireguard_flutter_api_new:
- * @messenger: an #FlBinaryMessenger.
- * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ * flutter_wireguard_tunnel_health_new:
+ * name: field in this object.
+ * public_key: field in this object.
+ * state: field in this object.
+ * last_handshake: field in this object.
  *
- * Creates a new object to access the WireguardFlutterApi API.
+ * Creates a new #TunnelHealth object.
  *
- * Returns: a new #FlutterWireguardWireguardFlutterApi
+ * Returns: a new #FlutterWireguardTunnelHealth
  */
-FlutterWireguardWireguardFlutterApi* flutter_wireguard_wireguard_flutter_api_new(FlBinaryMessenger* messenger, const gchar* suffix);
+FlutterWireguardTunnelHealth* flutter_wireguard_tunnel_health_new(const gchar* name, const gchar* public_key, FlutterWireguardTunnelHealthState state, int64_t last_handshake);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status:
- * @api: a #FlutterWireguardWireguardFlutterApi.
- * @status: parameter for this method.
- * @cancellable: (allow-none): a #GCancellable or %NULL.
- * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
- * @user_data: (closure): user data to pass to @callback.
+ * flutter_wireguard_tunnel_health_get_name
+ * @object: a #FlutterWireguardTunnelHealth.
  *
- * Pushed whenever a tunnel changes state or its statistics tick.
+ * Tunnel/interface name (e.g. "wg0").
+ *
+ * Returns: the field value.
  */
-void flutter_wireguard_wireguard_flutter_api_on_tunnel_status(FlutterWireguardWireguardFlutterApi* api, FlutterWireguardTunnelStatus* status, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+const gchar* flutter_wireguard_tunnel_health_get_name(FlutterWireguardTunnelHealth* object);
 
 /**
- * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_finish:
- * @api: a #FlutterWireguardWireguardFlutterApi.
- * @result: a #GAsyncResult.
- * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ * flutter_wireguard_tunnel_health_get_public_key
+ * @object: a #FlutterWireguardTunnelHealth.
  *
- * Completes a flutter_wireguard_wireguard_flutter_api_on_tunnel_status() call.
+ * Base64 public key of the peer; "" where the platform only reports the
+ * tunnel as a whole (Windows).
  *
- * Returns: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse or %NULL on error.
+ * Returns: the field value.
  */
-FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_finish(FlutterWireguardWireguardFlutterApi* api, GAsyncResult* result, GError** error);
+const gchar* flutter_wireguard_tunnel_health_get_public_key(FlutterWireguardTunnelHealth* object);
+
+/**
+ * flutter_wireguard_tunnel_health_get_state
+ * @object: a #FlutterWireguardTunnelHealth.
+ *
+ * Gets the value of the state field of @object.
+ *
+ * Returns: the field value.
+ */
+FlutterWireguardTunnelHealthState flutter_wireguard_tunnel_health_get_state(FlutterWireguardTunnelHealth* object);
+
+/**
+ * flutter_wireguard_tunnel_health_get_last_handshake
+ * @object: a #FlutterWireguardTunnelHealth.
+ *
+ * Epoch milliseconds of the handshake [state] was judged by (0 if none).
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_tunnel_health_get_last_handshake(FlutterWireguardTunnelHealth* object);
+
+/**
+ * flutter_wireguard_tunnel_health_equals:
+ * @a: a #FlutterWireguardTunnelHealth.
+ * @b: another #FlutterWireguardTunnelHealth.
+ *
+ * Checks if two #FlutterWireguardTunnelHealth objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_tunnel_health_equals(FlutterWireguardTunnelHealth* a, FlutterWireguardTunnelHealth* b);
+
+/**
+ * flutter_wireguard_tunnel_health_hash:
+ * @object: a #FlutterWireguardTunnelHealth.
+ *
+ * Calculates a hash code for a #FlutterWireguardTunnelHealth object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_tunnel_health_hash(FlutterWireguardTunnelHealth* object);
+
+/**
+ * FlutterWireguardKeyPairData:
+ *
+ * A WireGuard keypair generated natively.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardKeyPairData, flutter_wireguard_key_pair_data, FLUTTER_WIREGUARD, KEY_PAIR_DATA, GObject)
+
+/**
+ * flutter_wireguard_key_pair_data_new:
+ * private_key: field in this object.
+ * public_key: field in this object.
+ *
+ * Creates a new #KeyPairData object.
+ *
+ * Returns: a new #FlutterWireguardKeyPairData
+ */
+FlutterWireguardKeyPairData* flutter_wireguard_key_pair_data_new(const gchar* private_key, const gchar* public_key);
+
+/**
+ * flutter_wireguard_key_pair_data_get_private_key
+ * @object: a #FlutterWireguardKeyPairData.
+ *
+ * Base64, as `wg genkey` prints it.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_key_pair_data_get_private_key(FlutterWireguardKeyPairData* object);
+
+/**
+ * flutter_wireguard_key_pair_data_get_public_key
+ * @object: a #FlutterWireguardKeyPairData.
+ *
+ * Base64, as `wg pubkey` prints it.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_key_pair_data_get_public_key(FlutterWireguardKeyPairData* object);
+
+/**
+ * flutter_wireguard_key_pair_data_equals:
+ * @a: a #FlutterWireguardKeyPairData.
+ * @b: another #FlutterWireguardKeyPairData.
+ *
+ * Checks if two #FlutterWireguardKeyPairData objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_key_pair_data_equals(FlutterWireguardKeyPairData* a, FlutterWireguardKeyPairData* b);
+
+/**
+ * flutter_wireguard_key_pair_data_hash:
+ * @object: a #FlutterWireguardKeyPairData.
+ *
+ * Calculates a hash code for a #FlutterWireguardKeyPairData object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_key_pair_data_hash(FlutterWireguardKeyPairData* object);
+
+/**
+ * FlutterWireguardPeerStatus:
+ *
+ * One peer of a running tunnel, as of the last status poll.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardPeerStatus, flutter_wireguard_peer_status, FLUTTER_WIREGUARD, PEER_STATUS, GObject)
+
+/**
+ * flutter_wireguard_peer_status_new:
+ * public_key: field in this object.
+ * endpoint: field in this object.
+ * rx: field in this object.
+ * tx: field in this object.
+ * last_handshake: field in this object.
+ * persistent_keepalive: field in this object.
+ *
+ * Creates a new #PeerStatus object.
+ *
+ * Returns: a new #FlutterWireguardPeerStatus
+ */
+FlutterWireguardPeerStatus* flutter_wireguard_peer_status_new(const gchar* public_key, const gchar* endpoint, int64_t rx, int64_t tx, int64_t last_handshake, int64_t persistent_keepalive);
+
+/**
+ * flutter_wireguard_peer_status_get_public_key
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Base64 public key.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_peer_status_get_public_key(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_get_endpoint
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * "host:port" the peer was last heard from, null if none yet.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_peer_status_get_endpoint(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_get_rx
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Bytes received from the peer.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_status_get_rx(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_get_tx
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Bytes sent to the peer.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_status_get_tx(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_get_last_handshake
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Epoch milliseconds of the latest handshake, 0 if none.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_status_get_last_handshake(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_get_persistent_keepalive
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Seconds; 0 when off.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_status_get_persistent_keepalive(FlutterWireguardPeerStatus* object);
+
+/**
+ * flutter_wireguard_peer_status_equals:
+ * @a: a #FlutterWireguardPeerStatus.
+ * @b: another #FlutterWireguardPeerStatus.
+ *
+ * Checks if two #FlutterWireguardPeerStatus objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_peer_status_equals(FlutterWireguardPeerStatus* a, FlutterWireguardPeerStatus* b);
+
+/**
+ * flutter_wireguard_peer_status_hash:
+ * @object: a #FlutterWireguardPeerStatus.
+ *
+ * Calculates a hash code for a #FlutterWireguardPeerStatus object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_peer_status_hash(FlutterWireguardPeerStatus* object);
+
+/**
+ * FlutterWireguardPeerUsage:
+ *
+ * One peer's share of a [TunnelUsage].
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardPeerUsage, flutter_wireguard_peer_usage, FLUTTER_WIREGUARD, PEER_USAGE, GObject)
+
+/**
+ * flutter_wireguard_peer_usage_new:
+ * public_key: field in this object.
+ * rx: field in this object.
+ * tx: field in this object.
+ *
+ * Creates a new #PeerUsage object.
+ *
+ * Returns: a new #FlutterWireguardPeerUsage
+ */
+FlutterWireguardPeerUsage* flutter_wireguard_peer_usage_new(const gchar* public_key, int64_t rx, int64_t tx);
+
+/**
+ * flutter_wireguard_peer_usage_get_public_key
+ * @object: a #FlutterWireguardPeerUsage.
+ *
+ * Base64 public key.
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_peer_usage_get_public_key(FlutterWireguardPeerUsage* object);
+
+/**
+ * flutter_wireguard_peer_usage_get_rx
+ * @object: a #FlutterWireguardPeerUsage.
+ *
+ * Bytes received from the peer.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_usage_get_rx(FlutterWireguardPeerUsage* object);
+
+/**
+ * flutter_wireguard_peer_usage_get_tx
+ * @object: a #FlutterWireguardPeerUsage.
+ *
+ * Bytes sent to the peer.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_peer_usage_get_tx(FlutterWireguardPeerUsage* object);
+
+/**
+ * flutter_wireguard_peer_usage_equals:
+ * @a: a #FlutterWireguardPeerUsage.
+ * @b: another #FlutterWireguardPeerUsage.
+ *
+ * Checks if two #FlutterWireguardPeerUsage objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_peer_usage_equals(FlutterWireguardPeerUsage* a, FlutterWireguardPeerUsage* b);
+
+/**
+ * flutter_wireguard_peer_usage_hash:
+ * @object: a #FlutterWireguardPeerUsage.
+ *
+ * Calculates a hash code for a #FlutterWireguardPeerUsage object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_peer_usage_hash(FlutterWireguardPeerUsage* object);
+
+/**
+ * FlutterWireguardTunnelUsage:
+ *
+ * Data a tunnel used over a period, across restarts of the tunnel and of
+ * the app.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardTunnelUsage, flutter_wireguard_tunnel_usage, FLUTTER_WIREGUARD, TUNNEL_USAGE, GObject)
+
+/**
+ * flutter_wireguard_tunnel_usage_new:
+ * name: field in this object.
+ * since: field in this object.
+ * rx: field in this object.
+ * tx: field in this object.
+ * peers: field in this object.
+ *
+ * Creates a new #TunnelUsage object.
+ *
+ * Returns: a new #FlutterWireguardTunnelUsage
+ */
+FlutterWireguardTunnelUsage* flutter_wireguard_tunnel_usage_new(const gchar* name, int64_t since, int64_t rx, int64_t tx, FlValue* peers);
+
+/**
+ * flutter_wireguard_tunnel_usage_get_name
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Tunnel/interface name (e.g. "wg0").
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_tunnel_usage_get_name(FlutterWireguardTunnelUsage* object);
+
+/**
+ * flutter_wireguard_tunnel_usage_get_since
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Epoch milliseconds the usage is counted from, as asked.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_tunnel_usage_get_since(FlutterWireguardTunnelUsage* object);
+
+/**
+ * flutter_wireguard_tunnel_usage_get_rx
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Bytes received over the tunnel.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_tunnel_usage_get_rx(FlutterWireguardTunnelUsage* object);
+
+/**
+ * flutter_wireguard_tunnel_usage_get_tx
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Bytes sent over the tunnel.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_tunnel_usage_get_tx(FlutterWireguardTunnelUsage* object);
+
+/**
+ * flutter_wireguard_tunnel_usage_get_peers
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Peers that carried traffic in the period.
+ *
+ * Returns: the field value.
+ */
+FlValue* flutter_wireguard_tunnel_usage_get_peers(FlutterWireguardTunnelUsage* object);
+
+/**
+ * flutter_wireguard_tunnel_usage_equals:
+ * @a: a #FlutterWireguardTunnelUsage.
+ * @b: another #FlutterWireguardTunnelUsage.
+ *
+ * Checks if two #FlutterWireguardTunnelUsage objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_tunnel_usage_equals(FlutterWireguardTunnelUsage* a, FlutterWireguardTunnelUsage* b);
+
+/**
+ * flutter_wireguard_tunnel_usage_hash:
+ * @object: a #FlutterWireguardTunnelUsage.
+ *
+ * Calculates a hash code for a #FlutterWireguardTunnelUsage object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_tunnel_usage_hash(FlutterWireguardTunnelUsage* object);
+
+/**
+ * FlutterWireguardUsageQuotaExceeded:
+ *
+ * A tunnel that reached its usage quota.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardUsageQuotaExceeded, flutter_wireguard_usage_quota_exceeded, FLUTTER_WIREGUARD, USAGE_QUOTA_EXCEEDED, GObject)
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_new:
+ * name: field in this object.
+ * limit: field in this object.
+ * used: field in this object.
+ * since: field in this object.
+ * stopped: field in this object.
+ *
+ * Creates a new #UsageQuotaExceeded object.
+ *
+ * Returns: a new #FlutterWireguardUsageQuotaExceeded
+ */
+FlutterWireguardUsageQuotaExceeded* flutter_wireguard_usage_quota_exceeded_new(const gchar* name, int64_t limit, int64_t used, int64_t since, gboolean stopped);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_get_name
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Tunnel/interface name (e.g. "wg0").
+ *
+ * Returns: the field value.
+ */
+const gchar* flutter_wireguard_usage_quota_exceeded_get_name(FlutterWireguardUsageQuotaExceeded* object);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_get_limit
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * The quota, in bytes of rx + tx.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_usage_quota_exceeded_get_limit(FlutterWireguardUsageQuotaExceeded* object);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_get_used
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Bytes of rx + tx used since [since] when the quota was noticed.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_usage_quota_exceeded_get_used(FlutterWireguardUsageQuotaExceeded* object);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_get_since
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Epoch milliseconds the quota counts from.
+ *
+ * Returns: the field value.
+ */
+int64_t flutter_wireguard_usage_quota_exceeded_get_since(FlutterWireguardUsageQuotaExceeded* object);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_get_stopped
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Whether the tunnel was stopped; false if stopping it failed.
+ *
+ * Returns: the field value.
+ */
+gboolean flutter_wireguard_usage_quota_exceeded_get_stopped(FlutterWireguardUsageQuotaExceeded* object);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_equals:
+ * @a: a #FlutterWireguardUsageQuotaExceeded.
+ * @b: another #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Checks if two #FlutterWireguardUsageQuotaExceeded objects are equal.
+ *
+ * Returns: TRUE if @a and @b are equal.
+ */
+gboolean flutter_wireguard_usage_quota_exceeded_equals(FlutterWireguardUsageQuotaExceeded* a, FlutterWireguardUsageQuotaExceeded* b);
+
+/**
+ * flutter_wireguard_usage_quota_exceeded_hash:
+ * @object: a #FlutterWireguardUsageQuotaExceeded.
+ *
+ * Calculates a hash code for a #FlutterWireguardUsageQuotaExceeded object.
+ *
+ * Returns: the hash code.
+ */
+guint flutter_wireguard_usage_quota_exceeded_hash(FlutterWireguardUsageQuotaExceeded* object);
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardMessageCodec, flutter_wireguard_message_codec, FLUTTER_WIREGUARD, MESSAGE_CODEC, FlStandardMessageCodec)
+
+/**
+ * Custom type ID constants:
+ *
+ * Constants used to identify custom types in the codec.
+ * They are used in the codec to encode and decode custom types.
+ * They may be used in custom object creation functions to identify the type.
+ */
+extern const int flutter_wireguard_tunnel_state_type_id;
+extern const int flutter_wireguard_backend_kind_type_id;
+extern const int flutter_wireguard_tunnel_health_state_type_id;
+extern const int flutter_wireguard_tunnel_status_type_id;
+extern const int flutter_wireguard_backend_info_type_id;
+extern const int flutter_wireguard_tunnel_spec_type_id;
+extern const int flutter_wireguard_tunnel_result_type_id;
+extern const int flutter_wireguard_phase_stats_type_id;
+extern const int flutter_wireguard_tunnel_health_type_id;
+extern const int flutter_wireguard_key_pair_data_type_id;
+extern const int flutter_wireguard_peer_status_type_id;
+extern const int flutter_wireguard_peer_usage_type_id;
+extern const int flutter_wireguard_tunnel_usage_type_id;
+extern const int flutter_wireguard_usage_quota_exceeded_type_id;
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApi, flutter_wireguard_wireguard_host_api, FLUTTER_WIREGUARD, WIREGUARD_HOST_API, GObject)
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardHostApiResponseHandle, flutter_wireguard_wireguard_host_api_response_handle, FLUTTER_WIREGUARD, WIREGUARD_HOST_API_RESPONSE_HANDLE, GObject)
+
+/**
+ * FlutterWireguardWireguardHostApiVTable:
+ *
+ * Table of functions exposed by WireguardHostApi to be implemented by the API provider.
+ */
+typedef struct {
+  void (*start)(const gchar* name, const gchar* config, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*stop)(const gchar* name, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*status)(const gchar* name, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*tunnel_names)(FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*backend)(FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*start_many)(FlValue* specs, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*stop_many)(FlValue* names, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*switch_tunnel)(const gchar* from, const gchar* to, const gchar* config, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*diagnostics)(FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*dump_trace)(const gchar* path, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*lookup_peer)(const gchar* name, const gchar* ip_address, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*lookup_peers)(const gchar* name, FlValue* ip_addresses, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*compute_allowed_ips)(FlValue* include, FlValue* exclude, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*reresolve_endpoints)(const gchar* name, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_stale_after)(int64_t seconds, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*generate_key_pairs)(int64_t count, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*public_keys_from_private)(FlValue* private_keys, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*peer_by_public_key)(const gchar* name, const gchar* public_key, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*usage)(const gchar* name, int64_t since, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+  void (*set_usage_quota)(const gchar* name, int64_t limit_bytes, int64_t since, FlutterWireguardWireguardHostApiResponseHandle* response_handle, gpointer user_data);
+} FlutterWireguardWireguardHostApiVTable;
+
+/**
+ * flutter_wireguard_wireguard_host_api_set_method_handlers:
+ *
+ * @messenger: an #FlBinaryMessenger.
+ * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ * @vtable: implementations of the methods in this API.
+ * @user_data: (closure): user data to pass to the functions in @vtable.
+ * @user_data_free_func: (allow-none): a function which gets called to free @user_data, or %NULL.
+ *
+ * Connects the method handlers in the WireguardHostApi API.
+ */
+void flutter_wireguard_wireguard_host_api_set_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix, const FlutterWireguardWireguardHostApiVTable* vtable, gpointer user_data, GDestroyNotify user_data_free_func);
+
+/**
+ * flutter_wireguard_wireguard_host_api_clear_method_handlers:
+ *
+ * @messenger: an #FlBinaryMessenger.
+ * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ *
+ * Clears the method handlers in the WireguardHostApi API.
+ */
+void flutter_wireguard_wireguard_host_api_clear_method_handlers(FlBinaryMessenger* messenger, const gchar* suffix);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_start:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ *
+ * Responds to WireguardHostApi.start. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_start:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.start. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_start(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_stop:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ *
+ * Responds to WireguardHostApi.stop. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_stop:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.stop. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_stop(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_status:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.status. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelStatus* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_status:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.status. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_status(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_tunnel_names:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.tunnelNames. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_tunnel_names:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.tunnelNames. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_tunnel_names(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_backend:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.backend. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardBackendInfo* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_backend:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.backend. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_backend(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_start_many:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.startMany. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_start_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_start_many:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.startMany. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_start_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_stop_many:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.stopMany. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_stop_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_stop_many:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.stopMany. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_stop_many(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_switch_tunnel:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ *
+ * Responds to WireguardHostApi.switchTunnel. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_switch_tunnel(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_switch_tunnel:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.switchTunnel. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_switch_tunnel(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_diagnostics:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.diagnostics. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_diagnostics(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_diagnostics:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.diagnostics. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_diagnostics(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_dump_trace:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ *
+ * Responds to WireguardHostApi.dumpTrace. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_dump_trace(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_dump_trace:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.dumpTrace. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_dump_trace(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_lookup_peer:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.lookupPeer. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_lookup_peer(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_lookup_peer:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.lookupPeer. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_lookup_peer(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_lookup_peers:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.lookupPeers. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_lookup_peers(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_lookup_peers:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.lookupPeers. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_lookup_peers(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_compute_allowed_ips:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.computeAllowedIps. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_compute_allowed_ips(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_compute_allowed_ips:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.computeAllowedIps. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_compute_allowed_ips(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_reresolve_endpoints:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.reresolveEndpoints. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_reresolve_endpoints(FlutterWireguardWireguardHostApiResponseHandle* response_handle, int64_t return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_reresolve_endpoints:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.reresolveEndpoints. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_reresolve_endpoints(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_set_stale_after:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ *
+ * Responds to WireguardHostApi.setStaleAfter. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_set_stale_after(FlutterWireguardWireguardHostApiResponseHandle* response_handle);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_set_stale_after:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.setStaleAfter. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_set_stale_after(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_generate_key_pairs:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.generateKeyPairs. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_generate_key_pairs(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_generate_key_pairs:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.generateKeyPairs. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_generate_key_pairs(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_public_keys_from_private:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.publicKeysFromPrivate. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_public_keys_from_private(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlValue* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_public_keys_from_private:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.publicKeysFromPrivate. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_public_keys_from_private(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_peer_by_public_key:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.peerByPublicKey. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_peer_by_public_key(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardPeerStatus* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_peer_by_public_key:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.peerByPublicKey. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_peer_by_public_key(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_usage:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.usage. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_usage(FlutterWireguardWireguardHostApiResponseHandle* response_handle, FlutterWireguardTunnelUsage* return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_usage:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.usage. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_usage(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_set_usage_quota:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @return_value: location to write the value returned by this method.
+ *
+ * Responds to WireguardHostApi.setUsageQuota. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_set_usage_quota(FlutterWireguardWireguardHostApiResponseHandle* response_handle, int64_t return_value);
+
+/**
+ * flutter_wireguard_wireguard_host_api_respond_error_set_usage_quota:
+ * @response_handle: a #FlutterWireguardWireguardHostApiResponseHandle.
+ * @code: error code.
+ * @message: error message.
+ * @details: (allow-none): error details or %NULL.
+ *
+ * Responds with an error to WireguardHostApi.setUsageQuota. 
+ */
+void flutter_wireguard_wireguard_host_api_respond_error_set_usage_quota(FlutterWireguardWireguardHostApiResponseHandle* response_handle, const gchar* code, const gchar* message, FlValue* details);
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse, flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API_ON_TUNNEL_STATUS_RESPONSE, GObject)
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_is_error:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ *
+ * Checks if a response to WireguardFlutterApi.onTunnelStatus is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_is_error(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_code:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_code(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_message:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_message(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_details:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_response_get_error_details(FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* response);
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse, flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API_ON_TUNNEL_HEALTH_RESPONSE, GObject)
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse.
+ *
+ * Checks if a response to WireguardFlutterApi.onTunnelHealth is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_is_error(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_code:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_code(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_message:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_message(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_details:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_response_get_error_details(FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* response);
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse, flutter_wireguard_wireguard_flutter_api_on_usage_quota_response, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API_ON_USAGE_QUOTA_RESPONSE, GObject)
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse.
+ *
+ * Checks if a response to WireguardFlutterApi.onUsageQuota is an error.
+ *
+ * Returns: a %TRUE if this response is an error.
+ */
+gboolean flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_is_error(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_code:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse.
+ *
+ * Get the error code for this response.
+ *
+ * Returns: an error code or %NULL if not an error.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_code(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_message:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse.
+ *
+ * Get the error message for this response.
+ *
+ * Returns: an error message.
+ */
+const gchar* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_message(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* response);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_details:
+ * @response: a #FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse.
+ *
+ * Get the error details for this response.
+ *
+ * Returns: (allow-none): an error details or %NULL.
+ */
+FlValue* flutter_wireguard_wireguard_flutter_api_on_usage_quota_response_get_error_details(FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* response);
+
+/**
+ * FlutterWireguardWireguardFlutterApi:
+ *
+ * Platform -> host events.
+ */
+
+G_DECLARE_FINAL_TYPE(FlutterWireguardWireguardFlutterApi, flutter_wireguard_wireguard_flutter_api, FLUTTER_WIREGUARD, WIREGUARD_FLUTTER_API, GObject)
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_new:
+ * @messenger: an #FlBinaryMessenger.
+ * @suffix: (allow-none): a suffix to add to the API or %NULL for none.
+ *
+ * Creates a new object to access the WireguardFlutterApi API.
+ *
+ * Returns: a new #FlutterWireguardWireguardFlutterApi
+ */
+FlutterWireguardWireguardFlutterApi* flutter_wireguard_wireguard_flutter_api_new(FlBinaryMessenger* messenger, const gchar* suffix);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @status: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ * Pushed whenever a tunnel changes state or its statistics tick.
+ */
+void flutter_wireguard_wireguard_flutter_api_on_tunnel_status(FlutterWireguardWireguardFlutterApi* api, FlutterWireguardTunnelStatus* status, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_status_finish:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a flutter_wireguard_wireguard_flutter_api_on_tunnel_status() call.
+ *
+ * Returns: a #FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse or %NULL on error.
+ */
+FlutterWireguardWireguardFlutterApiOnTunnelStatusResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_status_finish(FlutterWireguardWireguardFlutterApi* api, GAsyncResult* result, GError** error);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @health: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ * Pushed the moment a peer of a running tunnel connects, goes stale or
+ * recovers.
+ */
+void flutter_wireguard_wireguard_flutter_api_on_tunnel_health(FlutterWireguardWireguardFlutterApi* api, FlutterWireguardTunnelHealth* health, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_tunnel_health_finish:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a flutter_wireguard_wireguard_flutter_api_on_tunnel_health() call.
+ *
+ * Returns: a #FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse or %NULL on error.
+ */
+FlutterWireguardWireguardFlutterApiOnTunnelHealthResponse* flutter_wireguard_wireguard_flutter_api_on_tunnel_health_finish(FlutterWireguardWireguardFlutterApi* api, GAsyncResult* result, GError** error);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @event: parameter for this method.
+ * @cancellable: (allow-none): a #GCancellable or %NULL.
+ * @callback: (scope async): (allow-none): a #GAsyncReadyCallback to call when the call is complete or %NULL to ignore the response.
+ * @user_data: (closure): user data to pass to @callback.
+ *
+ * Pushed once when a tunnel reaches the quota set with
+ * [WireguardHostApi.setUsageQuota], after it was stopped.
+ */
+void flutter_wireguard_wireguard_flutter_api_on_usage_quota(FlutterWireguardWireguardFlutterApi* api, FlutterWireguardUsageQuotaExceeded* event, GCancellable* cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * flutter_wireguard_wireguard_flutter_api_on_usage_quota_finish:
+ * @api: a #FlutterWireguardWireguardFlutterApi.
+ * @result: a #GAsyncResult.
+ * @error: (allow-none): #GError location to store the error occurring, or %NULL to ignore.
+ *
+ * Completes a flutter_wireguard_wireguard_flutter_api_on_usage_quota() call.
+ *
+ * Returns: a #FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse or %NULL on error.
+ */
+FlutterWireguardWireguardFlutterApiOnUsageQuotaResponse* flutter_wireguard_wireguard_flutter_api_on_usage_quota_finish(FlutterWireguardWireguardFlutterApi* api, GAsyncResult* result, GError** error);
 
 G_END_DECLS
 
@@ -0,0 +1,358 @@
+#include "metrics_exporter.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+#include "trace_buffer.h"
+
+namespace flutter_wireguard {
+
+namespace {
+
+std::runtime_error SysError(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+// A scrape request is a request line and a few headers; anything longer is
+// not Prometheus.
+constexpr size_t kMaxRequest = 8192;
+
+// Per-connection send/receive timeout.
+constexpr int kIoTimeoutMs = 2000;
+
+void AppendInt(std::string* out, int64_t v) {
+  char buf[24];
+  auto r = std::to_chars(buf, buf + sizeof(buf), v);
+  out->append(buf, r.ptr);
+}
+
+// Epoch milliseconds as seconds with millisecond precision, without going
+// through a locale-dependent double format.
+void AppendSeconds(std::string* out, int64_t ms) {
+  AppendInt(out, ms / 1000);
+  const int64_t frac = ms % 1000;
+  if (frac == 0) return;
+  char buf[4] = {'.', static_cast<char>('0' + frac / 100),
+                 static_cast<char>('0' + frac / 10 % 10),
+                 static_cast<char>('0' + frac % 10)};
+  out->append(buf, sizeof(buf));
+}
+
+// Label values per the exposition format: backslash, quote and newline
+// escaped. Interface names and base64 keys never need it, but the format
+// does not get to break if one ever does.
+void AppendLabel(std::string* out, const char* key, const std::string& value) {
+  out->append(key);
+  out->append("=\"");
+  for (char c : value) {
+    if (c == '\\') out->append("\\\\");
+    else if (c == '"') out->append("\\\"");
+    else if (c == '\n') out->append("\\n");
+    else out->push_back(c);
+  }
+  out->push_back('"');
+}
+
+void AppendFamily(std::string* out, const char* name, const char* type,
+                  const char* help) {
+  out->append("# HELP ").append(name).append(" ").append(help).append("\n");
+  out->append("# TYPE ").append(name).append(" ").append(type).append("\n");
+}
+
+int StateValue(TunnelStateCpp s) {
+  switch (s) {
+    case TunnelStateCpp::kDown:   return 0;
+    case TunnelStateCpp::kToggle: return 1;
+    case TunnelStateCpp::kUp:     return 2;
+  }
+  return 0;
+}
+
+bool IsLoopback(const std::string& host) {
+  in_addr v4{};
+  if (inet_pton(AF_INET, host.c_str(), &v4) == 1) {
+    return (ntohl(v4.s_addr) >> 24) == 127;
+  }
+  in6_addr v6{};
+  return inet_pton(AF_INET6, host.c_str(), &v6) == 1 &&
+         IN6_IS_ADDR_LOOPBACK(&v6);
+}
+
+// Writes every byte of `iov` (MSG_NOSIGNAL: a scraper that hung up must not
+// SIGPIPE the app).
+bool SendAll(int fd, iovec* iov, int iovcnt) {
+  while (iovcnt > 0) {
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = static_cast<size_t>(iovcnt);
+    ssize_t n = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    size_t left = static_cast<size_t>(n);
+    while (iovcnt > 0 && left >= iov->iov_len) {
+      left -= iov->iov_len;
+      ++iov;
+      --iovcnt;
+    }
+    if (iovcnt > 0) {
+      iov->iov_base = static_cast<char*>(iov->iov_base) + left;
+      iov->iov_len -= left;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+MetricsExporter::MetricsExporter(const std::string& address) {
+  if (address.rfind("unix:", 0) == 0) {
+    unix_path_ = address.substr(5);
+    if (unix_path_.empty() || unix_path_.size() >= sizeof(sockaddr_un{}.sun_path)) {
+      throw std::invalid_argument("bad metrics socket path '" + unix_path_ + "'");
+    }
+    return;
+  }
+  std::string host = "127.0.0.1";
+  std::string port = address;
+  const size_t colon = address.rfind(':');
+  if (colon != std::string::npos) {
+    host = address.substr(0, colon);
+    port = address.substr(colon + 1);
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+      host = host.substr(1, host.size() - 2);
+    }
+    if (host == "localhost") host = "127.0.0.1";
+  }
+  const char* end = port.data() + port.size();
+  auto r = std::from_chars(port.data(), end, port_);
+  if (port.empty() || r.ec != std::errc() || r.ptr != end || port_ < 0 ||
+      port_ > 65535) {
+    throw std::invalid_argument("bad metrics port in '" + address + "'");
+  }
+  if (!IsLoopback(host)) {
+    throw std::invalid_argument("metrics address '" + address +
+                                "' is not loopback");
+  }
+  host_ = host;
+}
+
+MetricsExporter::~MetricsExporter() { Stop(); }
+
+void MetricsExporter::Start() {
+  int fd;
+  if (!unix_path_.empty()) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, unix_path_.c_str(), unix_path_.size() + 1);
+    fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw SysError("socket");
+    unlink(unix_path_.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+      std::runtime_error err = SysError("bind " + unix_path_);
+      close(fd);
+      throw err;
+    }
+    chmod(unix_path_.c_str(), 0600);
+    bound_ = "unix:" + unix_path_;
+  } else {
+    const bool v6 = host_.find(':') != std::string::npos;
+    sockaddr_storage ss{};
+    socklen_t len;
+    if (v6) {
+      auto* a = reinterpret_cast<sockaddr_in6*>(&ss);
+      a->sin6_family = AF_INET6;
+      a->sin6_port = htons(static_cast<uint16_t>(port_));
+      inet_pton(AF_INET6, host_.c_str(), &a->sin6_addr);
+      len = sizeof(*a);
+    } else {
+      auto* a = reinterpret_cast<sockaddr_in*>(&ss);
+      a->sin_family = AF_INET;
+      a->sin_port = htons(static_cast<uint16_t>(port_));
+      inet_pton(AF_INET, host_.c_str(), &a->sin_addr);
+      len = sizeof(*a);
+    }
+    fd = socket(ss.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw SysError("socket");
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, reinterpret_cast<sockaddr*>(&ss), len) != 0) {
+      std::runtime_error err =
+          SysError("bind " + host_ + ":" + std::to_string(port_));
+      close(fd);
+      throw err;
+    }
+    getsockname(fd, reinterpret_cast<sockaddr*>(&ss), &len);
+    const uint16_t port = ntohs(v6 ? reinterpret_cast<sockaddr_in6*>(&ss)->sin6_port
+                                   : reinterpret_cast<sockaddr_in*>(&ss)->sin_port);
+    bound_ = (v6 ? "[" + host_ + "]" : host_) + ":" + std::to_string(port);
+  }
+  if (listen(fd, 16) != 0) {
+    std::runtime_error err = SysError("listen " + bound_);
+    close(fd);
+    if (!unix_path_.empty()) unlink(unix_path_.c_str());
+    throw err;
+  }
+  listen_fd_ = fd;
+  stopping_.store(false);
+  server_ = std::thread([this] { ServeLoop(); });
+}
+
+void MetricsExporter::Stop() {
+  if (listen_fd_ < 0) return;
+  stopping_.store(true);
+  // shutdown() wakes the blocked accept(); close() alone does not.
+  shutdown(listen_fd_, SHUT_RDWR);
+  if (server_.joinable()) server_.join();
+  close(listen_fd_);
+  listen_fd_ = -1;
+  if (!unix_path_.empty()) unlink(unix_path_.c_str());
+}
+
+void MetricsExporter::Update(
+    const std::vector<TunnelStatusCpp>& tunnels,
+    const std::vector<std::vector<PeerStatsCpp>>& peers) {
+  // Copy-assignment reuses the cached vectors' (and strings') storage.
+  std::lock_guard<std::mutex> lock(mu_);
+  tunnels_ = tunnels;
+  peers_ = peers;
+}
+
+void MetricsExporter::Render(
+    const std::vector<TunnelStatusCpp>& tunnels,
+    const std::vector<std::vector<PeerStatsCpp>>& peers, std::string* out) {
+  struct Family {
+    const char* name;
+    const char* type;
+    const char* help;
+  };
+  static constexpr Family kTunnel[] = {
+      {"wireguard_tunnel_state", "gauge",
+       "Tunnel state: 0 down, 1 changing, 2 up."},
+      {"wireguard_tunnel_rx_bytes", "counter",
+       "Bytes received on the tunnel, all peers."},
+      {"wireguard_tunnel_tx_bytes", "counter",
+       "Bytes sent on the tunnel, all peers."},
+      {"wireguard_tunnel_last_handshake_seconds", "gauge",
+       "Unix time of the tunnel's latest peer handshake, 0 if none."},
+  };
+  for (size_t f = 0; f < std::size(kTunnel); ++f) {
+    AppendFamily(out, kTunnel[f].name, kTunnel[f].type, kTunnel[f].help);
+    for (const auto& t : tunnels) {
+      out->append(kTunnel[f].name).push_back('{');
+      AppendLabel(out, "tunnel", t.name);
+      out->append("} ");
+      switch (f) {
+        case 0: AppendInt(out, StateValue(t.state)); break;
+        case 1: AppendInt(out, t.rx); break;
+        case 2: AppendInt(out, t.tx); break;
+        case 3: AppendSeconds(out, t.handshake); break;
+      }
+      out->push_back('\n');
+    }
+  }
+
+  bool any_peers = false;
+  for (const auto& p : peers) any_peers = any_peers || !p.empty();
+  if (!any_peers) return;
+  static constexpr Family kPeer[] = {
+      {"wireguard_peer_rx_bytes", "counter", "Bytes received from the peer."},
+      {"wireguard_peer_tx_bytes", "counter", "Bytes sent to the peer."},
+      {"wireguard_peer_last_handshake_seconds", "gauge",
+       "Unix time of the peer's latest handshake, 0 if none."},
+  };
+  const size_t n = std::min(tunnels.size(), peers.size());
+  for (size_t f = 0; f < std::size(kPeer); ++f) {
+    AppendFamily(out, kPeer[f].name, kPeer[f].type, kPeer[f].help);
+    for (size_t i = 0; i < n; ++i) {
+      for (const auto& p : peers[i]) {
+        out->append(kPeer[f].name).push_back('{');
+        AppendLabel(out, "tunnel", tunnels[i].name);
+        out->push_back(',');
+        AppendLabel(out, "public_key", p.public_key);
+        out->append("} ");
+        switch (f) {
+          case 0: AppendInt(out, p.rx); break;
+          case 1: AppendInt(out, p.tx); break;
+          case 2: AppendSeconds(out, p.handshake); break;
+        }
+        out->push_back('\n');
+      }
+    }
+  }
+}
+
+void MetricsExporter::ServeLoop() {
+  while (!stopping_.load()) {
+    int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      if (errno == EMFILE || errno == ENFILE) {
+        usleep(10 * 1000);
+        continue;
+      }
+      break;
+    }
+    ServeConnection(fd);
+    close(fd);
+  }
+}
+
+void MetricsExporter::ServeConnection(int fd) {
+  timeval tv{kIoTimeoutMs / 1000, (kIoTimeoutMs % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+
+  // Read up to the end of the headers; the body of a GET is ignored.
+  request_.clear();
+  char buf[1024];
+  while (request_.find("\r\n\r\n") == std::string::npos) {
+    if (request_.size() >= kMaxRequest) return;
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return;
+    request_.append(buf, static_cast<size_t>(n));
+  }
+
+  const char* status = "200 OK";
+  body_.clear();
+  if (request_.rfind("GET ", 0) != 0) {
+    status = "405 Method Not Allowed";
+  } else if (request_.compare(4, 9, "/metrics ") != 0 &&
+             request_.compare(4, 9, "/metrics?") != 0) {
+    status = "404 Not Found";
+  } else {
+    FWG_TRACE_SCOPE("metrics.render");
+    std::lock_guard<std::mutex> lock(mu_);
+    Render(tunnels_, peers_, &body_);
+  }
+
+  head_.assign("HTTP/1.1 ").append(status).append("\r\n");
+  if (status[0] == '2') {
+    head_.append("Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n");
+  }
+  head_.append("Content-Length: ");
+  AppendInt(&head_, static_cast<int64_t>(body_.size()));
+  head_.append("\r\nConnection: close\r\n\r\n");
+
+  iovec iov[2] = {{head_.data(), head_.size()}, {body_.data(), body_.size()}};
+  if (SendAll(fd, iov, body_.empty() ? 1 : 2) && status[0] == '2') {
+    scrapes_.fetch_add(1);
+  }
+}
+
+}  // namespace flutter_wireguard
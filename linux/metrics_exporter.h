@@ -0,0 +1,93 @@
+// Optional Prometheus exporter for tunnel and peer counters.
+//
+// The status poller hands every tick to Update(); a scrape renders the
+// Prometheus text exposition format (0.0.4, which OpenMetrics parsers
+// accept) from that cached snapshot into a buffer reused across scrapes.
+// Scrapes never reach the backend, so a monitoring system polling every
+// second costs no extra `wg show` / UAPI round trips and no elevation.
+//
+// The listener is loopback-only: a TCP port on 127.0.0.1 / ::1 or a Unix
+// socket. Scrapes are served one at a time on a single thread with short
+// socket timeouts, so a stalled client delays the next scrape but never
+// the poller.
+#ifndef FLUTTER_WIREGUARD_METRICS_EXPORTER_H_
+#define FLUTTER_WIREGUARD_METRICS_EXPORTER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "wg_backend.h"
+
+namespace flutter_wireguard {
+
+class MetricsExporter {
+ public:
+  // `address` is one of:
+  //   "unix:<path>"           Unix socket, chmod 0600
+  //   "<port>"                127.0.0.1:<port>
+  //   "<host>:<port>"         host must be 127.0.0.0/8, localhost or [::1]
+  // Port 0 picks a free port; see address(). Throws std::invalid_argument
+  // for anything else (in particular a non-loopback host).
+  explicit MetricsExporter(const std::string& address);
+  ~MetricsExporter();
+
+  MetricsExporter(const MetricsExporter&) = delete;
+  MetricsExporter& operator=(const MetricsExporter&) = delete;
+
+  // Binds and starts the serving thread. Throws std::runtime_error.
+  void Start();
+
+  // Stops serving and removes a Unix socket file. Idempotent.
+  void Stop();
+
+  // Replaces the snapshot scrapes are rendered from. `peers` is
+  // index-aligned with `tunnels` (PollTunnelStatuses' out-param) and may be
+  // empty, in which case no peer series are exported.
+  void Update(const std::vector<TunnelStatusCpp>& tunnels,
+              const std::vector<std::vector<PeerStatsCpp>>& peers);
+
+  // The bound address, with a port of 0 resolved: "127.0.0.1:9586",
+  // "[::1]:9586" or "unix:/run/...". Valid after Start().
+  std::string address() const { return bound_; }
+
+  // Number of /metrics requests answered so far.
+  uint64_t scrapes() const { return scrapes_.load(); }
+
+  // Appends the exposition text for one snapshot to `out`. Exposed for
+  // tests; the server calls it with the cached snapshot.
+  static void Render(const std::vector<TunnelStatusCpp>& tunnels,
+                     const std::vector<std::vector<PeerStatsCpp>>& peers,
+                     std::string* out);
+
+ private:
+  void ServeLoop();
+  void ServeConnection(int fd);
+
+  // Parsed from the constructor's `address`.
+  std::string unix_path_;  // set for "unix:<path>", else TCP
+  std::string host_;       // numeric loopback address
+  int port_ = 0;
+
+  std::string bound_;
+  int listen_fd_ = -1;
+  std::atomic<bool> stopping_{false};
+  std::atomic<uint64_t> scrapes_{0};
+  std::thread server_;
+
+  std::mutex mu_;  // guards the snapshot
+  std::vector<TunnelStatusCpp> tunnels_;
+  std::vector<std::vector<PeerStatsCpp>> peers_;
+
+  // Serving-thread only; keep their capacity between scrapes.
+  std::string request_;
+  std::string body_;
+  std::string head_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_METRICS_EXPORTER_H_
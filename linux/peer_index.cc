@@ -0,0 +1,104 @@
+#include "peer_index.h"
+
+#include <utility>
+
+namespace flutter_wireguard {
+
+PeerIndex::PeerIndex(const std::vector<PeerStatsCpp>& peers)
+    : index_(peers.size()) {
+  peers_.reserve(peers.size());
+  keys_.reserve(peers.size());
+  WgKey key;
+  for (const auto& p : peers) {
+    if (!WgKeyFromBase64(p.public_key, &key)) continue;
+    if (!index_.Insert(key, static_cast<uint32_t>(peers_.size())).second) {
+      continue;  // listed twice; the first wins
+    }
+    peers_.push_back(p);
+    keys_.push_back(key);
+  }
+}
+
+const PeerStatsCpp* PeerIndex::Find(const WgKey& key) const {
+  const uint32_t* i = index_.Find(key);
+  return i == nullptr ? nullptr : &peers_[*i];
+}
+
+int64_t PeerIndex::IndexOf(const WgKey& key) const {
+  const uint32_t* i = index_.Find(key);
+  return i == nullptr ? -1 : static_cast<int64_t>(*i);
+}
+
+PeerSetDiff DiffPeers(const PeerIndex& before, const PeerIndex& after) {
+  PeerSetDiff diff;
+  size_t kept = 0;
+  for (size_t i = 0; i < after.keys().size(); ++i) {
+    const PeerStatsCpp* old = before.Find(after.keys()[i]);
+    if (old == nullptr) {
+      diff.added.push_back(i);
+      continue;
+    }
+    ++kept;
+    if (old->handshake != after.peers()[i].handshake) diff.handshaken.push_back(i);
+  }
+  if (kept < before.keys().size()) {
+    for (size_t i = 0; i < before.keys().size(); ++i) {
+      if (after.Find(before.keys()[i]) == nullptr) diff.removed.push_back(i);
+    }
+  }
+  return diff;
+}
+
+PeerSetDiff PeerSnapshots::Update(const std::string& name,
+                                  const std::vector<PeerStatsCpp>& peers) {
+  std::shared_ptr<PeerIndex> old;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it != tunnels_.end()) old = it->second;
+  }
+
+  // Same keys in the same order: the old index still maps every key to its
+  // position, so only the counters need copying.
+  bool same = old != nullptr && old->keys_.size() == peers.size();
+  WgKey key;
+  for (size_t i = 0; same && i < peers.size(); ++i) {
+    same = WgKeyFromBase64(peers[i].public_key, &key) && key == old->keys_[i];
+  }
+  if (same) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    // Nobody else holds it (the map and `old` are the two references), so
+    // it can change in place; otherwise a reader has it and we copy.
+    if (it != tunnels_.end() && it->second == old && old.use_count() == 2) {
+      PeerSetDiff diff;
+      for (size_t i = 0; i < peers.size(); ++i) {
+        if (old->peers_[i].handshake != peers[i].handshake) {
+          diff.handshaken.push_back(i);
+        }
+        old->peers_[i] = peers[i];
+      }
+      return diff;
+    }
+  }
+
+  auto next = std::make_shared<PeerIndex>(peers);
+  PeerSetDiff diff = DiffPeers(old != nullptr ? *old : PeerIndex(), *next);
+  std::lock_guard<std::mutex> lock(mu_);
+  tunnels_[name] = std::move(next);
+  return diff;
+}
+
+std::shared_ptr<const PeerIndex> PeerSnapshots::Get(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto it = tunnels_.find(name);
+  if (it == tunnels_.end()) return nullptr;
+  return it->second;
+}
+
+void PeerSnapshots::Forget(const std::string& name) {
+  std::lock_guard<std::mutex> lock(mu_);
+  tunnels_.erase(name);
+}
+
+}  // namespace flutter_wireguard
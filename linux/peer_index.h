@@ -0,0 +1,95 @@
+// The peers of each running tunnel as of the last status poll, keyed by
+// raw public key.
+//
+// The poller hands every tick's per-peer counters to PeerSnapshots::Update,
+// which matches them against the previous tick through a WgKeyMap (one
+// base64 decode and one hash probe per peer, no string compares) and
+// reports what changed: peers that appeared or went, and peers with a new
+// handshake. A tick with the same peers in the same order, the common case,
+// updates the snapshot in place without rebuilding its index. Lookups by
+// public key (peerByPublicKey) are a single probe.
+#ifndef FLUTTER_WIREGUARD_PEER_INDEX_H_
+#define FLUTTER_WIREGUARD_PEER_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "wg_key.h"
+#include "wg_key_map.h"
+
+namespace flutter_wireguard {
+
+struct PeerStatsCpp {
+  std::string public_key;  // base64
+  std::string endpoint;    // empty if none
+  int64_t rx = 0;
+  int64_t tx = 0;
+  int64_t handshake = 0;   // epoch ms, 0 = never
+  uint32_t keepalive = 0;  // seconds, 0 = off
+};
+
+// One tunnel's peers. A peer whose key is not valid base64 is dropped: it
+// can't be looked up, and no backend reports one.
+class PeerIndex {
+ public:
+  PeerIndex() = default;
+  explicit PeerIndex(const std::vector<PeerStatsCpp>& peers);
+
+  const std::vector<PeerStatsCpp>& peers() const { return peers_; }
+  const std::vector<WgKey>& keys() const { return keys_; }
+
+  // The peer with `key`, or null.
+  const PeerStatsCpp* Find(const WgKey& key) const;
+
+  // Position of `key` in peers(), or -1.
+  int64_t IndexOf(const WgKey& key) const;
+
+ private:
+  friend class PeerSnapshots;
+
+  std::vector<PeerStatsCpp> peers_;
+  std::vector<WgKey> keys_;  // keys_[i] is peers_[i]'s
+  WgKeyMap<uint32_t> index_;
+};
+
+// How one tick's peers differ from the previous tick's. Positions index the
+// respective snapshot's peers().
+struct PeerSetDiff {
+  std::vector<size_t> added;       // in the new snapshot
+  std::vector<size_t> removed;     // in the old snapshot
+  std::vector<size_t> handshaken;  // in the new: present before, handshake moved
+
+  bool Unchanged() const {
+    return added.empty() && removed.empty() && handshaken.empty();
+  }
+};
+
+PeerSetDiff DiffPeers(const PeerIndex& before, const PeerIndex& after);
+
+// The latest PeerIndex of each tunnel. Thread-safe; snapshots are
+// copy-on-write, so a lookup holds the lock only to take a reference.
+class PeerSnapshots {
+ public:
+  // Replaces `name`'s snapshot with `peers` and returns how it differs from
+  // the one it replaces (everything is added for a tunnel seen first).
+  PeerSetDiff Update(const std::string& name,
+                     const std::vector<PeerStatsCpp>& peers);
+
+  // Null if `name` has not been polled since it came up.
+  std::shared_ptr<const PeerIndex> Get(const std::string& name) const;
+
+  void Forget(const std::string& name);
+
+ private:
+  mutable std::mutex mu_;
+  std::map<std::string, std::shared_ptr<PeerIndex>> tunnels_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_PEER_INDEX_H_
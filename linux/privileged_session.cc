@@ -1,15 +1,25 @@
 #include "privileged_session.h"
 
 #include <fcntl.h>
+#include <net/if.h>
 #include <signal.h>
 #include <spawn.h>
+#include <sys/stat.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
 #include <cstdlib>
 #include <cstring>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "phase_timer.h"
+#include "resolved_dns.h"
+#include "trace_buffer.h"
 
 extern char** environ;
 
@@ -18,6 +28,7 @@ namespace flutter_wireguard {
 namespace {
 
 constexpr const char* kEndMarker = "__FWG_END__";
+constexpr const char* kItemMarker = "__FWG_ITEM__";
 
 // Splits a string on whitespace (space/tab). Empty input -> empty vector.
 // Used to parse FLUTTER_WIREGUARD_ELEVATE into an argv prefix. We deliberately
@@ -37,23 +48,185 @@ std::vector<std::string> SplitWS(const std::string& s) {
   return out;
 }
 
-// Inline shell loop. Reads three lines (OP, ARG1, ARG2) per request, runs the
-// matching command with stdout+stderr merged, then emits __FWG_END__ <ec>.
+// Config hand-off helpers shared by the elevated loop and the root path.
+//   fwg_stage <iface> <nlines>: reads <nlines> config lines from stdin
+//     (always all of them, so a failure can't desync the loop) and writes
+//     them to a root-only staging file. The directory is 0711 so the
+//     unprivileged plugin can stat() a staged file to adopt its tunnel after
+//     a restart, without being able to list or read anything.
+//   fwg_wgup <iface> <impl|"">: wg-quick up on the staged file. The file is
+//     kept on success so fwg_down can replay PostDown hooks.
+//   fwg_up <iface> <impl|""> <nlines>: fwg_stage + fwg_wgup.
+//   fwg_down <iface>: wg-quick down on the staged file, or a plain link
+//     delete when there is none (tunnel started elsewhere / file mode).
+//   fwg_rules <table> <priority>: the wg-quick default-route rule pair for
+//     <table>. IPv6 is best-effort (the host may have it disabled).
+//   fwg_routes <nlines>: reads <nlines> `ip -batch` commands from stdin and
+//     runs them in one `ip`. ip stops at the first failure and names its
+//     line; the commands before it are undone, so a failed install leaves
+//     nothing behind.
+//   fwg_nft <nlines>: reads <nlines> lines of `nft -f` input from stdin and
+//     hands them to one `nft`, which applies all of them or none. Then reads
+//     a count and that many KillSwitchRecords lines and, if nft succeeded,
+//     leaves them in the world-readable `killswitch` next to the staged
+//     configs (or removes it for none).
+//   fwg_many <k> <fn> <arg> <iface...>: runs `fn iface arg` for every iface,
+//     k at a time, then prints each one's output followed by
+//     `__FWG_ITEM__ <ec>` in input order. POSIX sh has no `wait -n`, so a
+//     FIFO holding k tokens is the semaphore: each job takes one to start
+//     and puts it back when done, and the next starts as soon as any slot
+//     frees. A `!`-prefixed iface is one fwg_stage rejected.
+constexpr const char* kStageFns = R"SHELL(
+fwg_stage() {
+  cfg=''; i=0
+  while [ "$i" -lt "$2" ] && IFS= read -r l; do
+    cfg="$cfg$l
+"; i=$((i + 1))
+  done
+  d=/run/flutter_wireguard; f="$d/$1.conf"
+  (umask 077; mkdir -p "$d" && chmod 711 "$d" &&
+   printf '%s' "$cfg" > "$f"); rc=$?
+  cfg=''; return "$rc"
+}
+fwg_wgup() {
+  f="/run/flutter_wireguard/$1.conf"
+  if [ -n "$2" ]; then
+    WG_QUICK_USERSPACE_IMPLEMENTATION="$2" wg-quick up "$f" 2>&1
+  else
+    wg-quick up "$f" 2>&1
+  fi
+  rc=$?; [ "$rc" -eq 0 ] || rm -f "$f"; return "$rc"
+}
+fwg_up() { fwg_stage "$1" "$3" || return 1; fwg_wgup "$1" "$2"; }
+fwg_down() {
+  f="/run/flutter_wireguard/$1.conf"
+  if [ -f "$f" ]; then
+    wg-quick down "$f" 2>&1; rc=$?; rm -f "$f"; return "$rc"
+  fi
+  ip link delete dev "$1" 2>&1
+}
+fwg_rules() {
+  ip -4 rule add table main suppress_prefixlength 0 priority "$2" 2>&1 &&
+  ip -4 rule add not fwmark "$1" table "$1" priority $(($2 + 1)) 2>&1 ||
+  return 1
+  ip -6 rule add table main suppress_prefixlength 0 priority "$2" 2>/dev/null &&
+  ip -6 rule add not fwmark "$1" table "$1" priority $(($2 + 1)) 2>/dev/null
+  return 0
+}
+fwg_routes() {
+  cmds=''; i=0
+  while [ "$i" -lt "$1" ] && IFS= read -r l; do
+    cmds="$cmds$l
+"; i=$((i + 1))
+  done
+  out=$(printf '%s' "$cmds" | ip -batch - 2>&1) && return 0
+  rc=$?; printf '%s\n' "$out"
+  n=$(printf '%s\n' "$out" | sed -n 's/^Command failed -:\([0-9]*\)$/\1/p' | head -n 1)
+  printf '%s' "$cmds" | head -n "$((${n:-1} - 1))" |
+    sed -e 's/^address add /address del /' -e 's/^route append /route del /' |
+    ip -force -batch - >/dev/null 2>&1
+  return "$rc"
+}
+fwg_nft() {
+  cmds=''; i=0
+  while [ "$i" -lt "$1" ] && IFS= read -r l; do
+    cmds="$cmds$l
+"; i=$((i + 1))
+  done
+  IFS= read -r m; recs=''; i=0
+  while [ "$i" -lt "$m" ] && IFS= read -r l; do
+    recs="$recs$l
+"; i=$((i + 1))
+  done
+  printf '%s' "$cmds" | nft -f - 2>&1 || return 1
+  d=/run/flutter_wireguard; f="$d/killswitch"
+  if [ "$m" -eq 0 ]; then rm -f "$f"; return 0; fi
+  (umask 022; mkdir -p "$d" && chmod 711 "$d" &&
+   printf '%s' "$recs" > "$f.tmp" && mv -f "$f.tmp" "$f") || true
+}
+fwg_many() {
+  k=$1; fn=$2; arg=$3; shift 3
+  [ "$k" -gt 0 ] 2>/dev/null || k=1
+  t=$(mktemp -d) || return 1
+  mkfifo "$t/slots" || { rm -rf "$t"; return 1; }
+  {
+    i=0; while [ "$i" -lt "$k" ]; do echo; i=$((i + 1)); done >&3
+    for n in "$@"; do
+      case "$n" in '!'*) continue ;; esac
+      IFS= read -r tok <&3
+      ( "$fn" "$n" "$arg" > "$t/$n.log" 2>&1 3>&-
+        echo "$?" > "$t/$n.rc"; echo >&3 ) &
+    done
+    wait
+  } 3<>"$t/slots"
+  for n in "$@"; do
+    case "$n" in
+      '!'*) echo "could not stage config"; rc=1 ;;
+      *)    cat "$t/$n.log" 2>/dev/null; rc=$(cat "$t/$n.rc" 2>/dev/null) ;;
+    esac
+    printf '%s %d\n' __FWG_ITEM__ "${rc:-1}"
+  done
+  rm -rf "$t"
+}
+)SHELL";
+
+// Inline shell loop. Announces itself with a bare __FWG_END__ 0 once the
+// elevation helper has let it run, so the parent can tell the prompt apart
+// from the first op. Then reads three lines (OP, ARG1, ARG2) per request,
+// runs the matching command with stdout+stderr merged, then emits
+// __FWG_END__ <ec>.
 // All variables are double-quoted — args containing spaces are safe — and the
 // OP is matched against a fixed allowlist so unexpected input cannot escape.
+// UPCFG then reads its line count and config lines (see fwg_up); UPMANY
+// stages every tunnel before starting any of them.
 constexpr const char* kShellLoop = R"SHELL(
+printf "%s %d\n" "__FWG_END__" 0
 while IFS= read -r op && IFS= read -r a1 && IFS= read -r a2; do
   case "$op" in
     SHOW)    wg show "$a1" dump 2>&1 ;;
     UP)      wg-quick up "$a1" 2>&1 ;;
     UPENV)   WG_QUICK_USERSPACE_IMPLEMENTATION="$a1" wg-quick up "$a2" 2>&1 ;;
     DOWN)    wg-quick down "$a1" 2>&1 ;;
+    UPCFG)   IFS= read -r n; fwg_up "$a1" "$a2" "$n" ;;
+    DOWNIF)  fwg_down "$a1" ;;
+    RULES)   fwg_rules "$a1" "$a2" ;;
+    ROUTES)  IFS= read -r n; fwg_routes "$n" ;;
+    NFT)     IFS= read -r n; fwg_nft "$n" ;;
+    ENDPOINTS) IFS= read -r c; set --; j=0
+             while [ "$j" -lt "$c" ] && IFS=' ' read -r k e; do
+               set -- "$@" peer "$k" endpoint "$e"; j=$((j + 1))
+             done
+             wg set "$a1" "$@" 2>&1 ;;
+    UPMANY)  IFS= read -r c; set --; j=0
+             while [ "$j" -lt "$c" ] && IFS= read -r n && IFS= read -r m; do
+               if fwg_stage "$n" "$m"; then set -- "$@" "$n"
+               else set -- "$@" "!$n"; fi
+               j=$((j + 1))
+             done
+             fwg_many "$a1" fwg_wgup "$a2" "$@" ;;
+    DOWNMANY) IFS= read -r c; set --; j=0
+             while [ "$j" -lt "$c" ] && IFS= read -r n; do
+               set -- "$@" "$n"; j=$((j + 1))
+             done
+             fwg_many "$a1" fwg_down "" "$@" ;;
     *)       echo "unknown op: $op" >&2 ;;
   esac
   printf "%s %d\n" "__FWG_END__" "$?"
 done
 )SHELL";
 
+// Config as "<nlines>\n<lines...>", every line newline-terminated. The count
+// lets the shell read exactly the config and nothing of the next request.
+std::string FrameConfig(const std::string& config) {
+  std::string body = config;
+  if (!body.empty() && body.back() != '\n') body.push_back('\n');
+  size_t lines = 0;
+  for (char c : body) {
+    if (c == '\n') ++lines;
+  }
+  return std::to_string(lines) + "\n" + body;
+}
+
 bool WriteAll(int fd, const std::string& data) {
   size_t off = 0;
   while (off < data.size()) {
@@ -105,6 +278,59 @@ bool ReadUntilMarker(int fd, std::string* body, int* exit_code) {
   }
 }
 
+// Splits a batch reply into one result per `__FWG_ITEM__ <ec>` line. Items
+// the reply is missing (session died mid-batch, elevation refused) inherit
+// the batch result itself, so every caller still gets `count` entries.
+std::vector<ProcessResult> SplitItems(const ProcessResult& batch, size_t count) {
+  std::vector<ProcessResult> out;
+  out.reserve(count);
+  size_t start = 0;
+  size_t pos = 0;
+  const std::string& body = batch.stdout_data;
+  const size_t marker_len = std::strlen(kItemMarker);
+  while (out.size() < count && pos < body.size()) {
+    size_t nl = body.find('\n', pos);
+    if (nl == std::string::npos) break;
+    if (body.compare(pos, marker_len, kItemMarker) == 0) {
+      const std::string tail =
+          body.substr(pos + marker_len, nl - pos - marker_len);
+      int ec = -1;
+      try {
+        ec = std::stoi(tail);
+      } catch (...) {
+      }
+      out.push_back({ec, body.substr(start, pos - start), ""});
+      start = nl + 1;
+    }
+    pos = nl + 1;
+  }
+  const ProcessResult missing =
+      batch.exit_code == 0
+          ? ProcessResult{-1, "", "elevated session lost"}
+          : batch;
+  while (out.size() < count) out.push_back(missing);
+  return out;
+}
+
+// Calls fn(0..n-1) on up to `max_parallel` threads at once.
+template <typename Fn>
+void RunBounded(size_t n, size_t max_parallel, Fn fn) {
+  const size_t k = std::min(n, std::max<size_t>(1, max_parallel));
+  if (k <= 1) {
+    for (size_t i = 0; i < n; ++i) fn(i);
+    return;
+  }
+  std::atomic<size_t> next{0};
+  std::vector<std::thread> workers;
+  workers.reserve(k);
+  for (size_t w = 0; w < k; ++w) {
+    workers.emplace_back([&] {
+      for (size_t i = next++; i < n; i = next++) fn(i);
+    });
+  }
+  for (auto& t : workers) t.join();
+}
+
 }  // namespace
 
 RealPrivilegedSession::RealPrivilegedSession(std::shared_ptr<ProcessRunner> runner)
@@ -185,11 +411,12 @@ bool RealPrivilegedSession::EnsureSession() {
   std::vector<std::string> args = elev;
   args.push_back("sh");
   args.push_back("-c");
-  args.push_back(kShellLoop);
+  args.push_back(std::string(kStageFns) + kShellLoop);
   std::vector<char*> argv;
   for (auto& a : args) argv.push_back(const_cast<char*>(a.c_str()));
   argv.push_back(nullptr);
 
+  FWG_TRACE_SCOPE("elevated.spawn");
   pid_t pid = -1;
   int rc = ::posix_spawnp(&pid, elev[0].c_str(), &actions, nullptr, argv.data(), environ);
   posix_spawn_file_actions_destroy(&actions);
@@ -207,43 +434,60 @@ bool RealPrivilegedSession::EnsureSession() {
   child_pid_        = pid;
   child_stdin_fd_   = in_pipe[1];
   child_stdout_fd_  = out_pipe[0];
+
+  // Blocks for as long as the polkit agent (or sudo askpass...) is up. EOF
+  // here means the user cancelled or authentication failed.
+  FWG_TRACE_SCOPE("elevated.prompt");
+  PhaseTimer elevate("session", "elevate");
+  std::string hello;
+  int ec = -1;
+  if (!ReadUntilMarker(child_stdout_fd_, &hello, &ec) || ec != 0) {
+    TeardownLocked();
+    return false;
+  }
   return true;
 }
 
 ProcessResult RealPrivilegedSession::SendOp(const std::string& op,
                                             const std::string& arg1,
-                                            const std::string& arg2) {
-  std::lock_guard<std::mutex> lock(session_mu_);
-
+                                            const std::string& arg2,
+                                            const std::string& payload) {
   if (is_root_) {
     // Root path: just shell out directly via the existing ProcessRunner.
     // This avoids pkexec entirely.
-    std::vector<std::string> argv;
-    std::map<std::string, std::string> env;
-    if (op == "SHOW")        argv = {"wg", "show", arg1, "dump"};
-    else if (op == "UP")     argv = {"wg-quick", "up", arg1};
-    else if (op == "UPENV") {
-      argv = {"wg-quick", "up", arg2};
-      env["WG_QUICK_USERSPACE_IMPLEMENTATION"] = arg1;
-    }
-    else if (op == "DOWN")   argv = {"wg-quick", "down", arg1};
-    else                     return {-1, "", "unknown op " + op};
-    return runner_->Run(argv, env, std::nullopt);
+    return RunDirect(op, arg1, arg2, payload);
+  }
+
+  FWG_TRACE_SCOPE("elevated.op");
+  std::unique_lock<std::mutex> lock(session_mu_, std::defer_lock);
+  {
+    FWG_TRACE_SCOPE("elevated.lock_wait");
+    lock.lock();
   }
 
   for (int attempt = 0; attempt < 2; ++attempt) {
     if (!EnsureSession()) {
-      return {-1, "", "privilege elevation is not available (pkexec missing? "
-                      "set FLUTTER_WIREGUARD_ELEVATE to override)"};
+      return {-1, "", "privilege elevation failed or was cancelled (pkexec "
+                      "missing? set FLUTTER_WIREGUARD_ELEVATE to override)"};
+    }
+    std::string request = op + "\n" + arg1 + "\n" + arg2 + "\n" + payload;
+    bool written;
+    {
+      FWG_TRACE_SCOPE("elevated.write");
+      written = WriteAll(child_stdin_fd_, request);
     }
-    std::string payload = op + "\n" + arg1 + "\n" + arg2 + "\n";
-    if (!WriteAll(child_stdin_fd_, payload)) {
+    if (!written) {
       TeardownLocked();
       continue;  // child probably died — retry once with a fresh session
     }
     std::string body;
     int ec = -1;
-    if (!ReadUntilMarker(child_stdout_fd_, &body, &ec)) {
+    bool read;
+    {
+      FWG_TRACE_SCOPE("elevated.read");
+      read = ReadUntilMarker(child_stdout_fd_, &body, &ec);
+    }
+    if (!read) {
       TeardownLocked();
       continue;
     }
@@ -252,6 +496,41 @@ ProcessResult RealPrivilegedSession::SendOp(const std::string& op,
   return {-1, "", "elevated session lost"};
 }
 
+ProcessResult RealPrivilegedSession::RunDirect(const std::string& op,
+                                               const std::string& arg1,
+                                               const std::string& arg2,
+                                               const std::string& payload) {
+  std::vector<std::string> argv;
+  std::map<std::string, std::string> env;
+  if (op == "SHOW")        argv = {"wg", "show", arg1, "dump"};
+  else if (op == "UP")     argv = {"wg-quick", "up", arg1};
+  else if (op == "UPENV") {
+    argv = {"wg-quick", "up", arg2};
+    env["WG_QUICK_USERSPACE_IMPLEMENTATION"] = arg1;
+  }
+  else if (op == "DOWN")   argv = {"wg-quick", "down", arg1};
+  else if (op == "UPCFG" || op == "DOWNIF" || op == "RULES") {
+    // Same shell helpers as the elevated loop. For UPCFG the payload's first
+    // line is the count fwg_up expects, the rest arrives on stdin.
+    std::string script = kStageFns;
+    if (op == "UPCFG") {
+      size_t nl = payload.find('\n');
+      script += "fwg_up \"$1\" \"$2\" \"$3\"";
+      argv = {"sh", "-c", script, "sh", arg1, arg2, payload.substr(0, nl)};
+      return runner_->Run(argv, env, payload.substr(nl + 1));
+    }
+    if (op == "RULES") {
+      script += "fwg_rules \"$1\" \"$2\"";
+      argv = {"sh", "-c", script, "sh", arg1, arg2};
+    } else {
+      script += "fwg_down \"$1\"";
+      argv = {"sh", "-c", script, "sh", arg1};
+    }
+  }
+  else                     return {-1, "", "unknown op " + op};
+  return runner_->Run(argv, env, std::nullopt);
+}
+
 ProcessResult RealPrivilegedSession::ShowDump(const std::string& iface) {
   return SendOp("SHOW", iface, "");
 }
@@ -268,4 +547,151 @@ ProcessResult RealPrivilegedSession::WgQuickDown(const std::string& conf_path) {
   return SendOp("DOWN", conf_path, "");
 }
 
+ProcessResult RealPrivilegedSession::WgQuickUpInline(
+    const std::string& iface, const std::string& config,
+    const std::string& userspace_impl) {
+  return SendOp("UPCFG", iface, userspace_impl, FrameConfig(config));
+}
+
+ProcessResult RealPrivilegedSession::WgQuickDownByName(const std::string& iface) {
+  return SendOp("DOWNIF", iface, "");
+}
+
+ProcessResult RealPrivilegedSession::InstallPolicyRules(uint32_t table,
+                                                        uint32_t priority) {
+  return SendOp("RULES", std::to_string(table), std::to_string(priority));
+}
+
+ProcessResult RealPrivilegedSession::InstallRoutes(const std::string& iface,
+                                                   const RoutePlan& plan) {
+  if (is_root_) {
+    // We hold CAP_NET_ADMIN ourselves: skip `ip` and talk rtnetlink.
+    FWG_TRACE_SCOPE("routes.netlink");
+    try {
+      const unsigned int index = ::if_nametoindex(iface.c_str());
+      if (index == 0) {
+        throw std::runtime_error("no interface '" + iface + "'");
+      }
+      RouteInstaller(OpenRouteChannel()).Install(static_cast<int>(index), plan);
+      return {0, "", ""};
+    } catch (const std::exception& e) {
+      return {1, "", e.what()};
+    }
+  }
+  const std::string script = IpBatchScript(iface, plan);
+  const size_t lines = std::count(script.begin(), script.end(), '\n');
+  return SendOp("ROUTES", iface, "", std::to_string(lines) + "\n" + script);
+}
+
+ProcessResult RealPrivilegedSession::InstallKillSwitch(const KillSwitchSet& tunnels) {
+  if (is_root_) {
+    // One NFNL batch from here instead of an `nft` that builds the same one.
+    FWG_TRACE_SCOPE("kill_switch.netlink");
+    try {
+      KillSwitchInstaller(OpenNetfilterChannel()).Install(tunnels);
+    } catch (const std::exception& e) {
+      return {1, "", e.what()};
+    }
+    // The table is in; a record that can't be written only costs a
+    // restarted plugin the adopted tunnels' rules, as fwg_nft's `|| true`.
+    try {
+      ::mkdir(kStagingDir, 0711);
+      SaveKillSwitchRecords(std::string(kStagingDir) + "/" + kKillSwitchStateFile,
+                            tunnels);
+    } catch (const std::exception&) {
+    }
+    return {0, "", ""};
+  }
+  const std::string script = NftScript(tunnels);
+  const std::string records = KillSwitchRecords(tunnels);
+  const size_t lines = std::count(script.begin(), script.end(), '\n');
+  const size_t record_lines = std::count(records.begin(), records.end(), '\n');
+  return SendOp("NFT", "", "",
+                std::to_string(lines) + "\n" + script +
+                    std::to_string(record_lines) + "\n" + records);
+}
+
+bool RealPrivilegedSession::CanApplyDns() {
+  if (!is_root_) return false;
+  std::lock_guard<std::mutex> lock(dns_mu_);
+  if (resolved_ == nullptr && !no_system_bus_) {
+    try {
+      resolved_ = ResolvedDns::ConnectSystem();
+    } catch (const std::exception&) {
+      no_system_bus_ = true;
+    }
+  }
+  // resolved may be started or stopped while we run, so ask every time.
+  return resolved_ != nullptr && resolved_->Available();
+}
+
+ProcessResult RealPrivilegedSession::ApplyDns(const std::string& iface,
+                                              const DnsPlan& plan) {
+  std::lock_guard<std::mutex> lock(dns_mu_);
+  if (resolved_ == nullptr) return {1, "", "not connected to systemd-resolved"};
+  try {
+    const unsigned int index = ::if_nametoindex(iface.c_str());
+    if (index == 0) throw std::runtime_error("no interface '" + iface + "'");
+    resolved_->Apply(static_cast<int>(index), plan);
+    return {0, "", ""};
+  } catch (const std::exception& e) {
+    return {1, "", e.what()};
+  }
+}
+
+ProcessResult RealPrivilegedSession::SetPeerEndpoints(
+    const std::string& iface, const std::vector<PeerEndpoint>& peers) {
+  auto blank = [](const std::string& v) {
+    return v.empty() || v.find_first_of(" \t\r\n") != std::string::npos;
+  };
+  std::vector<std::string> argv = {"wg", "set", iface};
+  std::string payload;
+  for (const auto& p : peers) {
+    if (blank(p.public_key) || blank(p.endpoint)) {
+      return {1, "", "malformed peer endpoint"};
+    }
+    argv.insert(argv.end(), {"peer", p.public_key, "endpoint", p.endpoint});
+    payload += p.public_key + " " + p.endpoint + "\n";
+  }
+  if (peers.empty()) return {0, "", ""};
+  if (is_root_) return runner_->Run(argv, {}, std::nullopt);
+  return SendOp("ENDPOINTS", iface, "", std::to_string(peers.size()) + "\n" + payload);
+}
+
+std::vector<ProcessResult> RealPrivilegedSession::WgQuickUpMany(
+    const std::vector<InlineTunnel>& tunnels,
+    const std::string& userspace_impl,
+    size_t max_parallel) {
+  if (tunnels.empty()) return {};
+  if (is_root_) {
+    std::vector<ProcessResult> out(tunnels.size());
+    RunBounded(tunnels.size(), max_parallel, [&](size_t i) {
+      out[i] = RunDirect("UPCFG", tunnels[i].iface, userspace_impl,
+                         FrameConfig(tunnels[i].config));
+    });
+    return out;
+  }
+  std::string payload = std::to_string(tunnels.size()) + "\n";
+  for (const auto& t : tunnels) payload += t.iface + "\n" + FrameConfig(t.config);
+  return SplitItems(SendOp("UPMANY", std::to_string(max_parallel),
+                           userspace_impl, payload),
+                    tunnels.size());
+}
+
+std::vector<ProcessResult> RealPrivilegedSession::WgQuickDownManyByName(
+    const std::vector<std::string>& ifaces, size_t max_parallel) {
+  if (ifaces.empty()) return {};
+  if (is_root_) {
+    std::vector<ProcessResult> out(ifaces.size());
+    RunBounded(ifaces.size(), max_parallel, [&](size_t i) {
+      out[i] = RunDirect("DOWNIF", ifaces[i], "", "");
+    });
+    return out;
+  }
+  std::string payload = std::to_string(ifaces.size()) + "\n";
+  for (const auto& i : ifaces) payload += i + "\n";
+  return SplitItems(SendOp("DOWNMANY", std::to_string(max_parallel), "", payload),
+                    ifaces.size());
+}
+
 }  // namespace flutter_wireguard
@@ -6,27 +6,71 @@
 // the first request and reuses it for every subsequent privileged operation.
 //
 // The protocol over stdin/stdout is line-oriented:
-//   parent -> child:   <OP>\n<ARG1>\n<ARG2>\n
+//   parent -> child:   <OP>\n<ARG1>\n<ARG2>\n[<payload>]
 //   child  -> parent:  <merged stdout+stderr>\n__FWG_END__ <exit_code>\n
 //
+// Only UPCFG carries a payload: a line count followed by that many config
+// lines, so the config never touches the unprivileged filesystem. The root
+// side stages it in /run/flutter_wireguard/<iface>.conf (root-only tmpfs;
+// wg-quick insists on a `<iface>.conf` path) and keeps it until DOWNIF so
+// PostDown hooks still run.
+//
+// UPMANY / DOWNMANY are the batch forms (ARG1 = max parallel wg-quick runs).
+// Their payload is a tunnel count followed by, per tunnel, the iface name
+// and (UPMANY only) a framed config as above. The reply body carries one
+// `__FWG_ITEM__ <exit_code>` line after each tunnel's output, in request
+// order, so one round trip (and at most one prompt) covers the whole batch.
+//
+// RULES (ARG1 = routing table, ARG2 = rule priority) points traffic at a
+// tunnel whose routes were installed into their own table, see
+// WgBackend::SwitchTunnel.
+//
+// ROUTES (ARG1 = iface) carries a line count and that many `ip -batch`
+// commands (see route_installer.h), run by a single `ip` process.
+//
+// ENDPOINTS (ARG1 = iface) carries a line count and that many
+// `<public key> <endpoint>` lines, applied by one `wg set` (see
+// endpoint_resolver.h).
+//
+// NFT carries a line count and that many lines of `nft -f` input, committed
+// by a single `nft` as one transaction (see kill_switch.h), then a line count
+// and that many KillSwitchRecords lines to record next to the staged
+// configs.
+//
 // All arguments are strict, plugin-controlled values:
 //   * iface names pass IsValidName() (max 15 chars, [A-Za-z0-9_=+.-]).
-//   * config paths live under XDG_RUNTIME_DIR/flutter_wireguard/<iface>.conf.
+//   * config paths (file hand-off only) live under
+//     XDG_RUNTIME_DIR/flutter_wireguard/<iface>.conf.
 //   * userspace impl is one of {wireguard-go, boringtun-cli, boringtun}.
 // None of these can break the shell loop — but to be safe the loop double
 // quotes every argument and the OP names are matched against a whitelist.
 #ifndef FLUTTER_WIREGUARD_PRIVILEGED_SESSION_H_
 #define FLUTTER_WIREGUARD_PRIVILEGED_SESSION_H_
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
 
+#include "dns_plan.h"
+#include "endpoint_resolver.h"
+#include "kill_switch.h"
 #include "process_runner.h"
+#include "route_installer.h"
 
 namespace flutter_wireguard {
 
+class ResolvedDns;
+
+// Where the root side stages inline configs, and records the kill switch.
+inline constexpr char kStagingDir[] = "/run/flutter_wireguard";
+
+struct InlineTunnel {
+  std::string iface;
+  std::string config;
+};
+
 class PrivilegedSession {
  public:
   virtual ~PrivilegedSession() = default;
@@ -42,6 +86,83 @@ class PrivilegedSession {
 
   // `wg-quick down <conf_path>`. Best-effort.
   virtual ProcessResult WgQuickDown(const std::string& conf_path) = 0;
+
+  // `wg-quick up` for `iface` with `config` streamed over the elevated
+  // channel instead of read from a user-owned file.
+  virtual ProcessResult WgQuickUpInline(const std::string& iface,
+                                        const std::string& config,
+                                        const std::string& userspace_impl) = 0;
+
+  // Brings `iface` down by name: `wg-quick down` on the staged config if
+  // WgQuickUpInline left one, else `ip link delete`. Best-effort.
+  virtual ProcessResult WgQuickDownByName(const std::string& iface) = 0;
+
+  // Adds the policy rules that send everything not marked `table` through
+  // routing table `table`, with the main table's non-default routes still
+  // winning (wg-quick's own default-route scheme), at `priority` and
+  // `priority + 1`, for IPv4 and (best-effort) IPv6. Each rule is one
+  // netlink message, so traffic moves in a single step.
+  virtual ProcessResult InstallPolicyRules(uint32_t table, uint32_t priority) = 0;
+
+  // Adds `plan`'s addresses and routes on `iface` (already up), all or
+  // nothing. See route_installer.h.
+  virtual ProcessResult InstallRoutes(const std::string& iface,
+                                      const RoutePlan& plan) = 0;
+
+  // Whether ApplyDns can set DNS in systemd-resolved directly. If not,
+  // `DNS =` stays in the config for wg-quick and resolvconf.
+  virtual bool CanApplyDns() { return false; }
+
+  // Sets `plan` as `iface`'s (already up) DNS. See resolved_dns.h.
+  virtual ProcessResult ApplyDns(const std::string& iface, const DnsPlan& plan) {
+    (void)iface;
+    (void)plan;
+    return {1, "", "DNS is left to resolvconf here"};
+  }
+
+  // Points each peer of running `iface` at its new numeric endpoint, in one
+  // `wg set`. Keys are base64 and endpoints numeric; a value with blanks in
+  // it is refused.
+  virtual ProcessResult SetPeerEndpoints(const std::string& iface,
+                                         const std::vector<PeerEndpoint>& peers) {
+    (void)iface;
+    (void)peers;
+    return {1, "", "endpoint updates are not supported here"};
+  }
+
+  // Replaces the kill-switch table with one for `tunnels`, or removes it if
+  // `tunnels` is empty, in one transaction. The interfaces need not exist
+  // yet. See kill_switch.h.
+  virtual ProcessResult InstallKillSwitch(const KillSwitchSet& tunnels) {
+    if (tunnels.empty()) return {0, "", ""};
+    return {1, "", "kill switch is not supported here"};
+  }
+
+  // WgQuickUpInline for every tunnel, with up to `max_parallel` of them in
+  // flight at once. One result per tunnel, in input order. The default runs
+  // them one after another.
+  virtual std::vector<ProcessResult> WgQuickUpMany(
+      const std::vector<InlineTunnel>& tunnels,
+      const std::string& userspace_impl,
+      size_t max_parallel) {
+    (void)max_parallel;
+    std::vector<ProcessResult> out;
+    out.reserve(tunnels.size());
+    for (const auto& t : tunnels) {
+      out.push_back(WgQuickUpInline(t.iface, t.config, userspace_impl));
+    }
+    return out;
+  }
+
+  // WgQuickDownByName for every iface, batched the same way.
+  virtual std::vector<ProcessResult> WgQuickDownManyByName(
+      const std::vector<std::string>& ifaces, size_t max_parallel) {
+    (void)max_parallel;
+    std::vector<ProcessResult> out;
+    out.reserve(ifaces.size());
+    for (const auto& i : ifaces) out.push_back(WgQuickDownByName(i));
+    return out;
+  }
 };
 
 // Real impl: spawns pkexec sh on first use and keeps the pipe open.
@@ -58,17 +179,45 @@ class RealPrivilegedSession : public PrivilegedSession {
   ProcessResult WgQuickUp(const std::string& conf_path,
                           const std::string& userspace_impl) override;
   ProcessResult WgQuickDown(const std::string& conf_path) override;
+  ProcessResult WgQuickUpInline(const std::string& iface,
+                                const std::string& config,
+                                const std::string& userspace_impl) override;
+  ProcessResult WgQuickDownByName(const std::string& iface) override;
+  ProcessResult InstallPolicyRules(uint32_t table, uint32_t priority) override;
+  ProcessResult InstallRoutes(const std::string& iface,
+                              const RoutePlan& plan) override;
+  // Only as root: resolve1 would ask polkit, i.e. prompt, per call.
+  bool CanApplyDns() override;
+  ProcessResult ApplyDns(const std::string& iface, const DnsPlan& plan) override;
+  ProcessResult SetPeerEndpoints(const std::string& iface,
+                                 const std::vector<PeerEndpoint>& peers) override;
+  ProcessResult InstallKillSwitch(const KillSwitchSet& tunnels) override;
+  std::vector<ProcessResult> WgQuickUpMany(
+      const std::vector<InlineTunnel>& tunnels,
+      const std::string& userspace_impl,
+      size_t max_parallel) override;
+  std::vector<ProcessResult> WgQuickDownManyByName(
+      const std::vector<std::string>& ifaces, size_t max_parallel) override;
 
  private:
   // Lazily spawn the `pkexec sh -c <loop>` child. Returns true on success.
   // Holds session_mu_ for the lifetime of the call.
   bool EnsureSession();
 
-  // Send (op, arg1, arg2) and read the reply up to the __FWG_END__ marker.
-  // Auto-recovers if the child died (e.g. user hit Cancel last time).
+  // Send (op, arg1, arg2[, payload]) and read the reply up to the
+  // __FWG_END__ marker. Auto-recovers if the child died (e.g. user hit Cancel
+  // last time).
   ProcessResult SendOp(const std::string& op,
                        const std::string& arg1,
-                       const std::string& arg2);
+                       const std::string& arg2,
+                       const std::string& payload = std::string());
+
+  // Root path of SendOp for the single-tunnel ops: runs the command directly
+  // through runner_. Takes no lock, so batch ops can call it concurrently.
+  ProcessResult RunDirect(const std::string& op,
+                          const std::string& arg1,
+                          const std::string& arg2,
+                          const std::string& payload);
 
   void TeardownLocked();
 
@@ -83,6 +232,10 @@ class RealPrivilegedSession : public PrivilegedSession {
   pid_t child_pid_ = -1;
   int   child_stdin_fd_  = -1;   // we write to this
   int   child_stdout_fd_ = -1;   // we read from this (stdout+stderr merged)
+
+  std::mutex dns_mu_;
+  std::unique_ptr<ResolvedDns> resolved_;  // system bus, on first use
+  bool no_system_bus_ = false;
 };
 
 }  // namespace flutter_wireguard
@@ -14,6 +14,8 @@
 #include <filesystem>
 #include <sstream>
 
+#include "trace_buffer.h"
+
 extern char** environ;
 
 namespace flutter_wireguard {
@@ -46,6 +48,7 @@ ProcessResult RealProcessRunner::Run(
     const std::vector<std::string>& argv,
     const std::map<std::string, std::string>& env_extra,
     const std::optional<std::string>& stdin_data) {
+  FWG_TRACE_SCOPE("process.run");
   ProcessResult result;
   if (argv.empty()) return result;
 
@@ -90,8 +93,12 @@ ProcessResult RealProcessRunner::Run(
   posix_spawn_file_actions_addclose(&actions, stderr_pipe[0]);
 
   pid_t pid = -1;
-  int spawn_rc = posix_spawnp(&pid, c_argv[0], &actions, nullptr,
-                              c_argv.data(), c_env.data());
+  int spawn_rc;
+  {
+    FWG_TRACE_SCOPE("process.spawn");
+    spawn_rc = posix_spawnp(&pid, c_argv[0], &actions, nullptr, c_argv.data(),
+                            c_env.data());
+  }
   posix_spawn_file_actions_destroy(&actions);
 
   // Close child ends in the parent.
@@ -125,6 +132,7 @@ ProcessResult RealProcessRunner::Run(
 
   // Drain stdout/stderr in series — both have their own pipe buffer (typically
   // 64 KiB) which is far more than wg-quick / wg ever produce.
+  FWG_TRACE_SCOPE("process.wait");
   result.stdout_data = ReadAll(stdout_pipe[0]);
   result.stderr_data = ReadAll(stderr_pipe[0]);
 
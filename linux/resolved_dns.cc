@@ -0,0 +1,103 @@
+#include "resolved_dns.h"
+
+#include <gio/gio.h>
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "trace_buffer.h"
+
+namespace flutter_wireguard {
+
+namespace {
+
+constexpr char kBusName[] = "org.freedesktop.resolve1";
+constexpr char kObjectPath[] = "/org/freedesktop/resolve1";
+constexpr char kManager[] = "org.freedesktop.resolve1.Manager";
+constexpr int kTimeoutMs = 5000;
+
+// Consumes `error`.
+std::runtime_error DBusError(const std::string& what, GError* error) {
+  std::string message = what + ": ";
+  if (error == nullptr) return std::runtime_error(message + "unknown error");
+  g_dbus_error_strip_remote_error(error);
+  message += error->message;
+  g_error_free(error);
+  return std::runtime_error(message);
+}
+
+}  // namespace
+
+std::unique_ptr<ResolvedDns> ResolvedDns::ConnectSystem() {
+  GError* error = nullptr;
+  GDBusConnection* bus = g_bus_get_sync(G_BUS_TYPE_SYSTEM, nullptr, &error);
+  if (bus == nullptr) throw DBusError("system bus", error);
+  return std::unique_ptr<ResolvedDns>(new ResolvedDns(bus));
+}
+
+std::unique_ptr<ResolvedDns> ResolvedDns::Connect(const std::string& address) {
+  GError* error = nullptr;
+  GDBusConnection* bus = g_dbus_connection_new_for_address_sync(
+      address.c_str(),
+      static_cast<GDBusConnectionFlags>(
+          G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT |
+          G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION),
+      nullptr, nullptr, &error);
+  if (bus == nullptr) throw DBusError("bus " + address, error);
+  return std::unique_ptr<ResolvedDns>(new ResolvedDns(bus));
+}
+
+ResolvedDns::ResolvedDns(GDBusConnection* bus) : bus_(bus) {}
+
+ResolvedDns::~ResolvedDns() { g_object_unref(bus_); }
+
+bool ResolvedDns::Available() {
+  GVariant* reply = g_dbus_connection_call_sync(
+      bus_, "org.freedesktop.DBus", "/org/freedesktop/DBus", "org.freedesktop.DBus",
+      "NameHasOwner", g_variant_new("(s)", kBusName), G_VARIANT_TYPE("(b)"),
+      G_DBUS_CALL_FLAGS_NONE, kTimeoutMs, nullptr, nullptr);
+  if (reply == nullptr) return false;
+  gboolean owned = FALSE;
+  g_variant_get(reply, "(b)", &owned);
+  g_variant_unref(reply);
+  return owned != FALSE;
+}
+
+void ResolvedDns::Apply(int ifindex, const DnsPlan& plan) {
+  FWG_TRACE_SCOPE("dns.resolved");
+  GVariantBuilder servers;
+  g_variant_builder_init(&servers, G_VARIANT_TYPE("a(iay)"));
+  for (const auto& s : plan.servers) {
+    uint8_t bytes[16];
+    for (int i = 0; i < 8; ++i) {
+      bytes[i] = static_cast<uint8_t>(s.address.hi >> (56 - 8 * i));
+      bytes[8 + i] = static_cast<uint8_t>(s.address.lo >> (56 - 8 * i));
+    }
+    g_variant_builder_add(
+        &servers, "(i@ay)", s.v6 ? AF_INET6 : AF_INET,
+        g_variant_new_fixed_array(G_VARIANT_TYPE_BYTE, bytes, s.v6 ? 16 : 4, 1));
+  }
+  Call("SetLinkDNS", g_variant_new("(ia(iay))", ifindex, &servers));
+
+  GVariantBuilder domains;
+  g_variant_builder_init(&domains, G_VARIANT_TYPE("a(sb)"));
+  for (const auto& d : plan.domains) {
+    g_variant_builder_add(&domains, "(sb)", d.c_str(), FALSE);
+  }
+  g_variant_builder_add(&domains, "(sb)", ".", TRUE);  // "~."
+  Call("SetLinkDomains", g_variant_new("(ia(sb))", ifindex, &domains));
+
+  Call("SetLinkDefaultRoute", g_variant_new("(ib)", ifindex, TRUE));
+}
+
+void ResolvedDns::Call(const char* method, GVariant* args) {
+  GError* error = nullptr;
+  GVariant* reply = g_dbus_connection_call_sync(
+      bus_, kBusName, kObjectPath, kManager, method, args, nullptr,
+      G_DBUS_CALL_FLAGS_NONE, kTimeoutMs, nullptr, &error);
+  if (reply == nullptr) throw DBusError(method, error);
+  g_variant_unref(reply);
+}
+
+}  // namespace flutter_wireguard
@@ -0,0 +1,56 @@
+// Per-link DNS in systemd-resolved over D-Bus, without resolvconf.
+//
+// The three org.freedesktop.resolve1.Manager calls resolvectl would make
+// for `resolvconf -a tun.<iface> -m 0 -x`, sent straight from this process
+// through GIO (already linked for GTK): SetLinkDNS, SetLinkDomains and
+// SetLinkDefaultRoute. resolved forgets a link's settings when the link is
+// deleted, so Stop needs no call of its own. resolve1 only takes these
+// from root (or through a polkit prompt), so RealPrivilegedSession uses
+// ResolvedDns only when it runs privileged itself; see dns_plan.h for the
+// fallback.
+#ifndef FLUTTER_WIREGUARD_RESOLVED_DNS_H_
+#define FLUTTER_WIREGUARD_RESOLVED_DNS_H_
+
+#include <memory>
+#include <string>
+
+#include "dns_plan.h"
+
+typedef struct _GDBusConnection GDBusConnection;
+typedef struct _GVariant GVariant;
+
+namespace flutter_wireguard {
+
+class ResolvedDns {
+ public:
+  // On the system bus. Throws std::runtime_error.
+  static std::unique_ptr<ResolvedDns> ConnectSystem();
+  // On the bus at `address`, e.g. a private test bus. Throws
+  // std::runtime_error.
+  static std::unique_ptr<ResolvedDns> Connect(const std::string& address);
+
+  ~ResolvedDns();
+  ResolvedDns(const ResolvedDns&) = delete;
+  ResolvedDns& operator=(const ResolvedDns&) = delete;
+
+  // Whether org.freedesktop.resolve1 has an owner on the bus right now.
+  bool Available();
+
+  // Gives link `ifindex` the plan's servers and search domains, plus the
+  // "~." routing domain and the default-route flag that `resolvconf -x`
+  // maps to: names no other link claims are resolved through the tunnel.
+  // Throws std::runtime_error naming the call resolved refused.
+  void Apply(int ifindex, const DnsPlan& plan);
+
+ private:
+  explicit ResolvedDns(GDBusConnection* bus);
+
+  // One Manager method call; takes ownership of a floating `args`.
+  void Call(const char* method, GVariant* args);
+
+  GDBusConnection* bus_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_RESOLVED_DNS_H_
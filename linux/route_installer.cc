@@ -0,0 +1,398 @@
+#include "route_installer.h"
+
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace flutter_wireguard {
+
+namespace {
+
+std::runtime_error Errno(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+std::string Trim(const std::string& s) {
+  const size_t b = s.find_first_not_of(" \t\r");
+  if (b == std::string::npos) return "";
+  return s.substr(b, s.find_last_not_of(" \t\r") - b + 1);
+}
+
+std::string Lower(std::string s) {
+  for (char& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return s;
+}
+
+// Splits a comma-separated value, dropping empty items.
+std::vector<std::string> SplitList(const std::string& value) {
+  std::vector<std::string> out;
+  std::istringstream in(value);
+  std::string item;
+  while (std::getline(in, item, ',')) {
+    item = Trim(item);
+    if (!item.empty()) out.push_back(item);
+  }
+  return out;
+}
+
+int MaxBits(const RouteEntry& e) { return e.v6 ? 128 : 32; }
+
+// wg-quick's order: longest prefix first, then by address.
+bool LongestFirst(const RouteEntry& a, const RouteEntry& b) {
+  if (a.bits != b.bits) return a.bits > b.bits;
+  if (a.v6 != b.v6) return b.v6;
+  if (a.key.hi != b.key.hi) return a.key.hi < b.key.hi;
+  return a.key.lo < b.key.lo;
+}
+
+// Whether `route` lies inside the connected route the kernel adds for
+// `address` (none for a host address).
+bool Covers(const RouteEntry& address, const RouteEntry& route) {
+  using allowed_ips_internal::Masked;
+  return address.v6 == route.v6 && address.bits < MaxBits(address) &&
+         route.bits >= address.bits &&
+         Masked(route.key, address.bits) == Masked(address.key, address.bits);
+}
+
+// The kernel adds the connected route of each address itself, and in the
+// main table wg-quick skips what `ip route show dev <if> match` finds there.
+bool Connected(const RoutePlan& plan, const RouteEntry& route) {
+  return plan.table == 0 &&
+         std::any_of(plan.addresses.begin(), plan.addresses.end(),
+                     [&](const RouteEntry& a) { return Covers(a, route); });
+}
+
+size_t AddressBytes(const RouteEntry& e, uint8_t out[16]) {
+  for (int i = 0; i < 8; ++i) {
+    out[i] = static_cast<uint8_t>(e.key.hi >> (56 - 8 * i));
+    out[8 + i] = static_cast<uint8_t>(e.key.lo >> (56 - 8 * i));
+  }
+  return e.v6 ? 16 : 4;
+}
+
+void Put(std::string* b, const void* data, size_t len) {
+  b->append(static_cast<const char*>(data), len);
+}
+
+void PutAttr(std::string* b, uint16_t type, const void* data, size_t len) {
+  rtattr a{};
+  a.rta_len = static_cast<unsigned short>(RTA_LENGTH(len));
+  a.rta_type = type;
+  Put(b, &a, sizeof(a));
+  Put(b, data, len);
+  b->append(RTA_ALIGN(len) - len, '\0');
+}
+
+std::string Describe(const RouteEntry& e, bool address) {
+  return (address ? "address " : "route ") + FormatRouteEntry(e);
+}
+
+class SocketChannel : public NetlinkChannel {
+ public:
+  explicit SocketChannel(int fd) : fd_(fd) {}
+  ~SocketChannel() override { ::close(fd_); }
+
+  void Send(const std::string& datagram) override {
+    sockaddr_nl kernel{};
+    kernel.nl_family = AF_NETLINK;
+    while (::sendto(fd_, datagram.data(), datagram.size(), 0,
+                    reinterpret_cast<sockaddr*>(&kernel), sizeof(kernel)) < 0) {
+      if (errno != EINTR) throw Errno("netlink send");
+    }
+  }
+
+  std::string Receive() override {
+    alignas(nlmsghdr) char buf[64 * 1024];
+    for (;;) {
+      const ssize_t n = ::recv(fd_, buf, sizeof(buf), 0);
+      if (n > 0) return std::string(buf, static_cast<size_t>(n));
+      if (n < 0 && errno == EINTR) continue;
+      if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        throw std::runtime_error("netlink: no reply from the kernel");
+      }
+      throw Errno("netlink receive");
+    }
+  }
+
+ private:
+  int fd_;
+};
+
+}  // namespace
+
+bool TakeOverRoutes(const std::string& config, std::string* wg_quick_config,
+                    RoutePlan* plan) {
+  RoutePlan p;
+  std::string out;
+  bool in_interface = false;
+  bool in_peer = false;
+  bool saw_interface = false;
+  std::istringstream in(config);
+  std::string line;
+  while (std::getline(in, line)) {
+    const std::string body = line.substr(0, line.find('#'));
+    const size_t eq = body.find('=');
+    const std::string key = Lower(Trim(body.substr(0, eq)));
+    if (!key.empty() && key[0] == '[') {
+      in_interface = key == "[interface]";
+      in_peer = key == "[peer]";
+      out += line + "\n";
+      if (in_interface && !saw_interface) {
+        out += "Table = off\n";
+        saw_interface = true;
+      }
+      continue;
+    }
+    const std::string value = eq == std::string::npos ? "" : Trim(body.substr(eq + 1));
+    if (in_interface && key == "address") {
+      for (const auto& item : SplitList(value)) {
+        RouteEntry e;
+        IpKey masked;
+        const std::string ip = item.substr(0, item.find('/'));
+        if (!ParseIpPrefix(item, &masked, &e.bits, &e.v6) ||
+            !ParseIpAddress(ip, &e.key, &e.v6)) {
+          return false;
+        }
+        p.addresses.push_back(e);
+      }
+      continue;
+    }
+    if (in_interface && key == "table") {
+      const std::string t = Lower(value);
+      if (t == "off") return false;
+      if (t == "auto" || t == "main") {
+        p.table = 0;
+      } else if (!t.empty() && t.size() <= 10 &&
+                 std::all_of(t.begin(), t.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+        const unsigned long n = std::stoul(t);
+        if (n == 0 || n > 0xffffffffUL) return false;
+        p.table = static_cast<uint32_t>(n);
+        // RT_TABLE_MAIN by number is still the main table.
+        if (p.table == RT_TABLE_MAIN) p.table = 0;
+      } else {
+        return false;  // a table name from rt_tables; leave it to ip
+      }
+      continue;
+    }
+    if (in_interface && (key == "preup" || key == "postup")) return false;
+    if (in_peer && key == "allowedips") {
+      for (const auto& item : SplitList(value)) {
+        RouteEntry e;
+        if (!ParseIpPrefix(item, &e.key, &e.bits, &e.v6)) return false;
+        p.routes.push_back(e);
+      }
+    }
+    out += line + "\n";
+  }
+  // The threshold counts what wg-quick would have run `ip` for.
+  if (!saw_interface || p.routes.size() < kTakeOverMinRoutes) return false;
+  if (p.table == 0) {
+    for (const auto& r : p.routes) {
+      if (r.bits == 0) return false;
+    }
+  }
+  p.routes = CidrSet::FromPrefixes(p.routes).Prefixes();
+  if (p.table == 0) {
+    // 0.0.0.0/1 + 128.0.0.0/1 is how a config overrides the default route
+    // without replacing it; keep it that way.
+    std::vector<RouteEntry> halves;
+    for (auto& r : p.routes) {
+      if (r.bits != 0) continue;
+      r.bits = 1;
+      RouteEntry upper = r;
+      upper.key.hi = uint64_t{1} << 63;  // the top bit, in either family
+      halves.push_back(upper);
+    }
+    p.routes.insert(p.routes.end(), halves.begin(), halves.end());
+    p.routes.erase(std::remove_if(p.routes.begin(), p.routes.end(),
+                                  [&](const RouteEntry& r) { return Connected(p, r); }),
+                   p.routes.end());
+  }
+  std::sort(p.routes.begin(), p.routes.end(), LongestFirst);
+  *wg_quick_config = std::move(out);
+  *plan = std::move(p);
+  return true;
+}
+
+std::string FormatRouteEntry(const RouteEntry& e) { return FormatIpPrefix(e); }
+
+std::string IpBatchScript(const std::string& iface, const RoutePlan& plan) {
+  const std::string table =
+      plan.table == 0 ? "" : " table " + std::to_string(plan.table);
+  std::string out;
+  for (const auto& a : plan.addresses) {
+    out += "address add " + FormatRouteEntry(a) + " dev " + iface + "\n";
+  }
+  for (const auto& r : plan.routes) {
+    if (Connected(plan, r)) continue;
+    out += "route append " + FormatRouteEntry(r) + " dev " + iface + table + "\n";
+  }
+  return out;
+}
+
+std::unique_ptr<NetlinkChannel> OpenNetlinkChannel(int protocol) {
+  const int fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, protocol);
+  if (fd < 0) throw Errno("netlink socket");
+  auto channel = std::make_unique<SocketChannel>(fd);
+  // Acks without a copy of the request, where the kernel supports it.
+  int one = 1;
+  ::setsockopt(fd, SOL_NETLINK, NETLINK_CAP_ACK, &one, sizeof(one));
+  // Past rmem_max needs CAP_NET_ADMIN, which every caller needs anyway.
+  int rcvbuf = 1 << 20;
+  if (::setsockopt(fd, SOL_SOCKET, SO_RCVBUFFORCE, &rcvbuf, sizeof(rcvbuf)) != 0) {
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+  timeval timeout{5, 0};
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  sockaddr_nl local{};
+  local.nl_family = AF_NETLINK;
+  if (::bind(fd, reinterpret_cast<sockaddr*>(&local), sizeof(local)) != 0) {
+    throw Errno("netlink bind");
+  }
+  return channel;
+}
+
+std::unique_ptr<NetlinkChannel> OpenRouteChannel() {
+  return OpenNetlinkChannel(NETLINK_ROUTE);
+}
+
+RouteInstaller::RouteInstaller(std::unique_ptr<NetlinkChannel> channel)
+    : channel_(std::move(channel)) {}
+
+void RouteInstaller::Install(int ifindex, const RoutePlan& plan) {
+  std::vector<Item> items;
+  items.reserve(plan.addresses.size() + plan.routes.size());
+  for (const auto& a : plan.addresses) items.push_back({&a, true});
+  for (const auto& r : plan.routes) {
+    if (!Connected(plan, r)) items.push_back({&r, false});
+  }
+
+  std::vector<int> errors(items.size(), 1);
+  size_t sent = 0;
+  std::string failure;
+  try {
+    for (size_t begin = 0; begin < items.size() && failure.empty();
+         begin += kBatchMessages) {
+      const size_t end = std::min(items.size(), begin + kBatchMessages);
+      sent = end;
+      Exchange(ifindex, plan.table, items, begin, end, true, &errors);
+      for (size_t i = begin; i < end; ++i) {
+        // The very same route on this link already: nothing to add, and
+        // not ours to take out again on rollback.
+        if (!items[i].address && errors[i] == -EEXIST) continue;
+        if (errors[i] < 0) {
+          failure = Describe(*items[i].entry, items[i].address) + ": " +
+                    std::strerror(-errors[i]);
+          break;
+        }
+      }
+    }
+  } catch (const std::exception& e) {
+    failure = e.what();
+  }
+  if (failure.empty()) return;
+
+  // Undo everything that was, or for lack of an ack may have been, added,
+  // routes before addresses.
+  std::vector<Item> undo;
+  for (size_t i = sent; i-- > 0;) {
+    if (errors[i] >= 0) undo.push_back(items[i]);
+  }
+  std::vector<int> ignored(undo.size(), 1);
+  try {
+    for (size_t begin = 0; begin < undo.size(); begin += kBatchMessages) {
+      Exchange(ifindex, plan.table, undo, begin,
+               std::min(undo.size(), begin + kBatchMessages), false, &ignored);
+    }
+  } catch (const std::exception&) {
+    // The caller tears the link down, which takes the rest with it.
+  }
+  throw std::runtime_error(failure);
+}
+
+void RouteInstaller::Exchange(int ifindex, uint32_t table,
+                              const std::vector<Item>& items, size_t begin,
+                              size_t end, bool add, std::vector<int>* errors) {
+  buf_.clear();
+  const uint32_t first_seq = seq_ + 1;
+  for (size_t i = begin; i < end; ++i) {
+    const RouteEntry& e = *items[i].entry;
+    const size_t start = buf_.size();
+    nlmsghdr nh{};
+    if (items[i].address) {
+      nh.nlmsg_type = add ? RTM_NEWADDR : RTM_DELADDR;
+    } else {
+      nh.nlmsg_type = add ? RTM_NEWROUTE : RTM_DELROUTE;
+    }
+    nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK;
+    // Without EXCL a route only clashes with an identical one, which the
+    // kernel still reports as EEXIST; an address must be new.
+    if (add) nh.nlmsg_flags |= NLM_F_CREATE;
+    if (add && items[i].address) nh.nlmsg_flags |= NLM_F_EXCL;
+    nh.nlmsg_seq = ++seq_;
+    Put(&buf_, &nh, sizeof(nh));
+
+    uint8_t addr[16];
+    const size_t addr_len = AddressBytes(e, addr);
+    if (items[i].address) {
+      // What `ip address add` sends: local and address both the address.
+      ifaddrmsg m{};
+      m.ifa_family = e.v6 ? AF_INET6 : AF_INET;
+      m.ifa_prefixlen = e.bits;
+      m.ifa_index = static_cast<uint32_t>(ifindex);
+      Put(&buf_, &m, NLMSG_ALIGN(sizeof(m)));
+      PutAttr(&buf_, IFA_LOCAL, addr, addr_len);
+      PutAttr(&buf_, IFA_ADDRESS, addr, addr_len);
+    } else {
+      // And `ip route add <prefix> dev <iface> [table <n>]`.
+      rtmsg m{};
+      m.rtm_family = e.v6 ? AF_INET6 : AF_INET;
+      m.rtm_dst_len = e.bits;
+      m.rtm_table = static_cast<uint8_t>(
+          table == 0 ? RT_TABLE_MAIN : (table < 256 ? table : RT_TABLE_UNSPEC));
+      m.rtm_protocol = RTPROT_BOOT;
+      m.rtm_scope = RT_SCOPE_LINK;
+      m.rtm_type = RTN_UNICAST;
+      Put(&buf_, &m, NLMSG_ALIGN(sizeof(m)));
+      if (e.bits > 0) PutAttr(&buf_, RTA_DST, addr, addr_len);
+      const uint32_t oif = static_cast<uint32_t>(ifindex);
+      PutAttr(&buf_, RTA_OIF, &oif, sizeof(oif));
+      if (table >= 256) PutAttr(&buf_, RTA_TABLE, &table, sizeof(table));
+    }
+    const uint32_t len = static_cast<uint32_t>(buf_.size() - start);
+    std::memcpy(&buf_[start] + offsetof(nlmsghdr, nlmsg_len), &len, sizeof(len));
+  }
+  channel_->Send(buf_);
+  ++datagrams_sent_;
+
+  size_t pending = end - begin;
+  while (pending > 0) {
+    const std::string reply = channel_->Receive();
+    int left = static_cast<int>(reply.size());
+    for (auto* nh = reinterpret_cast<const nlmsghdr*>(reply.data());
+         NLMSG_OK(nh, left); nh = NLMSG_NEXT(nh, left)) {
+      if (nh->nlmsg_type != NLMSG_ERROR ||
+          nh->nlmsg_len < NLMSG_LENGTH(sizeof(nlmsgerr))) {
+        continue;
+      }
+      const uint32_t offset = nh->nlmsg_seq - first_seq;
+      if (offset >= end - begin) continue;
+      int& slot = (*errors)[begin + offset];
+      if (slot != 1) continue;
+      slot = static_cast<const nlmsgerr*>(NLMSG_DATA(nh))->error;
+      --pending;
+    }
+  }
+}
+
+}  // namespace flutter_wireguard
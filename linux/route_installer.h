@@ -0,0 +1,127 @@
+// Batched address and route installation over rtnetlink.
+//
+// wg-quick adds a tunnel's addresses and routes one `ip` invocation at a
+// time: for every AllowedIPs entry it runs `ip route show ... match` and
+// then `ip route add`, so a 2,000-prefix split tunnel forks `ip` 4,000
+// times before Start returns. For configs with many routes WgBackend tells
+// wg-quick `Table = off`, drops the Address lines, and installs the same
+// set itself once the link is up:
+//
+//   * With CAP_NET_ADMIN in-process (root, or FLUTTER_WIREGUARD_ELEVATE=none)
+//     RouteInstaller packs up to kBatchMessages RTM_NEWADDR / RTM_NEWROUTE
+//     messages into each datagram, each with NLM_F_ACK, matches the acks
+//     back by sequence number, and deletes whatever it added if any
+//     message fails.
+//   * Through the pkexec shell, which cannot speak netlink, the plan goes to
+//     a single `ip -batch` run (IpBatchScript) with the same rollback.
+//
+// Either way the cost is kernel work plus at most one process.
+#ifndef FLUTTER_WIREGUARD_ROUTE_INSTALLER_H_
+#define FLUTTER_WIREGUARD_ROUTE_INSTALLER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cidr_set.h"
+
+namespace flutter_wireguard {
+
+using RouteEntry = CidrPrefix;
+
+struct RoutePlan {
+  std::vector<RouteEntry> addresses;  // [Interface] Address, host bits kept
+  std::vector<RouteEntry> routes;     // peers' AllowedIPs, aggregated
+  uint32_t table = 0;                 // 0 = main
+};
+
+// Below this many routes wg-quick's forks cost tens of milliseconds, and
+// leaving the config untouched keeps wg-quick's behaviour exact.
+inline constexpr size_t kTakeOverMinRoutes = 16;
+
+// Decides whether Start installs `config`'s addresses and routes itself. If
+// so, fills *plan and sets *wg_quick_config to `config` with the Address
+// lines dropped and `Table = off`, so wg-quick only creates, configures and
+// raises the link. Declines for fewer than kTakeOverMinRoutes routes,
+// `Table = off`, PreUp/PostUp hooks (which may expect the routes), a /0 in
+// the main table (wg-quick's fwmark and rule scheme) and anything it cannot
+// parse, which is left for wg-quick to report.
+//
+// The routes are the union of every peer's AllowedIPs as the fewest
+// prefixes (CidrSet): all of them point at the same link, so overlapping,
+// duplicate and adjacent prefixes collapse without changing where a packet
+// goes. A union that reaches /0 in the main table stays two /1s, as the
+// config wrote it. Like wg-quick, a main-table route already covered by the
+// connected route of one of the tunnel's own addresses is skipped, and
+// routes go in longest prefix first.
+bool TakeOverRoutes(const std::string& config, std::string* wg_quick_config,
+                    RoutePlan* plan);
+
+// "10.0.0.0/8", "fd00::/16".
+std::string FormatRouteEntry(const RouteEntry& e);
+
+// `plan` for `iface` as `ip -batch` input, one command per line, addresses
+// first. Like Install, leaves out routes the addresses' connected routes
+// cover.
+std::string IpBatchScript(const std::string& iface, const RoutePlan& plan);
+
+// One netlink conversation. Abstract so tests can play the kernel.
+class NetlinkChannel {
+ public:
+  virtual ~NetlinkChannel() = default;
+  // One datagram, possibly holding many messages. Throws std::runtime_error.
+  virtual void Send(const std::string& datagram) = 0;
+  // The next datagram from the kernel. Throws std::runtime_error, including
+  // on timeout.
+  virtual std::string Receive() = 0;
+};
+
+// A netlink socket of `protocol` with a receive buffer large enough for a
+// batch of acks. Throws std::runtime_error.
+std::unique_ptr<NetlinkChannel> OpenNetlinkChannel(int protocol);
+
+// OpenNetlinkChannel(NETLINK_ROUTE).
+std::unique_ptr<NetlinkChannel> OpenRouteChannel();
+
+class RouteInstaller {
+ public:
+  // Messages per datagram. Their acks must all fit in the socket's receive
+  // buffer before we read any, and each costs ~1 KiB of skb there.
+  static constexpr size_t kBatchMessages = 128;
+
+  explicit RouteInstaller(std::unique_ptr<NetlinkChannel> channel);
+
+  // Adds `plan` on link `ifindex`: addresses, then routes. In the main
+  // table a route covered by an address's connected route is skipped, and
+  // one the kernel already has on this link counts as added (but is left
+  // alone by a rollback), as with wg-quick. All or nothing: if any message
+  // fails, what this call added is deleted again and std::runtime_error
+  // names the first failure.
+  void Install(int ifindex, const RoutePlan& plan);
+
+  // Datagrams sent so far, rollback included.
+  size_t datagrams_sent() const { return datagrams_sent_; }
+
+ private:
+  struct Item {
+    const RouteEntry* entry;
+    bool address;
+  };
+
+  // Sends items[begin, end) as one datagram of `add` or delete requests and
+  // fills (*errors)[i] with each one's ack: 0 or a negative errno. Items
+  // without an ack before the channel fails keep 1.
+  void Exchange(int ifindex, uint32_t table, const std::vector<Item>& items,
+                size_t begin, size_t end, bool add, std::vector<int>* errors);
+
+  std::unique_ptr<NetlinkChannel> channel_;
+  uint32_t seq_ = 0;
+  size_t datagrams_sent_ = 0;
+  std::string buf_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_ROUTE_INSTALLER_H_
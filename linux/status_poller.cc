@@ -0,0 +1,143 @@
+#include "status_poller.h"
+
+#include <exception>
+#include <string>
+
+#include "trace_buffer.h"
+
+namespace flutter_wireguard {
+
+std::vector<TunnelStatusCpp> PollTunnelStatuses(
+    WgBackend* backend, std::vector<std::vector<PeerStatsCpp>>* peers,
+    std::vector<PeerSetDiff>* diffs) {
+  FWG_TRACE_SCOPE("poller.tick");
+  std::vector<TunnelStatusCpp> out;
+  const std::vector<std::string> names = backend->TunnelNames();
+  out.reserve(names.size());
+  if (peers != nullptr) {
+    peers->clear();
+    peers->reserve(names.size());
+  }
+  if (diffs != nullptr) diffs->clear();
+  std::vector<PeerStatsCpp> tunnel_peers;
+  for (const auto& name : names) {
+    try {
+      out.push_back(
+          backend->Status(name, peers != nullptr ? &tunnel_peers : nullptr));
+    } catch (...) {
+      continue;  // skip this tunnel
+    }
+    if (peers == nullptr) continue;
+    PeerSetDiff diff = backend->peers().Update(name, tunnel_peers);
+    if (diffs != nullptr) diffs->push_back(std::move(diff));
+    peers->push_back(std::move(tunnel_peers));
+  }
+  return out;
+}
+
+std::vector<TunnelHealthEventCpp> ObserveHandshakes(
+    HandshakeMonitor* monitor, const std::vector<TunnelStatusCpp>& tick,
+    const std::vector<std::vector<PeerStatsCpp>>& peers, int64_t now_ms,
+    const std::vector<PeerSetDiff>* diffs) {
+  std::vector<TunnelHealthEventCpp> out;
+  std::vector<PeerHandshake> handshakes;
+  for (size_t i = 0; i < tick.size() && i < peers.size(); ++i) {
+    // Down, or up but only readable through sysfs: nothing to judge by.
+    if (tick[i].state != TunnelStateCpp::kUp || peers[i].empty()) continue;
+    if (diffs != nullptr && i < diffs->size() && (*diffs)[i].Unchanged() &&
+        monitor->Recheck(tick[i].name, now_ms, &out)) {
+      continue;
+    }
+    handshakes.clear();
+    for (const auto& p : peers[i]) handshakes.push_back({p.public_key, p.handshake});
+    monitor->Observe(tick[i].name, handshakes, now_ms, &out);
+  }
+  return out;
+}
+
+size_t FailOverStalePeers(WgBackend* backend,
+                          const std::vector<TunnelStatusCpp>& tick,
+                          const std::vector<std::vector<PeerStatsCpp>>& peers,
+                          const std::vector<TunnelHealthEventCpp>& health,
+                          int64_t now_ms) {
+  size_t moved = 0;
+  std::vector<std::string> stale;
+  std::vector<PeerHandshake> handshakes;
+  for (size_t i = 0; i < tick.size() && i < peers.size(); ++i) {
+    if (tick[i].state != TunnelStateCpp::kUp || peers[i].empty()) continue;
+    stale.clear();
+    for (const auto& e : health) {
+      if (e.name == tick[i].name && e.health == TunnelHealthCpp::kStale) {
+        stale.push_back(e.public_key);
+      }
+    }
+    handshakes.clear();
+    for (const auto& p : peers[i]) handshakes.push_back({p.public_key, p.handshake});
+    try {
+      moved += backend->FailOver(tick[i].name, stale, handshakes, now_ms);
+    } catch (const std::exception&) {
+      // Left to the failover engine's retry.
+    }
+  }
+  return moved;
+}
+
+std::vector<UsageQuotaEventCpp> RecordUsage(
+    UsageLedger* ledger, WgBackend* backend,
+    const std::vector<TunnelStatusCpp>& tick,
+    const std::vector<std::vector<PeerStatsCpp>>& peers, int64_t now_ms) {
+  std::vector<UsageQuotaEventCpp> exceeded;
+  if (ledger == nullptr) return exceeded;
+  ledger->Record(tick, peers, now_ms, &exceeded);
+  for (auto& e : exceeded) {
+    try {
+      backend->Stop(e.name);
+      e.stopped = true;
+    } catch (const std::exception&) {
+      // Reported as not stopped; the quota is spent either way.
+    }
+  }
+  return exceeded;
+}
+
+ipc::StatusRecord ToStatusRecord(const TunnelStatusCpp& s) {
+  ipc::StatusRecord r;
+  r.name = s.name;
+  switch (s.state) {
+    case TunnelStateCpp::kUp:     r.state = ipc::kStateUp; break;
+    case TunnelStateCpp::kToggle: r.state = ipc::kStateToggle; break;
+    case TunnelStateCpp::kDown:   r.state = ipc::kStateDown; break;
+  }
+  r.rx = s.rx;
+  r.tx = s.tx;
+  r.handshake_ms = s.handshake;
+  return r;
+}
+
+size_t PublishStatuses(SharedStatusSegment* segment,
+                       const std::vector<TunnelStatusCpp>& tick) {
+  if (segment == nullptr) return 0;
+  FWG_TRACE_SCOPE("poller.publish");
+  std::vector<ipc::StatusRecord> records;
+  records.reserve(tick.size());
+  for (const auto& s : tick) records.push_back(ToStatusRecord(s));
+  return segment->Publish(records);
+}
+
+size_t PublishPollTick(SharedStatusSegment* segment,
+                       const std::vector<TunnelStatusCpp>& tick,
+                       std::vector<ipc::StatusRecord>* unplaced) {
+  if (segment == nullptr) return 0;
+  FWG_TRACE_SCOPE("poller.publish");
+  std::vector<std::string> up;
+  std::vector<ipc::StatusRecord> records;
+  records.reserve(tick.size());
+  for (const auto& s : tick) {
+    if (s.state != TunnelStateCpp::kDown) up.push_back(s.name);
+    records.push_back(ToStatusRecord(s));
+  }
+  segment->Retain(up);
+  return segment->Publish(records, unplaced);
+}
+
+}  // namespace flutter_wireguard
@@ -0,0 +1,80 @@
+// One tick of the status poller, without any GLib.
+//
+// The plugin's one-second timer hands this to a worker thread; the scale
+// simulator (test/scale_sim_test.cc) drives the very same code against a
+// simulated kernel, so what it measures is what the plugin runs.
+#ifndef FLUTTER_WIREGUARD_STATUS_POLLER_H_
+#define FLUTTER_WIREGUARD_STATUS_POLLER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "handshake_monitor.h"
+#include "peer_index.h"
+#include "status_segment.h"
+#include "status_shm.h"
+#include "usage_ledger.h"
+#include "wg_backend.h"
+
+namespace flutter_wireguard {
+
+// Status() for every tunnel the backend knows. Tunnels whose Status()
+// throws are left out of the tick. With `peers`, it also receives each
+// returned tunnel's per-peer counters, index-aligned with the result, and
+// they become the backend's peers() snapshot; `diffs` then receives how
+// each differs from the previous poll's, aligned the same way.
+std::vector<TunnelStatusCpp> PollTunnelStatuses(
+    WgBackend* backend,
+    std::vector<std::vector<PeerStatsCpp>>* peers = nullptr,
+    std::vector<PeerSetDiff>* diffs = nullptr);
+
+// Feeds the per-peer handshakes of every running tunnel in a tick (as
+// returned by PollTunnelStatuses with `peers`) into `monitor` and returns
+// the health changes they cause, in tick order. With the tick's `diffs`, a
+// tunnel whose peers and handshakes did not change is only re-checked
+// against the clock, without handing its peer list over again.
+std::vector<TunnelHealthEventCpp> ObserveHandshakes(
+    HandshakeMonitor* monitor, const std::vector<TunnelStatusCpp>& tick,
+    const std::vector<std::vector<PeerStatsCpp>>& peers, int64_t now_ms,
+    const std::vector<PeerSetDiff>* diffs = nullptr);
+
+// WgBackend::FailOver for every running tunnel in a tick, with the stale
+// events `health` holds for it. Runs in the same poll that saw the peer go
+// stale, so the new endpoint is in place within the poll's own latency. A
+// failed update counts as a move that got no handshake: the peer tries its
+// next candidate after the retry delay. Returns the number of peers moved.
+size_t FailOverStalePeers(WgBackend* backend,
+                          const std::vector<TunnelStatusCpp>& tick,
+                          const std::vector<std::vector<PeerStatsCpp>>& peers,
+                          const std::vector<TunnelHealthEventCpp>& health,
+                          int64_t now_ms);
+
+// Feeds a tick into `ledger` (null: no-op) and stops every tunnel the tick
+// pushed over its quota, in the poll that noticed. Returns the quotas
+// exceeded, each with `stopped` false if its Stop() failed and the tunnel
+// is still up.
+std::vector<UsageQuotaEventCpp> RecordUsage(
+    UsageLedger* ledger, WgBackend* backend,
+    const std::vector<TunnelStatusCpp>& tick,
+    const std::vector<std::vector<PeerStatsCpp>>& peers, int64_t now_ms);
+
+// Segment records use the broker wire values (TunnelStateWire).
+ipc::StatusRecord ToStatusRecord(const TunnelStatusCpp& s);
+
+// Publishes a tick into `segment`; a null segment is a no-op. Returns the
+// number of slots that changed.
+size_t PublishStatuses(SharedStatusSegment* segment,
+                       const std::vector<TunnelStatusCpp>& tick);
+
+// PublishStatuses for a full PollTunnelStatuses tick: first hands the
+// slots of tunnels that have been down since the previous tick back to the
+// segment (see StatusSegmentWriter::Retain), then publishes. Records the
+// segment still has no room for are appended to `unplaced`; their events
+// must go out directly.
+size_t PublishPollTick(SharedStatusSegment* segment,
+                       const std::vector<TunnelStatusCpp>& tick,
+                       std::vector<ipc::StatusRecord>* unplaced);
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_STATUS_POLLER_H_
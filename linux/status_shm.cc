@@ -0,0 +1,140 @@
+#include "status_shm.h"
+
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace flutter_wireguard {
+
+namespace {
+
+std::runtime_error SysError(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+}  // namespace
+
+SharedStatusSegment::SharedStatusSegment(uint32_t capacity)
+    : capacity_(capacity), size_(ipc::StatusSegmentBytes(capacity)) {
+  memfd_ = memfd_create("flutter_wireguard_status",
+                        MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (memfd_ < 0) throw SysError("memfd_create");
+  if (ftruncate(memfd_, static_cast<off_t>(size_)) != 0) {
+    std::runtime_error err = SysError("ftruncate status segment");
+    close(memfd_);
+    throw err;
+  }
+  mem_ = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, memfd_, 0);
+  if (mem_ == MAP_FAILED) {
+    std::runtime_error err = SysError("mmap status segment");
+    close(memfd_);
+    throw err;
+  }
+  // Readers map exactly size_ bytes; a shrink would turn their loads into
+  // SIGBUS, so forbid resizing for everyone, us included. Where supported,
+  // also forbid any *new* writable mapping: our own already exists, and a
+  // client that receives the memfd must not be able to scribble on it.
+  int seals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+#ifdef F_SEAL_FUTURE_WRITE
+  if (fcntl(memfd_, F_ADD_SEALS, seals | F_SEAL_FUTURE_WRITE) != 0)
+#endif
+    fcntl(memfd_, F_ADD_SEALS, seals);
+  eventfd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (eventfd_ < 0) {
+    std::runtime_error err = SysError("eventfd");
+    munmap(mem_, size_);
+    close(memfd_);
+    throw err;
+  }
+  writer_ = std::make_unique<ipc::StatusSegmentWriter>(mem_, size_, capacity_);
+}
+
+SharedStatusSegment::~SharedStatusSegment() {
+  writer_.reset();
+  munmap(mem_, size_);
+  close(memfd_);
+  close(eventfd_);
+}
+
+size_t SharedStatusSegment::Publish(const std::vector<ipc::StatusRecord>& tick,
+                                    std::vector<ipc::StatusRecord>* unplaced) {
+  std::lock_guard<std::mutex> lock(mu_);
+  size_t changed = writer_->Publish(tick, unplaced);
+  if (changed > 0) {
+    uint64_t one = 1;
+    // EAGAIN only if the counter would overflow, i.e. nobody ever reads it.
+    ssize_t n = write(eventfd_, &one, sizeof(one));
+    (void)n;
+  }
+  return changed;
+}
+
+size_t SharedStatusSegment::Retain(const std::vector<std::string>& names) {
+  std::lock_guard<std::mutex> lock(mu_);
+  return writer_->Retain(names);
+}
+
+StatusSegmentView::StatusSegmentView(int memfd, int eventfd)
+    : eventfd_(eventfd) {
+  struct stat st {};
+  if (fstat(memfd, &st) != 0 || st.st_size <= 0) {
+    std::runtime_error err = SysError("fstat status segment");
+    close(memfd);
+    close(eventfd_);
+    throw err;
+  }
+  size_ = static_cast<size_t>(st.st_size);
+  void* mem = mmap(nullptr, size_, PROT_READ, MAP_SHARED, memfd, 0);
+  // The mapping keeps the memory alive; the descriptor is no longer needed.
+  close(memfd);
+  if (mem == MAP_FAILED) {
+    std::runtime_error err = SysError("mmap status segment");
+    close(eventfd_);
+    throw err;
+  }
+  mem_ = mem;
+  try {
+    reader_ = std::make_unique<ipc::StatusSegmentReader>(mem_, size_);
+  } catch (...) {
+    munmap(const_cast<void*>(mem_), size_);
+    close(eventfd_);
+    throw;
+  }
+}
+
+StatusSegmentView::~StatusSegmentView() {
+  reader_.reset();
+  munmap(const_cast<void*>(mem_), size_);
+  close(eventfd_);
+}
+
+bool StatusSegmentView::ConsumeNotification() {
+  uint64_t count = 0;
+  while (true) {
+    ssize_t n = read(eventfd_, &count, sizeof(count));
+    if (n == sizeof(count)) return count > 0;
+    if (n < 0 && errno == EINTR) continue;
+    return false;  // EAGAIN: nothing pending
+  }
+}
+
+std::unique_ptr<StatusSegmentView> MapLocalView(const SharedStatusSegment& seg) {
+  int memfd = fcntl(seg.memfd(), F_DUPFD_CLOEXEC, 0);
+  if (memfd < 0) throw SysError("dup status memfd");
+  int efd = fcntl(seg.eventfd(), F_DUPFD_CLOEXEC, 0);
+  if (efd < 0) {
+    std::runtime_error err = SysError("dup status eventfd");
+    close(memfd);
+    throw err;
+  }
+  return std::make_unique<StatusSegmentView>(memfd, efd);
+}
+
+}  // namespace flutter_wireguard
@@ -0,0 +1,90 @@
+// memfd-backed shared status segment (see cpp/status_segment.h).
+//
+// SharedStatusSegment is the writer: it owns a sealed memfd sized for the
+// slot table plus an eventfd that is bumped whenever a Publish() changed
+// something. Both descriptors can be handed to another process over a Unix
+// socket (SCM_RIGHTS, see kOpMapStatus in cpp/broker_dispatcher.h), where
+// StatusSegmentView maps the memfd read-only. From then on the reader gets
+// counters with plain loads and only touches the kernel to drain the eventfd
+// when it wants change notifications.
+#ifndef FLUTTER_WIREGUARD_STATUS_SHM_H_
+#define FLUTTER_WIREGUARD_STATUS_SHM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "status_segment.h"
+
+namespace flutter_wireguard {
+
+class SharedStatusSegment {
+ public:
+  // Throws std::runtime_error if memfd/eventfd/mmap are unavailable.
+  explicit SharedStatusSegment(uint32_t capacity = ipc::kDefaultStatusSlots);
+  ~SharedStatusSegment();
+
+  SharedStatusSegment(const SharedStatusSegment&) = delete;
+  SharedStatusSegment& operator=(const SharedStatusSegment&) = delete;
+
+  // Thread-safe. Writes the tick and signals the eventfd if any slot
+  // changed. Returns the number of changed slots; records that found no
+  // slot go to `unplaced` (see StatusSegmentWriter::Publish).
+  size_t Publish(const std::vector<ipc::StatusRecord>& tick,
+                 std::vector<ipc::StatusRecord>* unplaced = nullptr);
+
+  // Thread-safe. Frees the slots of tunnels not in `names`.
+  size_t Retain(const std::vector<std::string>& names);
+
+  int memfd() const { return memfd_; }
+  int eventfd() const { return eventfd_; }
+  size_t size() const { return size_; }
+  uint32_t capacity() const { return capacity_; }
+
+ private:
+  uint32_t capacity_;
+  size_t size_;
+  int memfd_ = -1;
+  int eventfd_ = -1;
+  void* mem_ = nullptr;
+  std::mutex mu_;  // single-writer guarantee for the seqlock
+  std::unique_ptr<ipc::StatusSegmentWriter> writer_;
+};
+
+// Read-only mapping of a segment. Takes ownership of both descriptors.
+class StatusSegmentView {
+ public:
+  // Throws std::runtime_error if the memfd can't be mapped or doesn't hold a
+  // compatible segment.
+  StatusSegmentView(int memfd, int eventfd);
+  ~StatusSegmentView();
+
+  StatusSegmentView(const StatusSegmentView&) = delete;
+  StatusSegmentView& operator=(const StatusSegmentView&) = delete;
+
+  const ipc::StatusSegmentReader& reader() const { return *reader_; }
+
+  // Non-blocking; poll/GLib-watch this for POLLIN.
+  int eventfd() const { return eventfd_; }
+
+  // Drains the eventfd. Returns false if no Publish() happened since the
+  // last call.
+  bool ConsumeNotification();
+
+ private:
+  int eventfd_ = -1;
+  const void* mem_ = nullptr;
+  size_t size_ = 0;
+  std::unique_ptr<ipc::StatusSegmentReader> reader_;
+};
+
+// Convenience for the in-process case: a view over dup()s of the owner's
+// descriptors, i.e. exactly what a remote process would get.
+std::unique_ptr<StatusSegmentView> MapLocalView(const SharedStatusSegment& seg);
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_STATUS_SHM_H_
@@ -0,0 +1,176 @@
+#include <arpa/inet.h>
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "allowed_ips.h"
+
+using flutter_wireguard::AllowedIpsTable;
+using flutter_wireguard::IpKey;
+using flutter_wireguard::ParseIpAddress;
+using flutter_wireguard::ParseIpPrefix;
+using flutter_wireguard::PrefixTrie;
+
+namespace {
+
+std::string LookupOrEmpty(const AllowedIpsTable& t, const std::string& ip) {
+  const std::string* k = t.Lookup(ip);
+  return k != nullptr ? *k : std::string();
+}
+
+}  // namespace
+
+TEST(ParseIpAddress, AgreesWithInetPton) {
+  const char* cases[] = {
+      "0.0.0.0", "10.1.2.3", "255.255.255.255", "1.2.3", "1.2.3.4.5", "256.1.1.1",
+      "01.2.3.4", "1..2.3", "", "::", "::1", "fd00::", "fd00::1:2", "1:2:3:4:5:6:7:8",
+      "1:2:3:4:5:6:7::", "::2:3:4:5:6:7:8", "1::8", "::ffff:10.0.0.1",
+      "64:ff9b::192.0.2.33", "1:2:3:4:5:6:7:8:9", "1:2:3:4:5:6:7", ":1::", "1::2::3",
+      "12345::", "g::", "1:", "fe80::1%eth0", "::1.2.3", "1:2:3:4:5:6:7:1.2.3.4",
+  };
+  for (const char* s : cases) {
+    IpKey key;
+    bool v6 = false;
+    uint8_t want[16];
+    const bool want4 = inet_pton(AF_INET, s, want) == 1;
+    const bool want6 = !want4 && inet_pton(AF_INET6, s, want) == 1;
+    ASSERT_EQ(ParseIpAddress(s, &key, &v6), want4 || want6) << s;
+    if (!want4 && !want6) continue;
+    EXPECT_EQ(v6, want6) << s;
+    uint8_t got[16] = {};
+    for (int i = 0; i < 8; ++i) {
+      got[i] = static_cast<uint8_t>(key.hi >> (56 - 8 * i));
+      got[8 + i] = static_cast<uint8_t>(key.lo >> (56 - 8 * i));
+    }
+    EXPECT_EQ(std::memcmp(got, want, want6 ? 16 : 4), 0) << s;
+  }
+}
+
+TEST(ParseIpPrefix, MasksHostBitsAndDefaultsToHostRoute) {
+  IpKey key, want;
+  uint8_t bits;
+  bool v6;
+  ASSERT_TRUE(ParseIpPrefix("10.1.2.3/8", &key, &bits, &v6));
+  ASSERT_TRUE(ParseIpAddress("10.0.0.0", &want, &v6));
+  EXPECT_EQ(bits, 8);
+  EXPECT_TRUE(key == want);
+  ASSERT_TRUE(ParseIpPrefix("fd00::1", &key, &bits, &v6));
+  EXPECT_EQ(bits, 128);
+  EXPECT_TRUE(v6);
+  ASSERT_TRUE(ParseIpPrefix("0.0.0.0/0", &key, &bits, &v6));
+  EXPECT_EQ(bits, 0);
+  EXPECT_FALSE(ParseIpPrefix("10.0.0.0/33", &key, &bits, &v6));
+  EXPECT_FALSE(ParseIpPrefix("::/129", &key, &bits, &v6));
+  EXPECT_FALSE(ParseIpPrefix("10.0.0.0/", &key, &bits, &v6));
+  EXPECT_FALSE(ParseIpPrefix("10.0.0.0/8x", &key, &bits, &v6));
+}
+
+TEST(AllowedIpsTable, LongestPrefixWinsAcrossPeers) {
+  auto t = AllowedIpsTable::FromConfig(
+      "[Interface]\nPrivateKey = x\nAddress = 10.9.0.2/32\n"
+      "[Peer]\nPublicKey = A\nAllowedIPs = 0.0.0.0/0, ::/0\n"
+      "[Peer]\nPublicKey = B\nAllowedIPs = 10.0.0.0/8\n"
+      "AllowedIPs = fd00::/16  # second line accumulates\n"
+      "[peer]\npublickey = C\nallowedips = 10.1.0.0/16,10.1.2.3/32\n");
+  EXPECT_EQ(t.peer_count(), 3u);
+  EXPECT_EQ(t.prefix_count(), 6u);
+  EXPECT_EQ(LookupOrEmpty(t, "8.8.8.8"), "A");
+  EXPECT_EQ(LookupOrEmpty(t, "10.200.0.1"), "B");
+  EXPECT_EQ(LookupOrEmpty(t, "10.1.9.9"), "C");
+  EXPECT_EQ(LookupOrEmpty(t, "10.1.2.3"), "C");
+  EXPECT_EQ(LookupOrEmpty(t, "fd00:1::5"), "B");
+  EXPECT_EQ(LookupOrEmpty(t, "2001:db8::1"), "A");
+  // The Interface's Address is not a route.
+  EXPECT_EQ(LookupOrEmpty(t, "10.9.0.2"), "B");
+  EXPECT_THROW(t.Lookup("example.com"), std::invalid_argument);
+}
+
+TEST(AllowedIpsTable, NoCoverIsNull) {
+  auto t = AllowedIpsTable::FromConfig(
+      "[Peer]\nPublicKey = A\nAllowedIPs = 192.168.0.0/24\n");
+  EXPECT_EQ(t.Lookup("192.168.1.1"), nullptr);
+  EXPECT_EQ(t.Lookup("::1"), nullptr);
+}
+
+TEST(AllowedIpsTable, DuplicatePrefixGoesToLaterPeerAndSetPeerMovesIt) {
+  auto t = AllowedIpsTable::FromConfig(
+      "[Peer]\nPublicKey = A\nAllowedIPs = 10.0.0.0/24\n"
+      "[Peer]\nPublicKey = B\nAllowedIPs = 10.0.0.0/24\n");
+  EXPECT_EQ(LookupOrEmpty(t, "10.0.0.1"), "B");
+
+  t.SetPeer("A", {"10.0.0.0/24"});
+  EXPECT_EQ(LookupOrEmpty(t, "10.0.0.1"), "A");
+  // B lost it for good: removing A doesn't hand it back.
+  EXPECT_TRUE(t.RemovePeer("A"));
+  EXPECT_EQ(t.Lookup("10.0.0.1"), nullptr);
+  EXPECT_FALSE(t.RemovePeer("A"));
+  EXPECT_THROW(t.SetPeer("D", {"10.0.0.0/99"}), std::invalid_argument);
+  EXPECT_THROW(AllowedIpsTable::FromConfig("[Peer]\nPublicKey = A\nAllowedIPs = x\n"),
+               std::invalid_argument);
+}
+
+// Random prefixes of every length against a linear longest-match scan, so
+// prefixes ending mid-node, exactly on a node boundary and nested inside
+// each other all get exercised.
+TEST(PrefixTrie, MatchesLinearScan) {
+  using flutter_wireguard::allowed_ips_internal::Masked;
+  std::mt19937_64 rng(7);
+  for (bool v6 : {false, true}) {
+    const int max_bits = v6 ? 128 : 32;
+    struct Entry { IpKey key; int bits; int32_t value; };
+    std::vector<Entry> entries;
+    std::vector<flutter_wireguard::PrefixEntry> input;
+    // Shared top bits so prefixes nest and collide.
+    auto random_key = [&] {
+      IpKey k{(rng() & 0x0000ffffffffffffULL) | 0x2001000000000000ULL, rng()};
+      if (!v6) k = IpKey{k.hi >> 32 << 32, 0};
+      return k;
+    };
+    for (int32_t i = 0; i < 3000; ++i) {
+      const int bits = static_cast<int>(rng() % (max_bits + 1));
+      const IpKey k = Masked(random_key(), bits);
+      input.push_back({k, static_cast<uint8_t>(bits), i});
+      bool replaced = false;
+      for (auto& e : entries) {
+        if (e.key == k && e.bits == bits) {
+          e.value = i;
+          replaced = true;
+        }
+      }
+      if (!replaced) entries.push_back({k, bits, i});
+    }
+    const PrefixTrie trie(max_bits, input);
+    EXPECT_EQ(trie.size(), entries.size());
+    for (int q = 0; q < 3000; ++q) {
+      IpKey probe = random_key();
+      if (q % 2 == 0) {
+        // Inside a known prefix, with random host bits.
+        const Entry& e = entries[rng() % entries.size()];
+        const IpKey host = random_key();
+        probe = IpKey{e.key.hi | (host.hi & ~Masked(IpKey{~0ULL, ~0ULL}, e.bits).hi),
+                      e.key.lo | (host.lo & ~Masked(IpKey{~0ULL, ~0ULL}, e.bits).lo)};
+        probe = Masked(probe, max_bits);
+      }
+      int best_bits = -1;
+      int32_t want = -1;
+      for (const auto& e : entries) {
+        if (e.bits > best_bits && Masked(probe, e.bits) == e.key) {
+          best_bits = e.bits;
+          want = e.value;
+        }
+      }
+      ASSERT_EQ(trie.Lookup(probe), want) << (v6 ? "v6" : "v4") << " probe " << q;
+    }
+  }
+}
+
+TEST(PrefixTrie, EmptyAndDefaultRoute) {
+  EXPECT_EQ(PrefixTrie(32).Lookup(IpKey{}), -1);
+  const PrefixTrie v6(128, {{IpKey{}, 0, 4}});
+  EXPECT_EQ(v6.Lookup(IpKey{~0ULL, ~0ULL}), 4);
+  EXPECT_EQ(v6.Lookup(IpKey{}), 4);
+}
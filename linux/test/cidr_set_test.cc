@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cidr_set.h"
+
+using flutter_wireguard::CidrPrefix;
+using flutter_wireguard::CidrSet;
+using flutter_wireguard::FormatIpPrefix;
+using flutter_wireguard::IpKey;
+
+namespace {
+
+using Strings = std::vector<std::string>;
+
+Strings Compute(const Strings& include, const Strings& exclude) {
+  return CidrSet::Parse(include).Subtract(CidrSet::Parse(exclude)).ToStrings();
+}
+
+// Whether `set` holds the IPv4 address `a`, by scanning its prefixes.
+bool Holds(const std::vector<CidrPrefix>& set, uint32_t a) {
+  const IpKey k{uint64_t{a} << 32, 0};
+  for (const auto& p : set) {
+    if (!p.v6 && flutter_wireguard::allowed_ips_internal::Masked(k, p.bits) == p.key) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+TEST(FormatIpPrefix, ShortensTheLongestZeroRun) {
+  const char* cases[] = {
+      "0.0.0.0/0", "10.1.2.3/32", "255.255.255.255/32", "::/0", "::1/128",
+      "fd00::/8", "2001:db8::1:0:0:1/128", "2001:db8:0:1:1:1:1:1/128",
+      "1:0:0:2:0:0:0:3/128", "1:2:3:4:5:6:7:8/128", "0:1::/32",
+  };
+  const char* want[] = {
+      "0.0.0.0/0", "10.1.2.3/32", "255.255.255.255/32", "::/0", "::1/128",
+      "fd00::/8", "2001:db8::1:0:0:1/128", "2001:db8:0:1:1:1:1:1/128",
+      "1:0:0:2::3/128", "1:2:3:4:5:6:7:8/128", "0:1::/32",
+  };
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+    CidrPrefix p;
+    ASSERT_TRUE(flutter_wireguard::ParseIpPrefix(cases[i], &p.key, &p.bits, &p.v6)) << cases[i];
+    EXPECT_EQ(FormatIpPrefix(p), want[i]);
+  }
+}
+
+TEST(CidrSet, AggregatesToTheFewestPrefixes) {
+  EXPECT_EQ(CidrSet::Parse({"10.0.0.0/25", "10.0.0.128/25", "10.0.1.0/24", "10.0.0.7",
+                            "10.0.2.0/23", " 192.168.1.9/24 "})
+                .ToStrings(),
+            (Strings{"10.0.0.0/22", "192.168.1.0/24"}));
+  EXPECT_EQ(CidrSet::Parse({"0.0.0.0/1", "128.0.0.0/1", "::/1", "8000::/1"}).ToStrings(),
+            (Strings{"0.0.0.0/0", "::/0"}));
+  // Adjacent but not alignable: 10.0.1.0/24 + 10.0.2.0/24 is not a /23.
+  EXPECT_EQ(CidrSet::Parse({"10.0.1.0/24", "10.0.2.0/24"}).ToStrings(),
+            (Strings{"10.0.1.0/24", "10.0.2.0/24"}));
+  EXPECT_TRUE(CidrSet::Parse({}).empty());
+  EXPECT_THROW(CidrSet::Parse({"10.0.0.0/8", "lan"}), std::invalid_argument);
+}
+
+TEST(CidrSet, EverythingExceptTheLan) {
+  EXPECT_EQ(Compute({"0.0.0.0/0"}, {"192.168.0.0/16"}),
+            (Strings{"0.0.0.0/1", "128.0.0.0/2", "192.0.0.0/9", "192.128.0.0/11",
+                     "192.160.0.0/13", "192.169.0.0/16", "192.170.0.0/15",
+                     "192.172.0.0/14", "192.176.0.0/12", "192.192.0.0/10",
+                     "193.0.0.0/8", "194.0.0.0/7", "196.0.0.0/6", "200.0.0.0/5",
+                     "208.0.0.0/4", "224.0.0.0/3"}));
+  const Strings all_but_private = Compute(
+      {"0.0.0.0/0", "::/0"},
+      {"10.0.0.0/8", "172.16.0.0/12", "192.168.0.0/16", "127.0.0.0/8", "169.254.0.0/16",
+       "fc00::/7", "fe80::/10"});
+  EXPECT_EQ(all_but_private.size(), 54u);
+  EXPECT_EQ(all_but_private.front(), "0.0.0.0/5");
+  EXPECT_EQ(all_but_private.back(), "ff00::/8");
+  // Excluding everything, or nothing to start from.
+  EXPECT_TRUE(Compute({"10.0.0.0/8"}, {"0.0.0.0/0"}).empty());
+  EXPECT_TRUE(Compute({}, {"10.0.0.0/8"}).empty());
+  // Families don't mix.
+  EXPECT_EQ(Compute({"10.0.0.0/8"}, {"::/0"}), (Strings{"10.0.0.0/8"}));
+  // Edges of the address space.
+  EXPECT_EQ(Compute({"::/0"}, {"::/128", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"}).size(),
+            254u);
+}
+
+TEST(CidrSet, UnionThenSubtractMatchesAnAddressScan) {
+  // Prefixes inside 10.0.0.0/16 so a scan of all 65536 addresses is exact.
+  std::mt19937 rng(3);
+  auto random_prefixes = [&](int n) {
+    Strings out;
+    for (int i = 0; i < n; ++i) {
+      const uint32_t a = 0x0a000000u | (rng() & 0xffff);
+      const int bits = 16 + static_cast<int>(rng() % 17);
+      out.push_back("10.0." + std::to_string(a >> 8 & 0xff) + "." + std::to_string(a & 0xff) +
+                    "/" + std::to_string(bits));
+    }
+    return out;
+  };
+  for (int round = 0; round < 20; ++round) {
+    const Strings a = random_prefixes(40), b = random_prefixes(40), c = random_prefixes(40);
+    const auto sa = CidrSet::Parse(a).Prefixes(), sb = CidrSet::Parse(b).Prefixes(),
+               sc = CidrSet::Parse(c).Prefixes();
+    const auto got =
+        CidrSet::Parse(a).Union(CidrSet::Parse(b)).Subtract(CidrSet::Parse(c)).Prefixes();
+    for (uint32_t host = 0; host < 65536; ++host) {
+      const uint32_t addr = 0x0a000000u | host;
+      const bool want = (Holds(sa, addr) || Holds(sb, addr)) && !Holds(sc, addr);
+      ASSERT_EQ(Holds(got, addr), want) << "round " << round << " address " << host;
+    }
+    // Minimal: no two outputs can merge into one prefix.
+    const auto again = CidrSet::FromPrefixes(got).Prefixes();
+    EXPECT_EQ(again.size(), got.size());
+    for (size_t i = 1; i < got.size(); ++i) {
+      const bool siblings = got[i].bits == got[i - 1].bits &&
+                            flutter_wireguard::allowed_ips_internal::Masked(
+                                got[i].key, got[i].bits - 1) == got[i - 1].key;
+      EXPECT_FALSE(siblings) << FormatIpPrefix(got[i - 1]) << " " << FormatIpPrefix(got[i]);
+    }
+  }
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "dns_plan.h"
+
+using flutter_wireguard::DnsPlan;
+using flutter_wireguard::TakeOverDns;
+
+TEST(TakeOverDns, SplitsServersFromSearchDomains) {
+  std::string config =
+      "[Interface]\nPrivateKey = k\nDNS = 10.9.0.1, fd00::53,corp.example\n"
+      "dns = lab.example  # a second line adds to the first\n"
+      "[Peer]\nPublicKey = p\nAllowedIPs = 0.0.0.0/0\n";
+  DnsPlan plan;
+  ASSERT_TRUE(TakeOverDns(config, &config, &plan));
+  EXPECT_EQ(config,
+            "[Interface]\nPrivateKey = k\n"
+            "[Peer]\nPublicKey = p\nAllowedIPs = 0.0.0.0/0\n");
+  ASSERT_EQ(plan.servers.size(), 2u);
+  EXPECT_FALSE(plan.servers[0].v6);
+  EXPECT_EQ(plan.servers[0].address.hi, uint64_t{0x0a090001} << 32);
+  EXPECT_TRUE(plan.servers[1].v6);
+  EXPECT_EQ(plan.domains, (std::vector<std::string>{"corp.example", "lab.example"}));
+}
+
+TEST(TakeOverDns, LeavesConfigsWithoutDnsOrWithHooksAlone) {
+  std::string out = "unchanged";
+  DnsPlan plan;
+  EXPECT_FALSE(TakeOverDns("[Interface]\nPrivateKey = k\n[Peer]\n", &out, &plan));
+  EXPECT_FALSE(TakeOverDns("[Interface]\nDNS = 1.1.1.1\nPostUp = resolvectl dns %i 9.9.9.9\n",
+                           &out, &plan));
+  // DNS in a [Peer] section is not wg-quick's DNS.
+  EXPECT_FALSE(TakeOverDns("[Interface]\n[Peer]\nDNS = 1.1.1.1\n", &out, &plan));
+  EXPECT_EQ(out, "unchanged");
+}
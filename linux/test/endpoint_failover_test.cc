@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "endpoint_failover.h"
+
+namespace flutter_wireguard {
+namespace {
+
+constexpr int64_t kT0 = 1700000000000;  // epoch ms
+constexpr int64_t kRetry = EndpointFailover::kRetryAfterMs;
+
+void Track(EndpointFailover* f, std::vector<std::string> a) {
+  f->Track("wg0", {{"A", std::move(a)}, {"B", {"b:1"}}});
+}
+
+TEST(EndpointFailover, StaleMovesToTheNextCandidateAtOnce) {
+  EndpointFailover f;
+  Track(&f, {"a1:1", "a2:1", "a3:1"});
+  EXPECT_EQ(f.Current("wg0", "A"), "a1:1");
+  EXPECT_EQ(f.Current("wg0", "B"), "");  // a single endpoint has no failover
+
+  EXPECT_TRUE(f.Next("wg0", {}, {{"A", kT0}}, kT0 + 1000).empty());
+  auto moves = f.Next("wg0", {"A", "B"}, {{"A", kT0}, {"B", kT0}}, kT0 + 2000);
+  ASSERT_EQ(moves.size(), 1u);
+  EXPECT_EQ(moves[0].public_key, "A");
+  EXPECT_EQ(moves[0].endpoint, "a2:1");
+  EXPECT_EQ(f.Current("wg0", "A"), "a2:1");
+
+  // a2 answers: it stays there.
+  EXPECT_TRUE(f.Next("wg0", {}, {{"A", kT0 + 2500}}, kT0 + 2000 + 10 * kRetry).empty());
+  EXPECT_EQ(f.Current("wg0", "A"), "a2:1");
+}
+
+TEST(EndpointFailover, SilentCandidatesGiveWayAndOnePassEndsWhereItStarted) {
+  EndpointFailover f;
+  Track(&f, {"a1:1", "a2:1", "a3:1"});
+  const std::vector<PeerHandshake> old = {{"A", kT0}};
+  ASSERT_EQ(f.Next("wg0", {"A"}, old, kT0 + 1000).size(), 1u);  // a2
+  EXPECT_TRUE(f.Next("wg0", {}, old, kT0 + 1000 + kRetry - 1).empty());
+  auto moves = f.Next("wg0", {}, old, kT0 + 1000 + kRetry);
+  ASSERT_EQ(moves.size(), 1u);
+  EXPECT_EQ(moves[0].endpoint, "a3:1");
+  moves = f.Next("wg0", {}, old, kT0 + 1000 + 2 * kRetry);
+  ASSERT_EQ(moves.size(), 1u);
+  EXPECT_EQ(moves[0].endpoint, "a1:1");
+  // Every candidate tried once: an idle peer is left alone.
+  EXPECT_TRUE(f.Next("wg0", {}, old, kT0 + 1000 + 10 * kRetry).empty());
+
+  // Stale again (after a recovery) starts a new pass.
+  moves = f.Next("wg0", {"A"}, {{"A", kT0 + 50000}}, kT0 + 500000);
+  ASSERT_EQ(moves.size(), 1u);
+  EXPECT_EQ(moves[0].endpoint, "a2:1");
+}
+
+TEST(EndpointFailover, ForgetAndUntrackedTunnelsMoveNothing) {
+  EndpointFailover f;
+  Track(&f, {"a1:1", "a2:1"});
+  EXPECT_TRUE(f.Next("wg1", {"A"}, {}, kT0).empty());
+  f.Forget("wg0");
+  EXPECT_TRUE(f.Next("wg0", {"A"}, {}, kT0).empty());
+  EXPECT_EQ(f.Current("wg0", "A"), "");
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "endpoint_resolver.h"
+
+using flutter_wireguard::CandidateEndpoints;
+using flutter_wireguard::EndpointResolver;
+using flutter_wireguard::HostResolver;
+using flutter_wireguard::IsNumericEndpoint;
+using flutter_wireguard::NamedEndpoints;
+using flutter_wireguard::SplitEndpoint;
+using flutter_wireguard::WithNumericEndpoints;
+using flutter_wireguard::WithPrimaryEndpoints;
+
+namespace {
+
+// Answers from a table, optionally slowly, and records what it was asked
+// and how many lookups overlapped.
+class StubResolver : public HostResolver {
+ public:
+  std::map<std::string, std::string> answers;  // "host:port" -> numeric
+  std::chrono::milliseconds delay{0};
+  std::mutex mu;
+  std::vector<std::string> asked;
+  int in_flight = 0;
+  int max_in_flight = 0;
+
+  std::string Resolve(const std::string& host, const std::string& port) override {
+    {
+      std::lock_guard<std::mutex> lock(mu);
+      max_in_flight = std::max(max_in_flight, ++in_flight);
+    }
+    std::this_thread::sleep_for(delay);
+    std::lock_guard<std::mutex> lock(mu);
+    --in_flight;
+    asked.push_back(host);
+    auto it = answers.find(host + ":" + port);
+    if (it == answers.end()) throw std::runtime_error(host + ": not found");
+    return it->second;
+  }
+};
+
+}  // namespace
+
+TEST(SplitEndpoint, HandlesBracketedIpv6AndRejectsMissingPort) {
+  std::string host, port;
+  ASSERT_TRUE(SplitEndpoint("vpn.example.com:51820", &host, &port));
+  EXPECT_EQ(host, "vpn.example.com");
+  EXPECT_EQ(port, "51820");
+  ASSERT_TRUE(SplitEndpoint("[2001:db8::1]:443", &host, &port));
+  EXPECT_EQ(host, "2001:db8::1");
+  EXPECT_EQ(port, "443");
+  EXPECT_FALSE(SplitEndpoint("vpn.example.com", &host, &port));
+  EXPECT_FALSE(SplitEndpoint("[2001:db8::1]", &host, &port));
+  EXPECT_FALSE(SplitEndpoint("host:", &host, &port));
+
+  EXPECT_TRUE(IsNumericEndpoint("192.0.2.1:51820"));
+  EXPECT_TRUE(IsNumericEndpoint("[2001:db8::1]:51820"));
+  EXPECT_FALSE(IsNumericEndpoint("vpn.example.com:51820"));
+}
+
+TEST(NamedEndpoints, FindsHostnamesAndRewritesOnlyThose) {
+  const std::string config =
+      "[Interface]\nPrivateKey = k\nListenPort = 51820\n"
+      "[Peer]\nEndpoint = a.example:51820  # comment\nPublicKey = A\n"
+      "[Peer]\nPublicKey = B\nEndpoint = 192.0.2.9:51820\n"
+      "[peer]\npublickey = C\nendpoint = [2001:db8::9]:1\n"
+      "[Peer]\nPublicKey = D\nEndpoint = b.example:443\n"
+      "[Peer]\nPublicKey = E\nEndpoint = unresolvable.example:1";
+  const auto named = NamedEndpoints(config);
+  ASSERT_EQ(named.size(), 3u);
+  EXPECT_EQ(named[0].public_key, "A");
+  EXPECT_EQ(named[0].endpoint, "a.example:51820");
+  EXPECT_EQ(named[1].public_key, "D");
+  EXPECT_EQ(named[2].endpoint, "unresolvable.example:1");
+
+  EXPECT_EQ(WithNumericEndpoints(config, {{"a.example:51820", "198.51.100.1:51820"},
+                                          {"b.example:443", "[2001:db8::2]:443"}}),
+            "[Interface]\nPrivateKey = k\nListenPort = 51820\n"
+            "[Peer]\nEndpoint = 198.51.100.1:51820\nPublicKey = A\n"
+            "[Peer]\nPublicKey = B\nEndpoint = 192.0.2.9:51820\n"
+            "[peer]\npublickey = C\nendpoint = [2001:db8::9]:1\n"
+            "[Peer]\nPublicKey = D\nEndpoint = [2001:db8::2]:443\n"
+            "[Peer]\nPublicKey = E\nEndpoint = unresolvable.example:1");
+}
+
+TEST(CandidateEndpoints, ListsOnlyPeersWithSeveralAndKeepsTheFirstForWg) {
+  const std::string config =
+      "[Interface]\nPrivateKey = k\n"
+      "[Peer]\nPublicKey = A\nEndpoint = a.example:51820 , [2001:db8::1]:51820,192.0.2.7:1\n"
+      "[Peer]\nEndpoint = b.example:51820\nPublicKey = B\n"
+      "[Peer]\nendpoint = c.example:1, c2.example:1  # backup\npublickey = C\n";
+  const auto candidates = CandidateEndpoints(config);
+  ASSERT_EQ(candidates.size(), 2u);
+  EXPECT_EQ(candidates.at("A"),
+            (std::vector<std::string>{"a.example:51820", "[2001:db8::1]:51820",
+                                      "192.0.2.7:1"}));
+  EXPECT_EQ(candidates.at("C"), (std::vector<std::string>{"c.example:1", "c2.example:1"}));
+
+  const std::string primary = WithPrimaryEndpoints(config);
+  EXPECT_EQ(primary,
+            "[Interface]\nPrivateKey = k\n"
+            "[Peer]\nPublicKey = A\nEndpoint = a.example:51820\n"
+            "[Peer]\nEndpoint = b.example:51820\nPublicKey = B\n"
+            "[Peer]\nEndpoint = c.example:1\npublickey = C\n");
+  EXPECT_TRUE(CandidateEndpoints(primary).empty());
+  EXPECT_EQ(NamedEndpoints(primary).size(), 3u);
+}
+
+TEST(EndpointResolver, ResolvesDistinctNamesConcurrently) {
+  auto stub = std::make_unique<StubResolver>();
+  StubResolver* s = stub.get();
+  std::vector<std::string> endpoints;
+  for (int i = 0; i < 8; ++i) {
+    const std::string e = "s" + std::to_string(i) + ".example:51820";
+    s->answers[e] = "192.0.2." + std::to_string(i) + ":51820";
+    endpoints.push_back(e);
+    endpoints.push_back(e);  // asked once regardless
+  }
+  endpoints.push_back("192.0.2.200:1");  // nothing to resolve
+  s->delay = std::chrono::milliseconds(50);
+  EndpointResolver resolver(std::move(stub));
+
+  const auto start = std::chrono::steady_clock::now();
+  const auto numeric = resolver.Resolve(endpoints);
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(numeric.size(), 8u);
+  EXPECT_EQ(numeric.at("s3.example:51820"), "192.0.2.3:51820");
+  EXPECT_EQ(s->asked.size(), 8u);
+  EXPECT_GT(s->max_in_flight, 1);
+  // Serially this is 400 ms.
+  EXPECT_LT(elapsed, std::chrono::milliseconds(300));
+}
+
+TEST(EndpointResolver, CachesForTheTtlAndFreshBypassesIt) {
+  auto stub = std::make_unique<StubResolver>();
+  StubResolver* s = stub.get();
+  s->answers["vpn.example:51820"] = "192.0.2.1:51820";
+  auto now = std::chrono::steady_clock::time_point();
+  EndpointResolver resolver(std::move(stub), std::chrono::seconds(30),
+                            [&] { return now; });
+
+  EXPECT_EQ(resolver.Resolve({"vpn.example:51820"}).size(), 1u);
+  now += std::chrono::seconds(29);
+  EXPECT_EQ(resolver.Resolve({"vpn.example:51820"}).at("vpn.example:51820"),
+            "192.0.2.1:51820");
+  EXPECT_EQ(resolver.lookups(), 1u);
+
+  s->answers["vpn.example:51820"] = "192.0.2.2:51820";
+  EXPECT_EQ(resolver.Resolve({"vpn.example:51820"}, /*fresh=*/true).at("vpn.example:51820"),
+            "192.0.2.2:51820");
+  EXPECT_EQ(resolver.lookups(), 2u);
+
+  now += std::chrono::seconds(31);
+  resolver.Resolve({"vpn.example:51820"});
+  EXPECT_EQ(resolver.lookups(), 3u);
+
+  // Failures are not cached: the next call asks again.
+  EXPECT_TRUE(resolver.Resolve({"gone.example:1"}).empty());
+  EXPECT_TRUE(resolver.Resolve({"gone.example:1"}).empty());
+  EXPECT_EQ(resolver.lookups(), 5u);
+}
+
+TEST(EndpointResolver, ResolveConfigsSharesOneFanOut) {
+  auto stub = std::make_unique<StubResolver>();
+  StubResolver* s = stub.get();
+  s->answers["vpn.example:51820"] = "192.0.2.1:51820";
+  EndpointResolver resolver(std::move(stub));
+  std::string a = "[Peer]\nPublicKey = A\nEndpoint = vpn.example:51820\n";
+  std::string b = "[Peer]\nPublicKey = B\nEndpoint = vpn.example:51820\n";
+  const auto numeric = resolver.ResolveConfigs({&a, &b});
+  EXPECT_EQ(numeric.size(), 1u);
+  EXPECT_EQ(a, "[Peer]\nPublicKey = A\nEndpoint = 192.0.2.1:51820\n");
+  EXPECT_EQ(b, "[Peer]\nPublicKey = B\nEndpoint = 192.0.2.1:51820\n");
+  EXPECT_EQ(s->asked.size(), 1u);
+}
+
+// localhost comes from /etc/hosts (or nss-myhostname), never the network.
+TEST(SystemHostResolver, ResolvesLocalhostNumerically) {
+  auto resolver = flutter_wireguard::SystemHostResolver();
+  const std::string e = resolver->Resolve("localhost", "51820");
+  EXPECT_TRUE(e == "127.0.0.1:51820" || e == "[::1]:51820") << e;
+  EXPECT_EQ(resolver->Resolve("192.0.2.1", "1"), "192.0.2.1:1");
+  EXPECT_THROW(resolver->Resolve("localhost", "no-such-service"), std::runtime_error);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "handshake_monitor.h"
+#include "phase_timer.h"
+
+namespace flutter_wireguard {
+namespace {
+
+constexpr int64_t kT0 = 1700000000000;  // epoch ms
+constexpr int64_t kStale = HandshakeMonitor::kDefaultStaleAfterMs;
+
+std::vector<TunnelHealthEventCpp> Observe(HandshakeMonitor* m,
+                                          const std::vector<PeerHandshake>& peers,
+                                          int64_t now) {
+  std::vector<TunnelHealthEventCpp> out;
+  m->Observe("wg0", peers, now, &out);
+  return out;
+}
+
+TEST(HandshakeMonitor, ConnectedStaleRecoveredFireOnceEach) {
+  HandshakeMonitor m;
+  m.Started("wg0", kT0);
+
+  EXPECT_TRUE(Observe(&m, {{"A", 0}}, kT0 + 1000).empty());
+  auto events = Observe(&m, {{"A", kT0 + 1500}}, kT0 + 2000);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].name, "wg0");
+  EXPECT_EQ(events[0].public_key, "A");
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kConnected);
+  EXPECT_EQ(events[0].handshake_ms, kT0 + 1500);
+  EXPECT_TRUE(Observe(&m, {{"A", kT0 + 1500}}, kT0 + 3000).empty());
+
+  // The tick the age reaches the threshold, not a tick later.
+  EXPECT_TRUE(Observe(&m, {{"A", kT0 + 1500}}, kT0 + 1500 + kStale - 1).empty());
+  events = Observe(&m, {{"A", kT0 + 1500}}, kT0 + 1500 + kStale);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kStale);
+  EXPECT_TRUE(Observe(&m, {{"A", kT0 + 1500}}, kT0 + 2 * kStale).empty());
+
+  const int64_t again = kT0 + 2 * kStale + 10;
+  events = Observe(&m, {{"A", again}}, again + 5);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kRecovered);
+  EXPECT_EQ(events[0].handshake_ms, again);
+}
+
+TEST(HandshakeMonitor, PeerThatNeverHandshakesGoesStaleAfterStart) {
+  HandshakeMonitor m;
+  m.SetStaleAfter(5000);
+  m.Started("wg0", kT0);
+  EXPECT_EQ(Observe(&m, {{"A", 0}, {"B", kT0 + 100}}, kT0 + 4999).size(), 1u);  // B
+  auto events = Observe(&m, {{"A", 0}, {"B", kT0 + 100}}, kT0 + 5000);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].public_key, "A");
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kStale);
+  EXPECT_EQ(events[0].handshake_ms, 0);
+
+  // A peer that was never connected is "connected" when it finally is.
+  events = Observe(&m, {{"A", kT0 + 6000}, {"B", kT0 + 6000}}, kT0 + 6000);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kConnected);
+}
+
+TEST(HandshakeMonitor, HandshakesFromBeforeARestartDoNotCount) {
+  HandshakeMonitor m;
+  m.Started("wg0", kT0);
+  EXPECT_EQ(Observe(&m, {{"A", kT0 + 10}}, kT0 + 20).size(), 1u);
+  m.Stopped("wg0");
+  m.Started("wg0", kT0 + 1000);
+  EXPECT_TRUE(Observe(&m, {{"A", kT0 + 10}}, kT0 + 1100).empty());
+  auto events = Observe(&m, {{"A", kT0 + 1200}}, kT0 + 1300);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kConnected);
+}
+
+TEST(HandshakeMonitor, AdoptedTunnelsUseTheHandshakesTheyHave) {
+  HandshakeMonitor m;
+  auto events = Observe(&m, {{"A", kT0 - 1000}, {"B", kT0 - kStale - 1}}, kT0);
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].public_key, "A");
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kConnected);
+  EXPECT_EQ(events[1].public_key, "B");
+  EXPECT_EQ(events[1].health, TunnelHealthCpp::kStale);
+}
+
+TEST(HandshakeMonitor, TickCrossesTheThresholdWithoutNewObservations) {
+  HandshakeMonitor m;
+  m.SetStaleAfter(10000);
+  m.Started("wg0", kT0, {""});
+  std::vector<TunnelHealthEventCpp> events;
+  m.Tick(kT0 + 9999, &events);
+  EXPECT_TRUE(events.empty());
+  m.Tick(kT0 + 10000, &events);
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].public_key, "");
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kStale);
+
+  m.Stopped("wg0");
+  events.clear();
+  m.Tick(kT0 + 100000, &events);
+  EXPECT_TRUE(events.empty());
+}
+
+TEST(HandshakeMonitor, RecheckKeepsPeersAndSkipsUntracked) {
+  HandshakeMonitor m;
+  m.SetStaleAfter(10000);
+  std::vector<TunnelHealthEventCpp> events;
+  EXPECT_FALSE(m.Recheck("wg0", kT0, &events));
+
+  m.Started("wg0", kT0);
+  Observe(&m, {{"A", kT0 + 100}}, kT0 + 200);
+  EXPECT_TRUE(m.Recheck("wg0", kT0 + 5000, &events));
+  EXPECT_TRUE(events.empty());
+  EXPECT_TRUE(m.Recheck("wg0", kT0 + 10100, &events));
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].public_key, "A");
+  EXPECT_EQ(events[0].health, TunnelHealthCpp::kStale);
+}
+
+TEST(HandshakeMonitor, RecordsStartToFirstHandshake) {
+  PhaseHistogram& h = PhaseRegistry::Instance().Get("start", "first_handshake");
+  const uint64_t before = h.Count();
+  HandshakeMonitor m;
+  m.Started("wg0", kT0);
+  Observe(&m, {{"A", kT0 + 250}, {"B", kT0 + 300}}, kT0 + 400);
+  Observe(&m, {{"A", kT0 + 250}, {"B", kT0 + 300}}, kT0 + 1400);
+  EXPECT_EQ(h.Count(), before + 1);  // once per start, not per peer
+
+  HandshakeMonitor adopted;
+  std::vector<TunnelHealthEventCpp> events;
+  adopted.Observe("wg1", {{"A", kT0}}, kT0 + 10, &events);
+  EXPECT_EQ(h.Count(), before + 1);  // no start to measure from
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
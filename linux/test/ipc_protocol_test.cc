@@ -0,0 +1,391 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ipc_protocol.h"
+
+namespace ipc = flutter_wireguard::ipc;
+
+namespace {
+
+ipc::StatusRecord Rec(const std::string& name, uint8_t state, int64_t rx,
+                      int64_t tx, int64_t hs) {
+  ipc::StatusRecord r;
+  r.name = name;
+  r.state = state;
+  r.rx = rx;
+  r.tx = tx;
+  r.handshake_ms = hs;
+  return r;
+}
+
+// Size of the legacy kOpEventStatus frame for `s`, as Broker::EmitStatus
+// would send it.
+size_t LegacyFrameBytes(const ipc::StatusRecord& s) {
+  ipc::Writer w;
+  w.U8(ipc::kStatusOk);
+  w.Str(s.name);
+  w.U8(s.state);
+  w.I64(s.rx);
+  w.I64(s.tx);
+  w.I64(s.handshake_ms);
+  return ipc::BuildFrame(ipc::kOpEventStatus, 0, ipc::kFlagEvent, w.Take())
+      .size();
+}
+
+}  // namespace
+
+TEST(IpcVarint, RoundTripsEdgeValues) {
+  const std::vector<uint64_t> unsigned_values = {
+      0, 1, 127, 128, 16383, 16384, uint64_t{1} << 35,
+      std::numeric_limits<uint64_t>::max()};
+  const std::vector<int64_t> signed_values = {
+      0, 1, -1, 63, -64, 64, -65, 1700000000123, -1700000000123,
+      std::numeric_limits<int64_t>::max(), std::numeric_limits<int64_t>::min()};
+
+  ipc::Writer w;
+  for (uint64_t v : unsigned_values) w.VarU64(v);
+  for (int64_t v : signed_values) w.VarI64(v);
+  std::vector<uint8_t> bytes = w.Take();
+
+  ipc::Reader r(bytes.data(), bytes.size());
+  for (uint64_t v : unsigned_values) EXPECT_EQ(r.VarU64(), v);
+  for (int64_t v : signed_values) EXPECT_EQ(r.VarI64(), v);
+  EXPECT_TRUE(r.Empty());
+}
+
+TEST(IpcVarint, SmallValuesUseOneByte) {
+  ipc::Writer w;
+  w.VarU64(127);
+  w.VarI64(-64);
+  w.VarI64(63);
+  EXPECT_EQ(w.Peek().size(), 3u);
+}
+
+TEST(IpcVarint, TruncatedAndOverlongInputThrow) {
+  std::vector<uint8_t> truncated = {0x80, 0x80};
+  ipc::Reader r1(truncated.data(), truncated.size());
+  EXPECT_THROW(r1.VarU64(), std::runtime_error);
+
+  std::vector<uint8_t> overlong(11, 0xff);
+  ipc::Reader r2(overlong.data(), overlong.size());
+  EXPECT_THROW(r2.VarU64(), std::runtime_error);
+}
+
+TEST(StatusDelta, FirstTickDefinesNamesAndAbsoluteValues) {
+  ipc::StatusDeltaEncoder enc;
+  ipc::StatusDeltaDecoder dec;
+  std::vector<ipc::StatusRecord> tick = {
+      Rec("wg0", ipc::kStateUp, 100, 200, 1700000000000),
+      Rec("home", ipc::kStateDown, 0, 0, 0),
+  };
+  std::vector<uint8_t> payload = enc.Encode(tick);
+  ASSERT_FALSE(payload.empty());
+
+  auto out = dec.Apply(payload.data(), payload.size());
+  ASSERT_EQ(out.size(), 2u);
+  EXPECT_EQ(out[0].name, "wg0");
+  EXPECT_EQ(out[0].state, ipc::kStateUp);
+  EXPECT_EQ(out[0].rx, 100);
+  EXPECT_EQ(out[0].tx, 200);
+  EXPECT_EQ(out[0].handshake_ms, 1700000000000);
+  EXPECT_EQ(out[1].name, "home");
+  EXPECT_EQ(out[1].state, ipc::kStateDown);
+}
+
+TEST(StatusDelta, UnchangedTickProducesNoPayload) {
+  ipc::StatusDeltaEncoder enc;
+  std::vector<ipc::StatusRecord> tick = {
+      Rec("wg0", ipc::kStateUp, 100, 200, 5000)};
+  ASSERT_FALSE(enc.Encode(tick).empty());
+  EXPECT_TRUE(enc.Encode(tick).empty());
+  EXPECT_TRUE(enc.Encode({}).empty());
+}
+
+TEST(StatusDelta, OnlyChangedTunnelsAreCoalescedIntoOnePayload) {
+  ipc::StatusDeltaEncoder enc;
+  ipc::StatusDeltaDecoder dec;
+  std::vector<ipc::StatusRecord> tick;
+  for (int i = 0; i < 8; ++i) {
+    tick.push_back(Rec("wg" + std::to_string(i), ipc::kStateUp, 1000, 1000, 0));
+  }
+  auto first = enc.Encode(tick);
+  dec.Apply(first.data(), first.size());
+
+  tick[2].rx += 1500;
+  tick[5].tx += 90;
+  tick[5].handshake_ms = 1700000000000;
+  auto second = enc.Encode(tick);
+  ASSERT_FALSE(second.empty());
+
+  auto out = dec.Apply(second.data(), second.size());
+  ASSERT_EQ(out.size(), 2u);
+  EXPECT_EQ(out[0].name, "wg2");
+  EXPECT_EQ(out[0].rx, 2500);
+  EXPECT_EQ(out[0].tx, 1000);
+  EXPECT_EQ(out[1].name, "wg5");
+  EXPECT_EQ(out[1].tx, 1090);
+  EXPECT_EQ(out[1].handshake_ms, 1700000000000);
+
+  // id + mask + one-byte varint: a single small counter bump is 5 bytes
+  // including the count prefix, vs ~46 bytes for a legacy snapshot frame.
+  ipc::StatusDeltaEncoder enc2;
+  enc2.Encode(tick);
+  tick[0].rx += 100;
+  EXPECT_LE(enc2.Encode(tick).size(), 5u);
+}
+
+TEST(StatusDelta, CounterResetEncodesNegativeDelta) {
+  ipc::StatusDeltaEncoder enc;
+  ipc::StatusDeltaDecoder dec;
+  std::vector<ipc::StatusRecord> tick = {
+      Rec("wg0", ipc::kStateUp, 1 << 30, 1 << 30, 0)};
+  auto a = enc.Encode(tick);
+  dec.Apply(a.data(), a.size());
+
+  tick[0] = Rec("wg0", ipc::kStateDown, 0, 0, 0);
+  auto b = enc.Encode(tick);
+  auto out = dec.Apply(b.data(), b.size());
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].state, ipc::kStateDown);
+  EXPECT_EQ(out[0].rx, 0);
+  EXPECT_EQ(out[0].tx, 0);
+}
+
+TEST(StatusDelta, DecoderRejectsUnknownId) {
+  ipc::Writer w;
+  w.VarU64(1);              // count
+  w.VarU64(3);              // id never defined
+  w.U8(ipc::kDeltaRx);
+  w.VarI64(10);
+  std::vector<uint8_t> bad = w.Take();
+  ipc::StatusDeltaDecoder dec;
+  EXPECT_THROW(dec.Apply(bad.data(), bad.size()), std::runtime_error);
+}
+
+TEST(StatusDelta, DecoderRejectsHugeId) {
+  ipc::Writer w;
+  w.VarU64(1);
+  w.VarU64(ipc::kMaxDeltaTunnels);
+  w.U8(ipc::kDeltaName);
+  w.Str("wg0");
+  std::vector<uint8_t> bad = w.Take();
+  ipc::StatusDeltaDecoder dec;
+  EXPECT_THROW(dec.Apply(bad.data(), bad.size()), std::runtime_error);
+}
+
+TEST(StatusDelta, ResetRestartsIdAssignment) {
+  ipc::StatusDeltaEncoder enc;
+  std::vector<ipc::StatusRecord> tick = {Rec("wg0", ipc::kStateUp, 1, 1, 0)};
+  enc.Encode(tick);
+  enc.Reset();
+  // After a reconnect the fresh decoder must be able to decode the next
+  // payload on its own, so the name is re-sent.
+  auto p = enc.Encode(tick);
+  ipc::StatusDeltaDecoder dec;
+  auto out = dec.Apply(p.data(), p.size());
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].name, "wg0");
+}
+
+TEST(StatusDelta, RunningOutOfIdsThrowsUntilReset) {
+  ipc::StatusDeltaEncoder enc;
+  ipc::StatusDeltaDecoder dec;
+  std::vector<ipc::StatusRecord> tick;
+  for (uint32_t i = 0; i < ipc::kMaxDeltaTunnels; ++i) {
+    tick.push_back(Rec("t" + std::to_string(i), ipc::kStateUp, 1, 1, 0));
+  }
+  auto p = enc.Encode(tick);
+  EXPECT_EQ(dec.Apply(p.data(), p.size()).size(), ipc::kMaxDeltaTunnels);
+
+  // Ids are never reused, so one more name has nowhere to go.
+  std::vector<ipc::StatusRecord> more = {Rec("late", ipc::kStateUp, 5, 6, 7)};
+  EXPECT_THROW(enc.Encode(more), std::length_error);
+
+  // After a reset the same decoder takes the re-sent name over id 0.
+  enc.Reset();
+  p = enc.Encode(more);
+  auto out = dec.Apply(p.data(), p.size());
+  ASSERT_EQ(out.size(), 1u);
+  EXPECT_EQ(out[0].name, "late");
+  EXPECT_EQ(out[0].rx, 5);
+  EXPECT_EQ(out[0].handshake_ms, 7);
+}
+
+TEST(StatusDelta, SteadyStateIsMuchSmallerThanLegacySnapshots) {
+  ipc::StatusDeltaEncoder enc;
+  std::vector<ipc::StatusRecord> tick;
+  for (int i = 0; i < 16; ++i) {
+    tick.push_back(Rec("tunnel" + std::to_string(i), ipc::kStateUp,
+                       int64_t{1} << 32, int64_t{1} << 31, 1700000000000));
+  }
+  enc.Encode(tick);
+
+  size_t legacy = 0;
+  for (auto& s : tick) {
+    s.rx += 12000;  // typical per-second traffic on an active tunnel
+    s.tx += 3000;
+    legacy += LegacyFrameBytes(s);
+  }
+  std::vector<uint8_t> payload = enc.Encode(tick);
+  size_t compact =
+      ipc::BuildFrame(ipc::kOpEventStatusDelta, 0, ipc::kFlagEvent, payload)
+          .size();
+  EXPECT_LT(compact * 5, legacy);
+}
+
+namespace {
+
+struct OwnedFrame {
+  uint32_t op;
+  uint32_t seq;
+  uint8_t flags;
+  std::vector<uint8_t> payload;
+};
+
+std::vector<uint8_t> Payload(size_t n, uint8_t seed) {
+  std::vector<uint8_t> p(n);
+  for (size_t i = 0; i < n; ++i) p[i] = static_cast<uint8_t>(seed + i);
+  return p;
+}
+
+// Three back-to-back frames of different shapes, including an empty payload.
+std::vector<uint8_t> ThreeFrames() {
+  std::vector<uint8_t> stream;
+  for (const auto& f :
+       {ipc::BuildFrame(ipc::kOpStart, 7, ipc::kFlagNone, Payload(40, 1)),
+        ipc::BuildFrame(ipc::kOpEventStatus, 0, ipc::kFlagEvent, {}),
+        ipc::BuildFrame(ipc::kOpStatus, 0xfffffffe, ipc::kFlagNone,
+                        Payload(3, 9))}) {
+    stream.insert(stream.end(), f.begin(), f.end());
+  }
+  return stream;
+}
+
+void ExpectThreeFrames(const std::vector<OwnedFrame>& got) {
+  ASSERT_EQ(got.size(), 3u);
+  EXPECT_EQ(got[0].op, ipc::kOpStart);
+  EXPECT_EQ(got[0].seq, 7u);
+  EXPECT_EQ(got[0].payload, Payload(40, 1));
+  EXPECT_EQ(got[1].op, ipc::kOpEventStatus);
+  EXPECT_EQ(got[1].flags, ipc::kFlagEvent);
+  EXPECT_TRUE(got[1].payload.empty());
+  EXPECT_EQ(got[2].op, ipc::kOpStatus);
+  EXPECT_EQ(got[2].seq, 0xfffffffeu);
+  EXPECT_EQ(got[2].payload, Payload(3, 9));
+}
+
+}  // namespace
+
+TEST(FrameDecoder, DecodesWholeStreamInOneChunk) {
+  std::vector<uint8_t> stream = ThreeFrames();
+  ipc::FrameDecoder dec;
+  std::vector<OwnedFrame> got;
+  dec.Feed(stream.data(), stream.size(), [&](const ipc::FrameView& f) {
+    got.push_back({f.op, f.seq, f.flags,
+                   std::vector<uint8_t>(f.payload, f.payload + f.payload_len)});
+  });
+  ExpectThreeFrames(got);
+  EXPECT_EQ(dec.Buffered(), 0u);
+}
+
+TEST(FrameDecoder, SplitAtEveryByteBoundary) {
+  std::vector<uint8_t> stream = ThreeFrames();
+  for (size_t cut = 0; cut <= stream.size(); ++cut) {
+    SCOPED_TRACE(cut);
+    ipc::FrameDecoder dec;
+    std::vector<OwnedFrame> got;
+    auto on_frame = [&](const ipc::FrameView& f) {
+      got.push_back({f.op, f.seq, f.flags,
+                     std::vector<uint8_t>(f.payload, f.payload + f.payload_len)});
+    };
+    dec.Feed(stream.data(), cut, on_frame);
+    dec.Feed(stream.data() + cut, stream.size() - cut, on_frame);
+    ExpectThreeFrames(got);
+    EXPECT_EQ(dec.Buffered(), 0u);
+  }
+}
+
+TEST(FrameDecoder, OneByteAtATime) {
+  std::vector<uint8_t> stream = ThreeFrames();
+  ipc::FrameDecoder dec;
+  std::vector<OwnedFrame> got;
+  size_t max_buffered = 0;
+  for (uint8_t b : stream) {
+    dec.Feed(&b, 1, [&](const ipc::FrameView& f) {
+      got.push_back({f.op, f.seq, f.flags,
+                     std::vector<uint8_t>(f.payload, f.payload + f.payload_len)});
+    });
+    if (dec.Buffered() > max_buffered) max_buffered = dec.Buffered();
+  }
+  ExpectThreeFrames(got);
+  // Never more than the largest single frame minus its last byte.
+  EXPECT_LT(max_buffered, 4u + 9u + 40u);
+}
+
+TEST(FrameDecoder, RejectsOversizedAndUndersizedLength) {
+  for (uint32_t total : {uint32_t{0}, uint32_t{8}, ipc::kMaxFrameBytes + 1,
+                         uint32_t{0xffffffff}}) {
+    SCOPED_TRACE(total);
+    uint8_t prefix[4];
+    for (int i = 0; i < 4; ++i) prefix[i] = static_cast<uint8_t>(total >> (i * 8));
+    ipc::FrameDecoder dec;
+    int frames = 0;
+    auto on_frame = [&](const ipc::FrameView&) { ++frames; };
+    // Split the prefix so the check happens on the buffered path too.
+    dec.Feed(prefix, 2, on_frame);
+    EXPECT_THROW(dec.Feed(prefix + 2, 2, on_frame), std::runtime_error);
+    EXPECT_TRUE(dec.Failed());
+    EXPECT_EQ(dec.Buffered(), 0u);
+    std::vector<uint8_t> ok = ipc::BuildFrame(ipc::kOpHello, 1, 0, {});
+    EXPECT_THROW(dec.Feed(ok.data(), ok.size(), on_frame), std::runtime_error);
+    EXPECT_EQ(frames, 0);
+
+    dec.Reset();
+    dec.Feed(ok.data(), ok.size(), on_frame);
+    EXPECT_EQ(frames, 1);
+  }
+}
+
+TEST(FrameDecoder, AcceptsMaximumFrameSplitAcrossChunks) {
+  std::vector<uint8_t> frame = ipc::BuildFrame(
+      ipc::kOpStart, 3, 0, Payload(ipc::kMaxFrameBytes - 9, 0));
+  ipc::FrameDecoder dec;
+  size_t payload_len = 0;
+  for (size_t off = 0; off < frame.size(); off += 4096) {
+    size_t n = std::min<size_t>(4096, frame.size() - off);
+    dec.Feed(frame.data() + off, n,
+             [&](const ipc::FrameView& f) { payload_len = f.payload_len; });
+    EXPECT_LE(dec.Buffered(), static_cast<size_t>(ipc::kMaxFrameBytes) + 4);
+  }
+  EXPECT_EQ(payload_len, ipc::kMaxFrameBytes - 9);
+}
+
+TEST(FrameDecoder, ThrowingCallbackLeavesDecoderAtNextFrame) {
+  std::vector<uint8_t> stream = ThreeFrames();
+  ipc::FrameDecoder dec;
+  int calls = 0;
+  // Buffered path: feed everything but the last byte, then the last byte.
+  dec.Feed(stream.data(), stream.size() - 1, [](const ipc::FrameView&) {});
+  EXPECT_THROW(dec.Feed(stream.data() + stream.size() - 1, 1,
+                        [&](const ipc::FrameView&) {
+                          ++calls;
+                          throw std::runtime_error("handler");
+                        }),
+               std::runtime_error);
+  EXPECT_EQ(calls, 1);
+  EXPECT_FALSE(dec.Failed());
+  EXPECT_EQ(dec.Buffered(), 0u);
+  std::vector<uint8_t> next = ipc::BuildFrame(ipc::kOpHello, 2, 0, {});
+  int after = 0;
+  dec.Feed(next.data(), next.size(), [&](const ipc::FrameView& f) {
+    EXPECT_EQ(f.seq, 2u);
+    ++after;
+  });
+  EXPECT_EQ(after, 1);
+}
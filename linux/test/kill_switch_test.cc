@@ -0,0 +1,543 @@
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <linux/if_tun.h>
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "kill_switch.h"
+#include "route_installer.h"
+
+namespace flutter_wireguard {
+namespace {
+
+RouteEntry Prefix(const std::string& s) {
+  RouteEntry e;
+  EXPECT_TRUE(ParseIpPrefix(s, &e.key, &e.bits, &e.v6)) << s;
+  return e;
+}
+
+// An interface address: host bits kept.
+RouteEntry Address(const std::string& s) {
+  RouteEntry e = Prefix(s);
+  EXPECT_TRUE(ParseIpAddress(s.substr(0, s.find('/')), &e.key, &e.v6)) << s;
+  return e;
+}
+
+KillSwitchPlan Plan(const std::vector<std::string>& endpoints,
+                    const std::vector<std::string>& bypass) {
+  KillSwitchPlan plan;
+  for (const auto& e : endpoints) EXPECT_TRUE(AddKillSwitchEndpoint(e, &plan)) << e;
+  for (const auto& b : bypass) plan.bypass.push_back(Prefix(b));
+  return plan;
+}
+
+// Plays nfnetlink: checks the batch framing, records each message's type
+// and the expressions of each rule, and acks every message.
+class FakeNetfilter : public NetlinkChannel {
+ public:
+  struct Message {
+    int type;  // NFT_MSG_*
+    uint16_t flags;
+    std::vector<std::string> exprs;  // NFTA_EXPR_NAME, for rules
+  };
+
+  std::vector<std::vector<Message>> batches;
+  std::map<size_t, int> fail;  // message index in the batch -> errno
+  int refuse = 0;              // errno for the batch as a whole
+
+  void Send(const std::string& datagram) override {
+    std::vector<Message> batch;
+    std::vector<uint32_t> seqs;
+    bool begun = false, ended = false;
+    int left = static_cast<int>(datagram.size());
+    for (auto* nh = reinterpret_cast<const nlmsghdr*>(datagram.data());
+         NLMSG_OK(nh, left); nh = NLMSG_NEXT(nh, left)) {
+      auto* g = static_cast<const nfgenmsg*>(NLMSG_DATA(nh));
+      if (nh->nlmsg_type == NFNL_MSG_BATCH_BEGIN) {
+        EXPECT_TRUE(batch.empty());
+        EXPECT_EQ(ntohs(g->res_id), NFNL_SUBSYS_NFTABLES);
+        begun = true;
+        continue;
+      }
+      if (nh->nlmsg_type == NFNL_MSG_BATCH_END) {
+        ended = true;
+        continue;
+      }
+      EXPECT_TRUE(begun && !ended);
+      EXPECT_EQ(nh->nlmsg_type >> 8, NFNL_SUBSYS_NFTABLES);
+      EXPECT_TRUE(nh->nlmsg_flags & NLM_F_ACK);
+      EXPECT_EQ(g->nfgen_family, NFPROTO_INET);
+      Message m{nh->nlmsg_type & 0xff, static_cast<uint16_t>(nh->nlmsg_flags), {}};
+      if (m.type == NFT_MSG_NEWRULE) Exprs(nh, &m.exprs);
+      batch.push_back(m);
+      seqs.push_back(nh->nlmsg_seq);
+    }
+    EXPECT_TRUE(begun && ended);
+    EXPECT_EQ(left, 0);
+    batches.push_back(batch);
+    if (refuse != 0) {
+      Ack(0, -refuse);
+      return;
+    }
+    for (size_t i = 0; i < seqs.size(); ++i) {
+      auto f = fail.find(i);
+      Ack(seqs[i], f == fail.end() ? 0 : -f->second);
+    }
+  }
+
+  std::string Receive() override {
+    if (replies_.empty()) throw std::runtime_error("netlink: no reply from the kernel");
+    std::string out = std::move(replies_.front());
+    replies_.erase(replies_.begin());
+    return out;
+  }
+
+ private:
+  static void Exprs(const nlmsghdr* nh, std::vector<std::string>* out) {
+    const size_t base = NLMSG_LENGTH(sizeof(nfgenmsg));
+    const char* p = reinterpret_cast<const char*>(nh) + base;
+    const char* end = reinterpret_cast<const char*>(nh) + nh->nlmsg_len;
+    while (p + NLA_HDRLEN <= end) {
+      auto* a = reinterpret_cast<const nlattr*>(p);
+      if ((a->nla_type & NLA_TYPE_MASK) == NFTA_RULE_EXPRESSIONS) {
+        const char* e = p + NLA_HDRLEN;
+        while (e < p + a->nla_len) {
+          auto* elem = reinterpret_cast<const nlattr*>(e);
+          // The first attribute of each element is its name.
+          out->push_back(e + 2 * NLA_HDRLEN);
+          e += NLA_ALIGN(elem->nla_len);
+        }
+      }
+      p += NLA_ALIGN(a->nla_len);
+    }
+  }
+
+  void Ack(uint32_t seq, int error) {
+    struct {
+      nlmsghdr nh;
+      nlmsgerr err;
+    } ack{};
+    ack.nh.nlmsg_len = sizeof(ack);
+    ack.nh.nlmsg_type = NLMSG_ERROR;
+    ack.nh.nlmsg_seq = seq;
+    ack.err.error = error;
+    // One ack per datagram, the most a busy socket splits them.
+    replies_.emplace_back(reinterpret_cast<const char*>(&ack), sizeof(ack));
+  }
+
+  std::vector<std::string> replies_;
+};
+
+TEST(TakeOverKillSwitch, StripsItsLinesAndCollectsEndpoints) {
+  const std::string config =
+      "[Interface]\nPrivateKey = abc\nKillSwitch = on  # leak nothing\n"
+      "KillSwitchBypass = 192.168.1.0/24, fd00:1::/64\nkillswitchbypass = 10.0.0.1\n"
+      "[Peer]\nPublicKey = A\nEndpoint = 203.0.113.7:51820\n"
+      "[Peer]\nPublicKey = B\nEndpoint = [2001:db8::7]:443\n"
+      "[Peer]\nPublicKey = C\nEndpoint = 203.0.113.7:51820\n";
+  std::string rest;
+  KillSwitchPlan plan;
+  ASSERT_TRUE(TakeOverKillSwitch(config, &rest, &plan));
+  EXPECT_EQ(rest,
+            "[Interface]\nPrivateKey = abc\n"
+            "[Peer]\nPublicKey = A\nEndpoint = 203.0.113.7:51820\n"
+            "[Peer]\nPublicKey = B\nEndpoint = [2001:db8::7]:443\n"
+            "[Peer]\nPublicKey = C\nEndpoint = 203.0.113.7:51820\n");
+  ASSERT_EQ(plan.endpoints.size(), 2u);  // C shares A's
+  EXPECT_EQ(FormatRouteEntry(plan.endpoints[0].address), "203.0.113.7/32");
+  EXPECT_EQ(plan.endpoints[0].port, 51820);
+  EXPECT_EQ(FormatRouteEntry(plan.endpoints[1].address), "2001:db8::7/128");
+  EXPECT_EQ(plan.endpoints[1].port, 443);
+  ASSERT_EQ(plan.bypass.size(), 3u);
+  EXPECT_EQ(FormatRouteEntry(plan.bypass[1]), "fd00:1::/64");
+  EXPECT_EQ(FormatRouteEntry(plan.bypass[2]), "10.0.0.1/32");
+}
+
+TEST(TakeOverKillSwitch, OffStillStripsAndBadValuesThrow) {
+  std::string config = "[Interface]\nKillSwitch = off\nKillSwitchBypass = 10.0.0.0/8\n";
+  KillSwitchPlan plan;
+  EXPECT_FALSE(TakeOverKillSwitch(config, &config, &plan));
+  EXPECT_EQ(config, "[Interface]\n");
+  EXPECT_FALSE(TakeOverKillSwitch("[Interface]\n[Peer]\nKillSwitch = on\n", &config, &plan))
+      << "only [Interface] has one";
+  EXPECT_THROW(TakeOverKillSwitch("[Interface]\nKillSwitch = maybe\n", &config, &plan),
+               std::invalid_argument);
+  EXPECT_THROW(TakeOverKillSwitch("[Interface]\nKillSwitch = on\nKillSwitchBypass = lan\n",
+                                  &config, &plan),
+               std::invalid_argument);
+  EXPECT_FALSE(AddKillSwitchEndpoint("vpn.example:51820", &plan));
+  EXPECT_FALSE(AddKillSwitchEndpoint("203.0.113.7:0", &plan));
+  EXPECT_FALSE(AddKillSwitchEndpoint("203.0.113.7:65536", &plan));
+}
+
+TEST(NftScript, OneTransactionThatReplacesOrDeletesTheTable) {
+  const std::string script =
+      NftScript({{"wg0", Plan({"203.0.113.7:51820"}, {"192.168.1.0/24"})}});
+  EXPECT_EQ(script,
+            "table inet flutter_wireguard\n"
+            "delete table inet flutter_wireguard\n"
+            "table inet flutter_wireguard {\n"
+            "\tchain output {\n"
+            "\t\ttype filter hook output priority 0; policy drop;\n"
+            "\t\toifname \"lo\" accept\n"
+            "\t\toifname \"wg0\" accept\n"
+            "\t\tip daddr 203.0.113.7/32 udp dport 51820 accept\n"
+            "\t\tip daddr 192.168.1.0/24 accept\n"
+            "\t\tmeta nfproto ipv4 udp dport 67 accept\n"
+            "\t\tmeta nfproto ipv6 udp dport 547 accept\n"
+            "\t\tmeta nfproto ipv6 icmpv6 type 133-136 accept\n"
+            "\t}\n"
+            "\tchain input {\n"
+            "\t\ttype filter hook input priority 0; policy drop;\n"
+            "\t\tiifname \"lo\" accept\n"
+            "\t\tiifname \"wg0\" accept\n"
+            "\t\tip saddr 203.0.113.7/32 udp sport 51820 accept\n"
+            "\t\tip saddr 192.168.1.0/24 accept\n"
+            "\t\tmeta nfproto ipv4 udp dport 68 accept\n"
+            "\t\tmeta nfproto ipv6 udp dport 546 accept\n"
+            "\t\tmeta nfproto ipv6 icmpv6 type 133-136 accept\n"
+            "\t}\n"
+            "}\n");
+  EXPECT_EQ(NftScript({}),
+            "table inet flutter_wireguard\ndelete table inet flutter_wireguard\n");
+}
+
+TEST(KillSwitchRecords, RoundTripThroughTheStateFile) {
+  const KillSwitchSet set = {
+      {"wg0", Plan({"203.0.113.7:51820", "[2001:db8::7]:443"}, {"192.168.1.0/24"})},
+      {"wg1", Plan({}, {})}};
+  const std::string records = KillSwitchRecords(set);
+  EXPECT_EQ(records,
+            "wg0 on\n"
+            "wg0 endpoint 203.0.113.7/32 51820\n"
+            "wg0 endpoint 2001:db8::7/128 443\n"
+            "wg0 bypass 192.168.1.0/24\n"
+            "wg1 on\n");
+  const KillSwitchSet back = ParseKillSwitchRecords(records + "wg2 endpoint x 1\nbad\n");
+  EXPECT_EQ(KillSwitchRecords(back), records);
+
+  char dir[] = "/tmp/fwg_ks_XXXXXX";
+  ASSERT_NE(::mkdtemp(dir), nullptr);
+  const std::string path = std::string(dir) + "/" + kKillSwitchStateFile;
+  const mode_t old_mask = ::umask(077);
+  SaveKillSwitchRecords(path, set);
+  ::umask(old_mask);
+  struct stat st;
+  ASSERT_EQ(::stat(path.c_str(), &st), 0);
+  EXPECT_EQ(st.st_mode & 0777, 0644u);  // for the unprivileged plugin
+  SaveKillSwitchRecords(path, {});
+  EXPECT_NE(::access(path.c_str(), F_OK), 0);
+  SaveKillSwitchRecords(path, {});  // nothing to remove is fine
+  ::rmdir(dir);
+}
+
+TEST(KillSwitchInstaller, WholeTableInOneBatch) {
+  auto kernel = std::make_unique<FakeNetfilter>();
+  FakeNetfilter* k = kernel.get();
+  KillSwitchInstaller installer(std::move(kernel));
+  installer.Install({{"wg0", Plan({"203.0.113.7:51820", "[2001:db8::7]:51820"},
+                                  {"192.168.1.0/24"})},
+                     {"wg1", Plan({}, {})}});
+  EXPECT_EQ(installer.batches_sent(), 1u);
+  ASSERT_EQ(k->batches.size(), 1u);
+  const auto& b = k->batches[0];
+  // Table ensured, deleted, re-created; two chains; then the rules:
+  // per chain lo, wg0, 2 endpoints, 1 bypass, wg1, DHCPv4, DHCPv6, ND.
+  ASSERT_EQ(b.size(), 3u + 2u + 2u * 9u);
+  EXPECT_EQ(b[0].type, NFT_MSG_NEWTABLE);
+  EXPECT_FALSE(b[0].flags & NLM_F_EXCL);
+  EXPECT_EQ(b[1].type, NFT_MSG_DELTABLE);
+  EXPECT_EQ(b[2].type, NFT_MSG_NEWTABLE);
+  EXPECT_EQ(b[3].type, NFT_MSG_NEWCHAIN);
+  EXPECT_EQ(b[4].type, NFT_MSG_NEWCHAIN);
+  for (size_t i = 5; i < b.size(); ++i) {
+    EXPECT_EQ(b[i].type, NFT_MSG_NEWRULE);
+    EXPECT_TRUE(b[i].flags & NLM_F_APPEND);
+    EXPECT_EQ(b[i].exprs.back(), "immediate");
+  }
+  EXPECT_EQ(b[5].exprs, (std::vector<std::string>{"meta", "cmp", "immediate"}));
+  // ip daddr 203.0.113.7 udp dport 51820.
+  EXPECT_EQ(b[7].exprs, (std::vector<std::string>{"meta", "cmp", "payload", "cmp", "meta",
+                                                   "cmp", "payload", "cmp", "immediate"}));
+  // ip daddr 192.168.1.0/24: masked first.
+  EXPECT_EQ(b[9].exprs, (std::vector<std::string>{"meta", "cmp", "payload", "bitwise",
+                                                   "cmp", "immediate"}));
+
+  installer.Install({});
+  ASSERT_EQ(k->batches.size(), 2u);
+  ASSERT_EQ(k->batches[1].size(), 2u);
+  EXPECT_EQ(k->batches[1][0].type, NFT_MSG_NEWTABLE);
+  EXPECT_EQ(k->batches[1][1].type, NFT_MSG_DELTABLE);
+}
+
+TEST(KillSwitchInstaller, NamesTheFirstRefusedMessage) {
+  auto kernel = std::make_unique<FakeNetfilter>();
+  FakeNetfilter* k = kernel.get();
+  KillSwitchInstaller installer(std::move(kernel));
+  k->fail[6] = EINVAL;  // the output chain's wg0 rule
+  k->fail[9] = EOPNOTSUPP;
+  try {
+    installer.Install({{"wg0", Plan({}, {})}});
+    FAIL() << "expected Install to throw";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()),
+              std::string("rule output 'oifname \"wg0\" accept': ") + std::strerror(EINVAL));
+  }
+
+  k->fail.clear();
+  k->refuse = EPERM;
+  try {
+    installer.Install({});
+    FAIL() << "expected Install to throw";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string(e.what()).find(std::strerror(EPERM)), std::string::npos);
+  }
+}
+
+// ----- Against the kernel, in a network namespace of our own -----
+
+// Runs in the forked child. Failures go to `out`, one per line.
+class Netns {
+ public:
+  explicit Netns(std::string* out) : out_(out) {}
+
+  void Expect(bool ok, const std::string& what) {
+    if (!ok) *out_ += what + "\n";
+  }
+
+  // A TUN device, up, with `addresses` and `routes`. Kept until exit.
+  int Tun(const std::string& name, const RoutePlan& plan) {
+    const int fd = ::open("/dev/net/tun", O_RDWR | O_CLOEXEC);
+    if (fd < 0) return -1;
+    ifreq ifr{};
+    ifr.ifr_flags = IFF_TUN | IFF_NO_PI;
+    std::strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+    if (::ioctl(fd, TUNSETIFF, &ifr) != 0 || !Up(name)) return -1;
+    RouteInstaller(OpenRouteChannel())
+        .Install(static_cast<int>(::if_nametoindex(name.c_str())), plan);
+    return fd;
+  }
+
+  static bool Up(const std::string& name) {
+    const int s = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    ifreq ifr{};
+    std::strncpy(ifr.ifr_name, name.c_str(), IFNAMSIZ - 1);
+    bool ok = ::ioctl(s, SIOCGIFFLAGS, &ifr) == 0;
+    ifr.ifr_flags |= IFF_UP;
+    ok = ok && ::ioctl(s, SIOCSIFFLAGS, &ifr) == 0;
+    ::close(s);
+    return ok;
+  }
+
+  // 0 if one UDP datagram to host:port left, else errno.
+  static int Send(const std::string& host, uint16_t port) {
+    sockaddr_storage to{};
+    socklen_t len;
+    const bool v6 = host.find(':') != std::string::npos;
+    if (v6) {
+      auto* a = reinterpret_cast<sockaddr_in6*>(&to);
+      a->sin6_family = AF_INET6;
+      a->sin6_port = htons(port);
+      ::inet_pton(AF_INET6, host.c_str(), &a->sin6_addr);
+      len = sizeof(*a);
+    } else {
+      auto* a = reinterpret_cast<sockaddr_in*>(&to);
+      a->sin_family = AF_INET;
+      a->sin_port = htons(port);
+      ::inet_pton(AF_INET, host.c_str(), &a->sin_addr);
+      len = sizeof(*a);
+    }
+    const int s = ::socket(v6 ? AF_INET6 : AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    const int rc = ::sendto(s, "x", 1, 0, reinterpret_cast<sockaddr*>(&to), len) == 1
+                       ? 0
+                       : errno;
+    ::close(s);
+    return rc;
+  }
+
+  // Writes an IPv4 UDP datagram from `src`:`sport` to 10.9.0.1:`dport` into
+  // `tun`, as if it had arrived on the wire, and reports whether a socket
+  // bound to `dport` got it.
+  static bool Receives(int tun, const std::string& src, uint16_t sport, uint16_t dport) {
+    const int s = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    sockaddr_in local{};
+    local.sin_family = AF_INET;
+    local.sin_port = htons(dport);
+    ::bind(s, reinterpret_cast<sockaddr*>(&local), sizeof(local));
+
+    uint8_t pkt[29] = {0x45, 0, 0, 29, 0, 0, 0x40, 0, 64, IPPROTO_UDP};
+    ::inet_pton(AF_INET, src.c_str(), pkt + 12);
+    ::inet_pton(AF_INET, "10.9.0.1", pkt + 16);
+    uint32_t sum = 0;
+    for (int i = 0; i < 20; i += 2) sum += pkt[i] << 8 | pkt[i + 1];
+    while (sum >> 16) sum = (sum & 0xffff) + (sum >> 16);
+    pkt[10] = static_cast<uint8_t>(~sum >> 8);
+    pkt[11] = static_cast<uint8_t>(~sum);
+    pkt[20] = static_cast<uint8_t>(sport >> 8);
+    pkt[21] = static_cast<uint8_t>(sport);
+    pkt[22] = static_cast<uint8_t>(dport >> 8);
+    pkt[23] = static_cast<uint8_t>(dport);
+    pkt[25] = 9;  // UDP length; checksum 0 = none
+    pkt[28] = 'x';
+    bool got = false;
+    if (::write(tun, pkt, sizeof(pkt)) == static_cast<ssize_t>(sizeof(pkt))) {
+      pollfd p{s, POLLIN, 0};
+      got = ::poll(&p, 1, 200) == 1;
+    }
+    ::close(s);
+    return got;
+  }
+
+ private:
+  std::string* out_;
+};
+
+// 77 if the sandbox gives us no network namespace or no nf_tables.
+constexpr int kSkip = 77;
+
+void RunInNetns(std::string* failures) {
+  Netns ns(failures);
+  // Tentative addresses would make IPv6 sends fail for a second.
+  if (FILE* f = std::fopen("/proc/sys/net/ipv6/conf/default/accept_dad", "w")) {
+    std::fputs("0", f);
+    std::fclose(f);
+  }
+  if (!Netns::Up("lo")) ::_exit(kSkip);
+  RoutePlan phys;
+  phys.addresses = {Address("10.9.0.1/24"), Address("fd09::1/64")};
+  phys.routes = {Prefix("0.0.0.0/0"), Prefix("::/0")};
+  RoutePlan tunnel;
+  tunnel.addresses = {Address("10.8.0.1/24")};
+  int phys_fd, tunnel_fd;
+  try {
+    phys_fd = ns.Tun("phys0", phys);
+    tunnel_fd = ns.Tun("wgtest0", tunnel);
+  } catch (const std::exception&) {
+    ::_exit(kSkip);
+  }
+  if (phys_fd < 0 || tunnel_fd < 0) ::_exit(kSkip);
+
+  ns.Expect(Netns::Send("198.51.100.1", 53) == 0, "no route before arming");
+  ns.Expect(Netns::Receives(phys_fd, "198.51.100.1", 53, 40000),
+            "nothing received before arming");
+
+  std::unique_ptr<KillSwitchInstaller> armed;
+  try {
+    armed = std::make_unique<KillSwitchInstaller>(OpenNetfilterChannel());
+    armed->Install({{"wgtest0", Plan({"203.0.113.7:51820", "[2001:db8::7]:51820"},
+                                     {"192.168.77.0/24"})}});
+  } catch (const std::exception& e) {
+    // No nf_tables in this kernel, or not ours to use: nothing to test.
+    const std::string what = e.what();
+    if (what.find(std::strerror(EPERM)) != std::string::npos ||
+        what.find(std::strerror(EPROTONOSUPPORT)) != std::string::npos ||
+        what.find(std::strerror(EOPNOTSUPP)) != std::string::npos) {
+      ::_exit(kSkip);
+    }
+    *failures += "install: " + what + "\n";
+    return;
+  }
+  KillSwitchInstaller& installer = *armed;
+  auto blocked = [&](const std::string& host, uint16_t port) {
+    ns.Expect(Netns::Send(host, port) == EPERM, host + ":" + std::to_string(port) +
+                                                    " should be blocked");
+  };
+  auto allowed = [&](const std::string& host, uint16_t port) {
+    const int rc = Netns::Send(host, port);
+    ns.Expect(rc == 0, host + ":" + std::to_string(port) +
+                           " should pass: " + std::strerror(rc));
+  };
+  blocked("198.51.100.1", 53);
+  blocked("203.0.113.7", 51821);
+  blocked("203.0.113.8", 51820);
+  blocked("192.168.78.9", 53);
+  blocked("2001:db8::8", 51820);
+  allowed("127.0.0.1", 9);
+  allowed("10.8.0.2", 53);  // the tunnel
+  allowed("203.0.113.7", 51820);
+  allowed("2001:db8::7", 51820);
+  allowed("192.168.77.9", 53);
+  ns.Expect(Netns::Receives(phys_fd, "203.0.113.7", 51820, 40001),
+            "the endpoint's reply should come in");
+  ns.Expect(!Netns::Receives(phys_fd, "198.51.100.1", 53, 40002),
+            "anything else should not");
+
+  // Re-armed for a moved endpoint: the old one is closed in the same step.
+  installer.Install({{"wgtest0", Plan({"203.0.113.8:51820"}, {})}});
+  blocked("203.0.113.7", 51820);
+  blocked("192.168.77.9", 53);
+  allowed("203.0.113.8", 51820);
+  allowed("10.8.0.2", 53);
+
+  installer.Install({});
+  allowed("198.51.100.1", 53);
+  ns.Expect(Netns::Receives(phys_fd, "198.51.100.1", 53, 40003),
+            "nothing received after disarming");
+  // Disarming twice is fine.
+  try {
+    installer.Install({});
+  } catch (const std::exception& e) {
+    *failures += std::string("second removal: ") + e.what() + "\n";
+  }
+  ns.Expect(installer.batches_sent() == 4, "one batch per change");
+}
+
+TEST(KillSwitchInstaller, BlocksEverythingButTheTunnelInANetworkNamespace) {
+  int pipefd[2];
+  ASSERT_EQ(::pipe(pipefd), 0);
+  const pid_t pid = ::fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    ::close(pipefd[0]);
+    if (::unshare(CLONE_NEWNET) != 0 &&
+        ::unshare(CLONE_NEWUSER | CLONE_NEWNET) != 0) {
+      ::_exit(kSkip);
+    }
+    std::string failures;
+    try {
+      RunInNetns(&failures);
+    } catch (const std::exception& e) {
+      failures += std::string("threw: ") + e.what() + "\n";
+    }
+    const ssize_t w = ::write(pipefd[1], failures.data(), failures.size());
+    ::_exit(w == static_cast<ssize_t>(failures.size()) ? 0 : 1);
+  }
+  ::close(pipefd[1]);
+  std::string failures;
+  char buf[4096];
+  ssize_t n;
+  while ((n = ::read(pipefd[0], buf, sizeof(buf))) > 0) failures.append(buf, n);
+  ::close(pipefd[0]);
+  int status = 0;
+  ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  if (WEXITSTATUS(status) == kSkip) {
+    GTEST_SKIP() << "no private network namespace with TUN and nf_tables here";
+  }
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_EQ(failures, "");
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "metrics_exporter.h"
+
+using flutter_wireguard::MetricsExporter;
+using flutter_wireguard::PeerStatsCpp;
+using flutter_wireguard::TunnelStateCpp;
+using flutter_wireguard::TunnelStatusCpp;
+
+namespace {
+
+std::vector<TunnelStatusCpp> Tunnels() {
+  TunnelStatusCpp up{"wg0", TunnelStateCpp::kUp, 4096, 2048, 1700000000123};
+  TunnelStatusCpp down{"wg1", TunnelStateCpp::kDown, 0, 0, 0};
+  return {up, down};
+}
+
+std::vector<std::vector<PeerStatsCpp>> Peers() {
+  PeerStatsCpp a{"QUJD+/==", "198.51.100.1:51820", 4000, 2000, 1700000000123, 25};
+  PeerStatsCpp b{"REVG", "", 96, 48, 0, 0};
+  return {{a, b}, {}};
+}
+
+// One HTTP/1.1 exchange over `fd`; returns everything the server sent.
+std::string Exchange(int fd, const std::string& request) {
+  EXPECT_EQ(send(fd, request.data(), request.size(), MSG_NOSIGNAL),
+            static_cast<ssize_t>(request.size()));
+  std::string reply;
+  char buf[4096];
+  ssize_t n;
+  while ((n = recv(fd, buf, sizeof(buf), 0)) > 0) reply.append(buf, n);
+  close(fd);
+  return reply;
+}
+
+int ConnectTcp(const std::string& address) {
+  const size_t colon = address.rfind(':');
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(static_cast<uint16_t>(std::stoi(address.substr(colon + 1))));
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  int fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  EXPECT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+  return fd;
+}
+
+}  // namespace
+
+TEST(MetricsExporter, RendersTunnelAndPeerFamilies) {
+  std::string out;
+  MetricsExporter::Render(Tunnels(), Peers(), &out);
+  EXPECT_NE(out.find("# TYPE wireguard_tunnel_rx_bytes counter\n"
+                     "wireguard_tunnel_rx_bytes{tunnel=\"wg0\"} 4096\n"
+                     "wireguard_tunnel_rx_bytes{tunnel=\"wg1\"} 0\n"),
+            std::string::npos)
+      << out;
+  EXPECT_NE(out.find("wireguard_tunnel_state{tunnel=\"wg0\"} 2\n"), std::string::npos);
+  EXPECT_NE(out.find("wireguard_tunnel_state{tunnel=\"wg1\"} 0\n"), std::string::npos);
+  EXPECT_NE(out.find("wireguard_tunnel_last_handshake_seconds{tunnel=\"wg0\"} "
+                     "1700000000.123\n"),
+            std::string::npos);
+  EXPECT_NE(out.find("wireguard_tunnel_tx_bytes{tunnel=\"wg0\"} 2048\n"), std::string::npos);
+  EXPECT_NE(out.find("wireguard_peer_rx_bytes{tunnel=\"wg0\",public_key=\"QUJD+/==\"} 4000\n"),
+            std::string::npos);
+  EXPECT_NE(out.find("wireguard_peer_last_handshake_seconds{tunnel=\"wg0\","
+                     "public_key=\"REVG\"} 0\n"),
+            std::string::npos);
+  // Every family is declared exactly once, before its samples.
+  size_t help = 0;
+  for (size_t p = out.find("# HELP"); p != std::string::npos;
+       p = out.find("# HELP", p + 1)) {
+    ++help;
+  }
+  EXPECT_EQ(help, 7u);
+}
+
+TEST(MetricsExporter, OmitsPeerFamiliesWithoutPeers) {
+  std::string out;
+  MetricsExporter::Render(Tunnels(), {}, &out);
+  EXPECT_EQ(out.find("wireguard_peer_"), std::string::npos);
+  EXPECT_NE(out.find("wireguard_tunnel_state{tunnel=\"wg1\"} 0\n"), std::string::npos);
+}
+
+TEST(MetricsExporter, RejectsNonLoopbackAddresses) {
+  EXPECT_THROW(MetricsExporter("0.0.0.0:9586"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("192.168.1.10:9586"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("[::]:9586"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("example.com:9586"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("127.0.0.1:70000"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("127.0.0.1:"), std::invalid_argument);
+  EXPECT_THROW(MetricsExporter("unix:"), std::invalid_argument);
+  EXPECT_NO_THROW(MetricsExporter("9586"));
+  EXPECT_NO_THROW(MetricsExporter("localhost:9586"));
+  EXPECT_NO_THROW(MetricsExporter("127.0.0.2:9586"));
+  EXPECT_NO_THROW(MetricsExporter("[::1]:9586"));
+}
+
+TEST(MetricsExporter, ServesCachedSnapshotOverTcp) {
+  MetricsExporter exporter("127.0.0.1:0");
+  exporter.Start();
+  ASSERT_EQ(exporter.address().rfind("127.0.0.1:", 0), 0u);
+  ASSERT_NE(exporter.address(), "127.0.0.1:0");
+  exporter.Update(Tunnels(), Peers());
+
+  std::string reply = Exchange(ConnectTcp(exporter.address()),
+                               "GET /metrics HTTP/1.1\r\nHost: x\r\n\r\n");
+  EXPECT_EQ(reply.rfind("HTTP/1.1 200 OK\r\n", 0), 0u) << reply;
+  EXPECT_NE(reply.find("Content-Type: text/plain; version=0.0.4"), std::string::npos);
+  EXPECT_NE(reply.find("wireguard_tunnel_rx_bytes{tunnel=\"wg0\"} 4096\n"),
+            std::string::npos);
+
+  // A later tick replaces the snapshot; nothing is re-queried per scrape.
+  auto tunnels = Tunnels();
+  tunnels[0].rx = 8192;
+  exporter.Update(tunnels, Peers());
+  reply = Exchange(ConnectTcp(exporter.address()), "GET /metrics HTTP/1.0\r\n\r\n");
+  EXPECT_NE(reply.find("wireguard_tunnel_rx_bytes{tunnel=\"wg0\"} 8192\n"),
+            std::string::npos);
+
+  reply = Exchange(ConnectTcp(exporter.address()), "GET / HTTP/1.1\r\n\r\n");
+  EXPECT_EQ(reply.rfind("HTTP/1.1 404", 0), 0u);
+  reply = Exchange(ConnectTcp(exporter.address()), "POST /metrics HTTP/1.1\r\n\r\n");
+  EXPECT_EQ(reply.rfind("HTTP/1.1 405", 0), 0u);
+  EXPECT_EQ(exporter.scrapes(), 2u);
+  exporter.Stop();
+  exporter.Stop();  // idempotent
+}
+
+TEST(MetricsExporter, ServesOverUnixSocket) {
+  const std::string path = "/tmp/fwg-metrics-" + std::to_string(::getpid()) + ".sock";
+  {
+    MetricsExporter exporter("unix:" + path);
+    exporter.Start();
+    EXPECT_EQ(exporter.address(), "unix:" + path);
+    exporter.Update(Tunnels(), {});
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strcpy(addr.sun_path, path.c_str());
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    ASSERT_EQ(connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    std::string reply = Exchange(fd, "GET /metrics HTTP/1.1\r\n\r\n");
+    EXPECT_NE(reply.find("wireguard_tunnel_state{tunnel=\"wg0\"} 2\n"),
+              std::string::npos);
+  }
+  EXPECT_NE(access(path.c_str(), F_OK), 0);  // removed on Stop()
+}
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "peer_index.h"
+#include "wg_key.h"
+#include "wg_key_map.h"
+
+namespace flutter_wireguard {
+namespace {
+
+WgKey RandomKey(std::mt19937_64* rng) {
+  WgKey k;
+  for (size_t i = 0; i < kWgKeyLen; i += 8) {
+    const uint64_t v = (*rng)();
+    for (size_t j = 0; j < 8; ++j) k.bytes[i + j] = static_cast<uint8_t>(v >> (8 * j));
+  }
+  return k;
+}
+
+std::string Key(std::mt19937_64* rng) { return WgKeyToBase64(RandomKey(rng)); }
+
+PeerStatsCpp Peer(const std::string& key, int64_t handshake = 0) {
+  PeerStatsCpp p;
+  p.public_key = key;
+  p.handshake = handshake;
+  return p;
+}
+
+TEST(WgKeyCodec, RejectsEveryCharacterOutsideTheAlphabet) {
+  std::mt19937_64 rng(1);
+  const std::string good = Key(&rng);
+  WgKey k;
+  ASSERT_TRUE(WgKeyFromBase64(good, &k));
+  EXPECT_EQ(WgKeyToBase64(k), good);
+  const std::string alphabet =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (int c = 0; c < 256; ++c) {
+    std::string s = good;
+    s[7] = static_cast<char>(c);
+    EXPECT_EQ(WgKeyFromBase64(s, &k), alphabet.find(static_cast<char>(c)) != std::string::npos)
+        << c;
+  }
+}
+
+TEST(WgKeyCodec, RejectsNonCanonicalTailAndWrongLength) {
+  std::mt19937_64 rng(2);
+  std::string s = Key(&rng);
+  WgKey k;
+  EXPECT_FALSE(WgKeyFromBase64(s.substr(0, 43), &k));
+  EXPECT_FALSE(WgKeyFromBase64(s + "=", &k));
+  s[42] = 'B';  // value 1: a low bit the 32 bytes don't have
+  EXPECT_FALSE(WgKeyFromBase64(s, &k));
+  s[42] = 'E';  // value 4: canonical
+  EXPECT_TRUE(WgKeyFromBase64(s, &k));
+}
+
+TEST(WgKeyMap, MatchesStdMapUnderChurn) {
+  std::mt19937_64 rng(3);
+  std::vector<WgKey> pool;
+  for (int i = 0; i < 300; ++i) pool.push_back(RandomKey(&rng));
+  // Keys that share their first 16 bytes share a home slot: long runs that
+  // wrap around the end of a small table.
+  for (int i = 0; i < 20; ++i) {
+    WgKey k = pool[0];
+    k.bytes[31] = static_cast<uint8_t>(i + 1);
+    pool.push_back(k);
+  }
+
+  WgKeyMap<int> map;
+  std::map<std::string, int> want;
+  for (int step = 0; step < 20000; ++step) {
+    const WgKey& k = pool[rng() % pool.size()];
+    const std::string name = WgKeyToBase64(k);
+    if (rng() % 3 == 0) {
+      EXPECT_EQ(map.Erase(k), want.erase(name) == 1);
+    } else {
+      auto [value, added] = map.Insert(k, step);
+      auto [it, want_added] = want.emplace(name, step);
+      EXPECT_EQ(added, want_added);
+      EXPECT_EQ(*value, it->second);
+    }
+    ASSERT_EQ(map.size(), want.size());
+  }
+  for (const auto& k : pool) {
+    const int* v = map.Find(k);
+    auto it = want.find(WgKeyToBase64(k));
+    ASSERT_EQ(v != nullptr, it != want.end());
+    if (v != nullptr) {
+      EXPECT_EQ(*v, it->second);
+    }
+  }
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.Find(pool[0]), nullptr);
+}
+
+TEST(PeerIndex, DropsUndecodableAndDuplicateKeys) {
+  std::mt19937_64 rng(4);
+  const std::string a = Key(&rng), b = Key(&rng);
+  PeerIndex index({Peer(a, 1), Peer("not a key"), Peer(b, 2), Peer(a, 3)});
+  ASSERT_EQ(index.peers().size(), 2u);
+  WgKey ka, kb;
+  ASSERT_TRUE(WgKeyFromBase64(a, &ka));
+  ASSERT_TRUE(WgKeyFromBase64(b, &kb));
+  ASSERT_NE(index.Find(ka), nullptr);
+  EXPECT_EQ(index.Find(ka)->handshake, 1);  // the first listing wins
+  EXPECT_EQ(index.IndexOf(kb), 1);
+  EXPECT_EQ(index.IndexOf(RandomKey(&rng)), -1);
+}
+
+TEST(DiffPeers, AddedRemovedAndHandshaken) {
+  std::mt19937_64 rng(5);
+  const std::string a = Key(&rng), b = Key(&rng), c = Key(&rng);
+  PeerIndex before({Peer(a, 10), Peer(b, 20)});
+  PeerIndex after({Peer(c, 0), Peer(b, 25), Peer(a, 10)});
+  PeerSetDiff diff = DiffPeers(before, after);
+  EXPECT_EQ(diff.added, std::vector<size_t>{0});
+  EXPECT_TRUE(diff.removed.empty());
+  EXPECT_EQ(diff.handshaken, std::vector<size_t>{1});
+
+  diff = DiffPeers(after, PeerIndex({Peer(a, 10)}));
+  EXPECT_TRUE(diff.added.empty());
+  EXPECT_EQ(diff.removed, (std::vector<size_t>{0, 1}));
+  EXPECT_TRUE(diff.handshaken.empty());
+}
+
+TEST(PeerSnapshots, FirstUpdateAddsEverythingAndForgetResets) {
+  std::mt19937_64 rng(6);
+  const std::string a = Key(&rng), b = Key(&rng);
+  PeerSnapshots snaps;
+  EXPECT_EQ(snaps.Get("wg0"), nullptr);
+  EXPECT_EQ(snaps.Update("wg0", {Peer(a), Peer(b)}).added.size(), 2u);
+  EXPECT_TRUE(snaps.Update("wg0", {Peer(a), Peer(b)}).Unchanged());
+  snaps.Forget("wg0");
+  EXPECT_EQ(snaps.Get("wg0"), nullptr);
+  EXPECT_EQ(snaps.Update("wg0", {Peer(a), Peer(b)}).added.size(), 2u);
+}
+
+TEST(PeerSnapshots, SamePeersUpdateInPlaceUnlessSomeoneHoldsTheSnapshot) {
+  std::mt19937_64 rng(7);
+  const std::string a = Key(&rng), b = Key(&rng);
+  WgKey ka;
+  ASSERT_TRUE(WgKeyFromBase64(a, &ka));
+  PeerSnapshots snaps;
+  snaps.Update("wg0", {Peer(a, 1), Peer(b, 1)});
+  const PeerIndex* first = snaps.Get("wg0").get();
+
+  PeerSetDiff diff = snaps.Update("wg0", {Peer(a, 2), Peer(b, 1)});
+  EXPECT_EQ(diff.handshaken, std::vector<size_t>{0});
+  EXPECT_EQ(snaps.Get("wg0").get(), first);  // nobody held it: same object
+  EXPECT_EQ(snaps.Get("wg0")->Find(ka)->handshake, 2);
+
+  std::shared_ptr<const PeerIndex> held = snaps.Get("wg0");
+  diff = snaps.Update("wg0", {Peer(a, 3), Peer(b, 1)});
+  EXPECT_EQ(diff.handshaken, std::vector<size_t>{0});
+  EXPECT_EQ(held->Find(ka)->handshake, 2);  // the reader's copy is untouched
+  EXPECT_NE(snaps.Get("wg0").get(), held.get());
+  EXPECT_EQ(snaps.Get("wg0")->Find(ka)->handshake, 3);
+
+  // Same keys, new order: a rebuild, and nothing to report.
+  EXPECT_TRUE(snaps.Update("wg0", {Peer(b, 1), Peer(a, 3)}).Unchanged());
+  EXPECT_EQ(snaps.Get("wg0")->IndexOf(ka), 1);
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "phase_timer.h"
+
+namespace flutter_wireguard {
+namespace {
+
+TEST(PhaseHistogram, BucketBoundsCoverTheirValues) {
+  for (uint64_t us : {0ull, 1ull, 3ull, 4ull, 5ull, 7ull, 8ull, 1000ull,
+                      123456ull, 5000000ull, 1ull << 40}) {
+    const int b = PhaseHistogram::BucketOf(us);
+    EXPECT_LE(us, PhaseHistogram::UpperBoundOf(b)) << us;
+    if (b > 0) {
+      EXPECT_GT(us, PhaseHistogram::UpperBoundOf(b - 1)) << us;
+    }
+  }
+  // Buckets are contiguous and stay within 25% of their lower edge.
+  for (int b = PhaseHistogram::kSubBuckets; b < PhaseHistogram::kBuckets; ++b) {
+    const uint64_t lo = PhaseHistogram::UpperBoundOf(b - 1) + 1;
+    EXPECT_EQ(PhaseHistogram::BucketOf(lo), b);
+    EXPECT_LE(PhaseHistogram::UpperBoundOf(b) - lo, lo / 4) << b;
+  }
+}
+
+TEST(PhaseHistogram, PercentilesOfKnownDistribution) {
+  PhaseHistogram h;
+  EXPECT_EQ(h.PercentileUs(0.5), 0u);
+  for (uint64_t i = 1; i <= 100; ++i) h.Record(i * 1000);  // 1..100 ms
+  EXPECT_EQ(h.Count(), 100u);
+  auto near = [](uint64_t got, uint64_t want) {
+    return got >= want && got <= want + want / 4;
+  };
+  EXPECT_TRUE(near(h.PercentileUs(0.50), 50000)) << h.PercentileUs(0.50);
+  EXPECT_TRUE(near(h.PercentileUs(0.95), 95000)) << h.PercentileUs(0.95);
+  EXPECT_TRUE(near(h.PercentileUs(0.99), 99000)) << h.PercentileUs(0.99);
+  h.Reset();
+  EXPECT_EQ(h.Count(), 0u);
+}
+
+TEST(PhaseHistogram, ConcurrentRecordsAreAllCounted) {
+  PhaseHistogram h;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&h] {
+      for (int i = 0; i < 10000; ++i) h.Record(static_cast<uint64_t>(i));
+    });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(h.Count(), 40000u);
+}
+
+TEST(PhaseRegistry, TimersShowUpInSnapshot) {
+  auto& registry = PhaseRegistry::Instance();
+  registry.Reset();
+  {
+    PhaseTimer outer("test_op", "total");
+    PhaseTimer inner("test_op", "sleep");
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    inner.Stop();
+    inner.Stop();  // second Stop is a no-op
+  }
+  std::vector<PhaseSummary> rows;
+  for (auto& row : registry.Snapshot()) {
+    if (row.op == "test_op") rows.push_back(row);
+  }
+  ASSERT_EQ(rows.size(), 2u);
+  EXPECT_EQ(rows[0].phase, "sleep");  // ordered by (op, phase)
+  EXPECT_EQ(rows[1].phase, "total");
+  EXPECT_EQ(rows[0].count, 1u);
+  EXPECT_GE(rows[0].p50_us, 2000u);
+  EXPECT_GE(rows[1].p99_us, rows[0].p99_us);
+
+  registry.Reset();
+  for (const auto& row : registry.Snapshot()) EXPECT_NE(row.op, "test_op");
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -0,0 +1,225 @@
+#include <arpa/inet.h>
+#include <gio/gio.h>
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "resolved_dns.h"
+
+using flutter_wireguard::DnsPlan;
+using flutter_wireguard::DnsServer;
+using flutter_wireguard::ResolvedDns;
+
+namespace {
+
+constexpr char kIntrospection[] =
+    "<node>"
+    "  <interface name='org.freedesktop.resolve1.Manager'>"
+    "    <method name='SetLinkDNS'>"
+    "      <arg name='ifindex' type='i' direction='in'/>"
+    "      <arg name='addresses' type='a(iay)' direction='in'/>"
+    "    </method>"
+    "    <method name='SetLinkDomains'>"
+    "      <arg name='ifindex' type='i' direction='in'/>"
+    "      <arg name='domains' type='a(sb)' direction='in'/>"
+    "    </method>"
+    "    <method name='SetLinkDefaultRoute'>"
+    "      <arg name='ifindex' type='i' direction='in'/>"
+    "      <arg name='enable' type='b' direction='in'/>"
+    "    </method>"
+    "  </interface>"
+    "</node>";
+
+// A stand-in for systemd-resolved on a private bus: owns
+// org.freedesktop.resolve1, records each Manager call as text, and refuses
+// links above 100 the way resolved refuses unknown ones.
+class MockResolved {
+ public:
+  explicit MockResolved(const std::string& address) {
+    thread_ = std::thread([this, address] { Run(address); });
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this] { return ready_; });
+  }
+
+  ~MockResolved() {
+    // From inside the loop, so a quit can't land before it starts running.
+    GSource* quit = g_idle_source_new();
+    g_source_set_callback(
+        quit,
+        [](gpointer loop) -> gboolean {
+          g_main_loop_quit(static_cast<GMainLoop*>(loop));
+          return G_SOURCE_REMOVE;
+        },
+        loop_, nullptr);
+    g_source_attach(quit, context_);
+    g_source_unref(quit);
+    thread_.join();
+  }
+
+  std::vector<std::string> calls() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return calls_;
+  }
+
+ private:
+  void Run(const std::string& address) {
+    GMainContext* context = g_main_context_new();
+    g_main_context_push_thread_default(context);
+    context_ = context;
+    loop_ = g_main_loop_new(context, FALSE);
+    GDBusConnection* bus = g_dbus_connection_new_for_address_sync(
+        address.c_str(),
+        static_cast<GDBusConnectionFlags>(
+            G_DBUS_CONNECTION_FLAGS_AUTHENTICATION_CLIENT |
+            G_DBUS_CONNECTION_FLAGS_MESSAGE_BUS_CONNECTION),
+        nullptr, nullptr, nullptr);
+    GDBusNodeInfo* node = g_dbus_node_info_new_for_xml(kIntrospection, nullptr);
+    static const GDBusInterfaceVTable vtable = {&MockResolved::MethodCall, nullptr, nullptr, {}};
+    g_dbus_connection_register_object(bus, "/org/freedesktop/resolve1", node->interfaces[0],
+                                      &vtable, this, nullptr, nullptr);
+    GVariant* reply = g_dbus_connection_call_sync(
+        bus, "org.freedesktop.DBus", "/org/freedesktop/DBus", "org.freedesktop.DBus",
+        "RequestName", g_variant_new("(su)", "org.freedesktop.resolve1", 4u /* DO_NOT_QUEUE */),
+        G_VARIANT_TYPE("(u)"), G_DBUS_CALL_FLAGS_NONE, -1, nullptr, nullptr);
+    if (reply != nullptr) g_variant_unref(reply);
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      ready_ = true;
+    }
+    cv_.notify_all();
+    g_main_loop_run(loop_);
+    g_dbus_connection_close_sync(bus, nullptr, nullptr);
+    g_object_unref(bus);
+    g_dbus_node_info_unref(node);
+    g_main_loop_unref(loop_);
+    g_main_context_pop_thread_default(context);
+    g_main_context_unref(context);
+  }
+
+  static void MethodCall(GDBusConnection*, const gchar*, const gchar*, const gchar*,
+                         const gchar* method, GVariant* params,
+                         GDBusMethodInvocation* invocation, gpointer user_data) {
+    auto* self = static_cast<MockResolved*>(user_data);
+    gint32 ifindex = 0;
+    g_variant_get_child(params, 0, "i", &ifindex);
+    if (ifindex > 100) {
+      g_dbus_method_invocation_return_dbus_error(
+          invocation, "org.freedesktop.resolve1.NoSuchLink",
+          ("Link " + std::to_string(ifindex) + " not known").c_str());
+      return;
+    }
+    std::string call = std::string(method) + " " + std::to_string(ifindex);
+    const std::string name(method);
+    if (name == "SetLinkDefaultRoute") {
+      gboolean enable = FALSE;
+      g_variant_get_child(params, 1, "b", &enable);
+      call += enable ? " yes" : " no";
+    } else {
+      GVariant* list = g_variant_get_child_value(params, 1);
+      for (gsize i = 0; i < g_variant_n_children(list); ++i) {
+        GVariant* entry = g_variant_get_child_value(list, i);
+        if (name == "SetLinkDNS") {
+          gint32 family = 0;
+          g_variant_get_child(entry, 0, "i", &family);
+          GVariant* bytes = g_variant_get_child_value(entry, 1);
+          gsize n = 0;
+          const void* data = g_variant_get_fixed_array(bytes, &n, 1);
+          char text[INET6_ADDRSTRLEN] = "?";
+          if (n == (family == AF_INET6 ? 16u : 4u)) inet_ntop(family, data, text, sizeof(text));
+          call += std::string(" ") + text;
+          g_variant_unref(bytes);
+        } else {
+          const gchar* domain = nullptr;
+          gboolean routing = FALSE;
+          g_variant_get(entry, "(&sb)", &domain, &routing);
+          call += std::string(" ") + (routing ? "~" : "") + domain;
+        }
+        g_variant_unref(entry);
+      }
+      g_variant_unref(list);
+    }
+    {
+      std::lock_guard<std::mutex> lock(self->mu_);
+      self->calls_.push_back(call);
+    }
+    g_dbus_method_invocation_return_value(invocation, nullptr);
+  }
+
+  std::thread thread_;
+  GMainContext* context_ = nullptr;
+  GMainLoop* loop_ = nullptr;
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool ready_ = false;
+  std::vector<std::string> calls_;
+};
+
+class ResolvedDnsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    gchar* daemon = g_find_program_in_path("dbus-daemon");
+    if (daemon == nullptr) GTEST_SKIP() << "dbus-daemon not installed";
+    g_free(daemon);
+    bus_ = g_test_dbus_new(G_TEST_DBUS_NONE);
+    g_test_dbus_up(bus_);
+    address_ = g_test_dbus_get_bus_address(bus_);
+  }
+
+  void TearDown() override {
+    if (bus_ == nullptr) return;
+    g_test_dbus_down(bus_);
+    g_object_unref(bus_);
+  }
+
+  static DnsServer Server(const char* ip) {
+    DnsServer s;
+    flutter_wireguard::ParseIpAddress(ip, &s.address, &s.v6);
+    return s;
+  }
+
+  GTestDBus* bus_ = nullptr;
+  std::string address_;
+};
+
+}  // namespace
+
+TEST_F(ResolvedDnsTest, SetsServersDomainsAndDefaultRoute) {
+  MockResolved resolved(address_);
+  auto client = ResolvedDns::Connect(address_);
+  ASSERT_TRUE(client->Available());
+
+  DnsPlan plan;
+  plan.servers = {Server("10.9.0.1"), Server("fd00::53")};
+  plan.domains = {"corp.example"};
+  client->Apply(7, plan);
+  EXPECT_EQ(resolved.calls(), (std::vector<std::string>{
+                                  "SetLinkDNS 7 10.9.0.1 fd00::53",
+                                  "SetLinkDomains 7 corp.example ~.",
+                                  "SetLinkDefaultRoute 7 yes",
+                              }));
+}
+
+TEST_F(ResolvedDnsTest, ReportsWhatResolvedRefused) {
+  MockResolved resolved(address_);
+  auto client = ResolvedDns::Connect(address_);
+  DnsPlan plan;
+  plan.servers = {Server("1.1.1.1")};
+  try {
+    client->Apply(101, plan);
+    FAIL() << "expected Apply to throw";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()), "SetLinkDNS: Link 101 not known");
+  }
+  EXPECT_TRUE(resolved.calls().empty());
+}
+
+TEST_F(ResolvedDnsTest, UnavailableWithoutTheService) {
+  auto client = ResolvedDns::Connect(address_);
+  EXPECT_FALSE(client->Available());
+  EXPECT_THROW(client->Apply(7, DnsPlan{}), std::runtime_error);
+}
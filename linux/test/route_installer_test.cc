@@ -0,0 +1,371 @@
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "route_installer.h"
+
+using flutter_wireguard::FormatRouteEntry;
+using flutter_wireguard::IpBatchScript;
+using flutter_wireguard::NetlinkChannel;
+using flutter_wireguard::RouteInstaller;
+using flutter_wireguard::RoutePlan;
+using flutter_wireguard::TakeOverRoutes;
+
+namespace {
+
+// Plays rtnetlink: decodes every request, remembers what is installed and
+// acks each message, failing the ones whose destination is in `fail`.
+class FakeKernel : public NetlinkChannel {
+ public:
+  struct Request {
+    uint16_t type;
+    uint16_t flags;
+    std::string prefix;  // "10.0.0.0/8"
+    uint32_t oif = 0;
+    uint32_t table = 0;
+  };
+
+  std::vector<Request> requests;
+  std::vector<size_t> datagram_sizes;  // messages per datagram
+  std::map<std::string, int> fail;     // prefix -> errno
+  std::map<std::string, int> installed;
+  // Acks are split over this many datagrams, as a busy socket would.
+  size_t acks_per_reply = 50;
+
+  void Send(const std::string& datagram) override {
+    int left = static_cast<int>(datagram.size());
+    size_t count = 0;
+    for (auto* nh = reinterpret_cast<const nlmsghdr*>(datagram.data());
+         NLMSG_OK(nh, left); nh = NLMSG_NEXT(nh, left)) {
+      Request r = Decode(nh);
+      int error = 0;
+      auto f = fail.find(r.prefix);
+      const bool add = r.type == RTM_NEWROUTE || r.type == RTM_NEWADDR;
+      if (add && f != fail.end()) {
+        error = -f->second;
+      } else if (add) {
+        ++installed[r.prefix];
+      } else if (installed.erase(r.prefix) == 0) {
+        error = -ESRCH;
+      }
+      requests.push_back(r);
+      Ack(nh->nlmsg_seq, error);
+      ++count;
+    }
+    datagram_sizes.push_back(count);
+  }
+
+  std::string Receive() override {
+    if (replies_.empty()) throw std::runtime_error("netlink: no reply from the kernel");
+    std::string out = std::move(replies_.front());
+    replies_.erase(replies_.begin());
+    return out;
+  }
+
+ private:
+  static Request Decode(const nlmsghdr* nh) {
+    Request r;
+    r.type = nh->nlmsg_type;
+    r.flags = nh->nlmsg_flags;
+    uint8_t bits = 0;
+    int family = 0;
+    const rtattr* rta;
+    int len;
+    if (r.type == RTM_NEWADDR || r.type == RTM_DELADDR) {
+      auto* m = static_cast<const ifaddrmsg*>(NLMSG_DATA(nh));
+      bits = m->ifa_prefixlen;
+      family = m->ifa_family;
+      r.oif = m->ifa_index;
+      rta = IFA_RTA(m);
+      len = static_cast<int>(IFA_PAYLOAD(nh));
+    } else {
+      auto* m = static_cast<const rtmsg*>(NLMSG_DATA(nh));
+      bits = m->rtm_dst_len;
+      family = m->rtm_family;
+      r.table = m->rtm_table;
+      rta = RTM_RTA(m);
+      len = static_cast<int>(RTM_PAYLOAD(nh));
+    }
+    uint8_t addr[16] = {};
+    for (; RTA_OK(rta, len); rta = RTA_NEXT(rta, len)) {
+      const bool is_addr = (r.type == RTM_NEWADDR || r.type == RTM_DELADDR)
+                               ? rta->rta_type == IFA_LOCAL
+                               : rta->rta_type == RTA_DST;
+      if (is_addr) std::memcpy(addr, RTA_DATA(rta), RTA_PAYLOAD(rta));
+      if (r.type != RTM_NEWADDR && r.type != RTM_DELADDR) {
+        if (rta->rta_type == RTA_OIF) std::memcpy(&r.oif, RTA_DATA(rta), 4);
+        if (rta->rta_type == RTA_TABLE) std::memcpy(&r.table, RTA_DATA(rta), 4);
+      }
+    }
+    flutter_wireguard::RouteEntry e;
+    e.v6 = family == AF_INET6;
+    e.bits = bits;
+    for (int i = 0; i < 8; ++i) {
+      e.key.hi = e.key.hi << 8 | addr[i];
+      e.key.lo = e.key.lo << 8 | addr[8 + i];
+    }
+    if (!e.v6) e.key = {e.key.hi & 0xffffffff00000000ULL, 0};
+    r.prefix = FormatRouteEntry(e);
+    return r;
+  }
+
+  void Ack(uint32_t seq, int error) {
+    if (replies_.empty() || pending_ == acks_per_reply) {
+      replies_.emplace_back();
+      pending_ = 0;
+    }
+    struct {
+      nlmsghdr nh;
+      nlmsgerr err;
+    } ack{};
+    ack.nh.nlmsg_len = sizeof(ack);
+    ack.nh.nlmsg_type = NLMSG_ERROR;
+    ack.nh.nlmsg_seq = seq;
+    ack.err.error = error;
+    replies_.back().append(reinterpret_cast<const char*>(&ack), sizeof(ack));
+    ++pending_;
+  }
+
+  std::vector<std::string> replies_;
+  size_t pending_ = 0;
+};
+
+// Every other /24 from 10.100.0.0 on, so none of them aggregate.
+std::string SplitTunnel(int prefixes, const std::string& interface_extra = "") {
+  std::string c = "[Interface]\nPrivateKey = k\nAddress = 10.9.0.2/24, fd00:9::2/64\n" +
+                  interface_extra + "[Peer]\nPublicKey = p\nAllowedIPs = ";
+  for (int i = 0; i < prefixes; ++i) {
+    c += (i ? ", 10." : "10.") + std::to_string(2 * i / 256 + 100) + "." +
+         std::to_string(2 * i % 256) + ".0/24";
+  }
+  return c + "\n";
+}
+
+flutter_wireguard::RouteEntry Entry(const std::string& prefix, bool host_bits = false) {
+  flutter_wireguard::RouteEntry e;
+  EXPECT_TRUE(flutter_wireguard::ParseIpPrefix(prefix, &e.key, &e.bits, &e.v6));
+  if (host_bits) {
+    EXPECT_TRUE(flutter_wireguard::ParseIpAddress(prefix.substr(0, prefix.find('/')),
+                                                  &e.key, &e.v6));
+  }
+  return e;
+}
+
+RoutePlan Plan(const std::string& config) {
+  std::string rewritten;
+  RoutePlan plan;
+  EXPECT_TRUE(TakeOverRoutes(config, &rewritten, &plan));
+  return plan;
+}
+
+}  // namespace
+
+TEST(TakeOverRoutes, RewritesLargeConfigsForWgQuick) {
+  std::string rewritten;
+  RoutePlan plan;
+  ASSERT_TRUE(TakeOverRoutes(SplitTunnel(20, "Table = auto\nDNS = 1.1.1.1\n"),
+                             &rewritten, &plan));
+  EXPECT_EQ(rewritten.rfind("[Interface]\nTable = off\nPrivateKey = k\nDNS = 1.1.1.1\n", 0),
+            0u)
+      << rewritten;
+  EXPECT_EQ(rewritten.find("Address"), std::string::npos);
+  EXPECT_EQ(rewritten.find("auto"), std::string::npos);
+  ASSERT_EQ(plan.addresses.size(), 2u);
+  EXPECT_EQ(FormatRouteEntry(plan.addresses[0]), "10.9.0.2/24");  // host bits kept
+  EXPECT_EQ(FormatRouteEntry(plan.addresses[1]), "fd00:9::2/64");
+  EXPECT_EQ(plan.routes.size(), 20u);
+  EXPECT_EQ(plan.table, 0u);
+}
+
+TEST(TakeOverRoutes, LeavesWgQuickSpecialCasesAlone) {
+  std::string rewritten = "unchanged";
+  RoutePlan plan;
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(15), &rewritten, &plan));
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(20, "Table = off\n"), &rewritten, &plan));
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(20, "Table = vpn\n"), &rewritten, &plan));
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(20, "PostUp = ip rule add x\n"), &rewritten, &plan));
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(20) + "[Peer]\nAllowedIPs = 0.0.0.0/0\n",
+                              &rewritten, &plan));
+  EXPECT_FALSE(TakeOverRoutes(SplitTunnel(20) + "[Peer]\nAllowedIPs = 10.0.0.0/99\n",
+                              &rewritten, &plan));
+  EXPECT_EQ(rewritten, "unchanged");
+
+  // A default route is fine in a table of its own: no fwmark scheme there.
+  // It covers the twenty /24s, so they aggregate away.
+  const RoutePlan own = Plan(SplitTunnel(20, "Table = 52001\n") +
+                             "[Peer]\nAllowedIPs = 0.0.0.0/0, ::/0\n");
+  EXPECT_EQ(own.table, 52001u);
+  EXPECT_EQ(own.routes.size(), 2u);
+}
+
+TEST(TakeOverRoutes, SkipsConnectedAndDuplicateRoutesLongestFirst) {
+  const RoutePlan plan = Plan(SplitTunnel(20) +
+                              "[Peer]\nAllowedIPs = 10.9.0.0/24, 10.9.0.128/25, "
+                              "fd00:9::/64, 11.0.0.0/8, 10.100.2.0/24\n");
+  // 10.9.0.0/24 and below are the Address's connected route, and so is
+  // fd00:9::/64; 10.100.2.0/24 is listed twice.
+  ASSERT_EQ(plan.routes.size(), 21u);
+  EXPECT_EQ(FormatRouteEntry(plan.routes.back()), "11.0.0.0/8");
+  for (const auto& r : plan.routes) {
+    EXPECT_NE(FormatRouteEntry(r).rfind("10.9.", 0), 0u);
+    EXPECT_FALSE(r.v6);
+  }
+}
+
+TEST(TakeOverRoutes, AggregatesAcrossPeers) {
+  std::string config = "[Interface]\nAddress = 10.9.0.2/32\n";
+  // 10.200.0.0/24 .. 10.200.15.0/24 over four peers, plus covered leftovers.
+  for (int peer = 0; peer < 4; ++peer) {
+    config += "[Peer]\nPublicKey = p" + std::to_string(peer) + "\nAllowedIPs = ";
+    for (int i = peer; i < 16; i += 4) config += "10.200." + std::to_string(i) + ".0/24,";
+    config += "10.200.1.7/32\n";
+  }
+  config += "[Peer]\nPublicKey = q\nAllowedIPs = 0.0.0.0/1, 128.0.0.0/1, ::/1, 8000::/1\n";
+  const RoutePlan plan = Plan(config);
+  std::vector<std::string> routes;
+  for (const auto& r : plan.routes) routes.push_back(FormatRouteEntry(r));
+  // The /24s and /32s disappear into the two /1s, which stay split.
+  EXPECT_EQ(routes, (std::vector<std::string>{"0.0.0.0/1", "128.0.0.0/1", "::/1", "8000::/1"}));
+
+  // In a table of its own, a whole family is just /0.
+  const RoutePlan own = Plan("[Interface]\nTable = 1000\n" +
+                             config.substr(std::string("[Interface]\n").size()));
+  ASSERT_EQ(own.routes.size(), 2u);
+  EXPECT_EQ(FormatRouteEntry(own.routes[0]), "0.0.0.0/0");
+  EXPECT_EQ(FormatRouteEntry(own.routes[1]), "::/0");
+}
+
+TEST(IpBatchScript, AddressesThenRoutesInTheirTable) {
+  RoutePlan plan = Plan(SplitTunnel(16, "Table = 52001\n"));
+  const std::string script = IpBatchScript("wg0", plan);
+  EXPECT_EQ(script.rfind("address add 10.9.0.2/24 dev wg0\n"
+                         "address add fd00:9::2/64 dev wg0\n"
+                         "route append 10.100.0.0/24 dev wg0 table 52001\n",
+                         0),
+            0u)
+      << script;
+  EXPECT_EQ(std::count(script.begin(), script.end(), '\n'), 18);
+}
+
+TEST(RouteInstaller, PacksMessagesAndCollectsEveryAck) {
+  auto kernel_owner = std::make_unique<FakeKernel>();
+  FakeKernel* kernel = kernel_owner.get();
+  RouteInstaller installer(std::move(kernel_owner));
+  const RoutePlan plan = Plan(SplitTunnel(2000));
+  installer.Install(7, plan);
+
+  // 2 addresses + 2000 routes in ceil(2002 / 128) datagrams, not 2002.
+  EXPECT_EQ(installer.datagrams_sent(), 16u);
+  ASSERT_EQ(kernel->requests.size(), 2002u);
+  EXPECT_EQ(kernel->installed.size(), 2002u);
+  EXPECT_EQ(kernel->requests[0].type, RTM_NEWADDR);
+  EXPECT_EQ(kernel->requests[0].prefix, "10.9.0.2/24");
+  EXPECT_EQ(kernel->requests[0].oif, 7u);
+  const auto& route = kernel->requests[2];
+  EXPECT_EQ(route.type, RTM_NEWROUTE);
+  EXPECT_EQ(route.oif, 7u);
+  EXPECT_EQ(route.table, RT_TABLE_MAIN);
+  EXPECT_EQ(route.flags, NLM_F_REQUEST | NLM_F_ACK | NLM_F_CREATE);
+  EXPECT_EQ(kernel->requests[0].flags,
+            NLM_F_REQUEST | NLM_F_ACK | NLM_F_CREATE | NLM_F_EXCL);
+}
+
+TEST(RouteInstaller, RollsBackWhatItAddedOnFailure) {
+  auto kernel_owner = std::make_unique<FakeKernel>();
+  FakeKernel* kernel = kernel_owner.get();
+  kernel->fail["10.102.8.0/24"] = ENETUNREACH;  // route 260, in the third datagram
+  RouteInstaller installer(std::move(kernel_owner));
+  const RoutePlan plan = Plan(SplitTunnel(1000));
+  try {
+    installer.Install(7, plan);
+    FAIL() << "expected a failure";
+  } catch (const std::runtime_error& e) {
+    EXPECT_EQ(std::string(e.what()),
+              std::string("route 10.102.8.0/24: ") + std::strerror(ENETUNREACH));
+  }
+  // Nothing sent past the failing datagram, and everything that went in came
+  // back out, routes first.
+  EXPECT_EQ(kernel->installed.size(), 0u);
+  size_t adds = 0;
+  for (const auto& r : kernel->requests) {
+    adds += r.type == RTM_NEWROUTE || r.type == RTM_NEWADDR;
+  }
+  EXPECT_EQ(adds, 3 * RouteInstaller::kBatchMessages);
+  EXPECT_EQ(kernel->requests.back().type, RTM_DELADDR);
+  EXPECT_EQ(kernel->requests.size(), 2 * adds - 1);
+}
+
+TEST(RouteInstaller, LeavesConnectedAndExistingRoutesAlone) {
+  auto kernel_owner = std::make_unique<FakeKernel>();
+  FakeKernel* kernel = kernel_owner.get();
+  RouteInstaller installer(std::move(kernel_owner));
+  // Handed over as is, not through TakeOverRoutes: Address = 10.8.0.2/24
+  // with a peer's AllowedIPs = 10.8.0.0/24, the usual split tunnel.
+  RoutePlan plan = Plan(SplitTunnel(16));
+  plan.addresses = {Entry("10.8.0.2/24", true), Entry("fd00:8::2/64", true)};
+  plan.routes.insert(plan.routes.begin(), {Entry("10.8.0.0/24"), Entry("fd00:8::/64")});
+  // One AllowedIPs route is already on the link, from an earlier run.
+  kernel->fail["10.100.2.0/24"] = EEXIST;
+
+  installer.Install(7, plan);
+  for (const auto& r : kernel->requests) {
+    EXPECT_NE(r.prefix, "10.8.0.0/24");
+    EXPECT_NE(r.prefix, "fd00:8::/64");
+  }
+  EXPECT_EQ(kernel->requests.size(), 2u + 16u);
+  const std::string script = IpBatchScript("wg0", plan);
+  EXPECT_EQ(script.find("route append 10.8.0.0/24"), std::string::npos) << script;
+  EXPECT_EQ(std::count(script.begin(), script.end(), '\n'), 2 + 16);
+
+  // A later failure takes back what this call added, not the one it found.
+  kernel->fail["10.100.30.0/24"] = ENETUNREACH;
+  kernel->installed.clear();
+  kernel->requests.clear();
+  EXPECT_THROW(installer.Install(7, plan), std::runtime_error);
+  for (const auto& r : kernel->requests) {
+    if (r.type == RTM_DELROUTE) {
+      EXPECT_NE(r.prefix, "10.100.2.0/24");
+    }
+  }
+  EXPECT_TRUE(kernel->installed.empty());
+
+  // In a table of its own the kernel's connected route is no obstacle.
+  plan.table = 52001;
+  kernel->fail.clear();
+  kernel->requests.clear();
+  installer.Install(7, plan);
+  EXPECT_EQ(kernel->requests.size(), 2u + 18u);
+}
+
+TEST(RouteInstaller, TableAboveByteRangeGoesInAnAttribute) {
+  auto kernel_owner = std::make_unique<FakeKernel>();
+  FakeKernel* kernel = kernel_owner.get();
+  RouteInstaller installer(std::move(kernel_owner));
+  installer.Install(3, Plan(SplitTunnel(16, "Table = 52001\n")));
+  EXPECT_EQ(kernel->requests.back().table, 52001u);
+}
+
+TEST(RouteInstaller, LostAcksCountAsAddedForRollback) {
+  // A kernel that processes the batch but whose acks never arrive.
+  class Mute : public FakeKernel {
+   public:
+    std::string Receive() override {
+      throw std::runtime_error("netlink: no reply from the kernel");
+    }
+  };
+  auto kernel_owner = std::make_unique<Mute>();
+  Mute* kernel = kernel_owner.get();
+  RouteInstaller installer(std::move(kernel_owner));
+  EXPECT_THROW(installer.Install(3, Plan(SplitTunnel(20))), std::runtime_error);
+  EXPECT_EQ(kernel->installed.size(), 0u);
+}
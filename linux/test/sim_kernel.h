@@ -0,0 +1,238 @@
+// Simulated WireGuard host for load-testing the status path at scale.
+//
+// SimKernel models N tunnels x M peers with counters that grow every tick
+// at per-peer rates and handshakes that renew every ~2 minutes, and mirrors
+// each up tunnel into a synthetic /sys/class/net tree so
+// WgBackend::ReadSysfsCounters reads real files. SimPrivilegedSession and
+// SimProcessRunner plug it into WgBackend in place of pkexec / wg-quick,
+// in the same way FakePrivilegedSession does in wg_backend_test.cc, but
+// answering from the simulated state instead of scripted queues.
+#ifndef FLUTTER_WIREGUARD_TEST_SIM_KERNEL_H_
+#define FLUTTER_WIREGUARD_TEST_SIM_KERNEL_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "privileged_session.h"
+#include "process_runner.h"
+
+namespace flutter_wireguard {
+namespace sim {
+
+class SimKernel {
+ public:
+  struct Peer {
+    std::string public_key;
+    std::string endpoint;
+    std::string allowed_ips;
+    int64_t rx = 0;
+    int64_t tx = 0;
+    int64_t handshake_s = 0;  // 0 = never
+    int64_t rx_rate = 0;      // bytes per second
+    int64_t tx_rate = 0;
+  };
+
+  struct Tunnel {
+    std::vector<Peer> peers;
+    bool up = false;
+  };
+
+  // Tunnels are named sim0..sim<tunnels-1>. About one peer in ten is idle
+  // (no traffic, no handshake) to keep the handshake aggregation honest.
+  SimKernel(int tunnels, int peers, std::string sysfs_root, uint32_t seed = 1)
+      : sysfs_root_(std::move(sysfs_root)), rng_(seed) {
+    std::uniform_int_distribution<int64_t> rate(1000, 2000000);
+    std::uniform_int_distribution<int> idle(0, 9);
+    std::uniform_int_distribution<int64_t> age(0, 119);
+    for (int t = 0; t < tunnels; ++t) {
+      Tunnel tunnel;
+      for (int p = 0; p < peers; ++p) {
+        Peer peer;
+        peer.public_key = Key(t, p);
+        peer.endpoint = "198.51.100." + std::to_string(p % 250 + 1) + ":51820";
+        peer.allowed_ips = "10." + std::to_string(t % 250) + "." +
+                           std::to_string(p % 250) + ".0/24";
+        if (idle(rng_) != 0) {
+          peer.rx_rate = rate(rng_);
+          peer.tx_rate = rate(rng_) / 4;
+          peer.handshake_s = now_s_ - age(rng_);
+        }
+        tunnel.peers.push_back(std::move(peer));
+      }
+      tunnels_["sim" + std::to_string(t)] = std::move(tunnel);
+    }
+  }
+
+  std::vector<std::string> Names() const {
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<std::string> out;
+    for (const auto& [name, _] : tunnels_) out.push_back(name);
+    return out;
+  }
+
+  // `wg-quick up` / `down`: the interface appears in / leaves sysfs.
+  bool Up(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it == tunnels_.end()) return false;
+    it->second.up = true;
+    WriteSysfsLocked(name, it->second);
+    return true;
+  }
+
+  bool Down(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it == tunnels_.end() || !it->second.up) return false;
+    it->second.up = false;
+    std::error_code ec;
+    std::filesystem::remove_all(std::filesystem::path(sysfs_root_) / name, ec);
+    return true;
+  }
+
+  // One second of traffic: counters grow at each peer's rate (+-25%) and
+  // handshakes older than two minutes renew, as WireGuard's rekey timer
+  // does. Up tunnels' sysfs counters are rewritten.
+  void Advance() {
+    std::lock_guard<std::mutex> lock(mu_);
+    ++now_s_;
+    std::uniform_int_distribution<int> jitter(75, 125);
+    for (auto& [name, tunnel] : tunnels_) {
+      if (!tunnel.up) continue;
+      for (auto& p : tunnel.peers) {
+        if (p.rx_rate == 0) continue;
+        p.rx += p.rx_rate * jitter(rng_) / 100;
+        p.tx += p.tx_rate * jitter(rng_) / 100;
+        if (now_s_ - p.handshake_s >= 120) p.handshake_s = now_s_;
+      }
+      WriteSysfsLocked(name, tunnel);
+    }
+  }
+
+  // `wg show <iface> dump`, tab-separated as the real tool prints it.
+  bool Dump(const std::string& name, std::string* out) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tunnels_.find(name);
+    if (it == tunnels_.end() || !it->second.up) return false;
+    *out = "cHJpdmF0ZQ==\tcHVibGlj\t51820\toff\n";
+    for (const auto& p : it->second.peers) {
+      *out += p.public_key + "\t(none)\t" + p.endpoint + "\t" + p.allowed_ips +
+              "\t" + std::to_string(p.handshake_s) + "\t" +
+              std::to_string(p.rx) + "\t" + std::to_string(p.tx) + "\t25\n";
+    }
+    return true;
+  }
+
+  // What a correct Status() must report for `name`.
+  void Expected(const std::string& name, int64_t* rx, int64_t* tx,
+                int64_t* handshake_ms) const {
+    std::lock_guard<std::mutex> lock(mu_);
+    *rx = *tx = *handshake_ms = 0;
+    for (const auto& p : tunnels_.at(name).peers) {
+      *rx += p.rx;
+      *tx += p.tx;
+      if (p.handshake_s * 1000 > *handshake_ms) *handshake_ms = p.handshake_s * 1000;
+    }
+  }
+
+ private:
+  static std::string Key(int t, int p) {
+    // 44-char base64-looking key, unique per (tunnel, peer).
+    std::string k = std::to_string(t) + "x" + std::to_string(p);
+    k.resize(43, 'A');
+    return k + "=";
+  }
+
+  void WriteSysfsLocked(const std::string& name, const Tunnel& tunnel) {
+    int64_t rx = 0, tx = 0;
+    for (const auto& p : tunnel.peers) {
+      rx += p.rx;
+      tx += p.tx;
+    }
+    const auto dir = std::filesystem::path(sysfs_root_) / name / "statistics";
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    std::ofstream(dir / "rx_bytes") << rx << "\n";
+    std::ofstream(dir / "tx_bytes") << tx << "\n";
+  }
+
+  const std::string sysfs_root_;
+  mutable std::mutex mu_;
+  std::mt19937 rng_;
+  int64_t now_s_ = 1700000000;
+  std::map<std::string, Tunnel> tunnels_;
+};
+
+// PrivilegedSession answering from a SimKernel. Every op succeeds unless
+// the tunnel does not exist, mirroring wg / wg-quick exit codes.
+class SimPrivilegedSession : public PrivilegedSession {
+ public:
+  explicit SimPrivilegedSession(SimKernel* kernel) : kernel_(kernel) {}
+
+  ProcessResult ShowDump(const std::string& iface) override {
+    std::string out;
+    if (!kernel_->Dump(iface, &out)) {
+      return {1, "", "Unable to access interface: No such device\n"};
+    }
+    return {0, std::move(out), ""};
+  }
+  ProcessResult WgQuickUp(const std::string& conf_path,
+                          const std::string&) override {
+    return UpResult(std::filesystem::path(conf_path).stem().string());
+  }
+  ProcessResult WgQuickDown(const std::string& conf_path) override {
+    kernel_->Down(std::filesystem::path(conf_path).stem().string());
+    return {0, "", ""};
+  }
+  ProcessResult WgQuickUpInline(const std::string& iface, const std::string&,
+                                const std::string&) override {
+    return UpResult(iface);
+  }
+  ProcessResult WgQuickDownByName(const std::string& iface) override {
+    return kernel_->Down(iface) ? ProcessResult{0, "", ""}
+                                : ProcessResult{1, "", "Cannot find device\n"};
+  }
+  ProcessResult InstallPolicyRules(uint32_t, uint32_t) override {
+    return {0, "", ""};
+  }
+  ProcessResult InstallRoutes(const std::string&, const RoutePlan&) override {
+    return {0, "", ""};
+  }
+
+ private:
+  ProcessResult UpResult(const std::string& iface) {
+    return kernel_->Up(iface) ? ProcessResult{0, "", ""}
+                              : ProcessResult{1, "", "no such sim tunnel\n"};
+  }
+
+  SimKernel* kernel_;
+};
+
+// Unprivileged probes: wireguard-tools plus wireguard-go are "installed";
+// nothing is ever actually run.
+class SimProcessRunner : public ProcessRunner {
+ public:
+  ProcessResult Run(const std::vector<std::string>&,
+                    const std::map<std::string, std::string>&,
+                    const std::optional<std::string>&) override {
+    return {0, "", ""};
+  }
+  bool HasBinary(const std::string& name) override {
+    static const std::set<std::string> kInstalled = {"wg", "wg-quick",
+                                                     "wireguard-go"};
+    return kInstalled.count(name) > 0;
+  }
+};
+
+}  // namespace sim
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_TEST_SIM_KERNEL_H_
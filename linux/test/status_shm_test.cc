@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "status_segment.h"
+#include "status_shm.h"
+
+namespace flutter_wireguard {
+namespace {
+
+namespace ipc = flutter_wireguard::ipc;
+
+ipc::StatusRecord Rec(const std::string& name, int64_t v) {
+  ipc::StatusRecord r;
+  r.name = name;
+  r.state = ipc::kStateUp;
+  r.rx = v;
+  r.tx = v;
+  r.handshake_ms = v;
+  return r;
+}
+
+TEST(StatusSegment, ReadReturnsLatestPublishedRecord) {
+  std::vector<uint8_t> mem(ipc::StatusSegmentBytes(4) + 64);
+  // StatusSlot is 64-byte aligned; give the block the same alignment.
+  void* base = mem.data() + (64 - reinterpret_cast<uintptr_t>(mem.data()) % 64) % 64;
+  ipc::StatusSegmentWriter w(base, ipc::StatusSegmentBytes(4), 4);
+  ipc::StatusSegmentReader r(base, ipc::StatusSegmentBytes(4));
+
+  ipc::StatusRecord out;
+  EXPECT_FALSE(r.Read("wg0", &out));
+  EXPECT_EQ(w.Publish({Rec("wg0", 5), Rec("home", 7)}), 2u);
+  ASSERT_TRUE(r.Read("wg0", &out));
+  EXPECT_EQ(out.name, "wg0");
+  EXPECT_EQ(out.state, ipc::kStateUp);
+  EXPECT_EQ(out.rx, 5);
+  ASSERT_TRUE(r.Read("home", &out));
+  EXPECT_EQ(out.tx, 7);
+  EXPECT_FALSE(r.Read("../x", &out));
+}
+
+TEST(StatusSegment, UnchangedRecordsDoNotBumpSeqOrGeneration) {
+  SharedStatusSegment seg(4);
+  auto view = MapLocalView(seg);
+  seg.Publish({Rec("wg0", 1), Rec("wg1", 1)});
+  uint32_t gen = view->reader().Generation();
+
+  std::vector<uint32_t> seen;
+  std::vector<std::string> changed;
+  view->reader().ForEachChanged(
+      &seen, [&](const ipc::StatusRecord& r) { changed.push_back(r.name); });
+  EXPECT_EQ(changed, (std::vector<std::string>{"wg0", "wg1"}));
+
+  EXPECT_EQ(seg.Publish({Rec("wg0", 1), Rec("wg1", 2)}), 1u);
+  EXPECT_EQ(view->reader().Generation(), gen + 1);
+  changed.clear();
+  view->reader().ForEachChanged(
+      &seen, [&](const ipc::StatusRecord& r) { changed.push_back(r.name); });
+  EXPECT_EQ(changed, (std::vector<std::string>{"wg1"}));
+
+  EXPECT_EQ(seg.Publish({Rec("wg0", 1), Rec("wg1", 2)}), 0u);
+  EXPECT_EQ(view->reader().Generation(), gen + 1);
+}
+
+TEST(StatusSegment, FullTableHandsBackNewNames) {
+  SharedStatusSegment seg(2);
+  auto view = MapLocalView(seg);
+  std::vector<ipc::StatusRecord> unplaced;
+  EXPECT_EQ(seg.Publish({Rec("a", 1), Rec("b", 1), Rec("c", 3)}, &unplaced), 2u);
+  ipc::StatusRecord out;
+  EXPECT_TRUE(view->reader().Read("b", &out));
+  EXPECT_FALSE(view->reader().Read("c", &out));
+  ASSERT_EQ(unplaced.size(), 1u);
+  EXPECT_EQ(unplaced[0].name, "c");
+  EXPECT_EQ(unplaced[0].rx, 3);
+}
+
+TEST(StatusSegment, RetainFreesSlotsOfStoppedTunnelsForNewNames) {
+  SharedStatusSegment seg(2);
+  auto view = MapLocalView(seg);
+  seg.Publish({Rec("a", 1), Rec("b", 1)});
+  std::vector<uint32_t> seen;
+  std::vector<std::string> changed;
+  auto collect = [&](const ipc::StatusRecord& r) { changed.push_back(r.name); };
+  view->reader().ForEachChanged(&seen, collect);
+
+  // "a" stops: its slot stays until its down state has been published.
+  EXPECT_EQ(seg.Retain({"b"}), 0u);
+  ipc::StatusRecord down = Rec("a", 1);
+  down.state = ipc::kStateDown;
+  seg.Publish({down, Rec("b", 1)});
+  changed.clear();
+  view->reader().ForEachChanged(&seen, collect);
+  EXPECT_EQ(changed, (std::vector<std::string>{"a"}));
+
+  EXPECT_EQ(seg.Retain({"b"}), 1u);
+  ipc::StatusRecord out;
+  EXPECT_FALSE(view->reader().Read("a", &out));
+  EXPECT_TRUE(view->reader().Read("b", &out));
+  changed.clear();
+  view->reader().ForEachChanged(&seen, collect);
+  EXPECT_TRUE(changed.empty());  // a freed slot is not an event
+
+  // The freed slot goes to the next new name, which readers then see; the
+  // stopped tunnel's repeated down record is not placed again.
+  std::vector<ipc::StatusRecord> unplaced;
+  EXPECT_EQ(seg.Publish({down, Rec("b", 1), Rec("c", 4)}, &unplaced), 1u);
+  EXPECT_TRUE(unplaced.empty());
+  ASSERT_TRUE(view->reader().Read("c", &out));
+  EXPECT_EQ(out.rx, 4);
+  EXPECT_FALSE(view->reader().Read("a", &out));
+  view->reader().ForEachChanged(&seen, collect);
+  EXPECT_EQ(changed, (std::vector<std::string>{"c"}));
+
+  // Restarted, it needs a slot again; with none free it is handed back.
+  EXPECT_EQ(seg.Publish({Rec("a", 2)}, &unplaced), 0u);
+  ASSERT_EQ(unplaced.size(), 1u);
+  EXPECT_EQ(unplaced[0].name, "a");
+}
+
+TEST(StatusSegment, EventfdSignalsOnlyOnChange) {
+  SharedStatusSegment seg(4);
+  auto view = MapLocalView(seg);
+  EXPECT_FALSE(view->ConsumeNotification());
+  seg.Publish({Rec("wg0", 1)});
+  pollfd p{view->eventfd(), POLLIN, 0};
+  ASSERT_EQ(poll(&p, 1, 1000), 1);
+  EXPECT_TRUE(view->ConsumeNotification());
+  EXPECT_FALSE(view->ConsumeNotification());
+  seg.Publish({Rec("wg0", 1)});
+  EXPECT_FALSE(view->ConsumeNotification());
+}
+
+TEST(StatusSegment, ReaderNeverSeesTornRecord) {
+  // The writer keeps rx == tx == handshake_ms; a torn read would break that.
+  SharedStatusSegment seg(4);
+  auto view = MapLocalView(seg);
+  seg.Publish({Rec("wg0", 0)});
+  std::atomic<bool> stop{false};
+  std::thread writer([&] {
+    for (int64_t v = 1; !stop.load(std::memory_order_relaxed); ++v) {
+      seg.Publish({Rec("wg0", v * 0x100000001LL)});
+    }
+  });
+  int64_t last = 0;
+  for (int i = 0; i < 200000; ++i) {
+    ipc::StatusRecord r;
+    ASSERT_TRUE(view->reader().Read("wg0", &r));
+    ASSERT_EQ(r.rx, r.tx);
+    ASSERT_EQ(r.rx, r.handshake_ms);
+    ASSERT_GE(r.rx, last);
+    last = r.rx;
+  }
+  stop.store(true);
+  writer.join();
+}
+
+TEST(StatusSegment, ViewRejectsForeignMemfd) {
+  int fd = memfd_create("not_a_segment", MFD_CLOEXEC);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(ftruncate(fd, 4096), 0);
+  int efd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  EXPECT_THROW(StatusSegmentView(fd, efd), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
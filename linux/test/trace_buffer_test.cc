@@ -0,0 +1,87 @@
+// The plugin only compiles trace points in on request; test them regardless.
+#ifndef FLUTTER_WIREGUARD_TRACE
+#define FLUTTER_WIREGUARD_TRACE
+#endif
+#include "trace_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace flutter_wireguard {
+namespace {
+
+size_t CountOf(const std::string& haystack, const std::string& needle) {
+  size_t n = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + 1)) {
+    ++n;
+  }
+  return n;
+}
+
+TEST(TraceBuffer, RingKeepsTheNewestEvents) {
+  trace::ThreadRing ring;
+  const uint64_t total = trace::ThreadRing::kCapacity + 10;
+  for (uint64_t i = 0; i < total; ++i) ring.Push({"e", i, 0, 1, 'i'});
+  std::vector<trace::Event> out;
+  ring.CopyTo(&out);
+  ASSERT_EQ(out.size(), trace::ThreadRing::kCapacity);
+  EXPECT_EQ(out.front().ts_us, 10u);
+  EXPECT_EQ(out.back().ts_us, total - 1);
+}
+
+TEST(TraceBuffer, JsonHasCompleteAndInstantEvents) {
+  std::vector<trace::Event> events = {
+      {"pigeon.start", 100, 25, 7, 'X'},
+      {"worker.\"idle\"", 130, 0, 8, 'i'},
+  };
+  const std::string json = trace::ToJson(events);
+  EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+  EXPECT_NE(json.find("{\"name\":\"pigeon.start\",\"ph\":\"X\",\"ts\":100,"
+                      "\"dur\":25,"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"name\":\"worker.\\\"idle\\\"\",\"ph\":\"i\",\"s\":\"t\""),
+            std::string::npos);
+  EXPECT_NE(json.find("\"tid\":8}"), std::string::npos);
+}
+
+TEST(TraceBuffer, DumpCollectsEveryThread) {
+  {
+    FWG_TRACE_SCOPE("test.main_scope");
+    FWG_TRACE_INSTANT("test.main_instant");
+  }
+  std::thread([] { FWG_TRACE_SCOPE("test.worker_scope"); }).join();
+  // The exited worker's ring is recycled, not dropped.
+  std::thread([] { FWG_TRACE_INSTANT("test.second_worker"); }).join();
+
+  char path[] = "/tmp/fwg_trace_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  close(fd);
+  TraceDump(path);
+  std::ifstream in(path);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  std::remove(path);
+  const std::string json = ss.str();
+  EXPECT_EQ(CountOf(json, "\"test.main_scope\""), 1u);
+  EXPECT_EQ(CountOf(json, "\"test.main_instant\""), 1u);
+  EXPECT_EQ(CountOf(json, "\"test.worker_scope\""), 1u);
+  EXPECT_EQ(CountOf(json, "\"test.second_worker\""), 1u);
+}
+
+TEST(TraceBuffer, DumpToBadPathThrows) {
+  EXPECT_THROW(TraceDump("/nonexistent-dir/trace.json"), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
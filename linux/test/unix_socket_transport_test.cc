@@ -0,0 +1,422 @@
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <cstdlib>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "broker_dispatcher.h"
+#include "status_shm.h"
+#include "unix_socket_transport.h"
+
+namespace flutter_wireguard {
+namespace {
+
+namespace ipc = flutter_wireguard::ipc;
+
+class FakeService : public ipc::TunnelService {
+ public:
+  void Start(const std::string& name, const std::string& config) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (config.find("[Interface]") == std::string::npos) {
+      throw std::runtime_error("bad config");
+    }
+    up_[name] = true;
+  }
+  void Stop(const std::string& name) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    up_[name] = false;
+  }
+  ipc::StatusRecord Status(const std::string& name) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    ipc::StatusRecord r;
+    r.name = name;
+    r.state = up_[name] ? ipc::kStateUp : ipc::kStateDown;
+    return r;
+  }
+  std::vector<std::string> TunnelNames() override {
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<std::string> out;
+    for (const auto& kv : up_) out.push_back(kv.first);
+    return out;
+  }
+  ipc::BackendRecord Backend() override {
+    return {ipc::kBackendKernel, "fake"};
+  }
+  void SetStatusCallback(StatusCallback cb) override {
+    std::lock_guard<std::mutex> lock(mu_);
+    cb_ = std::move(cb);
+  }
+  bool SharedStatus(int* memfd, int* eventfd, uint32_t* slots,
+                    uint32_t* bytes) override {
+    if (!segment) return false;
+    *memfd = segment->memfd();
+    *eventfd = segment->eventfd();
+    *slots = segment->capacity();
+    *bytes = static_cast<uint32_t>(segment->size());
+    return true;
+  }
+  void Tick(const std::vector<ipc::StatusRecord>& tick) {
+    if (segment) segment->Publish(tick);
+    StatusCallback cb;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      cb = cb_;
+    }
+    if (cb) cb(tick);
+  }
+
+  std::unique_ptr<SharedStatusSegment> segment;
+
+ private:
+  std::mutex mu_;
+  std::map<std::string, bool> up_;
+  StatusCallback cb_;
+};
+
+struct Frame {
+  uint32_t op = 0;
+  uint32_t seq = 0;
+  uint8_t flags = 0;
+  std::vector<uint8_t> payload;
+};
+
+// Minimal synchronous client: one request at a time, events queued.
+class TestClient {
+ public:
+  explicit TestClient(const std::string& path)
+      : transport_(ConnectUnixSocket(path)) {}
+
+  void Send(uint32_t op, uint32_t seq, const std::vector<uint8_t>& payload) {
+    auto frame = ipc::BuildFrame(op, seq, 0, payload);
+    ASSERT_TRUE(transport_.Write(frame.data(), frame.size()));
+  }
+
+  // Returns false on EOF.
+  bool Next(Frame* out) {
+    while (ready_.empty()) {
+      uint8_t buf[4096];
+      size_t n = transport_.Read(buf, sizeof(buf));
+      if (n == 0) return false;
+      decoder_.Feed(buf, n, [this](const ipc::FrameView& f) {
+        ready_.push_back({f.op, f.seq, f.flags,
+                          std::vector<uint8_t>(f.payload,
+                                               f.payload + f.payload_len)});
+      });
+    }
+    *out = std::move(ready_.front());
+    ready_.pop_front();
+    return true;
+  }
+
+  std::vector<uint8_t> Call(uint32_t op, const std::vector<uint8_t>& payload) {
+    uint32_t seq = next_seq_++;
+    Send(op, seq, payload);
+    Frame f;
+    while (Next(&f)) {
+      if ((f.flags & ipc::kFlagEvent) != 0) {
+        events.push_back(std::move(f));
+        continue;
+      }
+      EXPECT_EQ(f.seq, seq);
+      return f.payload;
+    }
+    ADD_FAILURE() << "connection closed";
+    return {};
+  }
+
+  std::vector<Frame> events;
+
+ private:
+  UnixSocketTransport transport_;
+  ipc::FrameDecoder decoder_;
+  std::deque<Frame> ready_;
+  uint32_t next_seq_ = 1;
+};
+
+std::vector<uint8_t> HelloPayload() {
+  ipc::Writer w;
+  w.U32(ipc::kProtocolVersion);
+  return w.Take();
+}
+
+std::vector<uint8_t> NamePayload(const std::string& name) {
+  ipc::Writer w;
+  w.Str(name);
+  return w.Take();
+}
+
+class UnixSocketBrokerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    char tmpl[] = "/tmp/fwg_uds_XXXXXX";
+    ASSERT_NE(mkdtemp(tmpl), nullptr);
+    dir_ = tmpl;
+    path_ = dir_ + "/broker.sock";
+    dispatcher_ = std::make_unique<ipc::Dispatcher>(&service_);
+  }
+  void TearDown() override {
+    if (server_) server_->Stop();
+    server_.reset();
+    dispatcher_.reset();
+    rmdir(dir_.c_str());
+  }
+  void StartServer(uid_t allowed) {
+    server_ = std::make_unique<UnixSocketServer>(path_, allowed,
+                                                 dispatcher_.get());
+    server_->Start();
+  }
+
+  FakeService service_;
+  std::unique_ptr<ipc::Dispatcher> dispatcher_;
+  std::unique_ptr<UnixSocketServer> server_;
+  std::string dir_;
+  std::string path_;
+};
+
+TEST_F(UnixSocketBrokerTest, SocketIsOwnerOnly) {
+  StartServer(getuid());
+  struct stat st {};
+  ASSERT_EQ(stat(path_.c_str(), &st), 0);
+  EXPECT_EQ(st.st_mode & 0777, 0600u);
+}
+
+TEST_F(UnixSocketBrokerTest, HelloStartStatusRoundTrip) {
+  StartServer(getuid());
+  TestClient c(path_);
+
+  auto hello = c.Call(ipc::kOpHello, HelloPayload());
+  ipc::Reader hr(hello.data(), hello.size());
+  EXPECT_EQ(hr.U8(), ipc::kStatusOk);
+  EXPECT_EQ(hr.U32(), ipc::kProtocolVersion);
+
+  ipc::Writer sw;
+  sw.Str("wg0");
+  sw.Str("[Interface]\n");
+  auto start = c.Call(ipc::kOpStart, sw.Take());
+  ASSERT_FALSE(start.empty());
+  EXPECT_EQ(start[0], ipc::kStatusOk);
+
+  auto status = c.Call(ipc::kOpStatus, NamePayload("wg0"));
+  ipc::Reader sr(status.data(), status.size());
+  EXPECT_EQ(sr.U8(), ipc::kStatusOk);
+  EXPECT_EQ(sr.Str(), "wg0");
+  EXPECT_EQ(sr.U8(), ipc::kStateUp);
+
+  auto backend = c.Call(ipc::kOpBackend, {});
+  ipc::Reader br(backend.data(), backend.size());
+  EXPECT_EQ(br.U8(), ipc::kStatusOk);
+  EXPECT_EQ(br.U8(), ipc::kBackendKernel);
+  EXPECT_EQ(br.Str(), "fake");
+}
+
+TEST_F(UnixSocketBrokerTest, ServiceErrorsAndBadNamesBecomeErrorResponses) {
+  StartServer(getuid());
+  TestClient c(path_);
+
+  ipc::Writer sw;
+  sw.Str("wg0");
+  sw.Str("garbage");
+  auto start = c.Call(ipc::kOpStart, sw.Take());
+  ipc::Reader r1(start.data(), start.size());
+  EXPECT_EQ(r1.U8(), ipc::kStatusError);
+  EXPECT_EQ(r1.Str(), "bad config");
+
+  auto stop = c.Call(ipc::kOpStop, NamePayload("../etc"));
+  ipc::Reader r2(stop.data(), stop.size());
+  EXPECT_EQ(r2.U8(), ipc::kStatusError);
+  EXPECT_EQ(r2.Str(), "invalid tunnel name");
+
+  auto unknown = c.Call(77, {});
+  ipc::Reader r3(unknown.data(), unknown.size());
+  EXPECT_EQ(r3.U8(), ipc::kStatusError);
+}
+
+TEST_F(UnixSocketBrokerTest, EventsOnlyReachSubscribersInTheirEncoding) {
+  StartServer(getuid());
+  TestClient legacy(path_);
+  TestClient compact(path_);
+  TestClient silent(path_);
+  legacy.Call(ipc::kOpSubscribe, {});
+  compact.Call(ipc::kOpSubscribeCompact, {});
+  silent.Call(ipc::kOpHello, HelloPayload());
+
+  ipc::StatusRecord a;
+  a.name = "wg0";
+  a.state = ipc::kStateUp;
+  a.rx = 10;
+  ipc::StatusRecord b = a;
+  b.name = "wg1";
+  service_.Tick({a, b});
+
+  // Any later response proves every event written before it was seen.
+  legacy.Call(ipc::kOpTunnelNames, {});
+  compact.Call(ipc::kOpTunnelNames, {});
+  silent.Call(ipc::kOpTunnelNames, {});
+
+  ASSERT_EQ(legacy.events.size(), 2u);
+  EXPECT_EQ(legacy.events[0].op, ipc::kOpEventStatus);
+  EXPECT_EQ(legacy.events[0].seq, 0u);
+
+  ASSERT_EQ(compact.events.size(), 1u);
+  EXPECT_EQ(compact.events[0].op, ipc::kOpEventStatusDelta);
+  ipc::StatusDeltaDecoder dec;
+  auto recs = dec.Apply(compact.events[0].payload.data(),
+                        compact.events[0].payload.size());
+  ASSERT_EQ(recs.size(), 2u);
+  EXPECT_EQ(recs[1].name, "wg1");
+  EXPECT_EQ(recs[1].rx, 10);
+
+  EXPECT_TRUE(silent.events.empty());
+}
+
+TEST_F(UnixSocketBrokerTest, CompactSubscriberSurvivesRunningOutOfIds) {
+  StartServer(getuid());
+  TestClient compact(path_);
+  compact.Call(ipc::kOpSubscribeCompact, {});
+
+  std::vector<ipc::StatusRecord> tick;
+  for (uint32_t i = 0; i < ipc::kMaxDeltaTunnels; ++i) {
+    ipc::StatusRecord r;
+    r.name = "t" + std::to_string(i);
+    r.state = ipc::kStateUp;
+    tick.push_back(r);
+  }
+  service_.Tick(tick);
+  // One name past the last id: the session starts its ids over.
+  ipc::StatusRecord late;
+  late.name = "late";
+  late.rx = 3;
+  service_.Tick({late});
+  compact.Call(ipc::kOpTunnelNames, {});
+
+  ASSERT_EQ(compact.events.size(), 2u);
+  ipc::StatusDeltaDecoder dec;
+  dec.Apply(compact.events[0].payload.data(), compact.events[0].payload.size());
+  auto recs = dec.Apply(compact.events[1].payload.data(),
+                        compact.events[1].payload.size());
+  ASSERT_EQ(recs.size(), 1u);
+  EXPECT_EQ(recs[0].name, "late");
+  EXPECT_EQ(recs[0].rx, 3);
+
+  // A tick that can't fit even from scratch ends the subscription, not the
+  // poller thread; the connection itself keeps working.
+  tick.push_back(late);
+  service_.Tick(tick);
+  service_.Tick({late});
+  compact.Call(ipc::kOpTunnelNames, {});
+  EXPECT_EQ(compact.events.size(), 2u);
+}
+
+TEST_F(UnixSocketBrokerTest, PeerWithOtherUidIsRejected) {
+  StartServer(getuid() + 1);
+  UnixSocketTransport t(ConnectUnixSocket(path_));
+  // The server may already have closed its end, so the write can fail;
+  // either way nothing must come back.
+  auto frame = ipc::BuildFrame(ipc::kOpHello, 1, 0, HelloPayload());
+  t.Write(frame.data(), frame.size());
+  uint8_t buf[16];
+  EXPECT_EQ(t.Read(buf, sizeof(buf)), 0u);
+  EXPECT_EQ(server_->rejected(), 1u);
+}
+
+TEST_F(UnixSocketBrokerTest, BadFrameLengthDropsConnection) {
+  StartServer(getuid());
+  int fd = ConnectUnixSocket(path_);
+  UnixSocketTransport t(fd);
+  const uint8_t huge[4] = {0xff, 0xff, 0xff, 0x7f};
+  ASSERT_TRUE(t.Write(huge, sizeof(huge)));
+  uint8_t buf[16];
+  EXPECT_EQ(t.Read(buf, sizeof(buf)), 0u);
+}
+
+TEST_F(UnixSocketBrokerTest, MapStatusPassesSegmentDescriptors) {
+  service_.segment = std::make_unique<SharedStatusSegment>(8);
+  StartServer(getuid());
+  UnixSocketTransport t(ConnectUnixSocket(path_));
+  auto req = ipc::BuildFrame(ipc::kOpMapStatus, 1, 0, {});
+  ASSERT_TRUE(t.Write(req.data(), req.size()));
+
+  std::vector<int> fds;
+  ipc::FrameDecoder dec;
+  std::vector<uint8_t> resp;
+  while (resp.empty()) {
+    uint8_t buf[256];
+    size_t n = t.ReadWithFds(buf, sizeof(buf), &fds);
+    ASSERT_GT(n, 0u);
+    dec.Feed(buf, n, [&](const ipc::FrameView& f) {
+      resp.assign(f.payload, f.payload + f.payload_len);
+    });
+  }
+  ipc::Reader r(resp.data(), resp.size());
+  ASSERT_EQ(r.U8(), ipc::kStatusOk);
+  EXPECT_EQ(r.U32(), 8u);
+  EXPECT_EQ(r.U32(), service_.segment->size());
+  ASSERT_EQ(fds.size(), 2u);
+
+  StatusSegmentView view(fds[0], fds[1]);
+  ipc::StatusRecord rec;
+  rec.name = "wg0";
+  rec.state = ipc::kStateUp;
+  rec.rx = 1234;
+  service_.Tick({rec});
+  EXPECT_TRUE(view.ConsumeNotification());
+  ipc::StatusRecord out;
+  ASSERT_TRUE(view.reader().Read("wg0", &out));
+  EXPECT_EQ(out.rx, 1234);
+}
+
+TEST_F(UnixSocketBrokerTest, MapStatusWithoutSegmentIsAnError) {
+  StartServer(getuid());
+  TestClient c(path_);
+  auto resp = c.Call(ipc::kOpMapStatus, {});
+  ipc::Reader r(resp.data(), resp.size());
+  EXPECT_EQ(r.U8(), ipc::kStatusError);
+  EXPECT_EQ(r.Str(), "shared status unavailable");
+}
+
+TEST_F(UnixSocketBrokerTest, DiagnosticsReportsPhaseTimers) {
+  PhaseRegistry::Instance().Get("broker_test", "step").Record(1500);
+  StartServer(getuid());
+  TestClient c(path_);
+  auto resp = c.Call(ipc::kOpDiagnostics, {});
+  ipc::Reader r(resp.data(), resp.size());
+  ASSERT_EQ(r.U8(), ipc::kStatusOk);
+  bool found = false;
+  for (uint32_t n = r.U32(); n > 0; --n) {
+    std::string op = r.Str();
+    std::string phase = r.Str();
+    int64_t count = r.I64();
+    int64_t p50 = r.I64();
+    r.I64();
+    r.I64();
+    if (op == "broker_test" && phase == "step") {
+      found = true;
+      EXPECT_EQ(count, 1);
+      EXPECT_GE(p50, 1500);
+    }
+  }
+  EXPECT_TRUE(found);
+}
+
+TEST(PeerCredentials, ReportsOwnProcessOverSocketpair) {
+  int sv[2];
+  ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, sv), 0);
+  PeerCredentials cred;
+  ASSERT_TRUE(GetPeerCredentials(sv[0], &cred));
+  EXPECT_EQ(cred.uid, getuid());
+  EXPECT_EQ(cred.pid, getpid());
+  close(sv[0]);
+  close(sv[1]);
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
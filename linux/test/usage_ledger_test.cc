@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "usage_ledger.h"
+#include "wg_key.h"
+
+namespace flutter_wireguard {
+namespace {
+
+constexpr int64_t kT0 = 1700000000000;  // epoch ms
+constexpr int64_t kFlush = 60 * 1000;
+
+std::string KeyOf(uint8_t b) {
+  uint8_t key[kWgKeyLen] = {};
+  key[0] = b;
+  return WgKeyToBase64(key);
+}
+
+TunnelStatusCpp Up(const std::string& name, int64_t rx, int64_t tx) {
+  TunnelStatusCpp s;
+  s.name = name;
+  s.state = TunnelStateCpp::kUp;
+  s.rx = rx;
+  s.tx = tx;
+  return s;
+}
+
+PeerStatsCpp Peer(const std::string& key, int64_t rx, int64_t tx) {
+  PeerStatsCpp p;
+  p.public_key = key;
+  p.rx = rx;
+  p.tx = tx;
+  return p;
+}
+
+class UsageLedgerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    char tmpl[] = "/tmp/fwg_usage_XXXXXX";
+    ASSERT_NE(mkdtemp(tmpl), nullptr);
+    dir = tmpl;
+    path = dir + "/data/usage.ledger";
+  }
+  void TearDown() override { std::filesystem::remove_all(dir); }
+
+  // One tunnel, one peer carrying all of its traffic.
+  static void Tick(UsageLedger* ledger, int64_t now, int64_t rx, int64_t tx,
+                   std::vector<UsageQuotaEventCpp>* exceeded = nullptr) {
+    ledger->Record({Up("wg0", rx, tx)}, {{Peer(KeyOf(1), rx, tx)}}, now, exceeded);
+  }
+
+  std::string dir;
+  std::string path;
+};
+
+TEST_F(UsageLedgerTest, AccumulatesDeltasAcrossCounterResets) {
+  UsageLedger ledger(path);
+  Tick(&ledger, kT0, 100, 10);
+  Tick(&ledger, kT0 + 1000, 300, 30);
+  Tick(&ledger, kT0 + 2000, 50, 5);  // link re-created
+  Tick(&ledger, kT0 + 3000, 80, 8);
+
+  TunnelUsageCpp u = ledger.Usage("wg0", 0);
+  EXPECT_EQ(u.name, "wg0");
+  EXPECT_EQ(u.rx, 380);
+  EXPECT_EQ(u.tx, 38);
+  ASSERT_EQ(u.peers.size(), 1u);
+  EXPECT_EQ(u.peers[0].public_key, KeyOf(1));
+  EXPECT_EQ(u.peers[0].rx, 380);
+  EXPECT_EQ(ledger.Usage("wg1", 0).rx, 0);
+  EXPECT_TRUE(ledger.Usage("wg1", 0).peers.empty());
+}
+
+TEST_F(UsageLedgerTest, DownTunnelsDoNotCountOrLoseTheirBaseline) {
+  UsageLedger ledger(path);
+  Tick(&ledger, kT0, 100, 0);
+  TunnelStatusCpp down;
+  down.name = "wg0";
+  ledger.Record({down}, {{}}, kT0 + 1000);
+  Tick(&ledger, kT0 + 2000, 150, 0);
+  EXPECT_EQ(ledger.Usage("wg0", 0).rx, 150);
+}
+
+TEST_F(UsageLedgerTest, WritesOncePerFlushInterval) {
+  UsageLedger ledger(path, kFlush);
+  for (int64_t t = 0; t < kFlush; t += 1000) Tick(&ledger, kT0 + t, t, 0);
+  EXPECT_EQ(ledger.records(), 0u);
+  Tick(&ledger, kT0 + kFlush, kFlush, 0);
+  EXPECT_EQ(ledger.records(), 2u);  // the tunnel and its peer
+  // Nothing moved: nothing to write.
+  Tick(&ledger, kT0 + 2 * kFlush, kFlush, 0);
+  EXPECT_EQ(ledger.records(), 2u);
+}
+
+TEST_F(UsageLedgerTest, SurvivesRestartWithoutCountingTwice) {
+  {
+    UsageLedger ledger(path, kFlush);
+    Tick(&ledger, kT0, 1000, 100);
+    Tick(&ledger, kT0 + kFlush, 2000, 200);
+  }  // flushes
+  UsageLedger ledger(path, kFlush);
+  EXPECT_EQ(ledger.Usage("wg0", 0).rx, 2000);
+  // Still running: only what came after the last reading is new.
+  Tick(&ledger, kT0 + kFlush + 1000, 2500, 250);
+  EXPECT_EQ(ledger.Usage("wg0", 0).rx, 2500);
+  EXPECT_EQ(ledger.Usage("wg0", 0).peers.at(0).tx, 250);
+  // Re-created while we were gone.
+  Tick(&ledger, kT0 + kFlush + 2000, 10, 1);
+  EXPECT_EQ(ledger.Usage("wg0", 0).rx, 2510);
+}
+
+TEST_F(UsageLedgerTest, SinceSkipsBatchesThatEndedBefore) {
+  UsageLedger ledger(path, kFlush);
+  Tick(&ledger, kT0, 100, 0);
+  ledger.Flush(kT0);
+  Tick(&ledger, kT0 + 1000, 300, 0);
+  ledger.Flush(kT0 + 1000);
+  EXPECT_EQ(ledger.Usage("wg0", kT0 - 1).rx, 300);
+  EXPECT_EQ(ledger.Usage("wg0", kT0).rx, 200);
+  EXPECT_EQ(ledger.Usage("wg0", kT0 + 1000).rx, 0);
+}
+
+TEST_F(UsageLedgerTest, QuotaFiresOnceAndCountsPriorUsage) {
+  UsageLedger ledger(path);
+  Tick(&ledger, kT0, 600, 0);
+  EXPECT_EQ(ledger.SetQuota("wg0", 1000, kT0 - 1), 600);
+
+  std::vector<UsageQuotaEventCpp> exceeded;
+  Tick(&ledger, kT0 + 1000, 900, 99, &exceeded);
+  EXPECT_TRUE(exceeded.empty());
+  Tick(&ledger, kT0 + 2000, 900, 100, &exceeded);
+  ASSERT_EQ(exceeded.size(), 1u);
+  EXPECT_EQ(exceeded[0].name, "wg0");
+  EXPECT_EQ(exceeded[0].limit, 1000);
+  EXPECT_EQ(exceeded[0].used, 1000);
+  EXPECT_EQ(exceeded[0].since, kT0 - 1);
+
+  Tick(&ledger, kT0 + 3000, 5000, 100, &exceeded);
+  EXPECT_EQ(exceeded.size(), 1u);  // disarmed
+
+  ledger.SetQuota("wg0", 1, kT0);
+  ledger.SetQuota("wg0", 0, kT0);  // removed
+  Tick(&ledger, kT0 + 4000, 6000, 100, &exceeded);
+  EXPECT_EQ(exceeded.size(), 1u);
+}
+
+TEST_F(UsageLedgerTest, CompactFoldsOldRecordsByHour) {
+  constexpr int64_t kHour = 3600 * 1000;
+  const int64_t start = (kT0 / kHour) * kHour;
+  {
+    UsageLedger ledger(path, 1);
+    for (int64_t m = 0; m <= 120; ++m) {
+      Tick(&ledger, start + m * 60 * 1000, m * 10, m);
+    }
+    EXPECT_EQ(ledger.records(), 2u * 120);
+
+    const int64_t now = start + UsageLedger::kCompactAfterMs + 90 * 60 * 1000;
+    ledger.Compact(now);
+    // Hours 0 and 1 folded, minutes 90..120 kept: per tunnel and peer.
+    EXPECT_EQ(ledger.records(), 2u * (2 + 31));
+    EXPECT_EQ(ledger.Usage("wg0", 0).rx, 1200);
+    EXPECT_EQ(ledger.Usage("wg0", 0).peers.at(0).tx, 120);
+    // Inside hour 1 the whole folded hour still counts.
+    EXPECT_EQ(ledger.Usage("wg0", start + kHour + 1).rx, 1200 - 590);
+  }
+  EXPECT_FALSE(std::filesystem::exists(path + ".tmp"));
+  UsageLedger reopened(path, 1);
+  EXPECT_EQ(reopened.records(), 2u * (2 + 31));
+  EXPECT_EQ(reopened.Usage("wg0", 0).rx, 1200);
+}
+
+TEST_F(UsageLedgerTest, GrowsPastItsInitialSize) {
+  UsageLedger ledger(path, 1);
+  std::vector<TunnelStatusCpp> tick{Up("wg0", 0, 0)};
+  std::vector<std::vector<PeerStatsCpp>> peers(1);
+  for (int p = 1; p <= 200; ++p) peers[0].push_back(Peer(KeyOf(p), 0, 0));
+  for (int64_t t = 1; t <= 40; ++t) {
+    tick[0].rx = t * 200;
+    for (auto& p : peers[0]) p.rx = t;
+    ledger.Record(tick, peers, kT0 + t, nullptr);
+  }
+  EXPECT_EQ(ledger.records(), 39u * 201);  // the first tick rides with the second
+  TunnelUsageCpp u = ledger.Usage("wg0", 0);
+  EXPECT_EQ(u.rx, 8000);
+  ASSERT_EQ(u.peers.size(), 200u);
+  for (const auto& p : u.peers) EXPECT_EQ(p.rx, 40);
+}
+
+TEST_F(UsageLedgerTest, FlushThatCannotGrowTheFileKeepsTheBatch) {
+  UsageLedger ledger(path, 1);
+  std::vector<TunnelStatusCpp> tick{Up("wg0", 0, 0)};
+  std::vector<std::vector<PeerStatsCpp>> peers(1);
+  for (int p = 1; p <= 200; ++p) peers[0].push_back(Peer(KeyOf(p), 0, 0));
+  auto record = [&](int64_t t) {
+    tick[0].rx = t * 200;
+    for (auto& p : peers[0]) p.rx = t;
+    ledger.Record(tick, peers, kT0 + t, nullptr);
+  };
+  struct stat st;
+  ASSERT_EQ(::stat(path.c_str(), &st), 0);
+
+  // A file size limit fails the allocation the way a full disk does.
+  rlimit saved;
+  ASSERT_EQ(getrlimit(RLIMIT_FSIZE, &saved), 0);
+  rlimit capped = saved;
+  capped.rlim_cur = static_cast<rlim_t>(st.st_size);
+  auto old_handler = std::signal(SIGXFSZ, SIG_IGN);
+  ASSERT_EQ(setrlimit(RLIMIT_FSIZE, &capped), 0);
+  for (int64_t t = 1; t <= 25; ++t) record(t);
+  setrlimit(RLIMIT_FSIZE, &saved);
+  std::signal(SIGXFSZ, old_handler);
+
+  // 20 batches of 201 fit the initial 4096 records; the rest stay pending.
+  EXPECT_EQ(ledger.records(), 20u * 201);
+  struct stat after;
+  ASSERT_EQ(::stat(path.c_str(), &after), 0);
+  EXPECT_EQ(after.st_size, st.st_size);
+  EXPECT_EQ(ledger.Usage("wg0", 0).rx, 25 * 200);
+
+  record(26);
+  EXPECT_EQ(ledger.records(), 21u * 201);
+  TunnelUsageCpp u = ledger.Usage("wg0", 0);
+  EXPECT_EQ(u.rx, 26 * 200);
+  ASSERT_EQ(u.peers.size(), 200u);
+  for (const auto& p : u.peers) EXPECT_EQ(p.rx, 26);
+}
+
+TEST_F(UsageLedgerTest, OneProcessAtATimeAndOnlyLedgers) {
+  {
+    UsageLedger ledger(path);
+    EXPECT_EQ(::access(dir.c_str(), F_OK), 0);
+    struct stat st;
+    ASSERT_EQ(::stat((dir + "/data").c_str(), &st), 0);
+    EXPECT_EQ(st.st_mode & 0777, 0700u);
+    // flock is per open file description, so a second open in-process
+    // contends exactly like another process would.
+    EXPECT_THROW(UsageLedger second(path), std::runtime_error);
+  }
+  const std::string other = dir + "/not-a-ledger";
+  const int fd = ::open(other.c_str(), O_CREAT | O_WRONLY, 0600);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(::write(fd, std::string(100, 'x').data(), 100), 100);
+  ::close(fd);
+  EXPECT_THROW(UsageLedger bad(other), std::runtime_error);
+}
+
+TEST(UsageLedgerDefaultPath, PrefersXdgDataHome) {
+  const char* saved = std::getenv("XDG_DATA_HOME");
+  const std::string keep = saved != nullptr ? saved : "";
+  ::setenv("XDG_DATA_HOME", "/x/data", 1);
+  EXPECT_EQ(UsageLedger::DefaultPath(), "/x/data/flutter_wireguard/usage.ledger");
+  ::setenv("XDG_DATA_HOME", "", 1);
+  EXPECT_NE(UsageLedger::DefaultPath().find("/.local/share/flutter_wireguard/"),
+            std::string::npos);
+  if (saved != nullptr) {
+    ::setenv("XDG_DATA_HOME", keep.c_str(), 1);
+  } else {
+    ::unsetenv("XDG_DATA_HOME");
+  }
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -1,6 +1,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <map>
@@ -11,14 +12,26 @@
 
 #include "privileged_session.h"
 #include "process_runner.h"
+#include "status_poller.h"
+#include "status_shm.h"
 #include "wg_backend.h"
 
 using flutter_wireguard::BackendKindCpp;
 using flutter_wireguard::PrivilegedSession;
 using flutter_wireguard::ProcessResult;
 using flutter_wireguard::ProcessRunner;
+using flutter_wireguard::PublishPollTick;
+using flutter_wireguard::DnsPlan;
+using flutter_wireguard::KillSwitchSet;
+using flutter_wireguard::MapLocalView;
+using flutter_wireguard::PeerEndpoint;
+using flutter_wireguard::PollTunnelStatuses;
+using flutter_wireguard::RoutePlan;
+using flutter_wireguard::SharedStatusSegment;
+using flutter_wireguard::StatusSegmentView;
 using flutter_wireguard::TunnelStateCpp;
 using flutter_wireguard::WgBackend;
+namespace ipc = flutter_wireguard::ipc;
 
 namespace {
 
@@ -58,10 +71,15 @@ class FakePrivilegedSession : public PrivilegedSession {
   struct ShowCall { std::string iface; };
   struct UpCall   { std::string conf_path; std::string userspace_impl; };
   struct DownCall { std::string conf_path; };
+  struct InlineUpCall {
+    std::string iface; std::string config; std::string userspace_impl;
+  };
 
   std::vector<ShowCall> show_calls;
   std::vector<UpCall>   up_calls;
   std::vector<DownCall> down_calls;
+  std::vector<InlineUpCall> inline_up_calls;
+  std::vector<std::string>  down_by_name_calls;
 
   std::vector<ProcessResult> show_responses;
   std::vector<ProcessResult> up_responses;
@@ -80,6 +98,82 @@ class FakePrivilegedSession : public PrivilegedSession {
     down_calls.push_back({conf_path});
     return Pop(down_responses);
   }
+  // Inline hand-off shares the up/down response queues with the file mode.
+  ProcessResult WgQuickUpInline(const std::string& iface,
+                                const std::string& config,
+                                const std::string& userspace_impl) override {
+    inline_up_calls.push_back({iface, config, userspace_impl});
+    return Pop(up_responses);
+  }
+  ProcessResult WgQuickDownByName(const std::string& iface) override {
+    down_by_name_calls.push_back(iface);
+    return Pop(down_responses);
+  }
+  std::vector<std::pair<uint32_t, uint32_t>> rules_calls;
+  std::vector<ProcessResult> rules_responses;
+  ProcessResult InstallPolicyRules(uint32_t table, uint32_t priority) override {
+    rules_calls.emplace_back(table, priority);
+    return Pop(rules_responses);
+  }
+  std::vector<std::pair<std::string, RoutePlan>> routes_calls;
+  std::vector<ProcessResult> routes_responses;
+  ProcessResult InstallRoutes(const std::string& iface,
+                              const RoutePlan& plan) override {
+    routes_calls.emplace_back(iface, plan);
+    return Pop(routes_responses);
+  }
+  bool resolved_available = false;
+  std::vector<std::pair<std::string, DnsPlan>> dns_calls;
+  std::vector<ProcessResult> dns_responses;
+  bool CanApplyDns() override { return resolved_available; }
+  ProcessResult ApplyDns(const std::string& iface, const DnsPlan& plan) override {
+    dns_calls.emplace_back(iface, plan);
+    return Pop(dns_responses);
+  }
+  std::vector<std::pair<std::string, std::vector<PeerEndpoint>>> endpoint_calls;
+  ProcessResult SetPeerEndpoints(const std::string& iface,
+                                 const std::vector<PeerEndpoint>& peers) override {
+    endpoint_calls.emplace_back(iface, peers);
+    return ProcessResult{0, "", ""};
+  }
+  // Each set installed, with how many inline ups had been sent before it.
+  // With `kill_switch_record` set, a set that went in is recorded there as
+  // the real session does.
+  std::vector<std::pair<KillSwitchSet, size_t>> kill_switch_calls;
+  std::vector<ProcessResult> kill_switch_responses;
+  std::string kill_switch_record;
+  ProcessResult InstallKillSwitch(const KillSwitchSet& tunnels) override {
+    kill_switch_calls.emplace_back(tunnels, inline_up_calls.size());
+    ProcessResult r = Pop(kill_switch_responses);
+    if (r.exit_code == 0 && !kill_switch_record.empty()) {
+      flutter_wireguard::SaveKillSwitchRecords(kill_switch_record, tunnels);
+    }
+    return r;
+  }
+  // Batches run through the single-tunnel fakes above; only the batch
+  // shape is recorded.
+  std::vector<size_t> up_many_sizes;
+  std::vector<size_t> down_many_sizes;
+  std::vector<flutter_wireguard::ProcessResult> WgQuickUpMany(
+      const std::vector<flutter_wireguard::InlineTunnel>& tunnels,
+      const std::string& userspace_impl, size_t max_parallel) override {
+    up_many_sizes.push_back(tunnels.size());
+    return PrivilegedSession::WgQuickUpMany(tunnels, userspace_impl,
+                                            max_parallel);
+  }
+  std::vector<flutter_wireguard::ProcessResult> WgQuickDownManyByName(
+      const std::vector<std::string>& ifaces, size_t max_parallel) override {
+    down_many_sizes.push_back(ifaces.size());
+    return PrivilegedSession::WgQuickDownManyByName(ifaces, max_parallel);
+  }
+
+  // Every call above that would have gone through the elevated session.
+  size_t ElevatedCalls() const {
+    return show_calls.size() + up_calls.size() + down_calls.size() +
+           inline_up_calls.size() + down_by_name_calls.size() +
+           rules_calls.size() + routes_calls.size() + dns_calls.size() +
+           endpoint_calls.size() + kill_switch_calls.size();
+  }
 
  private:
   static ProcessResult Pop(std::vector<ProcessResult>& q) {
@@ -90,6 +184,21 @@ class FakePrivilegedSession : public PrivilegedSession {
   }
 };
 
+// Answers endpoint lookups from a table the test can change.
+class TableResolver : public flutter_wireguard::HostResolver {
+ public:
+  explicit TableResolver(std::shared_ptr<std::map<std::string, std::string>> hosts)
+      : hosts_(std::move(hosts)) {}
+  std::string Resolve(const std::string& host, const std::string& port) override {
+    auto it = hosts_->find(host + ":" + port);
+    if (it == hosts_->end()) throw std::runtime_error(host + ": not found");
+    return it->second;
+  }
+
+ private:
+  std::shared_ptr<std::map<std::string, std::string>> hosts_;
+};
+
 }  // namespace
 
 TEST(IsValidName, AcceptsTypicalInterfaceNames) {
@@ -158,7 +267,10 @@ class WgBackendIntegrationTest : public ::testing::Test {
         std::move(session_uptr));
     backend->SetSysfsRootForTesting(sysfs_root);
   }
-  void TearDown() override { std::filesystem::remove_all(sysfs_root); }
+  void TearDown() override {
+    std::filesystem::remove_all(sysfs_root);
+    std::filesystem::remove_all("/tmp/fwg-test-" + std::to_string(::getpid()));
+  }
 
   // Writes /tmp/fwg-test-sysfs-<pid>/<iface>/statistics/{rx,tx}_bytes.
   void WriteSysfsCounters(const std::string& iface, int64_t rx, int64_t tx) {
@@ -186,7 +298,28 @@ TEST_F(WgBackendIntegrationTest, StartRejectsInvalidName) {
   EXPECT_THROW(backend->Start("bad name", "[Interface]"), std::invalid_argument);
 }
 
+TEST_F(WgBackendIntegrationTest, StartHandsConfigOverSessionByDefault) {
+  session->up_responses.push_back({0, "", ""});
+  backend->Start("wg0", "[Interface]\nPrivateKey = abc\n");
+
+  ASSERT_EQ(session->inline_up_calls.size(), 1u);
+  EXPECT_EQ(session->inline_up_calls[0].iface, "wg0");
+  EXPECT_EQ(session->inline_up_calls[0].config,
+            "[Interface]\nPrivateKey = abc\n");
+  EXPECT_TRUE(session->up_calls.empty());
+  // The private key never reaches the user's filesystem.
+  EXPECT_FALSE(std::filesystem::exists(
+      "/tmp/fwg-test-" + std::to_string(::getpid()) + "/wg0.conf"));
+
+  // Stop goes by interface name.
+  backend->Stop("wg0");
+  ASSERT_EQ(session->down_by_name_calls.size(), 1u);
+  EXPECT_EQ(session->down_by_name_calls[0], "wg0");
+  EXPECT_TRUE(session->down_calls.empty());
+}
+
 TEST_F(WgBackendIntegrationTest, StartInvokesWgQuickWithConfigFile) {
+  backend->SetConfigHandoff(flutter_wireguard::ConfigHandoff::kFile);
   session->up_responses.push_back({0, "", ""});  // wg-quick up succeeds
   backend->Start("wg0", "[Interface]\nPrivateKey = abc\n");
 
@@ -227,9 +360,246 @@ TEST_F(WgBackendIntegrationTest, StatusReturnsParsedDump) {
   EXPECT_EQ(session->show_calls[0].iface, "wg0");
 }
 
+TEST_F(WgBackendIntegrationTest, StatusWithPeersSharesOneDump) {
+  session->up_responses.push_back({0, "", ""});  // start
+  backend->Start("wg0", "");
+  WriteSysfsCounters("wg0", /*rx=*/0, /*tx=*/0);
+  session->show_responses.push_back({0,
+      "PRIV\tPUB\t51820\toff\n"
+      "PEER1\t(none)\tep\tips\t12345\t10\t20\t0\n"
+      "PEER2\t(none)\t(none)\tips\t0\t5\t6\t0\n", ""});
+  std::vector<flutter_wireguard::PeerStatsCpp> peers(1);
+  auto s = backend->Status("wg0", &peers);
+  EXPECT_EQ(s.rx, 15);
+  ASSERT_EQ(peers.size(), 2u);
+  EXPECT_EQ(peers[0].public_key, "PEER1");
+  EXPECT_EQ(peers[1].tx, 6);
+  EXPECT_EQ(session->show_calls.size(), 1u);
+
+  // Down: the previous tick's peers don't linger.
+  std::filesystem::remove_all(sysfs_root + "/wg0");
+  backend->Status("wg0", &peers);
+  EXPECT_TRUE(peers.empty());
+}
+
+TEST_F(WgBackendIntegrationTest, LookupPeerUsesStartedConfig) {
+  session->up_responses.push_back({0, "", ""});
+  backend->Start("wg0",
+                 "[Interface]\nPrivateKey = abc\n"
+                 "[Peer]\nPublicKey = GW\nAllowedIPs = 0.0.0.0/0\n"
+                 "[Peer]\nPublicKey = LAN\nAllowedIPs = 192.168.7.0/24\n");
+  EXPECT_EQ(backend->LookupPeer("wg0", "192.168.7.20"), "LAN");
+  EXPECT_EQ(backend->LookupPeers("wg0", {"1.1.1.1", "::1", "192.168.7.1"}),
+            (std::vector<std::string>{"GW", "", "LAN"}));
+  EXPECT_THROW(backend->LookupPeer("wg0", "not-an-ip"), std::invalid_argument);
+  EXPECT_THROW(backend->LookupPeer("wg9", "1.1.1.1"), std::runtime_error);
+  // No shell-out, no elevated op: the index answers.
+  EXPECT_TRUE(session->show_calls.empty());
+}
+
+namespace {
+
+// Twenty non-adjacent /24s under 10.20.0.0/16, one per line of a single
+// peer.
+std::string LargeSplitTunnel() {
+  std::string c = "[Interface]\nPrivateKey = abc\nAddress = 10.9.0.2/24\n"
+                  "[Peer]\nPublicKey = GW\n";
+  for (int i = 0; i < 20; ++i) {
+    c += "AllowedIPs = 10.20." + std::to_string(2 * i) + ".0/24\n";
+  }
+  return c;
+}
+
+}  // namespace
+
+TEST_F(WgBackendIntegrationTest, StartInstallsLargeRouteSetsItself) {
+  backend->Start("wg0", LargeSplitTunnel());
+  ASSERT_EQ(session->inline_up_calls.size(), 1u);
+  const std::string& sent = session->inline_up_calls[0].config;
+  EXPECT_NE(sent.find("Table = off\n"), std::string::npos);
+  EXPECT_EQ(sent.find("Address"), std::string::npos);
+  ASSERT_EQ(session->routes_calls.size(), 1u);
+  EXPECT_EQ(session->routes_calls[0].first, "wg0");
+  EXPECT_EQ(session->routes_calls[0].second.addresses.size(), 1u);
+  EXPECT_EQ(session->routes_calls[0].second.routes.size(), 20u);
+
+  // A small config is left to wg-quick untouched.
+  backend->Start("wg1", "[Interface]\n[Peer]\nAllowedIPs = 10.0.0.0/8\n");
+  EXPECT_EQ(session->inline_up_calls[1].config,
+            "[Interface]\n[Peer]\nAllowedIPs = 10.0.0.0/8\n");
+  EXPECT_EQ(session->routes_calls.size(), 1u);
+}
+
+TEST_F(WgBackendIntegrationTest, FailedRouteInstallBringsTheLinkDown) {
+  session->routes_responses.push_back({1, "", "route 10.20.3.0/24: File exists"});
+  try {
+    backend->Start("wg0", LargeSplitTunnel());
+    FAIL() << "expected Start to throw";
+  } catch (const std::runtime_error& e) {
+    EXPECT_NE(std::string(e.what()).find("File exists"), std::string::npos);
+  }
+  EXPECT_EQ(session->down_by_name_calls, std::vector<std::string>{"wg0"});
+  EXPECT_TRUE(backend->TunnelNames().empty());
+
+  session->routes_responses.push_back({1, "", "Operation not permitted"});
+  auto results = backend->StartMany({{"wg1", LargeSplitTunnel()}, {"wg2", ""}});
+  EXPECT_FALSE(results[0].ok);
+  EXPECT_TRUE(results[1].ok);
+  EXPECT_EQ(session->down_by_name_calls.back(), "wg1");
+  EXPECT_EQ(backend->TunnelNames(), std::vector<std::string>{"wg2"});
+}
+
+TEST_F(WgBackendIntegrationTest, DnsGoesToResolvedWhenItIsThere) {
+  const std::string config =
+      "[Interface]\nPrivateKey = abc\nDNS = 10.9.0.1, corp.example\n"
+      "[Peer]\nAllowedIPs = 10.9.0.0/24\n";
+  // No resolved: wg-quick gets the DNS line and runs resolvconf.
+  backend->Start("wg0", config);
+  EXPECT_EQ(session->inline_up_calls[0].config, config);
+  EXPECT_TRUE(session->dns_calls.empty());
+
+  session->resolved_available = true;
+  backend->Start("wg1", config);
+  EXPECT_EQ(session->inline_up_calls[1].config.find("DNS"), std::string::npos);
+  ASSERT_EQ(session->dns_calls.size(), 1u);
+  EXPECT_EQ(session->dns_calls[0].first, "wg1");
+  EXPECT_EQ(session->dns_calls[0].second.servers.size(), 1u);
+  EXPECT_EQ(session->dns_calls[0].second.domains, std::vector<std::string>{"corp.example"});
+
+  // A refusal fails the start like wg-quick's `set -e` would.
+  session->dns_responses.push_back({1, "", "SetLinkDNS: Access denied"});
+  EXPECT_THROW(backend->Start("wg2", config), std::runtime_error);
+  EXPECT_EQ(session->down_by_name_calls, std::vector<std::string>{"wg2"});
+  auto results = backend->StartMany({{"wg3", config}});
+  EXPECT_TRUE(results[0].ok);
+  EXPECT_EQ(session->dns_calls.back().first, "wg3");
+}
+
+TEST_F(WgBackendIntegrationTest, NamedEndpointsReachWgQuickNumericAndReresolve) {
+  auto hosts = std::make_shared<std::map<std::string, std::string>>();
+  (*hosts)["a.example:51820"] = "192.0.2.1:51820";
+  (*hosts)["b.example:51820"] = "192.0.2.2:51820";
+  backend->SetEndpointResolverForTesting(
+      std::make_unique<flutter_wireguard::EndpointResolver>(
+          std::make_unique<TableResolver>(hosts)));
+  backend->Start("wg0",
+                 "[Interface]\nPrivateKey = abc\n"
+                 "[Peer]\nPublicKey = A\nEndpoint = a.example:51820\n"
+                 "[Peer]\nPublicKey = B\nEndpoint = b.example:51820\n"
+                 "[Peer]\nPublicKey = C\nEndpoint = 198.51.100.3:51820\n");
+  EXPECT_EQ(session->inline_up_calls[0].config,
+            "[Interface]\nPrivateKey = abc\n"
+            "[Peer]\nPublicKey = A\nEndpoint = 192.0.2.1:51820\n"
+            "[Peer]\nPublicKey = B\nEndpoint = 192.0.2.2:51820\n"
+            "[Peer]\nPublicKey = C\nEndpoint = 198.51.100.3:51820\n");
+
+  // Nothing moved: no privileged call at all.
+  EXPECT_EQ(backend->ReresolveEndpoints("wg0"), 0u);
+  EXPECT_TRUE(session->endpoint_calls.empty());
+
+  // b.example moved; a.example stopped resolving and keeps its address.
+  (*hosts)["b.example:51820"] = "192.0.2.22:51820";
+  hosts->erase("a.example:51820");
+  EXPECT_EQ(backend->ReresolveEndpoints("wg0"), 1u);
+  ASSERT_EQ(session->endpoint_calls.size(), 1u);
+  EXPECT_EQ(session->endpoint_calls[0].first, "wg0");
+  ASSERT_EQ(session->endpoint_calls[0].second.size(), 1u);
+  EXPECT_EQ(session->endpoint_calls[0].second[0].public_key, "B");
+  EXPECT_EQ(session->endpoint_calls[0].second[0].endpoint, "192.0.2.22:51820");
+  EXPECT_EQ(backend->ReresolveEndpoints("wg0"), 0u);
+
+  EXPECT_THROW(backend->ReresolveEndpoints("never-started"), std::runtime_error);
+}
+
+TEST_F(WgBackendIntegrationTest, StalePeerFailsOverToItsNextEndpointInOneSet) {
+  auto hosts = std::make_shared<std::map<std::string, std::string>>();
+  (*hosts)["a.example:51820"] = "192.0.2.1:51820";
+  (*hosts)["b.example:51820"] = "192.0.2.2:51820";
+  backend->SetEndpointResolverForTesting(
+      std::make_unique<flutter_wireguard::EndpointResolver>(
+          std::make_unique<TableResolver>(hosts)));
+  backend->Start("wg0",
+                 "[Interface]\nPrivateKey = abc\n"
+                 "[Peer]\nPublicKey = A\nEndpoint = a.example:51820, b.example:51820\n"
+                 "[Peer]\nPublicKey = C\nEndpoint = 198.51.100.3:51820, 198.51.100.4:51820\n");
+  EXPECT_EQ(session->inline_up_calls[0].config,
+            "[Interface]\nPrivateKey = abc\n"
+            "[Peer]\nPublicKey = A\nEndpoint = 192.0.2.1:51820\n"
+            "[Peer]\nPublicKey = C\nEndpoint = 198.51.100.3:51820\n");
+
+  const int64_t t0 = 1700000000000;
+  EXPECT_EQ(backend->FailOver("wg0", {}, {{"A", t0}, {"C", t0}}, t0 + 1000), 0u);
+  EXPECT_TRUE(session->endpoint_calls.empty());
+  EXPECT_EQ(backend->FailOver("wg0", {"A", "C"}, {{"A", t0}, {"C", t0}}, t0 + 2000), 2u);
+  ASSERT_EQ(session->endpoint_calls.size(), 1u);  // both peers, one `wg set`
+  ASSERT_EQ(session->endpoint_calls[0].second.size(), 2u);
+  EXPECT_EQ(session->endpoint_calls[0].second[0].public_key, "A");
+  EXPECT_EQ(session->endpoint_calls[0].second[0].endpoint, "192.0.2.2:51820");
+  EXPECT_EQ(session->endpoint_calls[0].second[1].endpoint, "198.51.100.4:51820");
+  EXPECT_TRUE(session->down_by_name_calls.empty());
+
+  // Re-resolving now follows the candidate A is on.
+  (*hosts)["b.example:51820"] = "192.0.2.22:51820";
+  EXPECT_EQ(backend->ReresolveEndpoints("wg0"), 1u);
+  EXPECT_EQ(session->endpoint_calls.back().second[0].endpoint, "192.0.2.22:51820");
+
+  backend->Stop("wg0");
+  EXPECT_EQ(backend->FailOver("wg0", {"A"}, {}, t0 + 100000), 0u);
+}
+
+TEST_F(WgBackendIntegrationTest, KillSwitchIsArmedBeforeUpAndDroppedAfterDown) {
+  const std::string config =
+      "[Interface]\nPrivateKey = abc\nKillSwitch = on\nKillSwitchBypass = 192.168.1.0/24\n"
+      "[Peer]\nPublicKey = A\nEndpoint = 198.51.100.3:51820, 198.51.100.4:51820\n";
+  backend->Start("wg0", config);
+  ASSERT_EQ(session->inline_up_calls.size(), 1u);
+  EXPECT_EQ(session->inline_up_calls[0].config,
+            "[Interface]\nPrivateKey = abc\n"
+            "[Peer]\nPublicKey = A\nEndpoint = 198.51.100.3:51820\n");
+  ASSERT_EQ(session->kill_switch_calls.size(), 1u);
+  EXPECT_EQ(session->kill_switch_calls[0].second, 0u);  // before wg-quick
+  const KillSwitchSet& armed = session->kill_switch_calls[0].first;
+  ASSERT_EQ(armed.count("wg0"), 1u);
+  EXPECT_EQ(armed.at("wg0").endpoints.size(), 2u);  // the failover candidate too
+  EXPECT_EQ(armed.at("wg0").bypass.size(), 1u);
+
+  // A second tunnel joins the same set; one without a switch leaves it be.
+  backend->Start("wg1", config);
+  backend->Start("wg2", "[Interface]\nPrivateKey = abc\n");
+  ASSERT_EQ(session->kill_switch_calls.size(), 2u);
+  EXPECT_EQ(session->kill_switch_calls[1].first.size(), 2u);
+
+  // wg-quick failing takes the new tunnel back out.
+  session->up_responses.push_back({1, "", "boom"});
+  EXPECT_THROW(backend->Start("wg3", config), std::runtime_error);
+  ASSERT_EQ(session->kill_switch_calls.size(), 4u);
+  EXPECT_EQ(session->kill_switch_calls[2].first.size(), 3u);
+  EXPECT_EQ(session->kill_switch_calls[3].first.size(), 2u);
+
+  // Refused rules fail the start before anything is up.
+  session->kill_switch_responses.push_back({1, "", "Operation not permitted"});
+  EXPECT_THROW(backend->Start("wg4", config), std::runtime_error);
+  EXPECT_EQ(session->inline_up_calls.size(), 4u);
+
+  backend->Stop("wg2");
+  EXPECT_EQ(session->kill_switch_calls.size(), 5u);  // had none
+  backend->Stop("wg0");
+  ASSERT_EQ(session->kill_switch_calls.size(), 6u);
+  EXPECT_EQ(session->kill_switch_calls[5].first.count("wg0"), 0u);
+  auto results = backend->StopMany({"wg1"});
+  EXPECT_TRUE(results[0].ok);
+  ASSERT_EQ(session->kill_switch_calls.size(), 7u);
+  EXPECT_TRUE(session->kill_switch_calls[6].first.empty());
+
+  EXPECT_THROW(backend->Start("wg5", "[Interface]\nKillSwitch = maybe\n"),
+               std::invalid_argument);
+}
+
 TEST_F(WgBackendIntegrationTest, StopIsIdempotentOnUnknownTunnel) {
-  // No exception, no Run() call (no config file written).
+  // No exception, and nothing is sent to the privileged side.
   backend->Stop("never-started");
+  EXPECT_TRUE(session->down_calls.empty());
+  EXPECT_TRUE(session->down_by_name_calls.empty());
 }
 
 TEST_F(WgBackendIntegrationTest, StatusFallsBackToSysfsCountersWithoutWgShow) {
@@ -257,6 +627,131 @@ TEST_F(WgBackendIntegrationTest, StatusReportsDownWhenInterfaceMissing) {
   EXPECT_TRUE(session->show_calls.empty());
 }
 
+TEST_F(WgBackendIntegrationTest, StartManyIsOneBatchWithPerTunnelResults) {
+  session->up_responses.push_back({0, "", ""});         // wg0
+  session->up_responses.push_back({1, "", "no route"});  // wg1
+  auto results = backend->StartMany({{"wg0", "[Interface]\n"},
+                                     {"wg1", "[Interface]\n"},
+                                     {"bad name", ""},
+                                     {"wg0", ""}});
+
+  ASSERT_EQ(results.size(), 4u);
+  EXPECT_TRUE(results[0].ok);
+  EXPECT_FALSE(results[1].ok);
+  EXPECT_NE(results[1].error.find("no route"), std::string::npos);
+  EXPECT_FALSE(results[2].ok);  // invalid name, never sent
+  EXPECT_FALSE(results[3].ok);  // duplicate within the batch
+  EXPECT_EQ(results[3].name, "wg0");
+  ASSERT_EQ(session->up_many_sizes.size(), 1u);
+  EXPECT_EQ(session->up_many_sizes[0], 2u);
+  // Only the tunnel that came up is tracked.
+  EXPECT_EQ(backend->TunnelNames(), std::vector<std::string>{"wg0"});
+}
+
+TEST_F(WgBackendIntegrationTest, StopManySkipsUnknownAndReportsFailures) {
+  backend->StartMany({{"wg0", ""}, {"wg1", ""}});
+  session->down_responses.push_back({0, "", ""});
+  session->down_responses.push_back({1, "", "busy"});
+  auto results = backend->StopMany({"wg0", "never-started", "wg1"});
+
+  ASSERT_EQ(results.size(), 3u);
+  EXPECT_TRUE(results[0].ok);
+  EXPECT_TRUE(results[1].ok);
+  EXPECT_FALSE(results[2].ok);
+  EXPECT_NE(results[2].error.find("busy"), std::string::npos);
+  EXPECT_EQ(session->down_by_name_calls,
+            (std::vector<std::string>{"wg0", "wg1"}));
+}
+
+TEST(WithStagingTable, PinsTableAndFwMarkInInterfaceSection) {
+  const std::string out = WgBackend::WithStagingTable(
+      "[Interface]\nPrivateKey = k\nTable = off\nfwmark=0x1\n"
+      "[Peer]\nPublicKey = p\nAllowedIPs = 0.0.0.0/0\n",
+      52001, 32000);
+  EXPECT_EQ(out.find("Table = off"), std::string::npos);
+  EXPECT_EQ(out.find("fwmark=0x1"), std::string::npos);
+  EXPECT_EQ(out.find("[Interface]\nTable = 52001\nFwMark = 52001\n"), 0u);
+  EXPECT_NE(out.find("PostDown = ip -4 rule del not fwmark 52001 table 52001 "
+                     "priority 32001"),
+            std::string::npos);
+  EXPECT_NE(out.find("[Peer]\nPublicKey = p\nAllowedIPs = 0.0.0.0/0\n"),
+            std::string::npos);
+  EXPECT_EQ(WgBackend::StagingTableFor("wg1"), WgBackend::StagingTableFor("wg1"));
+}
+
+// The plugin's poll path (PollTunnelStatuses, then PublishPollTick) over a
+// session that has used more names than the segment has slots: stopped
+// tunnels give theirs back, so a new one is still served from the segment.
+TEST_F(WgBackendIntegrationTest, PollTickRecyclesSlotsOfStoppedTunnels) {
+  SharedStatusSegment segment;
+  std::unique_ptr<StatusSegmentView> view = MapLocalView(segment);
+  std::vector<ipc::StatusRecord> unplaced;
+  for (uint32_t i = 0; i < ipc::kDefaultStatusSlots + 16; ++i) {
+    const std::string name = "t" + std::to_string(i);
+    backend->Start(name, "");
+    WriteSysfsCounters(name, i, i);
+    PublishPollTick(&segment, PollTunnelStatuses(backend.get()), &unplaced);
+    ASSERT_TRUE(unplaced.empty()) << name;
+    backend->Stop(name);
+    std::filesystem::remove_all(std::filesystem::path(sysfs_root) / name);
+    PublishPollTick(&segment, PollTunnelStatuses(backend.get()), &unplaced);
+    ASSERT_TRUE(unplaced.empty()) << name;
+  }
+  ASSERT_GT(backend->TunnelNames().size(), ipc::kDefaultStatusSlots);
+
+  backend->Start("fresh", "");
+  WriteSysfsCounters("fresh", 7, 7);
+  PublishPollTick(&segment, PollTunnelStatuses(backend.get()), &unplaced);
+  EXPECT_TRUE(unplaced.empty());
+  ipc::StatusRecord out;
+  ASSERT_TRUE(view->reader().Read("fresh", &out));
+  EXPECT_EQ(out.state, ipc::kStateUp);
+  EXPECT_EQ(out.rx, 7);
+}
+
+TEST_F(WgBackendIntegrationTest, SwitchTunnelMovesRulesOnlyAfterHandshake) {
+  backend->Start("wg0", "");
+  WriteSysfsCounters("wg1", 0, 0);
+  session->show_responses.push_back({0, "", ""});  // no handshake yet
+  session->show_responses.push_back({0,
+      "PRIV\tPUB\t51820\toff\n"
+      "PEER\t(none)\tep\tips\t12345\t10\t20\t0\n", ""});
+  backend->SwitchTunnel("wg0", "wg1", "[Interface]\nPrivateKey = k\n");
+
+  ASSERT_EQ(session->inline_up_calls.size(), 2u);
+  const uint32_t table = WgBackend::StagingTableFor("wg1");
+  EXPECT_NE(session->inline_up_calls[1].config.find(
+                "Table = " + std::to_string(table)),
+            std::string::npos);
+  EXPECT_EQ(session->show_calls.size(), 2u);
+  ASSERT_EQ(session->rules_calls.size(), 1u);
+  EXPECT_EQ(session->rules_calls[0].first, table);
+  EXPECT_EQ(session->down_by_name_calls, std::vector<std::string>{"wg0"});
+}
+
+TEST_F(WgBackendIntegrationTest, SwitchTunnelKeepsOldTunnelWithoutHandshake) {
+  backend->Start("wg0", "");
+  WriteSysfsCounters("wg1", 0, 0);
+  EXPECT_THROW(backend->SwitchTunnel("wg0", "wg1", "",
+                                     std::chrono::milliseconds(50)),
+               std::runtime_error);
+  EXPECT_TRUE(session->rules_calls.empty());
+  // Only the half-started replacement goes down.
+  EXPECT_EQ(session->down_by_name_calls, std::vector<std::string>{"wg1"});
+}
+
+TEST_F(WgBackendIntegrationTest, SwitchTunnelPacesElevatedHandshakePolls) {
+  backend->Start("wg0", "");
+  WriteSysfsCounters("wg1", 0, 0);
+  // No UAPI socket: every look is a `wg show` through the elevated shell,
+  // so 600 ms of waiting must cost a handful of them, not thirty.
+  EXPECT_THROW(backend->SwitchTunnel("wg0", "wg1", "",
+                                     std::chrono::milliseconds(600)),
+               std::runtime_error);
+  EXPECT_GE(session->show_calls.size(), 2u);
+  EXPECT_LE(session->show_calls.size(), 4u);
+}
+
 // All privileged ops are routed through PrivilegedSession (one pkexec
 // prompt for the whole app session) — no fork-and-exec of pkexec per call.
 TEST_F(WgBackendIntegrationTest, AllPrivilegedOpsGoThroughSession) {
@@ -269,12 +764,161 @@ TEST_F(WgBackendIntegrationTest, AllPrivilegedOpsGoThroughSession) {
     backend->Status("wg0");
   }
   EXPECT_EQ(session->show_calls.size(), 5u);
-  EXPECT_EQ(session->up_calls.size(), 1u);
+  EXPECT_EQ(session->inline_up_calls.size(), 1u);
   // Stop also goes through the session.
   backend->Stop("wg0");
-  EXPECT_EQ(session->down_calls.size(), 1u);
+  EXPECT_EQ(session->down_by_name_calls.size(), 1u);
   // The unprivileged `runner` is never used to exec pkexec.
   for (const auto& c : runner->calls) {
     for (const auto& a : c.argv) EXPECT_NE(a, "pkexec");
   }
 }
+
+// Already-privileged path: the config reaches the staging script on stdin,
+// framed by the same line count the elevated loop reads.
+TEST(RealPrivilegedSession, RootPathStreamsConfigOnStdin) {
+  ::setenv("FLUTTER_WIREGUARD_ELEVATE", "none", 1);
+  auto runner = std::make_shared<FakeRunner>();
+  flutter_wireguard::RealPrivilegedSession session(runner);
+  ::unsetenv("FLUTTER_WIREGUARD_ELEVATE");
+
+  session.WgQuickUpInline("wg0", "[Interface]\nPrivateKey = abc", "");
+  ASSERT_EQ(runner->calls.size(), 1u);
+  const auto& up = runner->calls[0];
+  ASSERT_EQ(up.argv.size(), 7u);
+  EXPECT_EQ(up.argv[0], "sh");
+  EXPECT_NE(up.argv[2].find("fwg_up"), std::string::npos);
+  EXPECT_EQ(up.argv[4], "wg0");
+  EXPECT_EQ(up.argv[5], "");
+  EXPECT_EQ(up.argv[6], "2");
+  ASSERT_TRUE(up.stdin_data.has_value());
+  EXPECT_EQ(*up.stdin_data, "[Interface]\nPrivateKey = abc\n");
+
+  session.WgQuickDownByName("wg0");
+  ASSERT_EQ(runner->calls.size(), 2u);
+  EXPECT_NE(runner->calls[1].argv[2].find("fwg_down"), std::string::npos);
+  EXPECT_EQ(runner->calls[1].argv.back(), "wg0");
+
+  session.SetPeerEndpoints("wg0", {{"A=", "192.0.2.1:1"}, {"B=", "[2001:db8::1]:2"}});
+  ASSERT_EQ(runner->calls.size(), 3u);
+  EXPECT_EQ(runner->calls[2].argv,
+            (std::vector<std::string>{"wg", "set", "wg0", "peer", "A=", "endpoint",
+                                      "192.0.2.1:1", "peer", "B=", "endpoint",
+                                      "[2001:db8::1]:2"}));
+  EXPECT_NE(session.SetPeerEndpoints("wg0", {{"A= x", "192.0.2.1:1"}}).exit_code, 0);
+  EXPECT_EQ(runner->calls.size(), 3u);
+}
+
+TEST_F(WgBackendIntegrationTest, AdoptsOnlyOwnRunningWireGuardLinks) {
+  const std::string staging = sysfs_root + "-run";
+  const std::string uapi = sysfs_root + "-uapi";
+  std::filesystem::create_directories(staging);
+  std::filesystem::create_directories(uapi);
+  backend->SetStagingDirForTesting(staging);
+  backend->SetUapiDirForTesting(uapi);
+  std::ofstream(staging + "/home.conf") << "";
+  std::ofstream(staging + "/tun0.conf") << "";  // TUN but no UAPI socket
+  std::ofstream(staging + "/eth0.conf") << "";  // not WireGuard at all
+
+  const std::vector<flutter_wireguard::NetLinkCpp> links = {
+      {"lo", ""},
+      {"eth0", ""},
+      {"home", "wireguard"},
+      {"wg0", "wireguard"},  // system tunnel, no config of ours
+      {"tun0", "tun"},
+  };
+  EXPECT_EQ(backend->AdoptRunningTunnels(links), 1u);
+  EXPECT_EQ(backend->TunnelNames(), std::vector<std::string>{"home"});
+  // Idempotent.
+  EXPECT_EQ(backend->AdoptRunningTunnels(links), 0u);
+
+  // Adopted tunnels behave as if started here: Status works and Stop goes
+  // by name, with no elevation for either discovery or the status read.
+  WriteSysfsCounters("home", 5, 6);
+  session->show_responses.push_back({1, "", ""});
+  EXPECT_EQ(backend->Status("home").state, TunnelStateCpp::kUp);
+  backend->Stop("home");
+  ASSERT_EQ(session->down_by_name_calls.size(), 1u);
+  EXPECT_EQ(session->down_by_name_calls[0], "home");
+  EXPECT_TRUE(session->up_calls.empty());
+  EXPECT_TRUE(session->inline_up_calls.empty());
+
+  std::filesystem::remove_all(staging);
+  std::filesystem::remove_all(uapi);
+}
+
+TEST_F(WgBackendIntegrationTest, RestartKeepsAdoptedKillSwitchesAndDropsDeadOnes) {
+  const std::string staging = sysfs_root + "-run";
+  std::filesystem::create_directories(staging);
+  const std::string record = staging + "/" + flutter_wireguard::kKillSwitchStateFile;
+  backend->SetStagingDirForTesting(staging);
+  session->kill_switch_record = record;
+  const std::string config =
+      "[Interface]\nPrivateKey = abc\nKillSwitch = on\n"
+      "[Peer]\nPublicKey = A\nEndpoint = 198.51.100.3:51820\n";
+  backend->Start("home", config);
+  backend->Start("work", config);
+  std::ofstream(staging + "/home.conf") << "";  // as fwg_stage leaves it
+  std::ofstream(staging + "/work.conf") << "";
+
+  // The app dies; `work` goes down with it, `home` keeps running.
+  SetUp();
+  backend->SetStagingDirForTesting(staging);
+  session->kill_switch_record = record;
+  std::filesystem::remove(staging + "/work.conf");
+  // Adoption runs at plugin registration: no prompt, even though `work`'s
+  // rules are stale.
+  EXPECT_EQ(backend->AdoptRunningTunnels({{"home", "wireguard"}}), 1u);
+  EXPECT_EQ(session->ElevatedCalls(), 0u);
+
+  // Stopping a tunnel nobody knows still elevates nothing.
+  backend->Stop("gone");
+  EXPECT_EQ(session->ElevatedCalls(), 0u);
+
+  // The next start commits the table: `home` and `cafe`, `work` dropped.
+  backend->Start("cafe", config);
+  ASSERT_EQ(session->kill_switch_calls.size(), 1u);
+  const KillSwitchSet kept = session->kill_switch_calls[0].first;
+  ASSERT_EQ(kept.size(), 2u);
+  ASSERT_EQ(kept.count("home"), 1u);
+  EXPECT_EQ(kept.count("work"), 0u);
+  ASSERT_EQ(kept.at("home").endpoints.size(), 1u);
+  EXPECT_EQ(kept.at("home").endpoints[0].port, 51820);
+  // Nothing to reconcile when adopting again.
+  backend->AdoptRunningTunnels({{"home", "wireguard"}});
+  EXPECT_EQ(session->kill_switch_calls.size(), 1u);
+
+  // Nothing left running at all: the table goes with the first stop that
+  // elevates anyway, even one of a tunnel without a kill switch.
+  backend->StopMany({"home", "cafe"});
+  EXPECT_FALSE(std::filesystem::exists(record));
+  flutter_wireguard::SaveKillSwitchRecords(record, kept);
+  SetUp();
+  backend->SetStagingDirForTesting(staging);
+  backend->Start("plain", "[Interface]\nPrivateKey = abc\n");
+  EXPECT_EQ(backend->AdoptRunningTunnels({{"plain", "wireguard"}}), 0u);
+  EXPECT_TRUE(session->kill_switch_calls.empty());
+  backend->Stop("plain");
+  ASSERT_EQ(session->kill_switch_calls.size(), 1u);
+  EXPECT_TRUE(session->kill_switch_calls[0].first.empty());
+  backend->Stop("plain");
+  EXPECT_EQ(session->kill_switch_calls.size(), 1u);
+
+  // A record that doesn't parse is left alone, table and file.
+  std::ofstream(record) << "garbage\n";
+  SetUp();
+  backend->SetStagingDirForTesting(staging);
+  EXPECT_EQ(backend->AdoptRunningTunnels(std::vector<flutter_wireguard::NetLinkCpp>{}), 0u);
+  backend->Start("plain", "[Interface]\nPrivateKey = abc\n");
+  EXPECT_TRUE(session->kill_switch_calls.empty());
+  EXPECT_TRUE(std::filesystem::exists(record));
+
+  std::filesystem::remove_all(staging);
+}
+
+TEST(ListNetLinks, SeesLoopback) {
+  auto links = WgBackend::ListNetLinks();
+  bool found = false;
+  for (const auto& l : links) found = found || l.name == "lo";
+  EXPECT_TRUE(found);
+}
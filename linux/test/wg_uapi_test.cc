@@ -0,0 +1,369 @@
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "privileged_session.h"
+#include "process_runner.h"
+#include "wg_backend.h"
+#include "wg_uapi.h"
+
+namespace flutter_wireguard {
+namespace {
+
+// wg genkey | wg pubkey, and the same key in UAPI hex.
+constexpr char kKeyB64[] = "xTIBA5rboUvnH4htodjb6e697QjLERt1NAB4mZqp8Dg=";
+constexpr char kKeyHex[] =
+    "c53201039adba14be71f886da1d8dbe9eebded08cb111b75340078999aa9f038";
+
+std::string Hex() { return kKeyHex; }
+
+std::string GetReply() {
+  return "private_key=0000000000000000000000000000000000000000000000000000000000000000\n"
+         "listen_port=51820\n"
+         "public_key=" + Hex() + "\n"
+         "preshared_key=0000000000000000000000000000000000000000000000000000000000000000\n"
+         "protocol_version=1\n"
+         "endpoint=[2001:db8::1]:51820\n"
+         "last_handshake_time_sec=1700000000\n"
+         "last_handshake_time_nsec=250000000\n"
+         "tx_bytes=200\n"
+         "rx_bytes=100\n"
+         "persistent_keepalive_interval=25\n"
+         "allowed_ip=10.0.0.0/24\n"
+         "allowed_ip=fd00::/64\n"
+         "public_key=" + std::string(64, 'a') + "\n"
+         "rx_bytes=1\n"
+         "tx_bytes=2\n"
+         "errno=0\n"
+         "\n";
+}
+
+// Minimal UAPI daemon: answers get=1 with GetReply() and acknowledges set=1,
+// recording what it was sent. `one_shot` mimics boringtun, which hangs up
+// after every request.
+class FakeUapiDaemon {
+ public:
+  FakeUapiDaemon(const std::string& path, bool one_shot)
+      : path_(path), one_shot_(one_shot) {
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    unlink(path.c_str());
+    EXPECT_EQ(bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    EXPECT_EQ(listen(listen_fd_, 4), 0);
+    thread_ = std::thread([this] { Loop(); });
+  }
+
+  ~FakeUapiDaemon() {
+    shutdown(listen_fd_, SHUT_RDWR);
+    // Unblock Serve() if a client still holds its connection open.
+    int conn = conn_fd_.load();
+    if (conn >= 0) shutdown(conn, SHUT_RDWR);
+    close(listen_fd_);
+    thread_.join();
+    unlink(path_.c_str());
+  }
+
+  int accepts() const { return accepts_.load(); }
+  std::vector<std::string> requests() {
+    std::lock_guard<std::mutex> lock(mu_);
+    return requests_;
+  }
+  std::string set_errno = "0";
+
+ private:
+  void Loop() {
+    while (true) {
+      int fd = accept(listen_fd_, nullptr, nullptr);
+      if (fd < 0) return;
+      ++accepts_;
+      conn_fd_ = fd;
+      Serve(fd);
+      conn_fd_ = -1;
+      close(fd);
+    }
+  }
+
+  void Serve(int fd) {
+    std::string buf;
+    char chunk[512];
+    while (true) {
+      size_t end = buf.find("\n\n");
+      if (end == std::string::npos) {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) return;
+        buf.append(chunk, static_cast<size_t>(n));
+        continue;
+      }
+      std::string req = buf.substr(0, end + 2);
+      buf.erase(0, end + 2);
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        requests_.push_back(req);
+      }
+      std::string reply = req.rfind("get=1\n", 0) == 0
+                              ? GetReply()
+                              : "errno=" + set_errno + "\n\n";
+      // Dribble the reply out in small writes to exercise the parser's
+      // line reassembly.
+      for (size_t off = 0; off < reply.size(); off += 7) {
+        send(fd, reply.data() + off, std::min<size_t>(7, reply.size() - off),
+             MSG_NOSIGNAL);
+      }
+      if (one_shot_) return;
+    }
+  }
+
+  std::string path_;
+  bool one_shot_;
+  int listen_fd_ = -1;
+  std::thread thread_;
+  std::atomic<int> accepts_{0};
+  std::atomic<int> conn_fd_{-1};
+  std::mutex mu_;
+  std::vector<std::string> requests_;
+};
+
+class UapiTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    dir = "/tmp/fwg-uapi-" + std::to_string(getpid());
+    std::filesystem::create_directories(dir);
+  }
+  void TearDown() override { std::filesystem::remove_all(dir); }
+  std::string dir;
+};
+
+TEST(WgKey, Base64AndHexRoundTrip) {
+  uint8_t a[kWgKeyLen], b[kWgKeyLen];
+  ASSERT_TRUE(WgKeyFromBase64(kKeyB64, a));
+  EXPECT_EQ(WgKeyToHex(a), Hex());
+  ASSERT_TRUE(WgKeyFromHex(Hex().data(), Hex().size(), b));
+  EXPECT_EQ(WgKeyToBase64(b), kKeyB64);
+  EXPECT_FALSE(WgKeyFromBase64("short=", a));
+  EXPECT_FALSE(WgKeyFromBase64(std::string(43, '*') + "=", a));
+  EXPECT_FALSE(WgKeyFromHex("zz", 2, a));
+}
+
+TEST(UapiParser, ParsesPeersAcrossEveryChunkBoundary) {
+  const std::string reply = GetReply();
+  UapiDevice dev;
+  UapiParser parser(&dev);
+  for (size_t split = 1; split < reply.size(); ++split) {
+    dev.Clear();
+    parser.Reset();
+    size_t used = 0;
+    EXPECT_FALSE(parser.Feed(reply.data(), split, &used));
+    ASSERT_TRUE(parser.Feed(reply.data() + split, reply.size() - split, &used));
+    ASSERT_EQ(dev.peers.size(), 2u);
+  }
+  EXPECT_EQ(dev.listen_port, 51820u);
+  EXPECT_EQ(dev.error, 0);
+  const UapiPeer& p = dev.peers[0];
+  EXPECT_EQ(WgKeyToBase64(p.public_key), kKeyB64);
+  EXPECT_STREQ(p.endpoint, "[2001:db8::1]:51820");
+  EXPECT_EQ(p.rx, 100);
+  EXPECT_EQ(p.tx, 200);
+  EXPECT_EQ(p.handshake_ms, int64_t{1700000000} * 1000 + 250);
+  EXPECT_EQ(p.keepalive, 25u);
+  EXPECT_EQ(p.allowed_ips, 2u);
+  EXPECT_EQ(dev.peers[1].rx, 1);
+  EXPECT_EQ(dev.peers[1].handshake_ms, 0);
+}
+
+TEST(UapiParser, ReusedDeviceKeepsCapacity) {
+  const std::string reply = GetReply();
+  UapiDevice dev;
+  UapiParser parser(&dev);
+  ASSERT_TRUE(parser.Feed(reply.data(), reply.size(), nullptr));
+  const UapiPeer* storage = dev.peers.data();
+  dev.Clear();
+  parser.Reset();
+  ASSERT_TRUE(parser.Feed(reply.data(), reply.size(), nullptr));
+  EXPECT_EQ(dev.peers.data(), storage);
+}
+
+TEST(UapiParser, RejectsGarbage) {
+  UapiDevice dev;
+  UapiParser parser(&dev);
+  const std::string no_eq = "listen_port\n";
+  EXPECT_THROW(parser.Feed(no_eq.data(), no_eq.size(), nullptr),
+               std::runtime_error);
+  parser.Reset();
+  const std::string longline(UapiParser::kMaxLine + 1, 'x');
+  EXPECT_THROW(parser.Feed(longline.data(), longline.size(), nullptr),
+               std::runtime_error);
+  parser.Reset();
+  const std::string bad_key = "public_key=nothex\n";
+  EXPECT_THROW(parser.Feed(bad_key.data(), bad_key.size(), nullptr),
+               std::runtime_error);
+}
+
+TEST(UapiRequests, BuildsSetBodies) {
+  EXPECT_EQ(UapiClient::AddPeerRequest(kKeyB64, "1.2.3.4:51820",
+                                       {"10.0.0.2/32", "fd00::2/128"}, 25),
+            "public_key=" + Hex() + "\n"
+            "endpoint=1.2.3.4:51820\n"
+            "persistent_keepalive_interval=25\n"
+            "replace_allowed_ips=true\n"
+            "allowed_ip=10.0.0.2/32\n"
+            "allowed_ip=fd00::2/128\n");
+  EXPECT_EQ(UapiClient::RemovePeerRequest(kKeyB64),
+            "public_key=" + Hex() + "\nremove=true\n");
+  EXPECT_THROW(UapiClient::AddPeerRequest("nope", "", {}, 0),
+               std::invalid_argument);
+  EXPECT_THROW(UapiClient::AddPeerRequest(kKeyB64, "x\nprivate_key=00", {}, 0),
+               std::invalid_argument);
+}
+
+TEST_F(UapiTest, KeepsOneConnectionAcrossRequests) {
+  FakeUapiDaemon daemon(dir + "/wg0.sock", /*one_shot=*/false);
+  UapiClient client("wg0", dir);
+  ASSERT_TRUE(client.Available());
+  UapiDevice dev;
+  for (int i = 0; i < 5; ++i) {
+    client.Get(&dev);
+    ASSERT_EQ(dev.peers.size(), 2u);
+  }
+  client.Set(UapiClient::RemovePeerRequest(kKeyB64));
+  EXPECT_EQ(daemon.accepts(), 1);
+  auto reqs = daemon.requests();
+  ASSERT_EQ(reqs.size(), 6u);
+  EXPECT_EQ(reqs[0], "get=1\n\n");
+  EXPECT_EQ(reqs[5], "set=1\npublic_key=" + Hex() + "\nremove=true\n\n");
+}
+
+TEST_F(UapiTest, ReconnectsWhenDaemonHangsUpAfterEachRequest) {
+  FakeUapiDaemon daemon(dir + "/wg0.sock", /*one_shot=*/true);
+  UapiClient client("wg0", dir);
+  UapiDevice dev;
+  for (int i = 0; i < 3; ++i) {
+    client.Get(&dev);
+    ASSERT_EQ(dev.peers.size(), 2u);
+  }
+  EXPECT_EQ(daemon.accepts(), 3);
+  EXPECT_EQ(daemon.requests().size(), 3u);
+}
+
+TEST_F(UapiTest, SetSurfacesDaemonErrno) {
+  FakeUapiDaemon daemon(dir + "/wg0.sock", /*one_shot=*/false);
+  daemon.set_errno = "-22";
+  UapiClient client("wg0", dir);
+  EXPECT_THROW(client.Set(UapiClient::RemovePeerRequest(kKeyB64)),
+               std::runtime_error);
+}
+
+TEST_F(UapiTest, MissingSocketIsUnavailable) {
+  UapiClient client("wg9", dir);
+  EXPECT_FALSE(client.Available());
+  UapiDevice dev;
+  EXPECT_THROW(client.Get(&dev), std::runtime_error);
+}
+
+// ----- WgBackend over UAPI -----
+
+class NullRunner : public ProcessRunner {
+ public:
+  ProcessResult Run(const std::vector<std::string>&,
+                    const std::map<std::string, std::string>&,
+                    const std::optional<std::string>&) override {
+    return ProcessResult{0, "", ""};
+  }
+  bool HasBinary(const std::string& name) override {
+    return name == "wg" || name == "wg-quick" || name == "wireguard-go";
+  }
+};
+
+class CountingSession : public PrivilegedSession {
+ public:
+  int shows = 0;
+  ProcessResult ShowDump(const std::string&) override {
+    ++shows;
+    return ProcessResult{1, "", "no"};
+  }
+  ProcessResult WgQuickUp(const std::string&, const std::string&) override {
+    return ProcessResult{0, "", ""};
+  }
+  ProcessResult WgQuickDown(const std::string&) override {
+    return ProcessResult{0, "", ""};
+  }
+  ProcessResult WgQuickUpInline(const std::string&, const std::string&,
+                                const std::string&) override {
+    return ProcessResult{0, "", ""};
+  }
+  ProcessResult WgQuickDownByName(const std::string&) override {
+    return ProcessResult{0, "", ""};
+  }
+  ProcessResult InstallPolicyRules(uint32_t, uint32_t) override {
+    return ProcessResult{0, "", ""};
+  }
+  ProcessResult InstallRoutes(const std::string&,
+                              const flutter_wireguard::RoutePlan&) override {
+    return ProcessResult{0, "", ""};
+  }
+};
+
+TEST_F(UapiTest, BackendReadsUserspaceTunnelsWithoutWgShow) {
+  auto session_uptr = std::make_unique<CountingSession>();
+  CountingSession* session = session_uptr.get();
+  WgBackend backend(std::make_unique<NullRunner>(), dir + "/conf",
+                    std::move(session_uptr));
+  backend.SetUapiDirForTesting(dir);
+  backend.SetSysfsRootForTesting(dir + "/sys");
+  std::filesystem::create_directories(dir + "/sys/wg0/statistics");
+  std::ofstream(dir + "/sys/wg0/statistics/rx_bytes") << "7\n";
+  std::ofstream(dir + "/sys/wg0/statistics/tx_bytes") << "7\n";
+  backend.Start("wg0", "[Interface]\n");
+
+  FakeUapiDaemon daemon(dir + "/wg0.sock", /*one_shot=*/false);
+  TunnelStatusCpp s = backend.Status("wg0");
+  EXPECT_EQ(s.state, TunnelStateCpp::kUp);
+  EXPECT_EQ(s.rx, 101);
+  EXPECT_EQ(s.tx, 202);
+  EXPECT_EQ(s.handshake, int64_t{1700000000} * 1000 + 250);
+
+  auto peers = backend.PeerStats("wg0");
+  ASSERT_EQ(peers.size(), 2u);
+  EXPECT_EQ(peers[0].public_key, kKeyB64);
+  EXPECT_EQ(peers[0].endpoint, "[2001:db8::1]:51820");
+
+  PeerConfigCpp add;
+  add.public_key = kKeyB64;
+  add.allowed_ips = {"10.0.0.9/32"};
+  backend.AddPeer("wg0", add);
+  backend.RemovePeer("wg0", kKeyB64);
+
+  EXPECT_EQ(session->shows, 0);
+  EXPECT_EQ(daemon.accepts(), 1);
+  EXPECT_EQ(daemon.requests().size(), 4u);
+}
+
+TEST_F(UapiTest, BackendRefusesLivePeerChangesWithoutSocket) {
+  WgBackend backend(std::make_unique<NullRunner>(), dir + "/conf",
+                    std::make_unique<CountingSession>());
+  backend.SetUapiDirForTesting(dir);
+  backend.Start("wg0", "");
+  PeerConfigCpp add;
+  add.public_key = kKeyB64;
+  EXPECT_THROW(backend.AddPeer("wg0", add), std::runtime_error);
+  EXPECT_THROW(backend.RemovePeer("wg0", "bad"), std::invalid_argument);
+  EXPECT_THROW(backend.RemovePeer("wg1", kKeyB64), std::runtime_error);
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "key_pairs.h"
+#include "wg_key.h"
+#include "x25519.h"
+
+namespace flutter_wireguard {
+namespace {
+
+std::vector<uint8_t> Hex(const std::string& hex) {
+  std::vector<uint8_t> out;
+  for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+    out.push_back(static_cast<uint8_t>(std::stoi(hex.substr(i, 2), nullptr, 16)));
+  }
+  return out;
+}
+
+std::string ToHex(const uint8_t* b, size_t n = kWgKeyLen) {
+  static constexpr char kDigits[] = "0123456789abcdef";
+  std::string s;
+  for (size_t i = 0; i < n; ++i) {
+    s.push_back(kDigits[b[i] >> 4]);
+    s.push_back(kDigits[b[i] & 0xf]);
+  }
+  return s;
+}
+
+// RFC 7748 section 5.2.
+TEST(X25519, Rfc7748ScalarMultiplication) {
+  uint8_t out[kWgKeyLen];
+  auto k = Hex("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4");
+  auto u = Hex("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c");
+  X25519(out, k.data(), u.data());
+  EXPECT_EQ(ToHex(out), "c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552");
+
+  k = Hex("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d");
+  u = Hex("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493");
+  X25519(out, k.data(), u.data());
+  EXPECT_EQ(ToHex(out), "95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957");
+}
+
+TEST(X25519, Rfc7748Iterated) {
+  uint8_t k[kWgKeyLen] = {9};
+  uint8_t u[kWgKeyLen] = {9};
+  uint8_t out[kWgKeyLen];
+  for (int i = 1; i <= 1000; ++i) {
+    X25519(out, k, u);
+    std::memcpy(u, k, kWgKeyLen);
+    std::memcpy(k, out, kWgKeyLen);
+    if (i == 1) {
+      EXPECT_EQ(ToHex(k), "422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079");
+    }
+  }
+  EXPECT_EQ(ToHex(k), "684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51");
+}
+
+// RFC 7748 section 6.1: both public keys and the shared secret.
+TEST(X25519, Rfc7748DiffieHellman) {
+  const auto alice = Hex("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+  const auto bob = Hex("5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+  uint8_t alice_pub[kWgKeyLen], bob_pub[kWgKeyLen], shared[kWgKeyLen];
+  PublicKey(alice_pub, alice.data());
+  PublicKey(bob_pub, bob.data());
+  EXPECT_EQ(ToHex(alice_pub), "8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a");
+  EXPECT_EQ(ToHex(bob_pub), "de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f");
+  X25519(shared, alice.data(), bob_pub);
+  EXPECT_EQ(ToHex(shared), "4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742");
+}
+
+// `echo <private> | wg pubkey`, with the private key from `wg genkey`.
+TEST(X25519, MatchesWgPubkey) {
+  uint8_t priv[kWgKeyLen], pub[kWgKeyLen];
+  ASSERT_TRUE(WgKeyFromBase64("dwdtCnMYpX08FsFyUbJmRd9ML4frwJkqsXf7pR25LCo=", priv));
+  PublicKey(pub, priv);
+  EXPECT_EQ(WgKeyToBase64(pub), "hSDwCYkwp1R0i33ctD73Wg2/Og0mOBr066SpjqqbTmo=");
+}
+
+TEST(X25519, BatchMatchesOneAtATimeAcrossBatchesAndThreads) {
+  constexpr size_t kN = 200;  // several batches, one of them short
+  std::vector<uint8_t> priv(kN * kWgKeyLen), pub(kN * kWgKeyLen);
+  uint32_t seed = 1;
+  for (auto& b : priv) {
+    seed = seed * 1103515245 + 12345;
+    b = static_cast<uint8_t>(seed >> 16);
+  }
+  for (size_t i = 0; i < kN; ++i) ClampPrivateKey(&priv[i * kWgKeyLen]);
+  PublicKeys(priv.data(), pub.data(), kN, /*max_threads=*/3);
+  for (size_t i = 0; i < kN; ++i) {
+    uint8_t one[kWgKeyLen];
+    PublicKey(one, &priv[i * kWgKeyLen]);
+    ASSERT_EQ(ToHex(one), ToHex(&pub[i * kWgKeyLen])) << i;
+  }
+  PublicKeys(priv.data(), pub.data(), 0);  // nothing to do
+}
+
+TEST(X25519, ClampIsWhatWgGenkeyDoes) {
+  uint8_t k[kWgKeyLen];
+  std::memset(k, 0xff, sizeof(k));
+  ClampPrivateKey(k);
+  EXPECT_EQ(k[0], 0xf8);
+  EXPECT_EQ(k[31], 0x7f);
+  std::memset(k, 0, sizeof(k));
+  ClampPrivateKey(k);
+  EXPECT_EQ(k[31], 0x40);
+}
+
+TEST(KeyPairs, GeneratedPairsAreClampedAndMatchWgPubkey) {
+  uint8_t next = 0;
+  auto fill = [&](uint8_t* out, size_t n) {
+    for (size_t i = 0; i < n; ++i) out[i] = next++;
+  };
+  auto pairs = GenerateKeyPairs(70, fill);
+  ASSERT_EQ(pairs.size(), 70u);
+  std::vector<std::string> privs;
+  for (const auto& p : pairs) {
+    uint8_t k[kWgKeyLen];
+    ASSERT_TRUE(WgKeyFromBase64(p.private_key, k));
+    EXPECT_EQ(k[0] & 7, 0);
+    EXPECT_EQ(k[31] & 0xc0, 0x40);
+    privs.push_back(p.private_key);
+  }
+  auto pubs = PublicKeysFromPrivate(privs);
+  for (size_t i = 0; i < pairs.size(); ++i) EXPECT_EQ(pubs[i], pairs[i].public_key);
+
+  EXPECT_TRUE(GenerateKeyPairs(0, fill).empty());
+  EXPECT_THROW(GenerateKeyPairs(-1, fill), std::invalid_argument);
+  EXPECT_THROW(GenerateKeyPairs(kMaxKeyPairs + 1, fill), std::invalid_argument);
+}
+
+TEST(KeyPairs, PublicKeysFromPrivateNamesTheBadKeyByIndex) {
+  EXPECT_EQ(PublicKeysFromPrivate({"dwdtCnMYpX08FsFyUbJmRd9ML4frwJkqsXf7pR25LCo="}),
+            std::vector<std::string>{"hSDwCYkwp1R0i33ctD73Wg2/Og0mOBr066SpjqqbTmo="});
+  try {
+    PublicKeysFromPrivate({"dwdtCnMYpX08FsFyUbJmRd9ML4frwJkqsXf7pR25LCo=", "secret!"});
+    FAIL() << "expected invalid_argument";
+  } catch (const std::invalid_argument& e) {
+    EXPECT_NE(std::string(e.what()).find("private key 1"), std::string::npos);
+    EXPECT_EQ(std::string(e.what()).find("secret"), std::string::npos);
+  }
+}
+
+}  // namespace
+}  // namespace flutter_wireguard
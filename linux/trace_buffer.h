@@ -0,0 +1,233 @@
+// Compile-time optional trace points, dumped as Chrome trace JSON.
+//
+// Built with FLUTTER_WIREGUARD_TRACE defined, FWG_TRACE_SCOPE("name") records
+// a complete event (start + duration) and FWG_TRACE_INSTANT("name") a point
+// event into a per-thread ring buffer. Only the owning thread writes its
+// ring, so recording is a clock read and a few plain stores, no lock and no
+// allocation. TraceDump() writes every ring to a JSON file that
+// chrome://tracing and ui.perfetto.dev open directly.
+//
+// Without FLUTTER_WIREGUARD_TRACE both macros expand to nothing and none of
+// the machinery below is compiled in.
+//
+// Names must be string literals (or otherwise outlive the process): only the
+// pointer is stored.
+#ifndef FLUTTER_WIREGUARD_TRACE_BUFFER_H_
+#define FLUTTER_WIREGUARD_TRACE_BUFFER_H_
+
+#ifdef FLUTTER_WIREGUARD_TRACE
+
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace flutter_wireguard {
+namespace trace {
+
+struct Event {
+  const char* name;
+  uint64_t ts_us;
+  uint64_t dur_us;  // 0 for instants
+  uint32_t tid;
+  char ph;          // 'X' complete, 'i' instant
+};
+
+inline uint64_t NowUs() {
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now().time_since_epoch())
+          .count());
+}
+
+// Single-writer ring. `head` counts every event ever written; the reader
+// takes the last kCapacity of them and drops any the writer may have
+// overwritten while it was copying. Dumping while threads are still
+// recording is therefore safe in practice but, strictly, a benign race on
+// the slots being copied.
+class ThreadRing {
+ public:
+  static constexpr uint64_t kCapacity = 8192;
+
+  void Push(const Event& e) {
+    const uint64_t h = head_.load(std::memory_order_relaxed);
+    events_[h % kCapacity] = e;
+    head_.store(h + 1, std::memory_order_release);
+  }
+
+  void CopyTo(std::vector<Event>* out) const {
+    const uint64_t end = head_.load(std::memory_order_acquire);
+    const uint64_t begin = end > kCapacity ? end - kCapacity : 0;
+    std::vector<Event> copy;
+    copy.reserve(static_cast<size_t>(end - begin));
+    for (uint64_t i = begin; i < end; ++i) copy.push_back(events_[i % kCapacity]);
+    const uint64_t after = head_.load(std::memory_order_acquire);
+    const uint64_t safe = after > kCapacity ? after - kCapacity : 0;
+    for (uint64_t i = begin; i < end; ++i) {
+      if (i >= safe) out->push_back(copy[static_cast<size_t>(i - begin)]);
+    }
+  }
+
+ private:
+  std::array<Event, kCapacity> events_{};
+  std::atomic<uint64_t> head_{0};
+};
+
+// Owns every ring ever handed out. The plugin runs each call on a fresh
+// detached thread, so rings of exited threads go back on a free list
+// (events intact) instead of piling up one per call.
+class Registry {
+ public:
+  static Registry& Instance() {
+    static Registry* registry = new Registry();  // outlives thread_locals
+    return *registry;
+  }
+
+  ThreadRing* Acquire() {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (!free_.empty()) {
+      ThreadRing* r = free_.back();
+      free_.pop_back();
+      return r;
+    }
+    rings_.push_back(std::make_unique<ThreadRing>());
+    return rings_.back().get();
+  }
+
+  void Release(ThreadRing* ring) {
+    std::lock_guard<std::mutex> lock(mu_);
+    free_.push_back(ring);
+  }
+
+  std::vector<Event> Collect() {
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<Event> out;
+    for (const auto& r : rings_) r->CopyTo(&out);
+    return out;
+  }
+
+ private:
+  std::mutex mu_;
+  std::vector<std::unique_ptr<ThreadRing>> rings_;
+  std::vector<ThreadRing*> free_;
+};
+
+struct ThreadState {
+  ThreadState()
+      : ring(Registry::Instance().Acquire()),
+        tid(static_cast<uint32_t>(::syscall(SYS_gettid))) {}
+  ~ThreadState() { Registry::Instance().Release(ring); }
+  ThreadRing* ring;
+  uint32_t tid;
+};
+
+inline ThreadState& Current() {
+  thread_local ThreadState state;
+  return state;
+}
+
+inline void Instant(const char* name) {
+  ThreadState& t = Current();
+  t.ring->Push({name, NowUs(), 0, t.tid, 'i'});
+}
+
+class Scope {
+ public:
+  explicit Scope(const char* name) : name_(name), start_(NowUs()) {}
+  ~Scope() {
+    ThreadState& t = Current();
+    t.ring->Push({name_, start_, NowUs() - start_, t.tid, 'X'});
+  }
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+
+ private:
+  const char* name_;
+  uint64_t start_;
+};
+
+inline void AppendJsonString(std::string* out, const char* s) {
+  out->push_back('"');
+  for (; *s != '\0'; ++s) {
+    const unsigned char c = static_cast<unsigned char>(*s);
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(static_cast<char>(c));
+    } else if (c < 0x20) {
+      char buf[8];
+      std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out->append(buf);
+    } else {
+      out->push_back(static_cast<char>(c));
+    }
+  }
+  out->push_back('"');
+}
+
+// Chrome trace "JSON object format". Timestamps are steady-clock
+// microseconds, which is all the viewers need for one process.
+inline std::string ToJson(const std::vector<Event>& events) {
+  const long pid = static_cast<long>(::getpid());
+  std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  char buf[160];
+  for (const auto& e : events) {
+    if (!first) out.push_back(',');
+    first = false;
+    out.append("{\"name\":");
+    AppendJsonString(&out, e.name);
+    if (e.ph == 'X') {
+      std::snprintf(buf, sizeof(buf),
+                    ",\"ph\":\"X\",\"ts\":%llu,\"dur\":%llu,\"pid\":%ld,"
+                    "\"tid\":%u}",
+                    static_cast<unsigned long long>(e.ts_us),
+                    static_cast<unsigned long long>(e.dur_us), pid, e.tid);
+    } else {
+      std::snprintf(buf, sizeof(buf),
+                    ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu,\"pid\":%ld,"
+                    "\"tid\":%u}",
+                    static_cast<unsigned long long>(e.ts_us), pid, e.tid);
+    }
+    out.append(buf);
+  }
+  out.append("]}\n");
+  return out;
+}
+
+}  // namespace trace
+
+// Writes everything recorded so far to `path`. Throws std::runtime_error if
+// the file cannot be written.
+inline void TraceDump(const std::string& path) {
+  const std::string json = trace::ToJson(trace::Registry::Instance().Collect());
+  std::FILE* f = std::fopen(path.c_str(), "w");
+  if (f == nullptr) throw std::runtime_error("cannot open " + path);
+  const bool ok = std::fwrite(json.data(), 1, json.size(), f) == json.size();
+  if (std::fclose(f) != 0 || !ok) throw std::runtime_error("cannot write " + path);
+}
+
+}  // namespace flutter_wireguard
+
+#define FWG_TRACE_CONCAT_(a, b) a##b
+#define FWG_TRACE_CONCAT(a, b) FWG_TRACE_CONCAT_(a, b)
+#define FWG_TRACE_SCOPE(name) \
+  ::flutter_wireguard::trace::Scope FWG_TRACE_CONCAT(fwg_trace_, __LINE__)(name)
+#define FWG_TRACE_INSTANT(name) ::flutter_wireguard::trace::Instant(name)
+
+#else  // !FLUTTER_WIREGUARD_TRACE
+
+#define FWG_TRACE_SCOPE(name) static_cast<void>(0)
+#define FWG_TRACE_INSTANT(name) static_cast<void>(0)
+
+#endif  // FLUTTER_WIREGUARD_TRACE
+
+#endif  // FLUTTER_WIREGUARD_TRACE_BUFFER_H_
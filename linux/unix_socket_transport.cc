@@ -0,0 +1,245 @@
+#include "unix_socket_transport.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace flutter_wireguard {
+
+namespace {
+
+sockaddr_un MakeAddress(const std::string& path) {
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    throw std::runtime_error("socket path too long: " + path);
+  }
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  return addr;
+}
+
+std::runtime_error SysError(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+// kOpMapStatus passes two; leave headroom without letting a hostile peer
+// make us accept an unbounded number.
+constexpr size_t kMaxPassedFds = 4;
+
+}  // namespace
+
+UnixSocketTransport::~UnixSocketTransport() {
+  if (fd_ >= 0) close(fd_);
+}
+
+size_t UnixSocketTransport::Read(uint8_t* buf, size_t len) {
+  while (true) {
+    ssize_t n = recv(fd_, buf, len, 0);
+    if (n > 0) return static_cast<size_t>(n);
+    if (n < 0 && errno == EINTR) continue;
+    return 0;
+  }
+}
+
+bool UnixSocketTransport::Write(const uint8_t* data, size_t len) {
+  while (len > 0) {
+    // MSG_NOSIGNAL: a vanished peer must not SIGPIPE the whole process.
+    ssize_t n = send(fd_, data, len, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += n;
+    len -= static_cast<size_t>(n);
+  }
+  return true;
+}
+
+bool UnixSocketTransport::WriteWithFds(const uint8_t* data, size_t len,
+                                       const std::vector<int>& fds) {
+  if (fds.empty() || len == 0) return Write(data, len);
+  if (fds.size() > kMaxPassedFds) return false;
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxPassedFds)] = {};
+  iovec iov{const_cast<uint8_t*>(data), len};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = CMSG_SPACE(sizeof(int) * fds.size());
+  cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+  std::memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * fds.size());
+  ssize_t n;
+  do {
+    n = sendmsg(fd_, &msg, MSG_NOSIGNAL);
+  } while (n < 0 && errno == EINTR);
+  if (n <= 0) return false;
+  // The descriptors went with the first byte; the rest is plain data.
+  return Write(data + n, len - static_cast<size_t>(n));
+}
+
+size_t UnixSocketTransport::ReadWithFds(uint8_t* buf, size_t len,
+                                        std::vector<int>* fds) {
+  alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxPassedFds)] = {};
+  iovec iov{buf, len};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  ssize_t n;
+  do {
+    n = recvmsg(fd_, &msg, MSG_CMSG_CLOEXEC);
+  } while (n < 0 && errno == EINTR);
+  if (n <= 0) return 0;
+  for (cmsghdr* c = CMSG_FIRSTHDR(&msg); c != nullptr; c = CMSG_NXTHDR(&msg, c)) {
+    if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) continue;
+    size_t count = (c->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < count; ++i) {
+      int fd;
+      std::memcpy(&fd, CMSG_DATA(c) + i * sizeof(int), sizeof(int));
+      fds->push_back(fd);
+    }
+  }
+  return static_cast<size_t>(n);
+}
+
+bool GetPeerCredentials(int fd, PeerCredentials* out) {
+  ucred cred{};
+  socklen_t len = sizeof(cred);
+  if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 ||
+      len != sizeof(cred)) {
+    return false;
+  }
+  out->pid = cred.pid;
+  out->uid = cred.uid;
+  out->gid = cred.gid;
+  return true;
+}
+
+int ConnectUnixSocket(const std::string& path) {
+  sockaddr_un addr = MakeAddress(path);
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) throw SysError("socket");
+  while (connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    if (errno == EINTR) continue;
+    std::runtime_error err = SysError("connect " + path);
+    close(fd);
+    throw err;
+  }
+  return fd;
+}
+
+UnixSocketServer::UnixSocketServer(std::string path, uid_t allowed_uid,
+                                   ipc::Dispatcher* dispatcher)
+    : path_(std::move(path)), allowed_uid_(allowed_uid), dispatcher_(dispatcher) {}
+
+UnixSocketServer::~UnixSocketServer() { Stop(); }
+
+void UnixSocketServer::Start() {
+  sockaddr_un addr = MakeAddress(path_);
+  int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) throw SysError("socket");
+  // A previous broker that crashed leaves its socket file behind; bind()
+  // would fail with EADDRINUSE forever otherwise.
+  unlink(path_.c_str());
+  if (bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    std::runtime_error err = SysError("bind " + path_);
+    close(fd);
+    throw err;
+  }
+  chmod(path_.c_str(), 0600);
+  if (listen(fd, SOMAXCONN) != 0) {
+    std::runtime_error err = SysError("listen " + path_);
+    close(fd);
+    unlink(path_.c_str());
+    throw err;
+  }
+  listen_fd_ = fd;
+  stopping_.store(false);
+  acceptor_ = std::thread([this] { AcceptLoop(); });
+}
+
+void UnixSocketServer::Stop() {
+  if (listen_fd_ < 0) return;
+  stopping_.store(true);
+  // shutdown() wakes the blocked accept(); close() alone does not.
+  shutdown(listen_fd_, SHUT_RDWR);
+  if (acceptor_.joinable()) acceptor_.join();
+  close(listen_fd_);
+  listen_fd_ = -1;
+  unlink(path_.c_str());
+
+  std::vector<std::thread> workers;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (int fd : live_fds_) shutdown(fd, SHUT_RDWR);
+    for (auto& kv : workers_) workers.push_back(std::move(kv.second));
+    workers_.clear();
+    finished_.clear();
+  }
+  for (auto& t : workers) t.join();
+}
+
+void UnixSocketServer::AcceptLoop() {
+  while (!stopping_.load()) {
+    int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      if (errno == EMFILE || errno == ENFILE) {
+        // Out of descriptors: back off instead of spinning.
+        usleep(10 * 1000);
+        continue;
+      }
+      break;
+    }
+    PeerCredentials cred;
+    if (!GetPeerCredentials(fd, &cred) || cred.uid != allowed_uid_) {
+      rejected_.fetch_add(1);
+      close(fd);
+      continue;
+    }
+    std::vector<std::thread> done;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      ReapFinishedLocked(&done);
+      if (stopping_.load()) {
+        close(fd);
+      } else {
+        live_fds_.insert(fd);
+        std::thread t([this, fd] { ServeConnection(fd); });
+        workers_.emplace(t.get_id(), std::move(t));
+      }
+    }
+    for (auto& t : done) t.join();
+  }
+}
+
+void UnixSocketServer::ServeConnection(int fd) {
+  UnixSocketTransport transport(fd);
+  dispatcher_->Serve(&transport);
+  // Drop the fd from the live set before the transport closes it, so Stop()
+  // never shuts down a recycled descriptor number.
+  std::lock_guard<std::mutex> lock(mu_);
+  live_fds_.erase(fd);
+  finished_.push_back(std::this_thread::get_id());
+}
+
+void UnixSocketServer::ReapFinishedLocked(std::vector<std::thread>* out) {
+  for (const auto& id : finished_) {
+    auto it = workers_.find(id);
+    if (it == workers_.end()) continue;
+    out->push_back(std::move(it->second));
+    workers_.erase(it);
+  }
+  finished_.clear();
+}
+
+}  // namespace flutter_wireguard
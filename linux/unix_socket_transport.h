@@ -0,0 +1,110 @@
+// Unix-domain-socket transport for the portable broker dispatcher
+// (cpp/broker_dispatcher.h).
+//
+// The server binds a SOCK_STREAM socket at a filesystem path, checks every
+// connecting peer's uid via SO_PEERCRED and serves each accepted connection
+// on its own thread through ipc::Dispatcher. Filesystem permissions on the
+// socket are a second line of defence only; SO_PEERCRED is what decides.
+#ifndef FLUTTER_WIREGUARD_UNIX_SOCKET_TRANSPORT_H_
+#define FLUTTER_WIREGUARD_UNIX_SOCKET_TRANSPORT_H_
+
+#include <sys/types.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "broker_dispatcher.h"
+
+namespace flutter_wireguard {
+
+// ipc::Transport over a connected stream socket. Owns (and closes) `fd`.
+class UnixSocketTransport : public ipc::Transport {
+ public:
+  explicit UnixSocketTransport(int fd) : fd_(fd) {}
+  ~UnixSocketTransport() override;
+
+  UnixSocketTransport(const UnixSocketTransport&) = delete;
+  UnixSocketTransport& operator=(const UnixSocketTransport&) = delete;
+
+  size_t Read(uint8_t* buf, size_t len) override;
+  bool Write(const uint8_t* data, size_t len) override;
+  bool CanPassFds() const override { return true; }
+  bool WriteWithFds(const uint8_t* data, size_t len,
+                    const std::vector<int>& fds) override;
+
+  // Like Read(), but also collects descriptors passed with SCM_RIGHTS
+  // (opened O_CLOEXEC; the caller owns them).
+  size_t ReadWithFds(uint8_t* buf, size_t len, std::vector<int>* fds);
+
+  int fd() const { return fd_; }
+
+ private:
+  int fd_;
+};
+
+// Credentials of the process on the other end of a connected AF_UNIX socket.
+struct PeerCredentials {
+  pid_t pid = 0;
+  uid_t uid = 0;
+  gid_t gid = 0;
+};
+
+// Reads SO_PEERCRED. Returns false if the kernel refuses (not AF_UNIX, ...).
+bool GetPeerCredentials(int fd, PeerCredentials* out);
+
+// Connects to the broker socket at `path`. Throws std::runtime_error.
+int ConnectUnixSocket(const std::string& path);
+
+class UnixSocketServer {
+ public:
+  // Only peers whose SO_PEERCRED uid equals `allowed_uid` are served; every
+  // other connection is closed before a single byte is read.
+  UnixSocketServer(std::string path, uid_t allowed_uid,
+                   ipc::Dispatcher* dispatcher);
+  ~UnixSocketServer();
+
+  UnixSocketServer(const UnixSocketServer&) = delete;
+  UnixSocketServer& operator=(const UnixSocketServer&) = delete;
+
+  // Binds (replacing a stale socket file), chmods the socket to 0600 and
+  // starts the accept thread. Throws std::runtime_error.
+  void Start();
+
+  // Stops accepting, shuts down every live connection and joins all
+  // threads. Idempotent.
+  void Stop();
+
+  // Number of connections rejected by the SO_PEERCRED check so far.
+  size_t rejected() const { return rejected_.load(); }
+
+ private:
+  void AcceptLoop();
+  void ServeConnection(int fd);
+  // Moves threads whose connection already ended out of workers_ so the
+  // caller can join them without holding mu_.
+  void ReapFinishedLocked(std::vector<std::thread>* out);
+
+  std::string path_;
+  uid_t allowed_uid_;
+  ipc::Dispatcher* dispatcher_;
+  int listen_fd_ = -1;
+  std::atomic<bool> stopping_{false};
+  std::atomic<size_t> rejected_{0};
+  std::thread acceptor_;
+
+  std::mutex mu_;
+  std::set<int> live_fds_;
+  std::map<std::thread::id, std::thread> workers_;
+  std::vector<std::thread::id> finished_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_UNIX_SOCKET_TRANSPORT_H_
@@ -0,0 +1,469 @@
+#include "usage_ledger.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace flutter_wireguard {
+
+namespace {
+
+using usage_ledger_internal::Header;
+using usage_ledger_internal::kMagic;
+using usage_ledger_internal::kVersion;
+using LedgerRecord = usage_ledger_internal::Record;
+
+constexpr size_t kInitialRecords = 4096;  // 352 KiB
+constexpr int64_t kHourMs = 3600 * 1000;
+
+std::runtime_error SysError(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+size_t FileBytes(size_t records) {
+  return sizeof(Header) + records * sizeof(LedgerRecord);
+}
+
+// Gives the first `bytes` of `fd` real blocks, growing it if needed. A
+// sparse range would only be backed when a store through the mapping
+// faults it in, and on a full disk that fault is a SIGBUS.
+void Allocate(int fd, size_t bytes, const std::string& path) {
+  const int err = ::posix_fallocate(fd, 0, static_cast<off_t>(bytes));
+  if (err != 0) {
+    throw std::runtime_error("allocate " + path + ": " + std::strerror(err));
+  }
+}
+
+Header* HeaderOf(void* mem) { return static_cast<Header*>(mem); }
+
+LedgerRecord* RecordsOf(void* mem) {
+  return reinterpret_cast<LedgerRecord*>(static_cast<char*>(mem) + sizeof(Header));
+}
+
+const LedgerRecord* RecordsOf(const void* mem) {
+  return reinterpret_cast<const LedgerRecord*>(static_cast<const char*>(mem) +
+                                               sizeof(Header));
+}
+
+bool SameTunnel(const LedgerRecord& r, const std::string& name) {
+  return name.size() < sizeof(r.tunnel) &&
+         std::strncmp(r.tunnel, name.c_str(), sizeof(r.tunnel)) == 0;
+}
+
+std::string TunnelOf(const LedgerRecord& r) {
+  return std::string(r.tunnel, strnlen(r.tunnel, sizeof(r.tunnel)));
+}
+
+bool IsTotal(const uint8_t key[kWgKeyLen]) {
+  uint8_t any = 0;
+  for (size_t i = 0; i < kWgKeyLen; ++i) any |= key[i];
+  return any == 0;
+}
+
+// Opens `path` for read/write and takes the ledger's lock on it.
+int OpenLocked(const std::string& path, int flags) {
+  const int fd = ::open(path.c_str(), O_RDWR | O_CLOEXEC | flags, 0600);
+  if (fd < 0) throw SysError("open " + path);
+  if (::flock(fd, LOCK_EX | LOCK_NB) != 0) {
+    const int err = errno;
+    ::close(fd);
+    if (err == EWOULDBLOCK) {
+      throw std::runtime_error("usage ledger " + path +
+                               " is in use by another process");
+    }
+    errno = err;
+    throw SysError("flock " + path);
+  }
+  return fd;
+}
+
+void InitHeader(Header* h) {
+  std::memset(h, 0, sizeof(*h));
+  std::memcpy(h->magic, kMagic, sizeof(kMagic));
+  h->version = kVersion;
+  h->record_size = sizeof(LedgerRecord);
+}
+
+int64_t NowMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+UsageLedger::UsageLedger(const std::string& path, int64_t flush_interval_ms)
+    : path_(path), flush_interval_ms_(flush_interval_ms) {
+  const std::filesystem::path dir = std::filesystem::path(path_).parent_path();
+  if (!dir.empty()) {
+    std::error_code ec;
+    if (std::filesystem::create_directories(dir, ec)) {
+      ::chmod(dir.c_str(), 0700);
+    } else if (ec) {
+      throw std::runtime_error("failed to create " + dir.string() + ": " +
+                               ec.message());
+    }
+  }
+  fd_ = OpenLocked(path_, O_CREAT);
+  try {
+    struct stat st;
+    if (::fstat(fd_, &st) != 0) throw SysError("fstat " + path_);
+    if (st.st_size == 0) {
+      Allocate(fd_, FileBytes(kInitialRecords), path_);
+      Map(kInitialRecords);
+      InitHeader(HeaderOf(mem_));
+    } else {
+      const size_t size = static_cast<size_t>(st.st_size);
+      if (size < FileBytes(0)) {
+        throw std::runtime_error(path_ + " is not a usage ledger");
+      }
+      // Older files were grown with ftruncate and may still have holes.
+      Allocate(fd_, size, path_);
+      Map((size - sizeof(Header)) / sizeof(LedgerRecord));
+      const Header* h = HeaderOf(mem_);
+      if (std::memcmp(h->magic, kMagic, sizeof(kMagic)) != 0 ||
+          h->version != kVersion || h->record_size != sizeof(LedgerRecord)) {
+        throw std::runtime_error(path_ + " is not a usage ledger");
+      }
+      if (h->count > capacity_) {
+        throw std::runtime_error(path_ + " is truncated");
+      }
+      Load();
+    }
+  } catch (...) {
+    Unmap();
+    ::close(fd_);
+    throw;
+  }
+}
+
+UsageLedger::~UsageLedger() {
+  try {
+    Flush(NowMs());
+  } catch (const std::exception&) {
+    // Out of disk: the unflushed batch is lost. Nothing was written past
+    // the allocated blocks, so every earlier batch is still in the file.
+  }
+  Unmap();
+  if (fd_ >= 0) ::close(fd_);
+}
+
+std::string UsageLedger::DefaultPath() {
+  std::filesystem::path base;
+  const char* xdg = std::getenv("XDG_DATA_HOME");
+  if (xdg != nullptr && *xdg != '\0') {
+    base = xdg;
+  } else {
+    const char* home = std::getenv("HOME");
+    base = std::filesystem::path(home != nullptr ? home : "") / ".local" / "share";
+  }
+  return (base / "flutter_wireguard" / "usage.ledger").string();
+}
+
+void UsageLedger::Map(size_t capacity) {
+  void* mem = ::mmap(nullptr, FileBytes(capacity), PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd_, 0);
+  if (mem == MAP_FAILED) throw SysError("mmap " + path_);
+  mem_ = mem;
+  capacity_ = capacity;
+}
+
+void UsageLedger::Unmap() {
+  if (mem_ != nullptr) ::munmap(mem_, FileBytes(capacity_));
+  mem_ = nullptr;
+  capacity_ = 0;
+}
+
+void UsageLedger::Load() {
+  const Header* h = HeaderOf(mem_);
+  const LedgerRecord* records = RecordsOf(mem_);
+  for (uint64_t i = 0; i < h->count; ++i) {
+    const LedgerRecord& r = records[i];
+    if (r.tunnel[0] == '\0') continue;
+    Tunnel& t = tunnels_[TunnelOf(r)];
+    WgKey key;
+    std::memcpy(key.bytes, r.key, kWgKeyLen);
+    Counter* c = IsTotal(r.key) ? &t.total : PeerCounter(&t, key);
+    // Records are in time order: the last one holds the latest reading.
+    c->known = true;
+    c->last_rx = r.rx_counter;
+    c->last_tx = r.tx_counter;
+  }
+}
+
+UsageLedger::Counter* UsageLedger::PeerCounter(Tunnel* t, const WgKey& key) {
+  auto [i, added] = t->index.Insert(key, static_cast<uint32_t>(t->peers.size()));
+  if (added) {
+    t->peers.emplace_back();
+    t->peers.back().key = key;
+  }
+  return &t->peers[*i];
+}
+
+int64_t UsageLedger::Advance(Counter* c, int64_t rx, int64_t tx) {
+  // Lower than last time: the link was re-created and counts from zero.
+  const bool reset = !c->known || rx < c->last_rx || tx < c->last_tx;
+  const int64_t drx = reset ? rx : rx - c->last_rx;
+  const int64_t dtx = reset ? tx : tx - c->last_tx;
+  c->known = true;
+  c->last_rx = rx;
+  c->last_tx = tx;
+  c->pending_rx += drx;
+  c->pending_tx += dtx;
+  return drx + dtx;
+}
+
+void UsageLedger::Record(const std::vector<TunnelStatusCpp>& tick,
+                         const std::vector<std::vector<PeerStatsCpp>>& peers,
+                         int64_t now_ms,
+                         std::vector<UsageQuotaEventCpp>* exceeded) {
+  std::lock_guard<std::mutex> lock(mu_);
+  if (last_flush_ms_ == 0) last_flush_ms_ = now_ms;
+  WgKey key;
+  for (size_t i = 0; i < tick.size(); ++i) {
+    const TunnelStatusCpp& s = tick[i];
+    if (s.state != TunnelStateCpp::kUp) continue;
+    Tunnel& t = tunnels_[s.name];
+    const int64_t used = Advance(&t.total, s.rx, s.tx);
+    if (i < peers.size()) {
+      for (const auto& p : peers[i]) {
+        if (!WgKeyFromBase64(p.public_key, &key)) continue;
+        Advance(PeerCounter(&t, key), p.rx, p.tx);
+      }
+    }
+    auto q = quotas_.find(s.name);
+    if (q == quotas_.end()) continue;
+    q->second.used += used;
+    if (q->second.used < q->second.limit) continue;
+    if (exceeded != nullptr) {
+      UsageQuotaEventCpp e;
+      e.name = s.name;
+      e.limit = q->second.limit;
+      e.used = q->second.used;
+      e.since = q->second.since;
+      exceeded->push_back(std::move(e));
+    }
+    quotas_.erase(q);
+  }
+  if (now_ms - last_flush_ms_ < flush_interval_ms_) return;
+  try {
+    FlushLocked(now_ms);
+  } catch (const std::exception&) {
+    // No room to grow: the batch stays pending and rides with the next
+    // flush, which may find the disk less full.
+  }
+}
+
+void UsageLedger::Flush(int64_t now_ms) {
+  std::lock_guard<std::mutex> lock(mu_);
+  FlushLocked(now_ms);
+}
+
+void UsageLedger::FlushLocked(int64_t now_ms) {
+  last_flush_ms_ = now_ms;
+  auto pending = [](const Counter& c) {
+    return c.pending_rx != 0 || c.pending_tx != 0;
+  };
+  uint64_t n = 0;
+  for (const auto& [name, t] : tunnels_) {
+    n += pending(t.total);
+    for (const auto& c : t.peers) n += pending(c);
+  }
+  if (n == 0) return;
+  Reserve(n, now_ms);
+
+  Header* h = HeaderOf(mem_);
+  LedgerRecord* out = RecordsOf(mem_) + h->count;
+  LedgerRecord r;
+  auto append = [&](const std::string& name, Counter* c) {
+    if (!pending(*c)) return;
+    std::memset(&r, 0, sizeof(r));
+    r.time_ms = now_ms;
+    std::memcpy(r.tunnel, name.data(), std::min(name.size(), sizeof(r.tunnel) - 1));
+    std::memcpy(r.key, c->key.bytes, kWgKeyLen);
+    r.rx = c->pending_rx;
+    r.tx = c->pending_tx;
+    r.rx_counter = c->last_rx;
+    r.tx_counter = c->last_tx;
+    std::memcpy(out++, &r, sizeof(r));
+    c->pending_rx = c->pending_tx = 0;
+  };
+  for (auto& [name, t] : tunnels_) {
+    append(name, &t.total);
+    for (auto& c : t.peers) append(name, &c);
+  }
+  // Only now does the batch count.
+  h->count += n;
+}
+
+void UsageLedger::Reserve(uint64_t more, int64_t now_ms) {
+  if (HeaderOf(mem_)->count + more <= capacity_) return;
+  if (HeaderOf(mem_)->count >= kCompactRecords) {
+    CompactLocked(now_ms);
+    if (HeaderOf(mem_)->count + more <= capacity_) return;
+  }
+  const size_t capacity = std::max<size_t>(
+      2 * capacity_, static_cast<size_t>(HeaderOf(mem_)->count + more));
+  try {
+    Allocate(fd_, FileBytes(capacity), path_);
+  } catch (...) {
+    // A partial allocation may have grown the file; the mapping never did.
+    // If this fails too, the next open allocates whatever is there.
+    int rc = ::ftruncate(fd_, static_cast<off_t>(FileBytes(capacity_)));
+    (void)rc;
+    throw;
+  }
+  Unmap();
+  Map(capacity);
+}
+
+void UsageLedger::Compact(int64_t now_ms) {
+  std::lock_guard<std::mutex> lock(mu_);
+  CompactLocked(now_ms);
+}
+
+void UsageLedger::CompactLocked(int64_t now_ms) {
+  const int64_t cutoff = now_ms - kCompactAfterMs;
+  const uint64_t count = HeaderOf(mem_)->count;
+  const LedgerRecord* in = RecordsOf(mem_);
+
+  // Old records fold into the hour they end in, stamped with its end, so a
+  // query from inside that hour still counts them.
+  std::vector<LedgerRecord> out;
+  std::map<std::pair<std::string, int64_t>, size_t> buckets;
+  for (uint64_t i = 0; i < count; ++i) {
+    const LedgerRecord& r = in[i];
+    if (r.tunnel[0] == '\0') continue;
+    if (r.time_ms >= cutoff) {
+      out.push_back(r);
+      continue;
+    }
+    const int64_t hour_end = (r.time_ms / kHourMs + 1) * kHourMs;
+    std::string id(r.tunnel, sizeof(r.tunnel));
+    id.append(reinterpret_cast<const char*>(r.key), kWgKeyLen);
+    auto [it, added] = buckets.emplace(std::make_pair(std::move(id), hour_end),
+                                       out.size());
+    if (added) {
+      out.push_back(r);
+      out.back().time_ms = hour_end;
+      continue;
+    }
+    LedgerRecord& b = out[it->second];
+    b.rx += r.rx;
+    b.tx += r.tx;
+    b.rx_counter = r.rx_counter;
+    b.tx_counter = r.tx_counter;
+  }
+  std::stable_sort(out.begin(), out.end(),
+                   [](const LedgerRecord& a, const LedgerRecord& b) {
+                     return a.time_ms < b.time_ms;
+                   });
+
+  // Written beside the ledger and renamed over it: a crash leaves one or
+  // the other, never half of each.
+  const std::string tmp = path_ + ".tmp";
+  const size_t capacity = std::max(kInitialRecords, 2 * out.size());
+  const int fd = OpenLocked(tmp, O_CREAT | O_TRUNC);
+  try {
+    Header h;
+    InitHeader(&h);
+    h.count = out.size();
+    Allocate(fd, FileBytes(capacity), tmp);
+    if (::pwrite(fd, &h, sizeof(h), 0) != static_cast<ssize_t>(sizeof(h))) {
+      throw SysError("write " + tmp);
+    }
+    const size_t bytes = out.size() * sizeof(LedgerRecord);
+    if (bytes > 0 &&
+        ::pwrite(fd, out.data(), bytes, sizeof(Header)) != static_cast<ssize_t>(bytes)) {
+      throw SysError("write " + tmp);
+    }
+    if (::fsync(fd) != 0) throw SysError("fsync " + tmp);
+    if (::rename(tmp.c_str(), path_.c_str()) != 0) throw SysError("rename " + tmp);
+  } catch (...) {
+    ::close(fd);
+    ::unlink(tmp.c_str());
+    throw;
+  }
+  Unmap();
+  ::close(fd_);
+  fd_ = fd;
+  Map(capacity);
+}
+
+TunnelUsageCpp UsageLedger::Usage(const std::string& name, int64_t since_ms) const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return UsageLocked(name, since_ms);
+}
+
+TunnelUsageCpp UsageLedger::UsageLocked(const std::string& name,
+                                        int64_t since_ms) const {
+  TunnelUsageCpp u;
+  u.name = name;
+  u.since = since_ms;
+  WgKeyMap<uint32_t> index;
+  std::vector<std::pair<WgKey, PeerUsageCpp>> peers;
+  auto add = [&](const uint8_t key[kWgKeyLen], int64_t rx, int64_t tx) {
+    if (IsTotal(key)) {
+      u.rx += rx;
+      u.tx += tx;
+      return;
+    }
+    WgKey k;
+    std::memcpy(k.bytes, key, kWgKeyLen);
+    auto [i, added] = index.Insert(k, static_cast<uint32_t>(peers.size()));
+    if (added) peers.emplace_back(k, PeerUsageCpp());
+    peers[*i].second.rx += rx;
+    peers[*i].second.tx += tx;
+  };
+
+  const uint64_t count = HeaderOf(mem_)->count;
+  const LedgerRecord* records = RecordsOf(static_cast<const void*>(mem_));
+  for (uint64_t i = 0; i < count; ++i) {
+    const LedgerRecord& r = records[i];
+    if (r.time_ms > since_ms && SameTunnel(r, name)) add(r.key, r.rx, r.tx);
+  }
+  auto t = tunnels_.find(name);
+  if (t != tunnels_.end()) {
+    add(t->second.total.key.bytes, t->second.total.pending_rx,
+        t->second.total.pending_tx);
+    for (const auto& c : t->second.peers) add(c.key.bytes, c.pending_rx, c.pending_tx);
+  }
+
+  for (auto& [key, p] : peers) {
+    if (p.rx == 0 && p.tx == 0) continue;
+    p.public_key = WgKeyToBase64(key);
+    u.peers.push_back(std::move(p));
+  }
+  return u;
+}
+
+int64_t UsageLedger::SetQuota(const std::string& name, int64_t limit_bytes,
+                              int64_t since_ms) {
+  std::lock_guard<std::mutex> lock(mu_);
+  const TunnelUsageCpp u = UsageLocked(name, since_ms);
+  if (limit_bytes <= 0) {
+    quotas_.erase(name);
+  } else {
+    quotas_[name] = Quota{limit_bytes, since_ms, u.rx + u.tx};
+  }
+  return u.rx + u.tx;
+}
+
+uint64_t UsageLedger::records() const {
+  std::lock_guard<std::mutex> lock(mu_);
+  return HeaderOf(mem_)->count;
+}
+
+}  // namespace flutter_wireguard
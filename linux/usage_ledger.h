@@ -0,0 +1,196 @@
+// Persistent per-tunnel and per-peer data usage, with optional quotas.
+//
+// Interface counters start from zero whenever a tunnel's link is
+// re-created, and the plugin itself keeps nothing across restarts, so
+// neither can answer "how much has wg0 used this month". The ledger can:
+// the status poller hands it every tick's counters, it turns them into
+// deltas (a counter that went down was reset; what it reads now is all
+// new), and appends those to a file that outlives both.
+//
+// The file is a 64-byte header followed by fixed-size records, mapped
+// MAP_SHARED and only ever appended to. A record is the usage of one peer
+// (or of the tunnel as a whole) over one batch, together with the raw
+// counters it was computed from, so a restarted plugin picks up where the
+// last one stopped instead of counting a running tunnel's traffic twice.
+// Ticks only add into in-memory accumulators; once per flush interval the
+// batch is memcpy'd into the mapping and the header's record count is
+// bumped after it, leaving write-back to the kernel. A crash loses at most
+// that one interval; records past the count are ignored, so a batch cut
+// short is not counted. The file's blocks are allocated before they are
+// mapped, so a full disk fails a flush rather than a store into the
+// mapping. A tunnel the ledger has never seen counts from the creation of
+// its link.
+//
+// Records older than a day are folded into hourly ones once the file
+// passes kCompactRecords, so it grows with the hours a peer is used, not
+// with the ticks.
+#ifndef FLUTTER_WIREGUARD_USAGE_LEDGER_H_
+#define FLUTTER_WIREGUARD_USAGE_LEDGER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "peer_index.h"
+#include "wg_backend.h"
+#include "wg_key.h"
+#include "wg_key_map.h"
+
+namespace flutter_wireguard {
+
+struct PeerUsageCpp {
+  std::string public_key;  // base64
+  int64_t rx = 0;
+  int64_t tx = 0;
+};
+
+struct TunnelUsageCpp {
+  std::string name;
+  int64_t since = 0;  // epoch ms, as asked
+  int64_t rx = 0;
+  int64_t tx = 0;
+  std::vector<PeerUsageCpp> peers;  // those with any traffic since `since`
+};
+
+// A tunnel whose rx + tx since the quota's start reached its limit.
+struct UsageQuotaEventCpp {
+  std::string name;
+  int64_t limit = 0;  // bytes
+  int64_t used = 0;   // bytes, rx + tx
+  int64_t since = 0;  // epoch ms
+  bool stopped = false;  // set by RecordUsage once Stop() succeeded
+};
+
+namespace usage_ledger_internal {
+
+inline constexpr char kMagic[8] = {'F', 'W', 'G', 'U', 'S', 'A', 'G', 'E'};
+inline constexpr uint32_t kVersion = 1;
+
+struct Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t count;  // committed records; written after them
+  uint64_t reserved[5];
+};
+static_assert(sizeof(Header) == 64, "ledger header layout");
+
+struct Record {
+  int64_t time_ms;      // end of the batch it covers
+  char tunnel[16];      // NUL-padded interface name
+  uint8_t key[kWgKeyLen];  // the peer; all zero for the tunnel as a whole
+  int64_t rx;           // bytes in the batch
+  int64_t tx;
+  int64_t rx_counter;   // interface counters as last read
+  int64_t tx_counter;
+};
+static_assert(sizeof(Record) == 88, "ledger record layout");
+
+}  // namespace usage_ledger_internal
+
+class UsageLedger {
+ public:
+  // Past this many records, growing the file compacts it first.
+  static constexpr uint64_t kCompactRecords = 1 << 18;
+  // Records younger than this are never folded.
+  static constexpr int64_t kCompactAfterMs = 24 * 3600 * 1000;
+
+  // Opens the ledger at `path`, creating it (and its directory, 0700) if
+  // needed. Throws std::runtime_error if it can't be mapped, isn't a
+  // ledger, or another process holds it.
+  explicit UsageLedger(const std::string& path,
+                       int64_t flush_interval_ms = 60 * 1000);
+  ~UsageLedger();  // flushes
+
+  UsageLedger(const UsageLedger&) = delete;
+  UsageLedger& operator=(const UsageLedger&) = delete;
+
+  // $XDG_DATA_HOME/flutter_wireguard/usage.ledger, or under
+  // ~/.local/share without XDG_DATA_HOME. Data, not runtime: it has to
+  // survive a reboot.
+  static std::string DefaultPath();
+
+  // One poll: `tick` and `peers` as PollTunnelStatuses returns them. Only
+  // tunnels that are up count. Quotas that the tick pushes over their
+  // limit are appended to `exceeded` and disarmed. Flushes when the
+  // interval since the last flush has passed; if the file can't grow, the
+  // batch stays pending until a later flush succeeds.
+  void Record(const std::vector<TunnelStatusCpp>& tick,
+              const std::vector<std::vector<PeerStatsCpp>>& peers,
+              int64_t now_ms,
+              std::vector<UsageQuotaEventCpp>* exceeded = nullptr);
+
+  // Appends everything accumulated since the last flush, stamped `now_ms`.
+  // Throws std::runtime_error, with the batch still pending, if the file
+  // can't grow to hold it.
+  void Flush(int64_t now_ms);
+
+  // Usage of `name` since `since_ms`, including the unflushed batch. Batches
+  // are counted whole if they end after `since_ms`, so the answer is exact
+  // to the flush interval (and to the hour for data over a day old).
+  TunnelUsageCpp Usage(const std::string& name, int64_t since_ms) const;
+
+  // Arms a quota: once `name`'s rx + tx since `since_ms` reaches
+  // `limit_bytes`, Record reports it (once). A limit of 0 or less removes
+  // the quota. Returns what is already used.
+  int64_t SetQuota(const std::string& name, int64_t limit_bytes,
+                   int64_t since_ms);
+
+  // Folds records older than kCompactAfterMs before `now_ms` into one per
+  // tunnel, peer and hour, by rewriting the file and renaming it over the
+  // old one.
+  void Compact(int64_t now_ms);
+
+  // Records committed to the file.
+  uint64_t records() const;
+
+ private:
+  struct Counter {
+    WgKey key{};
+    bool known = false;  // `last_*` hold a reading
+    int64_t last_rx = 0;
+    int64_t last_tx = 0;
+    int64_t pending_rx = 0;
+    int64_t pending_tx = 0;
+  };
+
+  struct Tunnel {
+    Counter total;
+    std::vector<Counter> peers;
+    WgKeyMap<uint32_t> index;  // key -> position in `peers`
+  };
+
+  struct Quota {
+    int64_t limit = 0;
+    int64_t since = 0;
+    int64_t used = 0;
+  };
+
+  void Map(size_t capacity);
+  void Unmap();
+  void Reserve(uint64_t more, int64_t now_ms);
+  void Load();
+  Counter* PeerCounter(Tunnel* t, const WgKey& key);
+  static int64_t Advance(Counter* c, int64_t rx, int64_t tx);
+  void FlushLocked(int64_t now_ms);
+  void CompactLocked(int64_t now_ms);
+  TunnelUsageCpp UsageLocked(const std::string& name, int64_t since_ms) const;
+
+  const std::string path_;
+  const int64_t flush_interval_ms_;
+  int fd_ = -1;
+  void* mem_ = nullptr;
+  size_t capacity_ = 0;  // records the mapping has room for
+  int64_t last_flush_ms_ = 0;
+
+  mutable std::mutex mu_;
+  std::map<std::string, Tunnel> tunnels_;
+  std::map<std::string, Quota> quotas_;
+};
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_USAGE_LEDGER_H_
@@ -1,11 +1,17 @@
 #include "wg_backend.h"
 
 #include <fcntl.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/utsname.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cctype>
 #include <cerrno>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -13,8 +19,11 @@
 #include <fstream>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
 
 #include "name_validator.h"
+#include "phase_timer.h"
+#include "trace_buffer.h"
 
 namespace flutter_wireguard {
 
@@ -42,6 +51,50 @@ bool ParseI64(const std::string& s, int64_t* out) {
   return true;
 }
 
+// Rule priority for switched tunnels: ahead of the pair wg-quick adds for a
+// default route (32764/32765), behind anything an administrator put first.
+constexpr uint32_t kSwitchRulePriority = 32000;
+
+// How often SwitchTunnel looks for the new tunnel's first handshake. A UAPI
+// read is a local socket round trip; anything else is a `wg show` through
+// the elevated shell, shared with the status poller, so it goes slower.
+constexpr std::chrono::milliseconds kSwitchUapiPollInterval{20};
+constexpr std::chrono::milliseconds kSwitchShowPollInterval{250};
+
+// Lower-cased copy of `s` with surrounding blanks removed.
+std::string TrimLower(const std::string& s) {
+  size_t b = s.find_first_not_of(" \t\r");
+  size_t e = s.find_last_not_of(" \t\r");
+  if (b == std::string::npos) return std::string();
+  std::string out = s.substr(b, e - b + 1);
+  for (char& c : out) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  return out;
+}
+
+// "wg-quick <verb> failed (<ec>): <output>" for a failed privileged op.
+std::string WgQuickError(const char* verb, const ProcessResult& r) {
+  return std::string("wg-quick ") + verb + " failed (" +
+         std::to_string(r.exit_code) + "): " +
+         (r.stderr_data.empty() ? r.stdout_data : r.stderr_data);
+}
+
+int64_t NowEpochMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+PeerStatsCpp ToPeerStats(const UapiPeer& p) {
+  PeerStatsCpp out;
+  out.public_key = WgKeyToBase64(p.public_key);
+  out.endpoint = p.endpoint;
+  out.rx = p.rx;
+  out.tx = p.tx;
+  out.handshake = p.handshake_ms;
+  out.keepalive = p.keepalive;
+  return out;
+}
+
 }  // namespace
 
 bool WgBackend::ReadSysfsCounters(const std::string& name,
@@ -108,12 +161,98 @@ TunnelStatusCpp WgBackend::ParseWgShowDump(const std::string& name,
   return s;
 }
 
+std::vector<PeerStatsCpp> WgBackend::ParseWgShowDumpPeers(
+    const std::string& dump_stdout) {
+  std::vector<PeerStatsCpp> peers;
+  std::stringstream ss(dump_stdout);
+  std::string line;
+  bool first = true;
+  while (std::getline(ss, line)) {
+    if (line.empty()) continue;
+    if (first) { first = false; continue; }
+    auto parts = Split(line, '\t');
+    if (parts.size() < 8) continue;
+    PeerStatsCpp p;
+    p.public_key = parts[0];
+    if (parts[2] != "(none)") p.endpoint = parts[2];
+    int64_t hs = 0, keepalive = 0;
+    ParseI64(parts[4], &hs);
+    ParseI64(parts[5], &p.rx);
+    ParseI64(parts[6], &p.tx);
+    p.handshake = hs * 1000;
+    if (ParseI64(parts[7], &keepalive)) {
+      p.keepalive = static_cast<uint32_t>(keepalive);  // "off" stays 0
+    }
+    peers.push_back(std::move(p));
+  }
+  return peers;
+}
+
+std::vector<NetLinkCpp> WgBackend::ListNetLinks() {
+  std::vector<NetLinkCpp> links;
+  int fd = ::socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+  if (fd < 0) return links;
+
+  struct {
+    nlmsghdr nh;
+    ifinfomsg ifm;
+  } req{};
+  req.nh.nlmsg_len = sizeof(req);
+  req.nh.nlmsg_type = RTM_GETLINK;
+  req.nh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+  req.nh.nlmsg_seq = 1;
+  req.ifm.ifi_family = AF_UNSPEC;
+  if (::send(fd, &req, sizeof(req), 0) < 0) {
+    ::close(fd);
+    return links;
+  }
+
+  // Link messages are a few hundred bytes to ~2 KiB each; the kernel packs
+  // as many as fit into each datagram.
+  alignas(nlmsghdr) char buf[32 * 1024];
+  bool done = false;
+  while (!done) {
+    ssize_t n = ::recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) break;
+    for (auto* nh = reinterpret_cast<nlmsghdr*>(buf);
+         NLMSG_OK(nh, static_cast<size_t>(n)); nh = NLMSG_NEXT(nh, n)) {
+      if (nh->nlmsg_type == NLMSG_DONE || nh->nlmsg_type == NLMSG_ERROR) {
+        done = true;
+        break;
+      }
+      if (nh->nlmsg_type != RTM_NEWLINK) continue;
+      auto* ifm = static_cast<ifinfomsg*>(NLMSG_DATA(nh));
+      int len = static_cast<int>(nh->nlmsg_len - NLMSG_LENGTH(sizeof(*ifm)));
+      NetLinkCpp link;
+      for (auto* rta = IFLA_RTA(ifm); RTA_OK(rta, len);
+           rta = RTA_NEXT(rta, len)) {
+        if (rta->rta_type == IFLA_IFNAME) {
+          link.name = static_cast<const char*>(RTA_DATA(rta));
+        } else if (rta->rta_type == IFLA_LINKINFO) {
+          int info_len = static_cast<int>(RTA_PAYLOAD(rta));
+          for (auto* info = static_cast<rtattr*>(RTA_DATA(rta));
+               RTA_OK(info, info_len); info = RTA_NEXT(info, info_len)) {
+            if (info->rta_type == IFLA_INFO_KIND) {
+              link.kind = static_cast<const char*>(RTA_DATA(info));
+            }
+          }
+        }
+      }
+      if (!link.name.empty()) links.push_back(std::move(link));
+    }
+  }
+  ::close(fd);
+  return links;
+}
+
 WgBackend::WgBackend(std::unique_ptr<ProcessRunner> runner,
                      std::string config_dir,
                      std::unique_ptr<PrivilegedSession> elevated)
     : runner_(std::move(runner)),
       elevated_(std::move(elevated)),
-      config_dir_(std::move(config_dir)) {
+      config_dir_(std::move(config_dir)),
+      endpoints_(std::make_unique<EndpointResolver>(SystemHostResolver())) {
   if (!elevated_) {
     // Default: build a real pkexec-backed session sharing our ProcessRunner.
     // We hand the session a non-owning view of runner_ via a shared_ptr alias
@@ -159,6 +298,10 @@ WgBackend::WgBackend(std::unique_ptr<ProcessRunner> runner,
                              config_dir_);
   }
 
+  if (const char* mode = std::getenv("FLUTTER_WIREGUARD_CONFIG_HANDOFF")) {
+    if (std::strcmp(mode, "file") == 0) handoff_ = ConfigHandoff::kFile;
+  }
+
   is_root_ = (geteuid() == 0);
   DetectBackend();
 }
@@ -243,51 +386,468 @@ std::string WgBackend::WriteConfigFile(const std::string& name,
 }
 
 void WgBackend::Start(const std::string& name, const std::string& config) {
+  FWG_TRACE_SCOPE("backend.start");
   if (!IsValidName(name)) {
     throw std::invalid_argument("invalid interface name '" + name + "'");
   }
   if (backend_.kind == BackendKindCpp::kUnknown) {
     throw std::runtime_error(backend_.detail);
   }
-  std::string cfg_path = WriteConfigFile(name, config);
-
-  ProcessResult r = elevated_->WgQuickUp(cfg_path, PickUserspaceImpl());
+  PhaseTimer total("start", "total");
+  const int64_t started_ms = NowEpochMs();
+  // Every endpoint hostname at once, instead of one by one inside wg.
+  std::string resolved = WithPrimaryEndpoints(config);
+  std::map<std::string, std::string> numeric;
+  {
+    PhaseTimer t("start", "resolve");
+    numeric = endpoints_->ResolveConfigs({&resolved});
+  }
+  TakeOver take_over;
+  const std::string up_config = PlanTakeOver(resolved, &take_over);
+  // Armed before the link exists, so the tunnel's first packet already
+  // finds it; undone if the start fails.
+  KillSwitchChanges disarm;
+  if (take_over.kill_switch) {
+    AddFailoverEndpoints(config, &take_over.kill_switch_plan);
+    PhaseTimer t("start", "kill_switch");
+    const std::string error =
+        UpdateKillSwitches({{name, take_over.kill_switch_plan}}, &disarm);
+    if (!error.empty()) throw std::runtime_error(error);
+  }
+  ProcessResult r;
+  std::string path;
+  if (handoff_ == ConfigHandoff::kFile) {
+    {
+      PhaseTimer t("start", "write_config");
+      path = WriteConfigFile(name, up_config);
+    }
+    // Includes the elevation prompt the first time; that part is also
+    // recorded on its own as session/elevate.
+    PhaseTimer t("start", "wg_quick_up");
+    r = elevated_->WgQuickUp(path, PickUserspaceImpl());
+  } else {
+    PhaseTimer t("start", "wg_quick_up");
+    r = elevated_->WgQuickUpInline(name, up_config, PickUserspaceImpl());
+  }
   if (r.exit_code != 0) {
-    throw std::runtime_error(
-        "wg-quick up failed (" + std::to_string(r.exit_code) + "): " +
-        (r.stderr_data.empty() ? r.stdout_data : r.stderr_data));
+    if (!disarm.empty()) UpdateKillSwitches(disarm);
+    throw std::runtime_error(WgQuickError("up", r));
   }
-  std::lock_guard<std::mutex> lock(mu_);
-  known_tunnels_.insert(name);
+  {
+    const std::string error = FinishTakeOver(name, take_over);
+    if (!error.empty()) {
+      if (handoff_ == ConfigHandoff::kFile) {
+        elevated_->WgQuickDown(path);
+      } else {
+        elevated_->WgQuickDownByName(name);
+      }
+      if (!disarm.empty()) UpdateKillSwitches(disarm);
+      throw std::runtime_error(error);
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    known_tunnels_.insert(name);
+  }
+  IndexPeers(name, config);
+  TrackEndpoints(name, config, numeric);
+  health_.Started(name, started_ms);
+  peers_.Forget(name);
+  DropStaleKillSwitches();
 }
 
 void WgBackend::Stop(const std::string& name) {
+  FWG_TRACE_SCOPE("backend.stop");
   if (!IsValidName(name)) return;
-  std::filesystem::path cfg = std::filesystem::path(config_dir_) / (name + ".conf");
-  std::error_code ec;
-  if (!std::filesystem::exists(cfg, ec)) return;
+  health_.Stopped(name);
+  failover_.Forget(name);
+  peers_.Forget(name);
+  // Best-effort throughout; the caller treats Stop as idempotent.
+  if (handoff_ == ConfigHandoff::kFile) {
+    std::filesystem::path cfg =
+        std::filesystem::path(config_dir_) / (name + ".conf");
+    std::error_code ec;
+    if (std::filesystem::exists(cfg, ec)) {
+      {
+        PhaseTimer t("stop", "wg_quick_down");
+        elevated_->WgQuickDown(cfg.string());
+      }
+      const std::string error = DisarmKillSwitch(name);
+      if (!error.empty()) throw std::runtime_error(error);
+      DropStaleKillSwitches();
+      return;
+    }
+  }
+  {
+    // Never prompt for elevation on behalf of a tunnel we know nothing of.
+    std::lock_guard<std::mutex> lock(mu_);
+    if (known_tunnels_.find(name) == known_tunnels_.end()) return;
+  }
+  {
+    PhaseTimer t("stop", "wg_quick_down");
+    elevated_->WgQuickDownByName(name);
+  }
+  const std::string error = DisarmKillSwitch(name);
+  if (!error.empty()) throw std::runtime_error(error);
+  DropStaleKillSwitches();
+}
+
+std::vector<TunnelResultCpp> WgBackend::StartMany(
+    const std::vector<TunnelSpecCpp>& specs, size_t max_parallel) {
+  FWG_TRACE_SCOPE("backend.start_many");
+  const int64_t started_ms = NowEpochMs();
+  std::vector<TunnelResultCpp> out(specs.size());
+  std::vector<InlineTunnel> batch;
+  std::vector<size_t> batch_index;
+  std::vector<TakeOver> batch_take_over;
+  std::set<std::string> seen;
+  for (size_t i = 0; i < specs.size(); ++i) {
+    const TunnelSpecCpp& spec = specs[i];
+    out[i].name = spec.name;
+    if (!IsValidName(spec.name)) {
+      out[i].error = "invalid interface name '" + spec.name + "'";
+    } else if (!seen.insert(spec.name).second) {
+      out[i].error = "tunnel '" + spec.name + "' appears twice in the batch";
+    } else if (backend_.kind == BackendKindCpp::kUnknown) {
+      out[i].error = backend_.detail;
+    } else if (handoff_ == ConfigHandoff::kFile) {
+      // wg-quick reads the file itself; nothing to batch on the elevated
+      // side, so this is just Start in a loop.
+      try {
+        Start(spec.name, spec.config);
+        out[i].ok = true;
+      } catch (const std::exception& e) {
+        out[i].error = e.what();
+      }
+    } else {
+      batch.push_back({spec.name, WithPrimaryEndpoints(spec.config)});
+      batch_index.push_back(i);
+    }
+  }
+  if (batch.empty()) return out;
+
+  // One resolver fan-out for the endpoints of the whole batch.
+  std::map<std::string, std::string> numeric;
+  {
+    std::vector<std::string*> configs;
+    for (auto& b : batch) configs.push_back(&b.config);
+    PhaseTimer t("start_many", "resolve");
+    numeric = endpoints_->ResolveConfigs(std::move(configs));
+  }
+  batch_take_over.resize(batch.size());
+  KillSwitchChanges arm;
+  for (size_t b = 0; b < batch.size(); ++b) {
+    TunnelResultCpp& res = out[batch_index[b]];
+    try {
+      batch[b].config = PlanTakeOver(batch[b].config, &batch_take_over[b]);
+    } catch (const std::exception& e) {
+      res.error = e.what();
+      continue;
+    }
+    if (batch_take_over[b].kill_switch) {
+      AddFailoverEndpoints(specs[batch_index[b]].config,
+                           &batch_take_over[b].kill_switch_plan);
+      arm[res.name] = batch_take_over[b].kill_switch_plan;
+    }
+  }
+  // Every kill switch of the batch in one transaction.
+  KillSwitchChanges disarm;
+  if (!arm.empty()) {
+    PhaseTimer t("start_many", "kill_switch");
+    const std::string error = UpdateKillSwitches(arm, &disarm);
+    if (!error.empty()) {
+      for (size_t b = 0; b < batch.size(); ++b) {
+        if (arm.count(batch[b].iface) > 0) out[batch_index[b]].error = error;
+      }
+      disarm.clear();
+    }
+  }
+  std::vector<InlineTunnel> up;
+  std::vector<size_t> up_index;
+  for (size_t b = 0; b < batch.size(); ++b) {
+    if (!out[batch_index[b]].error.empty()) continue;
+    up.push_back(batch[b]);
+    up_index.push_back(b);
+  }
 
-  // Best-effort; the caller treats Stop as idempotent.
-  elevated_->WgQuickDown(cfg.string());
+  PhaseTimer t("start_many", "wg_quick_up");
+  std::vector<ProcessResult> rs =
+      up.empty() ? std::vector<ProcessResult>()
+                 : elevated_->WgQuickUpMany(up, PickUserspaceImpl(), max_parallel);
+  t.Stop();
+  for (size_t u = 0; u < up.size(); ++u) {
+    const size_t b = up_index[u];
+    TunnelResultCpp& res = out[batch_index[b]];
+    if (u >= rs.size() || rs[u].exit_code != 0) {
+      res.error = u < rs.size() ? WgQuickError("up", rs[u])
+                                : "no result from the privileged session";
+      continue;
+    }
+    res.error = FinishTakeOver(res.name, batch_take_over[b]);
+    if (!res.error.empty()) {
+      elevated_->WgQuickDownByName(res.name);
+      continue;
+    }
+    res.ok = true;
+    disarm.erase(res.name);
+  }
+  // What is left are the failed starts' kill switches.
+  if (!disarm.empty()) UpdateKillSwitches(disarm);
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (size_t b = 0; b < batch.size(); ++b) {
+      if (out[batch_index[b]].ok) known_tunnels_.insert(batch[b].iface);
+    }
+  }
+  for (size_t b = 0; b < batch.size(); ++b) {
+    if (!out[batch_index[b]].ok) continue;
+    IndexPeers(batch[b].iface, specs[batch_index[b]].config);
+    TrackEndpoints(batch[b].iface, specs[batch_index[b]].config, numeric);
+    health_.Started(batch[b].iface, started_ms);
+    peers_.Forget(batch[b].iface);
+  }
+  if (!batch.empty()) DropStaleKillSwitches();
+  return out;
 }
 
-TunnelStatusCpp WgBackend::Status(const std::string& name) {
+std::vector<TunnelResultCpp> WgBackend::StopMany(
+    const std::vector<std::string>& names, size_t max_parallel) {
+  FWG_TRACE_SCOPE("backend.stop_many");
+  std::vector<TunnelResultCpp> out(names.size());
+  std::vector<std::string> batch;
+  std::vector<size_t> batch_index;
+  std::set<std::string> seen;
+  bool elevated = false;
+  for (size_t i = 0; i < names.size(); ++i) {
+    out[i].name = names[i];
+    out[i].ok = true;
+    if (!IsValidName(names[i]) || !seen.insert(names[i]).second) continue;
+    health_.Stopped(names[i]);
+    failover_.Forget(names[i]);
+    peers_.Forget(names[i]);
+    if (handoff_ == ConfigHandoff::kFile) {
+      std::filesystem::path cfg =
+          std::filesystem::path(config_dir_) / (names[i] + ".conf");
+      std::error_code ec;
+      if (std::filesystem::exists(cfg, ec)) {
+        ProcessResult r = elevated_->WgQuickDown(cfg.string());
+        elevated = true;
+        if (r.exit_code != 0) {
+          out[i].ok = false;
+          out[i].error = WgQuickError("down", r);
+        }
+        const std::string error = DisarmKillSwitch(names[i]);
+        if (!error.empty() && out[i].ok) {
+          out[i].ok = false;
+          out[i].error = error;
+        }
+        continue;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (known_tunnels_.find(names[i]) == known_tunnels_.end()) continue;
+    }
+    batch.push_back(names[i]);
+    batch_index.push_back(i);
+  }
+  if (batch.empty()) {
+    if (elevated) DropStaleKillSwitches();
+    return out;
+  }
+
+  PhaseTimer t("stop_many", "wg_quick_down");
+  std::vector<ProcessResult> rs =
+      elevated_->WgQuickDownManyByName(batch, max_parallel);
+  t.Stop();
+  for (size_t b = 0; b < batch.size(); ++b) {
+    if (b < rs.size() && rs[b].exit_code == 0) continue;
+    TunnelResultCpp& res = out[batch_index[b]];
+    res.ok = false;
+    res.error = b < rs.size() ? WgQuickError("down", rs[b])
+                              : "no result from the privileged session";
+  }
+  // The batch's kill switches go in one transaction too.
+  KillSwitchChanges disarm;
+  {
+    std::lock_guard<std::mutex> lock(kill_switch_mu_);
+    for (const auto& name : batch) {
+      if (kill_switches_.count(name) > 0) disarm[name] = std::nullopt;
+    }
+  }
+  if (!disarm.empty()) {
+    const std::string error = UpdateKillSwitches(disarm);
+    for (size_t b = 0; b < batch.size(); ++b) {
+      TunnelResultCpp& res = out[batch_index[b]];
+      if (disarm.count(batch[b]) == 0 || error.empty()) continue;
+      if (res.ok) res.error = error;
+      res.ok = false;
+    }
+  }
+  DropStaleKillSwitches();
+  return out;
+}
+
+uint32_t WgBackend::StagingTableFor(const std::string& name) {
+  // FNV-1a into 52000..52999, clear of wg-quick's 51820 default.
+  uint32_t h = 2166136261u;
+  for (unsigned char c : name) {
+    h ^= c;
+    h *= 16777619u;
+  }
+  return 52000 + h % 1000;
+}
+
+std::string WgBackend::WithStagingTable(const std::string& config,
+                                        uint32_t table,
+                                        uint32_t priority) {
+  const std::string t = std::to_string(table);
+  const std::string p = std::to_string(priority);
+  const std::string p1 = std::to_string(priority + 1);
+  std::string pinned = "Table = " + t + "\nFwMark = " + t + "\n";
+  for (const char* family : {"-4", "-6"}) {
+    pinned += std::string("PostDown = ip ") + family + " rule del not fwmark " +
+              t + " table " + t + " priority " + p1 + " 2>/dev/null || true\n";
+    pinned += std::string("PostDown = ip ") + family +
+              " rule del table main suppress_prefixlength 0 priority " + p +
+              " 2>/dev/null || true\n";
+  }
+
+  std::string out;
+  bool in_interface = false;
+  bool pinned_done = false;
+  std::istringstream in(config);
+  std::string line;
+  while (std::getline(in, line)) {
+    const std::string key = TrimLower(line.substr(0, line.find('=')));
+    if (!key.empty() && key[0] == '[') {
+      in_interface = key == "[interface]";
+      out += line + "\n";
+      if (in_interface && !pinned_done) {
+        out += pinned;
+        pinned_done = true;
+      }
+      continue;
+    }
+    if (in_interface && (key == "table" || key == "fwmark")) continue;
+    out += line + "\n";
+  }
+  if (!pinned_done) out = "[Interface]\n" + pinned + out;
+  return out;
+}
+
+void WgBackend::SwitchTunnel(const std::string& from,
+                             const std::string& to,
+                             const std::string& config,
+                             std::chrono::milliseconds handshake_timeout) {
+  FWG_TRACE_SCOPE("backend.switch_tunnel");
+  if (!IsValidName(from)) {
+    throw std::invalid_argument("invalid interface name '" + from + "'");
+  }
+  if (from == to) {
+    throw std::invalid_argument("cannot switch tunnel '" + to + "' to itself");
+  }
+  PhaseTimer total("switch", "total");
+  const uint32_t table = StagingTableFor(to);
+  {
+    PhaseTimer t("switch", "bring_up");
+    Start(to, WithStagingTable(config, table, kSwitchRulePriority));
+  }
+
+  // `from` still routes everything, including `to`'s own handshake packets;
+  // nothing moves until `to` has proven it can reach its peer.
+  PhaseTimer handshake("switch", "handshake");
+  const auto deadline = std::chrono::steady_clock::now() + handshake_timeout;
+  for (;;) {
+    int64_t latest = 0;
+    const bool direct = UapiHandshake(to, &latest);
+    if (!direct) latest = Status(to).handshake;
+    if (latest != 0) break;
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      Stop(to);
+      throw std::runtime_error(
+          "no handshake on '" + to + "' within " +
+          std::to_string(handshake_timeout.count()) + " ms; kept '" + from + "'");
+    }
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+        direct ? kSwitchUapiPollInterval : kSwitchShowPollInterval,
+        deadline - now));
+  }
+  handshake.Stop();
+
+  ProcessResult r;
+  {
+    PhaseTimer t("switch", "rules");
+    r = elevated_->InstallPolicyRules(table, kSwitchRulePriority);
+  }
+  if (r.exit_code != 0) {
+    Stop(to);
+    throw std::runtime_error(
+        "could not install routing rules (" + std::to_string(r.exit_code) +
+        "): " + (r.stderr_data.empty() ? r.stdout_data : r.stderr_data));
+  }
+  PhaseTimer t("switch", "stop_old");
+  Stop(from);
+}
+
+void WgBackend::RequireKnown(const std::string& name) const {
   if (!IsValidName(name)) {
     throw std::invalid_argument("invalid interface name '" + name + "'");
   }
+  std::lock_guard<std::mutex> lock(mu_);
+  if (known_tunnels_.find(name) == known_tunnels_.end()) {
+    throw std::runtime_error("tunnel '" + name + "' is unknown");
+  }
+}
+
+UapiClient* WgBackend::UapiFor(const std::string& name) {
+  UapiClient* client;
   {
     std::lock_guard<std::mutex> lock(mu_);
-    if (known_tunnels_.find(name) == known_tunnels_.end()) {
-      throw std::runtime_error("tunnel '" + name + "' is unknown");
-    }
+    auto& slot = uapi_[name];
+    if (!slot) slot = std::make_unique<UapiClient>(name, uapi_dir_);
+    client = slot.get();
   }
+  return client->Available() ? client : nullptr;
+}
+
+bool WgBackend::UapiHandshake(const std::string& name, int64_t* handshake) {
+  UapiClient* uapi = UapiFor(name);
+  if (uapi == nullptr) return false;
+  thread_local UapiDevice dev;
+  try {
+    uapi->Get(&dev);
+  } catch (const std::exception&) {
+    return false;  // not reachable from this process
+  }
+  *handshake = 0;
+  for (const auto& p : dev.peers) {
+    if (p.handshake_ms > *handshake) *handshake = p.handshake_ms;
+  }
+  return true;
+}
+
+TunnelStatusCpp WgBackend::Status(const std::string& name) {
+  return Status(name, nullptr);
+}
+
+TunnelStatusCpp WgBackend::Status(const std::string& name,
+                                  std::vector<PeerStatsCpp>* peers) {
+  FWG_TRACE_SCOPE("backend.status");
+  RequireKnown(name);
+  if (peers != nullptr) peers->clear();
 
   // Source of truth #1: byte counters from /sys/class/net/<name>/statistics/.
   // World-readable for both kernel WireGuard and the wireguard-go TUN device.
   TunnelStatusCpp s;
   s.name = name;
   int64_t rx = 0, tx = 0;
-  const bool iface_exists = ReadSysfsCounters(name, &rx, &tx, sysfs_root_);
+  bool iface_exists;
+  {
+    FWG_TRACE_SCOPE("backend.sysfs_counters");
+    iface_exists = ReadSysfsCounters(name, &rx, &tx, sysfs_root_);
+  }
   if (!iface_exists) {
     s.state = TunnelStateCpp::kDown;
     return s;
@@ -296,6 +856,34 @@ TunnelStatusCpp WgBackend::Status(const std::string& name) {
   s.tx = tx;
   s.state = TunnelStateCpp::kUp;
 
+  // Userspace tunnels: ask the implementation directly. One persistent
+  // socket, no fork, and the per-thread device buffer means steady-state
+  // polls allocate nothing.
+  if (UapiClient* uapi = UapiFor(name)) {
+    thread_local UapiDevice dev;
+    try {
+      FWG_TRACE_SCOPE("backend.uapi_get");
+      uapi->Get(&dev);
+      int64_t peer_rx = 0, peer_tx = 0;
+      for (const auto& p : dev.peers) {
+        if (p.handshake_ms > s.handshake) s.handshake = p.handshake_ms;
+        peer_rx += p.rx;
+        peer_tx += p.tx;
+      }
+      if (peers != nullptr) {
+        peers->reserve(dev.peers.size());
+        for (const auto& p : dev.peers) peers->push_back(ToPeerStats(p));
+      }
+      if (peer_rx > 0 || peer_tx > 0) {
+        s.rx = peer_rx;
+        s.tx = peer_tx;
+      }
+      return s;
+    } catch (const std::exception&) {
+      // Not reachable from this process (e.g. not root); use `wg show`.
+    }
+  }
+
   // Source of truth #2 (best-effort): `wg show <name> dump` for the latest
   // handshake and per-peer aggregated counters. Routed through the
   // PrivilegedSession so only the FIRST elevated op (typically Start) prompts
@@ -308,10 +896,440 @@ TunnelStatusCpp WgBackend::Status(const std::string& name) {
       s.rx = parsed.rx;
       s.tx = parsed.tx;
     }
+    if (peers != nullptr) *peers = ParseWgShowDumpPeers(r.stdout_data);
   }
   return s;
 }
 
+std::vector<PeerStatsCpp> WgBackend::PeerStats(const std::string& name) {
+  RequireKnown(name);
+  if (UapiClient* uapi = UapiFor(name)) {
+    thread_local UapiDevice dev;
+    try {
+      uapi->Get(&dev);
+      std::vector<PeerStatsCpp> peers;
+      peers.reserve(dev.peers.size());
+      for (const auto& p : dev.peers) peers.push_back(ToPeerStats(p));
+      return peers;
+    } catch (const std::exception&) {
+      // Fall through to `wg show`.
+    }
+  }
+  ProcessResult r = elevated_->ShowDump(name);
+  if (r.exit_code != 0) {
+    throw std::runtime_error(
+        "wg show failed (" + std::to_string(r.exit_code) + "): " +
+        (r.stderr_data.empty() ? r.stdout_data : r.stderr_data));
+  }
+  return ParseWgShowDumpPeers(r.stdout_data);
+}
+
+void WgBackend::AddPeer(const std::string& name, const PeerConfigCpp& peer) {
+  RequireKnown(name);
+  // UAPI only takes numeric endpoints.
+  std::string endpoint = peer.endpoint;
+  const bool named = !endpoint.empty() && !IsNumericEndpoint(endpoint);
+  if (named) {
+    const auto numeric = endpoints_->Resolve({endpoint});
+    auto it = numeric.find(endpoint);
+    if (it == numeric.end()) {
+      throw std::runtime_error("could not resolve endpoint '" + endpoint + "'");
+    }
+    endpoint = it->second;
+  }
+  // Build (and validate) the request before looking for a socket so bad
+  // input reports as such regardless of backend.
+  std::string body = UapiClient::AddPeerRequest(
+      peer.public_key, endpoint, peer.allowed_ips, peer.keepalive);
+  UapiClient* uapi = UapiFor(name);
+  if (uapi == nullptr) {
+    throw std::runtime_error("live peer changes need a userspace tunnel");
+  }
+  uapi->Set(body);
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    if (named) {
+      endpoint_names_[name][peer.public_key] = {peer.endpoint, endpoint};
+    } else if (endpoint_names_.count(name) != 0) {
+      endpoint_names_[name].erase(peer.public_key);
+    }
+  }
+  if (auto table = PeerTable(name)) {
+    auto updated = std::make_shared<AllowedIpsTable>(*table);
+    updated->SetPeer(peer.public_key, peer.allowed_ips);
+    std::lock_guard<std::mutex> lock(mu_);
+    peer_tables_[name] = std::move(updated);
+  }
+}
+
+void WgBackend::RemovePeer(const std::string& name,
+                           const std::string& public_key) {
+  RequireKnown(name);
+  std::string body = UapiClient::RemovePeerRequest(public_key);
+  UapiClient* uapi = UapiFor(name);
+  if (uapi == nullptr) {
+    throw std::runtime_error("live peer changes need a userspace tunnel");
+  }
+  uapi->Set(body);
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = endpoint_names_.find(name);
+    if (it != endpoint_names_.end()) it->second.erase(public_key);
+  }
+  if (auto table = PeerTable(name)) {
+    auto updated = std::make_shared<AllowedIpsTable>(*table);
+    updated->RemovePeer(public_key);
+    std::lock_guard<std::mutex> lock(mu_);
+    peer_tables_[name] = std::move(updated);
+  }
+}
+
+std::string WgBackend::PlanTakeOver(const std::string& config,
+                                    TakeOver* take_over) {
+  // The kill switch lines are ours alone; wg-quick would refuse them.
+  std::string up_config;
+  take_over->kill_switch =
+      TakeOverKillSwitch(config, &up_config, &take_over->kill_switch_plan);
+  // A large route set goes in natively once the link is up, instead of one
+  // `ip` run per prefix inside wg-quick.
+  const std::string without_kill_switch = up_config;
+  take_over->routes =
+      TakeOverRoutes(without_kill_switch, &up_config, &take_over->route_plan);
+  // DNS goes straight to systemd-resolved instead of through resolvconf,
+  // if resolved is there to take it.
+  std::string without_dns;
+  DnsPlan dns;
+  if (TakeOverDns(up_config, &without_dns, &dns) && elevated_->CanApplyDns()) {
+    take_over->dns = true;
+    take_over->dns_plan = std::move(dns);
+    up_config = std::move(without_dns);
+  }
+  return up_config;
+}
+
+std::string WgBackend::FinishTakeOver(const std::string& name,
+                                      const TakeOver& take_over) {
+  auto failure = [&](const char* what, const ProcessResult& r) {
+    return std::string("could not ") + what + " on '" + name + "' (" +
+           std::to_string(r.exit_code) +
+           "): " + (r.stderr_data.empty() ? r.stdout_data : r.stderr_data);
+  };
+  if (take_over.routes) {
+    PhaseTimer t("start", "routes");
+    ProcessResult r = elevated_->InstallRoutes(name, take_over.route_plan);
+    if (r.exit_code != 0) return failure("install routes", r);
+  }
+  if (take_over.dns) {
+    PhaseTimer t("start", "dns");
+    ProcessResult r = elevated_->ApplyDns(name, take_over.dns_plan);
+    if (r.exit_code != 0) return failure("set DNS", r);
+  }
+  return "";
+}
+
+void WgBackend::AddFailoverEndpoints(const std::string& config,
+                                     KillSwitchPlan* plan) {
+  std::vector<std::string> named;
+  for (const auto& [key, candidates] : CandidateEndpoints(config)) {
+    for (const auto& c : candidates) {
+      if (!AddKillSwitchEndpoint(c, plan)) named.push_back(c);
+    }
+  }
+  if (named.empty()) return;
+  for (const auto& [endpoint, numeric] : endpoints_->Resolve(named)) {
+    AddKillSwitchEndpoint(numeric, plan);
+  }
+}
+
+std::string WgBackend::UpdateKillSwitches(const KillSwitchChanges& changes,
+                                          KillSwitchChanges* previous) {
+  std::lock_guard<std::mutex> lock(kill_switch_mu_);
+  KillSwitchSet next = kill_switches_;
+  KillSwitchChanges replaced;
+  for (const auto& [name, plan] : changes) {
+    auto it = next.find(name);
+    replaced[name] = it == next.end() ? std::nullopt
+                                      : std::optional<KillSwitchPlan>(it->second);
+    if (plan) {
+      next[name] = *plan;
+    } else if (it != next.end()) {
+      next.erase(it);
+    }
+  }
+  ProcessResult r = elevated_->InstallKillSwitch(next);
+  if (r.exit_code != 0) {
+    return "could not set the kill switch (" + std::to_string(r.exit_code) +
+           "): " + (r.stderr_data.empty() ? r.stdout_data : r.stderr_data);
+  }
+  kill_switches_ = std::move(next);
+  kill_switch_stale_ = false;  // the table now holds exactly the set
+  if (previous != nullptr) *previous = std::move(replaced);
+  return "";
+}
+
+std::string WgBackend::DisarmKillSwitch(const std::string& name) {
+  {
+    std::lock_guard<std::mutex> lock(kill_switch_mu_);
+    if (kill_switches_.count(name) == 0) return "";
+  }
+  PhaseTimer t("stop", "kill_switch");
+  return UpdateKillSwitches({{name, std::nullopt}});
+}
+
+void WgBackend::WidenKillSwitch(const std::string& name,
+                                const std::vector<PeerEndpoint>& moved) {
+  KillSwitchPlan plan;
+  {
+    std::lock_guard<std::mutex> lock(kill_switch_mu_);
+    auto it = kill_switches_.find(name);
+    if (it == kill_switches_.end()) return;
+    plan = it->second;
+  }
+  const size_t before = plan.endpoints.size();
+  for (const auto& m : moved) AddKillSwitchEndpoint(m.endpoint, &plan);
+  if (plan.endpoints.size() == before) return;
+  const std::string error = UpdateKillSwitches({{name, std::move(plan)}});
+  if (!error.empty()) throw std::runtime_error(error);
+}
+
+size_t WgBackend::ReresolveEndpoints(const std::string& name) {
+  FWG_TRACE_SCOPE("backend.reresolve_endpoints");
+  RequireKnown(name);
+  std::map<std::string, NamedEndpoint> peers;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = endpoint_names_.find(name);
+    if (it != endpoint_names_.end()) peers = it->second;
+  }
+  if (peers.empty()) return 0;
+  std::vector<std::string> endpoints;
+  for (const auto& [key, peer] : peers) endpoints.push_back(peer.endpoint);
+  const auto numeric = endpoints_->Resolve(endpoints, /*fresh=*/true);
+  std::vector<PeerEndpoint> moved;
+  for (const auto& [key, peer] : peers) {
+    auto it = numeric.find(peer.endpoint);
+    if (it != numeric.end() && it->second != peer.numeric) {
+      moved.push_back({key, it->second});
+    }
+  }
+  if (moved.empty()) return 0;
+  std::vector<std::string> written;
+  for (const auto& m : moved) written.push_back(peers[m.public_key].endpoint);
+  ApplyEndpoints(name, moved, written);
+  return moved.size();
+}
+
+size_t WgBackend::FailOver(const std::string& name,
+                           const std::vector<std::string>& stale,
+                           const std::vector<PeerHandshake>& peers,
+                           int64_t now_ms) {
+  FWG_TRACE_SCOPE("backend.fail_over");
+  const std::vector<PeerEndpoint> next = failover_.Next(name, stale, peers, now_ms);
+  if (next.empty()) return 0;
+  PhaseTimer total("failover", "total");
+  std::vector<std::string> named;
+  for (const auto& n : next) {
+    if (!IsNumericEndpoint(n.endpoint)) named.push_back(n.endpoint);
+  }
+  std::map<std::string, std::string> numeric;
+  if (!named.empty()) {
+    PhaseTimer t("failover", "resolve");
+    numeric = endpoints_->Resolve(named);
+  }
+  std::vector<PeerEndpoint> moved;
+  std::vector<std::string> written;
+  for (const auto& n : next) {
+    if (IsNumericEndpoint(n.endpoint)) {
+      moved.push_back(n);
+    } else {
+      auto it = numeric.find(n.endpoint);
+      if (it == numeric.end()) continue;
+      moved.push_back({n.public_key, it->second});
+    }
+    written.push_back(n.endpoint);
+  }
+  if (moved.empty()) return 0;
+  PhaseTimer t("failover", "set_endpoint");
+  ApplyEndpoints(name, moved, written);
+  return moved.size();
+}
+
+void WgBackend::ApplyEndpoints(const std::string& name,
+                               const std::vector<PeerEndpoint>& moved,
+                               const std::vector<std::string>& written) {
+  WidenKillSwitch(name, moved);
+  if (UapiClient* uapi = UapiFor(name)) {
+    uapi->Set(UapiClient::SetEndpointsRequest(moved));
+  } else {
+    ProcessResult r = elevated_->SetPeerEndpoints(name, moved);
+    if (r.exit_code != 0) {
+      throw std::runtime_error(
+          "wg set failed (" + std::to_string(r.exit_code) + "): " +
+          (r.stderr_data.empty() ? r.stdout_data : r.stderr_data));
+    }
+  }
+  // A named endpoint is followed by ReresolveEndpoints from now on; a
+  // numeric one leaves nothing to re-resolve.
+  std::lock_guard<std::mutex> lock(mu_);
+  auto& tracked = endpoint_names_[name];
+  for (size_t i = 0; i < moved.size(); ++i) {
+    if (IsNumericEndpoint(written[i])) {
+      tracked.erase(moved[i].public_key);
+    } else {
+      tracked[moved[i].public_key] = {written[i], moved[i].endpoint};
+    }
+  }
+  if (tracked.empty()) endpoint_names_.erase(name);
+}
+
+void WgBackend::TrackEndpoints(const std::string& name, const std::string& config,
+                               const std::map<std::string, std::string>& numeric) {
+  failover_.Track(name, CandidateEndpoints(config));
+  std::map<std::string, NamedEndpoint> peers;
+  for (auto& p : NamedEndpoints(WithPrimaryEndpoints(config))) {
+    auto it = numeric.find(p.endpoint);
+    peers[p.public_key] = {p.endpoint, it == numeric.end() ? "" : it->second};
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  if (peers.empty()) {
+    endpoint_names_.erase(name);
+  } else {
+    endpoint_names_[name] = std::move(peers);
+  }
+}
+
+void WgBackend::IndexPeers(const std::string& name, const std::string& config) {
+  std::shared_ptr<const AllowedIpsTable> table;
+  try {
+    table = std::make_shared<AllowedIpsTable>(AllowedIpsTable::FromConfig(config));
+  } catch (const std::invalid_argument&) {
+    // No index; LookupPeer reports it.
+  }
+  std::lock_guard<std::mutex> lock(mu_);
+  if (table) {
+    peer_tables_[name] = std::move(table);
+  } else {
+    peer_tables_.erase(name);
+  }
+}
+
+std::shared_ptr<const AllowedIpsTable> WgBackend::PeerTable(
+    const std::string& name) {
+  std::lock_guard<std::mutex> lock(mu_);
+  auto it = peer_tables_.find(name);
+  return it == peer_tables_.end() ? nullptr : it->second;
+}
+
+std::string WgBackend::LookupPeer(const std::string& name,
+                                  const std::string& ip) {
+  return LookupPeers(name, {ip}).front();
+}
+
+std::vector<std::string> WgBackend::LookupPeers(
+    const std::string& name, const std::vector<std::string>& ips) {
+  RequireKnown(name);
+  std::shared_ptr<const AllowedIpsTable> table = PeerTable(name);
+  if (!table) {
+    throw std::runtime_error("no AllowedIPs index for '" + name +
+                             "'; it was not started by this process");
+  }
+  std::vector<std::string> out;
+  out.reserve(ips.size());
+  for (const auto& ip : ips) {
+    const std::string* key = table->Lookup(ip);
+    out.push_back(key != nullptr ? *key : std::string());
+  }
+  return out;
+}
+
+bool WgBackend::PeerByPublicKey(const std::string& name,
+                                const std::string& public_key,
+                                PeerStatsCpp* out) {
+  RequireKnown(name);
+  WgKey key;
+  if (!WgKeyFromBase64(public_key, &key)) {
+    throw std::invalid_argument("not a WireGuard public key: " + public_key);
+  }
+  std::shared_ptr<const PeerIndex> snapshot = peers_.Get(name);
+  if (!snapshot) {
+    peers_.Update(name, PeerStats(name));
+    snapshot = peers_.Get(name);
+  }
+  const PeerStatsCpp* peer = snapshot ? snapshot->Find(key) : nullptr;
+  if (peer == nullptr) return false;
+  *out = *peer;
+  return true;
+}
+
+size_t WgBackend::AdoptRunningTunnels() {
+  return AdoptRunningTunnels(ListNetLinks());
+}
+
+size_t WgBackend::AdoptRunningTunnels(const std::vector<NetLinkCpp>& links) {
+  size_t adopted = 0;
+  for (const auto& link : links) {
+    if (!IsValidName(link.name)) continue;
+    const bool is_wireguard =
+        link.kind == "wireguard" ||
+        (link.kind == "tun" && UapiClient(link.name, uapi_dir_).Available());
+    if (!is_wireguard) continue;
+    // Only tunnels this plugin started: anything else (a system wg0 from
+    // /etc/wireguard, another VPN app) is none of our business.
+    std::error_code ec;
+    const std::string file = link.name + ".conf";
+    if (!std::filesystem::exists(std::filesystem::path(staging_dir_) / file, ec) &&
+        !std::filesystem::exists(std::filesystem::path(config_dir_) / file, ec)) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    if (known_tunnels_.insert(link.name).second) ++adopted;
+  }
+  AdoptKillSwitches();
+  return adopted;
+}
+
+void WgBackend::AdoptKillSwitches() {
+  std::string records;
+  {
+    std::ifstream in(std::filesystem::path(staging_dir_) / kKillSwitchStateFile);
+    if (!in) return;  // no table
+    std::ostringstream buf;
+    buf << in.rdbuf();
+    records = buf.str();
+  }
+  KillSwitchSet armed = ParseKillSwitchRecords(records);
+  // The file is removed when the set empties, so this is a record we can't
+  // read; better a stale table than one wiped under a running tunnel.
+  if (armed.empty()) return;
+  std::set<std::string> known;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    known = known_tunnels_;
+  }
+  std::lock_guard<std::mutex> lock(kill_switch_mu_);
+  for (auto& [name, plan] : armed) {
+    if (known.count(name) == 0) {
+      // A tunnel that died with the last session would keep its rules, and
+      // with them the policy drop, until someone ran nft by hand. Taking
+      // them out needs elevation, which must not happen at registration:
+      // DropStaleKillSwitches does it with the next privileged op.
+      kill_switch_stale_ = true;
+    } else if (kill_switches_.count(name) == 0) {
+      kill_switches_[name] = std::move(plan);
+    }
+  }
+}
+
+void WgBackend::DropStaleKillSwitches() {
+  {
+    std::lock_guard<std::mutex> lock(kill_switch_mu_);
+    if (!kill_switch_stale_) return;
+  }
+  // Committing the armed set leaves the dead tunnels out. Best-effort: on
+  // failure the flag stays and the next privileged op tries again.
+  UpdateKillSwitches({});
+}
+
 std::vector<std::string> WgBackend::TunnelNames() const {
   std::lock_guard<std::mutex> lock(mu_);
   return std::vector<std::string>(known_tunnels_.begin(), known_tunnels_.end());
@@ -14,17 +14,34 @@
 //     If the unprivileged read fails the tunnel is reported as UP with zero
 //     stats; full stats become available when the app runs as root or a
 //     polkit rule grants CAP_NET_ADMIN to wg(8).
+//   - Tunnels run by a userspace implementation are read (and reconfigured
+//     peer by peer) over their UAPI socket instead, see wg_uapi.h. That
+//     needs no fork at all but only works when the socket is reachable,
+//     i.e. as root; everything else keeps the paths above.
 #ifndef FLUTTER_WIREGUARD_WG_BACKEND_H_
 #define FLUTTER_WIREGUARD_WG_BACKEND_H_
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <set>
 #include <string>
 #include <vector>
 
+#include "allowed_ips.h"
+#include "dns_plan.h"
+#include "endpoint_failover.h"
+#include "endpoint_resolver.h"
+#include "handshake_monitor.h"
+#include "kill_switch.h"
+#include "peer_index.h"
 #include "privileged_session.h"
 #include "process_runner.h"
+#include "route_installer.h"
+#include "wg_uapi.h"
 
 namespace flutter_wireguard {
 
@@ -39,6 +56,38 @@ struct TunnelStatusCpp {
   int64_t handshake = 0;
 };
 
+struct PeerConfigCpp {
+  std::string public_key;  // base64
+  std::string endpoint;    // optional "host:port"
+  std::vector<std::string> allowed_ips;
+  uint32_t keepalive = 0;
+};
+
+// How Start hands the config to the privileged side.
+//   kInline: streamed over the elevated channel; nothing is written to the
+//            user's filesystem and Stop works by interface name. Default.
+//   kFile:   written to <config_dir>/<name>.conf (0600) and passed by path.
+//            Kept for elevation helpers that can't take a payload.
+enum class ConfigHandoff { kInline, kFile };
+
+// One network interface as reported by an RTM_GETLINK dump.
+struct NetLinkCpp {
+  std::string name;
+  std::string kind;  // IFLA_INFO_KIND: "wireguard", "tun", ... or empty
+};
+
+// One entry of a StartMany batch, and the per-tunnel outcome of a batch.
+struct TunnelSpecCpp {
+  std::string name;
+  std::string config;
+};
+
+struct TunnelResultCpp {
+  std::string name;
+  bool ok = false;
+  std::string error;  // empty when ok
+};
+
 struct BackendInfoCpp {
   BackendKindCpp kind = BackendKindCpp::kUnknown;
   std::string detail;
@@ -53,21 +102,131 @@ class WgBackend {
                      std::string config_dir = std::string(),
                      std::unique_ptr<PrivilegedSession> elevated = nullptr);
 
-  // Brings the named tunnel up. Throws std::runtime_error on failure.
+  // Brings the named tunnel up. Throws std::runtime_error on failure, and
+  // std::invalid_argument for malformed KillSwitch lines (kill_switch.h);
+  // a kill switch is armed before wg-quick runs and disarmed again if the
+  // start fails.
   void Start(const std::string& name, const std::string& config);
 
-  // Brings the named tunnel down. No-op if unknown / already down.
+  // Brings the named tunnel down. No-op if unknown / already down. Needs no
+  // config file: tunnels started in this process are stopped by name. Then
+  // drops the tunnel's kill switch, if it has one; throws
+  // std::runtime_error if that fails.
   void Stop(const std::string& name);
 
+  // Batch Start/Stop. With inline hand-off the whole batch is one elevated
+  // round trip (so at most one prompt) and up to `max_parallel` wg-quick
+  // runs overlap; file hand-off falls back to one call per tunnel. Never
+  // throws: every input gets a result, in input order. StopMany treats
+  // unknown names as success, like Stop.
+  std::vector<TunnelResultCpp> StartMany(const std::vector<TunnelSpecCpp>& specs,
+                                         size_t max_parallel = 8);
+  std::vector<TunnelResultCpp> StopMany(const std::vector<std::string>& names,
+                                        size_t max_parallel = 8);
+
+  // Make-before-break replacement of `from` by `to`. `to` comes up with its
+  // routes in a table of its own (see WithStagingTable), so both tunnels
+  // run side by side while `from` keeps carrying traffic. Once `to` has a
+  // handshake, one pair of policy rules moves traffic onto it and `from` is
+  // stopped. InstallPolicyRules adds the two rules one after the other, so
+  // the move is not atomic: until the second lands, traffic still falls
+  // through to `from`'s rules, and if it fails the first one stays. The
+  // handshake is read over UAPI every 20 ms where that works, else with a
+  // `wg show` every 250 ms. On any failure before the rules go in, `to` is
+  // torn down again and `from` is left as it was; throws
+  // std::runtime_error.
+  void SwitchTunnel(const std::string& from,
+                    const std::string& to,
+                    const std::string& config,
+                    std::chrono::milliseconds handshake_timeout =
+                        std::chrono::seconds(5));
+
   // Snapshot of the named tunnel. Throws if `name` was never started.
   TunnelStatusCpp Status(const std::string& name);
 
-  // Names of every tunnel touched in this process lifetime (UP or DOWN).
+  // Same, and fills `peers` with the per-peer counters behind the totals
+  // (cleared if the tunnel is down or only sysfs could be read). One
+  // backend query serves both.
+  TunnelStatusCpp Status(const std::string& name,
+                         std::vector<PeerStatsCpp>* peers);
+
+  // Per-peer counters of the named tunnel, in the order the backend lists
+  // them. Throws if `name` was never started or can't be read.
+  std::vector<PeerStatsCpp> PeerStats(const std::string& name);
+
+  // Adds (or updates) / removes one peer on a running tunnel without
+  // restarting it. Only userspace tunnels with a reachable UAPI socket
+  // support this; throws std::runtime_error otherwise.
+  void AddPeer(const std::string& name, const PeerConfigCpp& peer);
+  void RemovePeer(const std::string& name, const std::string& public_key);
+
+  // Looks up the hostnames in `name`'s peer Endpoints again, bypassing the
+  // cache, and points each peer whose address changed at the new one; for
+  // apps to call when the network changes. A name that no longer resolves
+  // keeps its current address. Returns the number of peers moved (0 for a
+  // config with numeric endpoints only, or an adopted tunnel). Throws
+  // std::runtime_error if `name` is unknown or the update fails.
+  size_t ReresolveEndpoints(const std::string& name);
+
+  // Moves peers of `name` that were given several endpoints on to their
+  // next one (see endpoint_failover.h): those in `stale`, and those whose
+  // last move has not produced a handshake in `peers` yet. One set for all
+  // of them; the link stays up. A candidate that does not resolve is
+  // skipped until the next move. Returns the number of peers moved. Throws
+  // std::runtime_error if the update fails.
+  size_t FailOver(const std::string& name, const std::vector<std::string>& stale,
+                  const std::vector<PeerHandshake>& peers, int64_t now_ms);
+
+  // Public key of the peer whose AllowedIPs most specifically cover `ip`
+  // (longest prefix, as the kernel routes), or "" if none do. Answered from
+  // an index built from the config at Start and kept in step by
+  // AddPeer/RemovePeer; never queries the tunnel. Throws
+  // std::invalid_argument for a malformed address and std::runtime_error if
+  // `name` is unknown or was adopted (its config was never seen).
+  std::string LookupPeer(const std::string& name, const std::string& ip);
+  std::vector<std::string> LookupPeers(const std::string& name,
+                                       const std::vector<std::string>& ips);
+
+  // Names of every tunnel touched in this process lifetime (UP or DOWN),
+  // plus those adopted by AdoptRunningTunnels().
   std::vector<std::string> TunnelNames() const;
 
+  // Picks up tunnels that are still running from a previous app session so
+  // Status/Stop work on them without a Start. A link is adopted if it is a
+  // WireGuard interface (kernel "wireguard" kind, or a TUN device with a
+  // UAPI socket) and this plugin left a config for it, either staged by the
+  // privileged side or in config_dir. Adopted tunnels get back the kill
+  // switch the kill-switch record says they have. Runs at plugin
+  // registration, on the main thread, so it never elevates: costs one
+  // netlink dump and a file read. Rules the record holds for tunnels that
+  // are gone come out of the table with the next privileged operation
+  // (Start, Stop and their batch forms); a record that doesn't parse is
+  // left alone. Returns the number of newly adopted tunnels.
+  size_t AdoptRunningTunnels();
+  size_t AdoptRunningTunnels(const std::vector<NetLinkCpp>& links);
+
+  // `public_key`'s counters as of the last status poll of `name` (one
+  // probe of its PeerSnapshots entry), or, before the first poll, read now.
+  // False if the tunnel has no such peer. Throws std::invalid_argument for
+  // a malformed key and, when it has to read, what PeerStats throws.
+  bool PeerByPublicKey(const std::string& name, const std::string& public_key,
+                       PeerStatsCpp* out);
+
+  // Each running tunnel's peers as of its last poll. The status poller
+  // updates it; Start/StartMany/Stop/StopMany clear the tunnel's entry.
+  PeerSnapshots& peers() { return peers_; }
+
+  // Handshake ages of running tunnels. Start/StartMany start a tunnel's
+  // clocks and Stop/StopMany forget it; the status poller feeds it.
+  HandshakeMonitor& health() { return health_; }
+
   // Active backend metadata.
   BackendInfoCpp Backend() const { return backend_; }
 
+  // Defaults to kInline, or kFile when FLUTTER_WIREGUARD_CONFIG_HANDOFF=file.
+  ConfigHandoff handoff() const { return handoff_; }
+  void SetConfigHandoff(ConfigHandoff mode) { handoff_ = mode; }
+
   // ----- Statics exposed for unit testing -----
 
   // Validates a Linux interface name against WireGuard's accepted character
@@ -82,6 +241,23 @@ class WgBackend {
   static TunnelStatusCpp ParseWgShowDump(const std::string& name,
                                          const std::string& dump_stdout);
 
+  // `config` with its [Interface] section pinned to `table`: Table and
+  // FwMark are replaced by `table` (wg-quick then installs routes there and
+  // adds no rules of its own), and a PostDown removes the rules that
+  // InstallPolicyRules(table, priority) adds.
+  static std::string WithStagingTable(const std::string& config,
+                                      uint32_t table,
+                                      uint32_t priority);
+
+  // The routing table SwitchTunnel gives `name`: stable per name, so the
+  // PostDown baked into a running tunnel's config stays right across
+  // restarts of the app.
+  static uint32_t StagingTableFor(const std::string& name);
+
+  // Same input as ParseWgShowDump, one entry per peer line.
+  static std::vector<PeerStatsCpp> ParseWgShowDumpPeers(
+      const std::string& dump_stdout);
+
   // Reads byte counters from /sys/class/net/<name>/statistics/{rx,tx}_bytes.
   // Both kernel WireGuard and the TUN device created by wireguard-go expose
   // these counters world-readable, so they work with no privilege escalation.
@@ -92,8 +268,13 @@ class WgBackend {
                                 int64_t* tx,
                                 const std::string& sysfs_root = "/sys/class/net");
 
+  // Every interface in the current network namespace, from one
+  // RTM_GETLINK dump. Empty if netlink is unavailable.
+  static std::vector<NetLinkCpp> ListNetLinks();
+
  private:
   // Writes config to a private file inside config_dir_. Returns absolute path.
+  // kFile hand-off only.
   std::string WriteConfigFile(const std::string& name, const std::string& config);
 
   // Detects the active backend at construction.
@@ -107,19 +288,134 @@ class WgBackend {
   // Returns the userspace impl name for env var, or "" if kernel mode.
   std::string PickUserspaceImpl() const;
 
+  // Throws unless `name` is valid and was started in this process.
+  void RequireKnown(const std::string& name) const;
+
+  // The UAPI connection for `name` if a userspace implementation serves it,
+  // else null. Connections are created once and kept for the process
+  // lifetime.
+  UapiClient* UapiFor(const std::string& name);
+
+  // Newest handshake of any of `name`'s peers, read over UAPI. False if the
+  // socket isn't there or this process can't use it.
+  bool UapiHandshake(const std::string& name, int64_t* handshake);
+
+  // The parts of a config Start sets up itself instead of wg-quick: a kill
+  // switch (TakeOverKillSwitch), a large route set (TakeOverRoutes) and DNS
+  // (TakeOverDns).
+  struct TakeOver {
+    bool kill_switch = false;
+    KillSwitchPlan kill_switch_plan;
+    bool routes = false;
+    RoutePlan route_plan;
+    bool dns = false;
+    DnsPlan dns_plan;
+  };
+
+  // Fills *take_over for `config` and returns the config wg-quick gets.
+  // Throws std::invalid_argument for malformed KillSwitch lines.
+  std::string PlanTakeOver(const std::string& config, TakeOver* take_over);
+
+  // Lets every failover candidate of `config` (as Start was given it)
+  // through *plan as well, resolving the named ones.
+  void AddFailoverEndpoints(const std::string& config, KillSwitchPlan* plan);
+
+  // Sets each kill switch in `changes` (nullopt drops it) and commits the
+  // resulting set in one transaction. Returns "" or the error, in which
+  // case nothing changed. *previous, if given, receives what the changes
+  // replaced, which undoes them when passed back.
+  using KillSwitchChanges = std::map<std::string, std::optional<KillSwitchPlan>>;
+  std::string UpdateKillSwitches(const KillSwitchChanges& changes,
+                                 KillSwitchChanges* previous = nullptr);
+
+  // Drops `name`'s kill switch after Stop, if it has one. Returns "" or the
+  // error.
+  std::string DisarmKillSwitch(const std::string& name);
+
+  // After adoption: takes back the plans the kill-switch record holds for
+  // known tunnels and marks the table stale if it has others' rules.
+  void AdoptKillSwitches();
+
+  // If the table is stale, commits the armed set to take the dead tunnels'
+  // rules out. Only called once an operation has already elevated.
+  void DropStaleKillSwitches();
+
+  // Lets `moved` through `name`'s kill switch, if it has one, before they
+  // are applied. Throws std::runtime_error.
+  void WidenKillSwitch(const std::string& name, const std::vector<PeerEndpoint>& moved);
+
+  // Applies *take_over to the freshly raised `name`: addresses and routes,
+  // then DNS. Returns "" on success, else the error for Start to report
+  // (the caller brings the link back down).
+  std::string FinishTakeOver(const std::string& name, const TakeOver& take_over);
+
+  // Remembers which of `config`'s peers have named endpoints, and what
+  // they resolved to (`numeric`), for ReresolveEndpoints, and which have
+  // failover candidates.
+  void TrackEndpoints(const std::string& name, const std::string& config,
+                      const std::map<std::string, std::string>& numeric);
+
+  // Points each of `moved` at its numeric endpoint in one UAPI set or `wg
+  // set`, then records `written` (the endpoint as the config or a failover
+  // candidate wrote it; same order) as each peer's endpoint. Throws
+  // std::runtime_error if the update fails.
+  void ApplyEndpoints(const std::string& name, const std::vector<PeerEndpoint>& moved,
+                      const std::vector<std::string>& written);
+
+  // (Re)builds `name`'s AllowedIPs index from `config`. A config whose
+  // AllowedIPs don't parse leaves the tunnel without one; wg-quick has
+  // already accepted or rejected it, so that is not Start's error to raise.
+  void IndexPeers(const std::string& name, const std::string& config);
+  std::shared_ptr<const AllowedIpsTable> PeerTable(const std::string& name);
+
   std::unique_ptr<ProcessRunner>     runner_;
   std::unique_ptr<PrivilegedSession> elevated_;
   std::string config_dir_;
   std::string sysfs_root_ = "/sys/class/net";  // overridable for tests
   BackendInfoCpp backend_;
+  ConfigHandoff handoff_ = ConfigHandoff::kInline;
   bool is_root_ = false;
 
   mutable std::mutex mu_;
   std::set<std::string> known_tunnels_;
+  std::string uapi_dir_ = "/var/run/wireguard";  // overridable for tests
+  // Where the privileged side stages inline configs (privileged_session.cc).
+  std::string staging_dir_ = kStagingDir;
+  std::map<std::string, std::unique_ptr<UapiClient>> uapi_;
+  // Copy-on-write: lookups take a reference under mu_ and search without it.
+  std::map<std::string, std::shared_ptr<const AllowedIpsTable>> peer_tables_;
+  // Endpoint hostnames are resolved before wg-quick runs (and cached);
+  // `endpoint_names_` keeps each tunnel's named peers with the numeric
+  // endpoint last applied, keyed by public key.
+  std::unique_ptr<EndpointResolver> endpoints_;
+  struct NamedEndpoint {
+    std::string endpoint;  // "host:port"
+    std::string numeric;   // "" if it did not resolve
+  };
+  std::map<std::string, std::map<std::string, NamedEndpoint>> endpoint_names_;
+  EndpointFailover failover_;
+  HandshakeMonitor health_;
+  PeerSnapshots peers_;
+  // Armed kill switches, the table's contents. kill_switch_mu_ is held
+  // across each commit so that concurrent starts can't lose each other's
+  // rules.
+  std::mutex kill_switch_mu_;
+  KillSwitchSet kill_switches_;
+  // The table still holds rules of tunnels that died with an earlier
+  // session (see AdoptKillSwitches).
+  bool kill_switch_stale_ = false;
 
  public:
   // Override the sysfs root for testing.
   void SetSysfsRootForTesting(const std::string& root) { sysfs_root_ = root; }
+  // Override the UAPI socket directory for testing.
+  void SetUapiDirForTesting(const std::string& dir) { uapi_dir_ = dir; }
+  // Override the privileged staging directory for testing.
+  void SetStagingDirForTesting(const std::string& dir) { staging_dir_ = dir; }
+  // Replace the endpoint resolver (and drop its cache) for testing.
+  void SetEndpointResolverForTesting(std::unique_ptr<EndpointResolver> r) {
+    endpoints_ = std::move(r);
+  }
 };
 
 }  // namespace flutter_wireguard
@@ -0,0 +1,321 @@
+#include "wg_uapi.h"
+
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace flutter_wireguard {
+
+namespace {
+
+// A wedged daemon must not stall the status poller forever.
+constexpr int kReplyTimeoutSec = 2;
+
+bool KeyIs(const char* key, size_t key_len, const char* literal) {
+  size_t n = std::strlen(literal);
+  return key_len == n && std::memcmp(key, literal, n) == 0;
+}
+
+// Decimal, optionally negative. No allocation, no locale, no errno.
+bool ParseDecimal(const char* p, size_t n, int64_t* out) {
+  if (n == 0) return false;
+  bool neg = false;
+  if (*p == '-') {
+    neg = true;
+    ++p;
+    --n;
+    if (n == 0) return false;
+  }
+  uint64_t v = 0;
+  for (size_t i = 0; i < n; ++i) {
+    if (p[i] < '0' || p[i] > '9') return false;
+    if (v > (UINT64_MAX - 9) / 10) return false;
+    v = v * 10 + static_cast<uint64_t>(p[i] - '0');
+  }
+  if (v > static_cast<uint64_t>(INT64_MAX)) return false;
+  *out = neg ? -static_cast<int64_t>(v) : static_cast<int64_t>(v);
+  return true;
+}
+
+int HexNibble(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+std::runtime_error SysError(const std::string& what) {
+  return std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+void RequireSingleLine(const std::string& v, const char* what) {
+  if (v.find('\n') != std::string::npos || v.find('\0') != std::string::npos) {
+    throw std::invalid_argument(std::string("invalid ") + what);
+  }
+}
+
+}  // namespace
+
+bool WgKeyFromHex(const char* hex, size_t len, uint8_t out[kWgKeyLen]) {
+  if (len != kWgKeyLen * 2) return false;
+  for (size_t i = 0; i < kWgKeyLen; ++i) {
+    int hi = HexNibble(hex[2 * i]);
+    int lo = HexNibble(hex[2 * i + 1]);
+    if (hi < 0 || lo < 0) return false;
+    out[i] = static_cast<uint8_t>((hi << 4) | lo);
+  }
+  return true;
+}
+
+std::string WgKeyToHex(const uint8_t key[kWgKeyLen]) {
+  static constexpr char kDigits[] = "0123456789abcdef";
+  std::string s(kWgKeyLen * 2, '\0');
+  for (size_t i = 0; i < kWgKeyLen; ++i) {
+    s[2 * i] = kDigits[key[i] >> 4];
+    s[2 * i + 1] = kDigits[key[i] & 0xf];
+  }
+  return s;
+}
+
+// ----- UapiParser -----
+
+bool UapiParser::Feed(const char* data, size_t len, size_t* consumed) {
+  size_t i = 0;
+  while (i < len && !done_) {
+    const char* nl = static_cast<const char*>(std::memchr(data + i, '\n', len - i));
+    size_t take = (nl ? static_cast<size_t>(nl - (data + i)) : len - i);
+    if (line_len_ + take > kMaxLine) {
+      throw std::runtime_error("uapi line too long");
+    }
+    std::memcpy(line_ + line_len_, data + i, take);
+    line_len_ += take;
+    i += take;
+    if (nl == nullptr) break;
+    ++i;  // the '\n'
+    if (line_len_ == 0) {
+      done_ = true;
+    } else {
+      Line(line_, line_len_);
+      line_len_ = 0;
+    }
+  }
+  if (consumed != nullptr) *consumed = i;
+  return done_;
+}
+
+void UapiParser::Line(const char* p, size_t n) {
+  const char* eq = static_cast<const char*>(std::memchr(p, '=', n));
+  if (eq == nullptr) throw std::runtime_error("malformed uapi line");
+  const char* key = p;
+  size_t key_len = static_cast<size_t>(eq - p);
+  const char* val = eq + 1;
+  size_t val_len = n - key_len - 1;
+  int64_t num = 0;
+
+  if (KeyIs(key, key_len, "public_key")) {
+    out_->peers.emplace_back();
+    if (!WgKeyFromHex(val, val_len, out_->peers.back().public_key)) {
+      throw std::runtime_error("malformed uapi public_key");
+    }
+    return;
+  }
+  if (KeyIs(key, key_len, "errno")) {
+    if (!ParseDecimal(val, val_len, &num)) {
+      throw std::runtime_error("malformed uapi errno");
+    }
+    out_->error = num;
+    return;
+  }
+  if (out_->peers.empty()) {
+    // Interface section. private_key is deliberately never stored.
+    if (KeyIs(key, key_len, "listen_port") && ParseDecimal(val, val_len, &num)) {
+      out_->listen_port = static_cast<uint32_t>(num);
+    } else if (KeyIs(key, key_len, "fwmark") && ParseDecimal(val, val_len, &num)) {
+      out_->fwmark = static_cast<uint32_t>(num);
+    }
+    return;
+  }
+
+  UapiPeer& peer = out_->peers.back();
+  if (KeyIs(key, key_len, "rx_bytes")) {
+    if (ParseDecimal(val, val_len, &num)) peer.rx = num;
+  } else if (KeyIs(key, key_len, "tx_bytes")) {
+    if (ParseDecimal(val, val_len, &num)) peer.tx = num;
+  } else if (KeyIs(key, key_len, "last_handshake_time_sec")) {
+    if (ParseDecimal(val, val_len, &num)) peer.handshake_ms += num * 1000;
+  } else if (KeyIs(key, key_len, "last_handshake_time_nsec")) {
+    if (ParseDecimal(val, val_len, &num)) peer.handshake_ms += num / 1000000;
+  } else if (KeyIs(key, key_len, "persistent_keepalive_interval")) {
+    if (ParseDecimal(val, val_len, &num)) peer.keepalive = static_cast<uint32_t>(num);
+  } else if (KeyIs(key, key_len, "allowed_ip")) {
+    ++peer.allowed_ips;
+  } else if (KeyIs(key, key_len, "endpoint")) {
+    size_t m = val_len < sizeof(peer.endpoint) - 1 ? val_len
+                                                   : sizeof(peer.endpoint) - 1;
+    std::memcpy(peer.endpoint, val, m);
+    peer.endpoint[m] = '\0';
+  }
+  // preshared_key, protocol_version and keys from newer protocol revisions
+  // are skipped.
+}
+
+// ----- UapiClient -----
+
+UapiClient::UapiClient(std::string iface, std::string socket_dir)
+    : path_(std::move(socket_dir) + "/" + iface + ".sock") {}
+
+UapiClient::~UapiClient() { Close(); }
+
+bool UapiClient::Available() const {
+  struct stat st {};
+  return ::stat(path_.c_str(), &st) == 0 && S_ISSOCK(st.st_mode);
+}
+
+void UapiClient::Close() {
+  std::lock_guard<std::mutex> lock(mu_);
+  if (fd_ >= 0) ::close(fd_);
+  fd_ = -1;
+}
+
+void UapiClient::Get(UapiDevice* out) {
+  std::lock_guard<std::mutex> lock(mu_);
+  TransactLocked("get=1\n\n", out);
+}
+
+void UapiClient::Set(const std::string& body) {
+  std::lock_guard<std::mutex> lock(mu_);
+  TransactLocked("set=1\n" + body + "\n", &scratch_);
+}
+
+bool UapiClient::ConnectLocked() {
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (path_.size() >= sizeof(addr.sun_path)) {
+    errno = ENAMETOOLONG;
+    return false;
+  }
+  std::memcpy(addr.sun_path, path_.c_str(), path_.size() + 1);
+  int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) return false;
+  if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    int saved = errno;
+    ::close(fd);
+    errno = saved;
+    return false;
+  }
+  timeval tv{kReplyTimeoutSec, 0};
+  ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  fd_ = fd;
+  return true;
+}
+
+int UapiClient::RoundTripLocked(const std::string& request, UapiDevice* out) {
+  const char* data = request.data();
+  size_t left = request.size();
+  while (left > 0) {
+    // MSG_NOSIGNAL: a daemon that went away must not SIGPIPE the app.
+    ssize_t n = ::send(fd_, data, left, MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return (errno == EPIPE || errno == ECONNRESET) ? 0 : -1;
+    }
+    data += n;
+    left -= static_cast<size_t>(n);
+  }
+
+  out->Clear();
+  UapiParser parser(out);
+  bool got_any = false;
+  while (true) {
+    ssize_t n = ::recv(fd_, buf_, sizeof(buf_), 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n == 0 || (n < 0 && errno == ECONNRESET)) return got_any ? -1 : 0;
+    if (n < 0) return -1;
+    got_any = true;
+    size_t used = 0;
+    if (parser.Feed(buf_, static_cast<size_t>(n), &used)) return 1;
+  }
+}
+
+void UapiClient::TransactLocked(const std::string& request, UapiDevice* out) {
+  const bool reused = fd_ >= 0;
+  if (!reused && !ConnectLocked()) throw SysError("connect " + path_);
+  int r;
+  try {
+    r = RoundTripLocked(request, out);
+    if (r == 0 && reused) {
+      // The daemon closed the idle connection (boringtun does after every
+      // request). Nothing was processed; one retry on a fresh socket.
+      ::close(fd_);
+      fd_ = -1;
+      if (!ConnectLocked()) throw SysError("connect " + path_);
+      r = RoundTripLocked(request, out);
+    }
+  } catch (...) {
+    // Parser error: the stream position is unknown, start over next time.
+    ::close(fd_);
+    fd_ = -1;
+    throw;
+  }
+  if (r != 1) {
+    ::close(fd_);
+    fd_ = -1;
+    throw std::runtime_error(path_ + ": connection lost");
+  }
+  if (out->error != 0) {
+    int64_t e = out->error < 0 ? -out->error : out->error;
+    throw std::runtime_error(path_ + ": " +
+                             std::strerror(static_cast<int>(e)));
+  }
+}
+
+std::string UapiClient::AddPeerRequest(
+    const std::string& public_key, const std::string& endpoint,
+    const std::vector<std::string>& allowed_ips, uint32_t keepalive) {
+  uint8_t key[kWgKeyLen];
+  if (!WgKeyFromBase64(public_key, key)) {
+    throw std::invalid_argument("invalid public key");
+  }
+  RequireSingleLine(endpoint, "endpoint");
+  std::string body = "public_key=" + WgKeyToHex(key) + "\n";
+  if (!endpoint.empty()) body += "endpoint=" + endpoint + "\n";
+  body += "persistent_keepalive_interval=" + std::to_string(keepalive) + "\n";
+  body += "replace_allowed_ips=true\n";
+  for (const auto& ip : allowed_ips) {
+    if (ip.empty()) throw std::invalid_argument("invalid allowed IP");
+    RequireSingleLine(ip, "allowed IP");
+    body += "allowed_ip=" + ip + "\n";
+  }
+  return body;
+}
+
+std::string UapiClient::RemovePeerRequest(const std::string& public_key) {
+  uint8_t key[kWgKeyLen];
+  if (!WgKeyFromBase64(public_key, key)) {
+    throw std::invalid_argument("invalid public key");
+  }
+  return "public_key=" + WgKeyToHex(key) + "\nremove=true\n";
+}
+
+std::string UapiClient::SetEndpointsRequest(const std::vector<PeerEndpoint>& peers) {
+  std::string body;
+  for (const auto& p : peers) {
+    uint8_t key[kWgKeyLen];
+    if (!WgKeyFromBase64(p.public_key, key)) {
+      throw std::invalid_argument("invalid public key");
+    }
+    RequireSingleLine(p.endpoint, "endpoint");
+    body += "public_key=" + WgKeyToHex(key) + "\nupdate_only=true\nendpoint=" +
+            p.endpoint + "\n";
+  }
+  return body;
+}
+
+}  // namespace flutter_wireguard
@@ -0,0 +1,151 @@
+// Native client for the WireGuard cross-platform userspace API (UAPI).
+//
+// Userspace implementations (wireguard-go, boringtun) listen on
+// /var/run/wireguard/<iface>.sock and speak a line-oriented key=value
+// protocol: `get=1\n\n` dumps the device, `set=1\n<lines>\n` reconfigures
+// it, and every reply ends with `errno=<n>\n\n`. `wg show` and `wg set` are
+// thin wrappers around exactly this, so talking to the socket directly saves
+// a fork/exec (and, unprivileged, a trip through the pkexec session) per
+// poll tick.
+//
+// UapiParser is incremental and allocation-free: it copies at most one line
+// into a fixed buffer and decodes values in place. Peers land in a
+// caller-owned UapiDevice whose vector keeps its capacity between polls, so
+// a steady-state Get() allocates nothing.
+#ifndef FLUTTER_WIREGUARD_WG_UAPI_H_
+#define FLUTTER_WIREGUARD_WG_UAPI_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "endpoint_resolver.h"
+#include "wg_key.h"
+
+namespace flutter_wireguard {
+
+struct UapiPeer {
+  uint8_t public_key[kWgKeyLen] = {};
+  int64_t rx = 0;
+  int64_t tx = 0;
+  int64_t handshake_ms = 0;  // 0 = never
+  uint32_t keepalive = 0;    // seconds, 0 = off
+  uint32_t allowed_ips = 0;  // number of allowed_ip lines
+  char endpoint[64] = {};    // NUL-terminated "host:port", empty if none
+};
+
+struct UapiDevice {
+  uint32_t listen_port = 0;
+  uint32_t fwmark = 0;
+  int64_t error = 0;  // the reply's errno=; non-zero means the op failed
+  std::vector<UapiPeer> peers;
+
+  // Forgets the previous reply but keeps the peers' storage.
+  void Clear() {
+    listen_port = 0;
+    fwmark = 0;
+    error = 0;
+    peers.clear();
+  }
+};
+
+class UapiParser {
+ public:
+  // Longest line the protocol produces is `public_key=` + 64 hex digits or a
+  // bracketed IPv6 endpoint; anything past this is treated as corruption.
+  static constexpr size_t kMaxLine = 256;
+
+  explicit UapiParser(UapiDevice* out) : out_(out) {}
+
+  // Consumes up to `len` bytes. Returns true once the blank line that ends a
+  // reply has been seen; `*consumed` then says how much of `data` belonged
+  // to it. Throws std::runtime_error on an overlong or malformed line.
+  bool Feed(const char* data, size_t len, size_t* consumed);
+
+  // Starts over for the next reply; does not touch the device.
+  void Reset() {
+    line_len_ = 0;
+    done_ = false;
+  }
+
+ private:
+  void Line(const char* p, size_t n);
+
+  UapiDevice* out_;
+  char line_[kMaxLine];
+  size_t line_len_ = 0;
+  bool done_ = false;
+};
+
+// One persistent connection to one interface's UAPI socket. wireguard-go
+// serves any number of requests per connection; boringtun hangs up after
+// each, which is indistinguishable from a stale connection and handled by
+// the same transparent reconnect. Thread-safe.
+class UapiClient {
+ public:
+  explicit UapiClient(std::string iface,
+                      std::string socket_dir = "/var/run/wireguard");
+  ~UapiClient();
+
+  UapiClient(const UapiClient&) = delete;
+  UapiClient& operator=(const UapiClient&) = delete;
+
+  // True if the socket file exists, i.e. a userspace implementation owns
+  // `iface`. Says nothing about whether we may connect to it.
+  bool Available() const;
+
+  // get=1. Fills `*out` (cleared first). Throws std::runtime_error if the
+  // socket can't be reached, the reply is malformed or carries errno != 0.
+  void Get(UapiDevice* out);
+
+  // set=1 with `body`, which must be complete `key=value\n` lines. Throws
+  // like Get().
+  void Set(const std::string& body);
+
+  // Drops the connection; the next call reconnects.
+  void Close();
+
+  const std::string& path() const { return path_; }
+
+  // ----- Request builders (keys are base64, as in wg-quick configs) -----
+
+  // Adds or updates a peer. Replaces its allowed IPs with `allowed_ips`.
+  // Throws std::invalid_argument on a malformed key or a value containing
+  // a newline.
+  static std::string AddPeerRequest(const std::string& public_key,
+                                    const std::string& endpoint,
+                                    const std::vector<std::string>& allowed_ips,
+                                    uint32_t keepalive);
+
+  static std::string RemovePeerRequest(const std::string& public_key);
+
+  // Moves existing peers to new endpoints; leaves everything else about
+  // them, and peers that are gone, alone. Throws like AddPeerRequest.
+  static std::string SetEndpointsRequest(const std::vector<PeerEndpoint>& peers);
+
+ private:
+  // Sends `request` and parses the reply into `*out`. Retries once on a
+  // fresh connection if a reused one turns out to be dead.
+  void TransactLocked(const std::string& request, UapiDevice* out);
+  bool ConnectLocked();
+  // 1 = reply parsed, 0 = connection closed before any reply byte,
+  // -1 = I/O error or EOF mid-reply.
+  int RoundTripLocked(const std::string& request, UapiDevice* out);
+
+  std::string path_;
+  std::mutex mu_;
+  int fd_ = -1;
+  UapiDevice scratch_;  // Set() replies; reused
+  char buf_[4096];
+};
+
+// 32 raw key bytes <-> the hex UAPI speaks (base64 is in wg_key.h).
+// The decoder returns false on anything that isn't exactly one key.
+bool WgKeyFromHex(const char* hex, size_t len, uint8_t out[kWgKeyLen]);
+std::string WgKeyToHex(const uint8_t key[kWgKeyLen]);
+
+}  // namespace flutter_wireguard
+
+#endif  // FLUTTER_WIREGUARD_WG_UAPI_H_
@@ -66,6 +66,20 @@ enum BackendKind {
   unknown,
 }
 
+/// How a running tunnel's peer is doing, judged by the age of its last
+/// handshake.
+enum TunnelHealthState {
+  /// First handshake since the tunnel was started.
+  connected,
+
+  /// No handshake for the stale-after age (180 s unless set with
+  /// [WireguardHostApi.setStaleAfter]), or none that long after the start.
+  stale,
+
+  /// A handshake again after [stale].
+  recovered,
+}
+
 class BackendInfo {
   BackendInfo({required this.kind, required this.detail});
 
@@ -76,6 +90,188 @@ class BackendInfo {
   final String detail;
 }
 
+/// One tunnel to bring up in a [WireguardHostApi.startMany] batch.
+class TunnelSpec {
+  TunnelSpec({required this.name, required this.config});
+
+  /// Tunnel/interface name (e.g. "wg0").
+  final String name;
+
+  /// wg-quick / wg-config string, as for [WireguardHostApi.start].
+  final String config;
+}
+
+/// Per-tunnel outcome of a batch call.
+class TunnelResult {
+  TunnelResult({required this.name, required this.ok, this.error});
+
+  final String name;
+
+  /// True if the tunnel reached the requested state.
+  final bool ok;
+
+  /// Backend error message when [ok] is false.
+  final String? error;
+}
+
+/// Latency percentiles of one step of a tunnel operation.
+class PhaseStats {
+  PhaseStats({
+    required this.op,
+    required this.phase,
+    required this.count,
+    required this.p50Ms,
+    required this.p95Ms,
+    required this.p99Ms,
+  });
+
+  /// Operation the phase belongs to ("start", "stop", "switch", ...).
+  final String op;
+
+  /// Step within [op] ("wg_quick_up", "create_service", "total", ...).
+  final String phase;
+
+  /// Number of samples recorded since the process started.
+  final int count;
+
+  final double p50Ms;
+  final double p95Ms;
+  final double p99Ms;
+}
+
+/// A peer of a running tunnel crossing the handshake-age threshold.
+class TunnelHealth {
+  TunnelHealth({
+    required this.name,
+    required this.publicKey,
+    required this.state,
+    required this.lastHandshake,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  final String name;
+
+  /// Base64 public key of the peer; "" where the platform only reports the
+  /// tunnel as a whole (Windows).
+  final String publicKey;
+
+  final TunnelHealthState state;
+
+  /// Epoch milliseconds of the handshake [state] was judged by (0 if none).
+  final int lastHandshake;
+}
+
+/// A WireGuard keypair generated natively.
+class KeyPairData {
+  KeyPairData({
+    required this.privateKey,
+    required this.publicKey,
+  });
+
+  /// Base64, as `wg genkey` prints it.
+  final String privateKey;
+
+  /// Base64, as `wg pubkey` prints it.
+  final String publicKey;
+}
+
+/// One peer of a running tunnel, as of the last status poll.
+class PeerStatus {
+  PeerStatus({
+    required this.publicKey,
+    this.endpoint,
+    required this.rx,
+    required this.tx,
+    required this.lastHandshake,
+    required this.persistentKeepalive,
+  });
+
+  /// Base64 public key.
+  final String publicKey;
+
+  /// "host:port" the peer was last heard from, null if none yet.
+  final String? endpoint;
+
+  /// Bytes received from the peer.
+  final int rx;
+
+  /// Bytes sent to the peer.
+  final int tx;
+
+  /// Epoch milliseconds of the latest handshake, 0 if none.
+  final int lastHandshake;
+
+  /// Seconds; 0 when off.
+  final int persistentKeepalive;
+}
+
+/// One peer's share of a [TunnelUsage].
+class PeerUsage {
+  PeerUsage({required this.publicKey, required this.rx, required this.tx});
+
+  /// Base64 public key.
+  final String publicKey;
+
+  /// Bytes received from the peer.
+  final int rx;
+
+  /// Bytes sent to the peer.
+  final int tx;
+}
+
+/// Data a tunnel used over a period, across restarts of the tunnel and of
+/// the app.
+class TunnelUsage {
+  TunnelUsage({
+    required this.name,
+    required this.since,
+    required this.rx,
+    required this.tx,
+    required this.peers,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  final String name;
+
+  /// Epoch milliseconds the usage is counted from, as asked.
+  final int since;
+
+  /// Bytes received over the tunnel.
+  final int rx;
+
+  /// Bytes sent over the tunnel.
+  final int tx;
+
+  /// Peers that carried traffic in the period.
+  final List<PeerUsage> peers;
+}
+
+/// A tunnel that reached its usage quota.
+class UsageQuotaExceeded {
+  UsageQuotaExceeded({
+    required this.name,
+    required this.limit,
+    required this.used,
+    required this.since,
+    required this.stopped,
+  });
+
+  /// Tunnel/interface name (e.g. "wg0").
+  final String name;
+
+  /// The quota, in bytes of rx + tx.
+  final int limit;
+
+  /// Bytes of rx + tx used since [since] when the quota was noticed.
+  final int used;
+
+  /// Epoch milliseconds the quota counts from.
+  final int since;
+
+  /// Whether the tunnel was stopped; false if stopping it failed.
+  final bool stopped;
+}
+
 /// Host -> platform calls. All implementations must be reentrant and may be
 /// called from any isolate / thread.
 @HostApi()
@@ -101,6 +297,92 @@ abstract class WireguardHostApi {
   /// Returns the active backend.
   @async
   BackendInfo backend();
+
+  /// Bring several tunnels up at once. Independent tunnels are brought up
+  /// concurrently where the platform allows it; one failure does not abort
+  /// the rest. Results come back in input order.
+  @async
+  List<TunnelResult> startMany(List<TunnelSpec> specs);
+
+  /// Bring several tunnels down at once. Unknown names count as success.
+  @async
+  List<TunnelResult> stopMany(List<String> names);
+
+  /// Replace tunnel [from] with [to] (configured by [config]) without a
+  /// connectivity gap: [to] comes up and completes a handshake before
+  /// traffic moves over and [from] goes down. If [to] fails, [from] is left
+  /// untouched and "SWITCH_FAILED" is thrown.
+  @async
+  void switchTunnel(String from, String to, String config);
+
+  /// Per-phase timings of every Start/Stop since the backend started, for
+  /// telling where a slow connect spent its time.
+  @async
+  List<PhaseStats> diagnostics();
+
+  /// Write the native trace buffers to [path] as Chrome trace JSON. Only
+  /// available in builds with trace points compiled in; throws
+  /// "TRACE_FAILED" otherwise.
+  @async
+  void dumpTrace(String path);
+
+  /// Public key of the peer tunnel [name] would route [ipAddress] to: the
+  /// longest AllowedIPs prefix containing it, as the kernel picks. Null if no
+  /// peer covers it. Throws "LOOKUP_FAILED" for an unknown tunnel or a
+  /// malformed address.
+  @async
+  String? lookupPeer(String name, String ipAddress);
+
+  /// [lookupPeer] for many addresses at once; results match [ipAddresses] in
+  /// order.
+  @async
+  List<String?> lookupPeers(String name, List<String> ipAddresses);
+
+  /// The addresses in [include] but not in [exclude], as the fewest CIDR
+  /// prefixes (IPv4 first, each family in address order). Throws
+  /// "ALLOWED_IPS_FAILED" for a malformed prefix.
+  @async
+  List<String> computeAllowedIps(List<String> include, List<String> exclude);
+
+  /// Looks up the hostnames in the peer Endpoints of tunnel [name] again and
+  /// moves the peers whose address changed. Returns how many moved. Throws
+  /// "RESOLVE_FAILED".
+  @async
+  int reresolveEndpoints(String name);
+
+  /// Handshake age, in seconds, after which a peer is reported
+  /// [TunnelHealthState.stale]. Defaults to 180; values below 1 are raised to 1.
+  @async
+  void setStaleAfter(int seconds);
+
+  /// [count] fresh keypairs from the platform CSPRNG, derived off the platform
+  /// thread. Throws "KEYS_FAILED" for a negative or too-large [count].
+  @async
+  List<KeyPairData> generateKeyPairs(int count);
+
+  /// The public key of each of [privateKeys], in order. Throws "KEYS_FAILED"
+  /// naming the first key that is not 32 bytes of base64.
+  @async
+  List<String> publicKeysFromPrivate(List<String> privateKeys);
+
+  /// The peer of tunnel [name] with [publicKey], as of the last status poll;
+  /// null if the tunnel has no such peer. Throws "PEER_FAILED" for an unknown
+  /// tunnel or a malformed key.
+  @async
+  PeerStatus? peerByPublicKey(String name, String publicKey);
+
+  /// Data tunnel [name] used since [since] (epoch milliseconds), from the
+  /// persistent usage ledger. Throws "USAGE_FAILED" for an invalid name or
+  /// when the ledger is unavailable.
+  @async
+  TunnelUsage usage(String name, int since);
+
+  /// Stops tunnel [name] once its rx + tx since [since] reaches [limitBytes],
+  /// reporting it through [WireguardFlutterApi.onUsageQuota]; a [limitBytes] of
+  /// 0 removes the quota. Returns the bytes already used. Throws
+  /// "USAGE_FAILED" like [usage].
+  @async
+  int setUsageQuota(String name, int limitBytes, int since);
 }
 
 /// Platform -> host events.
@@ -108,4 +390,12 @@ abstract class WireguardHostApi {
 abstract class WireguardFlutterApi {
   /// Pushed whenever a tunnel changes state or its statistics tick.
   void onTunnelStatus(TunnelStatus status);
+
+  /// Pushed the moment a peer of a running tunnel connects, goes stale or
+  /// recovers.
+  void onTunnelHealth(TunnelHealth health);
+
+  /// Pushed once when a tunnel reaches the quota set with
+  /// [WireguardHostApi.setUsageQuota], after it was stopped.
+  void onUsageQuota(UsageQuotaExceeded event);
 }
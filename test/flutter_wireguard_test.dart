@@ -35,7 +35,28 @@ void main() {
   }
 
   tearDown(() {
-    for (final m in ['start', 'stop', 'status', 'tunnelNames', 'backend']) {
+    for (final m in [
+      'start',
+      'stop',
+      'status',
+      'tunnelNames',
+      'backend',
+      'startMany',
+      'stopMany',
+      'switchTunnel',
+      'diagnostics',
+      'dumpTrace',
+      'lookupPeer',
+      'lookupPeers',
+      'computeAllowedIps',
+      'reresolveEndpoints',
+      'setStaleAfter',
+      'generateKeyPairs',
+      'publicKeysFromPrivate',
+      'peerByPublicKey',
+      'usage',
+      'setUsageQuota',
+    ]) {
       clearHost(m);
     }
   });
@@ -90,6 +111,185 @@ void main() {
       expect(b.detail, 'wg-quick (kernel)');
     });
 
+    test('startMany sends specs and decodes per-tunnel results', () async {
+      List<Object?>? got;
+      mockHost('startMany', (args) {
+        got = args[0] as List<Object?>;
+        return [
+          TunnelResult(name: 'wg0', ok: true),
+          TunnelResult(name: 'wg1', ok: false, error: 'boom'),
+        ];
+      });
+      final results = await wg.startMany([
+        wg.TunnelSpec(name: 'wg0', config: '[Interface]'),
+        wg.TunnelSpec(name: 'wg1', config: '[Interface]'),
+      ]);
+      expect(got!.cast<TunnelSpec>().map((s) => s.name), ['wg0', 'wg1']);
+      expect(results.map((r) => r.ok), [true, false]);
+      expect(results[1].error, 'boom');
+    });
+
+    test('stopMany forwards names', () async {
+      List<Object?>? got;
+      mockHost('stopMany', (args) {
+        got = args[0] as List<Object?>;
+        return [TunnelResult(name: 'wg0', ok: true)];
+      });
+      final results = await wg.stopMany(['wg0']);
+      expect(got, ['wg0']);
+      expect(results.single.ok, isTrue);
+    });
+
+    test('switchTunnel forwards from, to and config', () async {
+      List<Object?>? got;
+      mockHost('switchTunnel', (args) {
+        got = args;
+        return null;
+      });
+      await wg.switchTunnel('home', 'office', '[Interface]');
+      expect(got, ['home', 'office', '[Interface]']);
+    });
+
+    test('diagnostics decodes phase stats', () async {
+      mockHost('diagnostics', (_) => [
+            PhaseStats(
+                op: 'start',
+                phase: 'wg_quick_up',
+                count: 3,
+                p50Ms: 120.0,
+                p95Ms: 240.0,
+                p99Ms: 240.0),
+          ]);
+      final stats = await wg.diagnostics();
+      expect(stats.single.op, 'start');
+      expect(stats.single.phase, 'wg_quick_up');
+      expect(stats.single.count, 3);
+      expect(stats.single.p95Ms, 240.0);
+    });
+
+    test('dumpTrace forwards path', () async {
+      String? gotPath;
+      mockHost('dumpTrace', (args) {
+        gotPath = args[0] as String;
+        return null;
+      });
+      await wg.dumpTrace('/tmp/wg.trace.json');
+      expect(gotPath, '/tmp/wg.trace.json');
+    });
+
+    test('lookupPeer forwards name and address, null means no peer', () async {
+      List<Object?>? got;
+      mockHost('lookupPeer', (args) {
+        got = args;
+        return args[1] == '10.0.0.1' ? 'QUJD' : null;
+      });
+      expect(await wg.lookupPeer('wg0', '10.0.0.1'), 'QUJD');
+      expect(got, ['wg0', '10.0.0.1']);
+      expect(await wg.lookupPeer('wg0', '8.8.8.8'), isNull);
+    });
+
+    test('lookupPeers keeps input order', () async {
+      mockHost('lookupPeers', (args) => [null, 'QUJD']);
+      expect(await wg.lookupPeers('wg0', ['8.8.8.8', '10.0.0.1']), [null, 'QUJD']);
+    });
+
+    test('computeAllowedIps forwards both lists', () async {
+      List<Object?>? got;
+      mockHost('computeAllowedIps', (args) {
+        got = args;
+        return ['0.0.0.0/1', '128.0.0.0/2'];
+      });
+      expect(await wg.computeAllowedIps(['0.0.0.0/0'], wg.lanPrefixes),
+          ['0.0.0.0/1', '128.0.0.0/2']);
+      expect(got, [
+        ['0.0.0.0/0'],
+        wg.lanPrefixes,
+      ]);
+    });
+
+    test('reresolveEndpoints returns the moved count', () async {
+      Object? got;
+      mockHost('reresolveEndpoints', (args) {
+        got = args[0];
+        return 2;
+      });
+      expect(await wg.reresolveEndpoints('wg0'), 2);
+      expect(got, 'wg0');
+    });
+
+    test('setStaleAfter sends whole seconds', () async {
+      Object? got;
+      mockHost('setStaleAfter', (args) {
+        got = args[0];
+        return null;
+      });
+      await wg.setStaleAfter(const Duration(seconds: 30));
+      expect(got, 30);
+    });
+
+    test('generateKeyPairs sends the count and maps the pairs', () async {
+      Object? got;
+      mockHost('generateKeyPairs', (args) {
+        got = args[0];
+        return [
+          KeyPairData(
+              privateKey: 'dwdtCnMYpX08FsFyUbJmRd9ML4frwJkqsXf7pR25LCo=',
+              publicKey: 'hSDwCYkwp1R0i33ctD73Wg2/Og0mOBr066SpjqqbTmo='),
+        ];
+      });
+      final pairs = await wg.generateKeyPairs(1);
+      expect(got, 1);
+      expect(pairs.single, isA<wg.WireGuardKeyPair>());
+      expect(pairs.single.publicKey, 'hSDwCYkwp1R0i33ctD73Wg2/Og0mOBr066SpjqqbTmo=');
+    });
+
+    test('publicKeysFromPrivate keeps input order', () async {
+      mockHost('publicKeysFromPrivate',
+          (args) => (args[0]! as List<Object?>).map((k) => 'pub:$k').toList());
+      expect(await wg.publicKeysFromPrivate(['a', 'b']), ['pub:a', 'pub:b']);
+    });
+
+    test('peerByPublicKey forwards name and key, null means no peer', () async {
+      final got = <Object?>[];
+      mockHost('peerByPublicKey', (args) {
+        got.addAll(args);
+        if (args[1] != 'A') return null;
+        return PeerStatus(
+            publicKey: 'A',
+            endpoint: '192.0.2.1:51820',
+            rx: 10,
+            tx: 20,
+            lastHandshake: 1700000000000,
+            persistentKeepalive: 25);
+      });
+      final peer = await wg.peerByPublicKey('wg0', 'A');
+      expect(got, ['wg0', 'A']);
+      expect(peer!.endpoint, '192.0.2.1:51820');
+      expect(peer.persistentKeepalive, 25);
+      expect(await wg.peerByPublicKey('wg0', 'B'), isNull);
+    });
+
+    test('usage and setUsageQuota send epoch milliseconds', () async {
+      final since = DateTime.utc(2024, 1, 1);
+      mockHost('usage', (args) {
+        expect(args, ['wg0', since.millisecondsSinceEpoch]);
+        return TunnelUsage(
+            name: 'wg0',
+            since: args[1]! as int,
+            rx: 10,
+            tx: 20,
+            peers: [PeerUsage(publicKey: 'A', rx: 10, tx: 20)]);
+      });
+      mockHost('setUsageQuota', (args) {
+        expect(args, ['wg0', 1000, since.millisecondsSinceEpoch]);
+        return 30;
+      });
+      final u = await wg.usage('wg0', since);
+      expect(u.rx + u.tx, 30);
+      expect(u.peers.single.publicKey, 'A');
+      expect(await wg.setUsageQuota('wg0', 1000, since), 30);
+    });
+
     test('platform errors propagate', () async {
       messenger.setMockDecodedMessageHandler<Object?>(
         const BasicMessageChannel<Object?>(
@@ -130,4 +330,47 @@ void main() {
       await sub.cancel();
     });
   });
+  group('health stream', () {
+    test('events delivered via FlutterApi reach the stream', () async {
+      final received = <wg.TunnelHealth>[];
+      final sub = wg.healthStream().listen(received.add);
+
+      const channel = 'dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth';
+      const flutterCodec = WireguardFlutterApi.pigeonChannelCodec;
+      final payload = flutterCodec.encodeMessage(<Object?>[
+        TunnelHealth(
+            name: 'wg0',
+            publicKey: 'A',
+            state: TunnelHealthState.stale,
+            lastHandshake: 3),
+      ]);
+      await messenger.handlePlatformMessage(channel, payload, (_) {});
+
+      await Future<void>.delayed(Duration.zero);
+      expect(received, hasLength(1));
+      expect(received.single.publicKey, 'A');
+      expect(received.single.state, TunnelHealthState.stale);
+      await sub.cancel();
+    });
+  });
+  group('usage quota stream', () {
+    test('events delivered via FlutterApi reach the stream', () async {
+      final received = <wg.UsageQuotaExceeded>[];
+      final sub = wg.usageQuotaStream().listen(received.add);
+
+      const channel = 'dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onUsageQuota';
+      const flutterCodec = WireguardFlutterApi.pigeonChannelCodec;
+      final payload = flutterCodec.encodeMessage(<Object?>[
+        UsageQuotaExceeded(
+            name: 'wg0', limit: 1000, used: 1200, since: 0, stopped: true),
+      ]);
+      await messenger.handlePlatformMessage(channel, payload, (_) {});
+
+      await Future<void>.delayed(Duration.zero);
+      expect(received, hasLength(1));
+      expect(received.single.used, 1200);
+      expect(received.single.stopped, isTrue);
+      await sub.cancel();
+    });
+  });
 }
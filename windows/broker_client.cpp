@@ -40,25 +40,6 @@ void CheckOk(ipc_ns::Reader& r) {
   }
 }
 
-bool ReadFully(HANDLE h, void* buf, DWORD len) {
-  BYTE* p = static_cast<BYTE*>(buf);
-  while (len > 0) {
-    DWORD got = 0;
-    OVERLAPPED ov{};
-    ov.hEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
-    if (ov.hEvent == nullptr) return false;
-    BOOL ok = ::ReadFile(h, p, len, &got, &ov);
-    if (!ok && ::GetLastError() == ERROR_IO_PENDING) {
-      ok = ::GetOverlappedResult(h, &ov, &got, TRUE);
-    }
-    ::CloseHandle(ov.hEvent);
-    if (!ok || got == 0) return false;
-    p += got;
-    len -= got;
-  }
-  return true;
-}
-
 bool WriteFully(HANDLE h, const void* buf, DWORD len) {
   const BYTE* p = static_cast<const BYTE*>(buf);
   while (len > 0) {
@@ -188,9 +169,14 @@ HANDLE BrokerClient::LaunchBrokerAndConnect() {
 void BrokerClient::EnsureConnected() {
   std::lock_guard<std::mutex> connect_lock(connect_mu_);
   if (pipe_ != INVALID_HANDLE_VALUE) return;
+  // Includes the UAC prompt when the broker is not running yet.
+  PhaseTimer launch("broker", "connect");
   HANDLE h = LaunchBrokerAndConnect();
+  launch.Stop();
   pipe_ = h;
   stop_.store(false);
+  frame_decoder_.Reset();
+  delta_decoder_.Reset();
   reader_ = std::thread(&BrokerClient::ReaderLoop, this);
 
   // HELLO handshake.
@@ -206,59 +192,90 @@ void BrokerClient::EnsureConnected() {
     throw BrokerError("broker protocol version mismatch");
   }
 
-  // Subscribe to status events.
-  Request(ipc_ns::kOpSubscribe, {});
+  // Subscribe to status events, preferring the compact delta stream. A
+  // broker that predates kOpSubscribeCompact answers with an error, in which
+  // case we fall back to full snapshots.
+  auto sub = Request(ipc_ns::kOpSubscribeCompact, {});
+  if (sub.empty() || sub[0] != ipc_ns::kStatusOk) {
+    Request(ipc_ns::kOpSubscribe, {});
+  }
 }
 
-void BrokerClient::ReaderLoop() {
-  HANDLE h = pipe_;
-  while (!stop_.load()) {
-    uint32_t total = 0;
-    if (!ReadFully(h, &total, sizeof(total))) break;
-    if (total < 9 || total > ipc_ns::kMaxFrameBytes) break;
-    std::vector<uint8_t> body(total);
-    if (!ReadFully(h, body.data(), total)) break;
-    ipc_ns::Reader r(body.data(), body.size());
-    uint32_t op = r.U32();
-    uint32_t seq = r.U32();
-    uint8_t flags = r.U8();
-    std::vector<uint8_t> payload(body.begin() + 9, body.end());
-    (void)op;
-
-    if ((flags & ipc_ns::kFlagEvent) != 0) {
-      // Status event. Decode and dispatch.
-      try {
-        ipc_ns::Reader pr(payload.data(), payload.size());
-        if (pr.U8() != ipc_ns::kStatusOk) continue;
+void BrokerClient::DispatchFrame(const ipc_ns::FrameView& f) {
+  if ((f.flags & ipc_ns::kFlagEvent) != 0) {
+    // Status event. Decode and dispatch.
+    try {
+      std::vector<BrokerStatus> events;
+      if (f.op == ipc_ns::kOpEventStatusDelta) {
+        for (auto& rec : delta_decoder_.Apply(f.payload, f.payload_len)) {
+          BrokerStatus s;
+          s.name = std::move(rec.name);
+          s.state = rec.state;
+          s.rx = rec.rx;
+          s.tx = rec.tx;
+          s.handshake_ms = rec.handshake_ms;
+          events.push_back(std::move(s));
+        }
+      } else {
+        ipc_ns::Reader pr(f.payload, f.payload_len);
+        if (pr.U8() != ipc_ns::kStatusOk) return;
         BrokerStatus s;
         s.name = pr.Str();
         s.state = pr.U8();
         s.rx = pr.I64();
         s.tx = pr.I64();
         s.handshake_ms = pr.I64();
-        StatusCallback cb;
-        {
-          std::lock_guard<std::mutex> lock(mu_);
-          cb = status_cb_;
-        }
-        if (cb) cb(s);
-      } catch (...) {
+        events.push_back(std::move(s));
+      }
+      StatusCallback cb;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        cb = status_cb_;
+      }
+      if (cb) {
+        for (const auto& s : events) cb(s);
       }
-      continue;
+    } catch (...) {
     }
+    return;
+  }
 
-    std::shared_ptr<Pending> pending;
-    {
-      std::lock_guard<std::mutex> lock(mu_);
-      auto it = inflight_.find(seq);
-      if (it == inflight_.end()) continue;
-      pending = it->second;
-      inflight_.erase(it);
-      pending->payload = std::move(payload);
-      pending->ready = true;
+  std::shared_ptr<Pending> pending;
+  {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = inflight_.find(f.seq);
+    if (it == inflight_.end()) return;
+    pending = it->second;
+    inflight_.erase(it);
+    pending->payload.assign(f.payload, f.payload + f.payload_len);
+    pending->ready = true;
+  }
+  cv_.notify_all();
+}
+
+void BrokerClient::ReaderLoop() {
+  HANDLE h = pipe_;
+  // One event for the lifetime of the connection; ReadFile resets it.
+  HANDLE event = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
+  uint8_t chunk[16 * 1024];
+  while (event != nullptr && !stop_.load()) {
+    DWORD got = 0;
+    OVERLAPPED ov{};
+    ov.hEvent = event;
+    BOOL ok = ::ReadFile(h, chunk, sizeof(chunk), &got, &ov);
+    if (!ok && ::GetLastError() == ERROR_IO_PENDING) {
+      ok = ::GetOverlappedResult(h, &ov, &got, TRUE);
+    }
+    if (!ok || got == 0) break;
+    try {
+      frame_decoder_.Feed(
+          chunk, got, [this](const ipc_ns::FrameView& f) { DispatchFrame(f); });
+    } catch (...) {
+      // Framing lost (bad length prefix); drop the connection.
+      break;
     }
-    cv_.notify_all();
   }
+  if (event != nullptr) ::CloseHandle(event);
 
   // Pipe closed. Fail every outstanding request.
   std::lock_guard<std::mutex> lock(mu_);
@@ -365,4 +382,25 @@ BrokerBackend BrokerClient::Backend() {
   return b;
 }
 
+std::vector<PhaseSummary> BrokerClient::Diagnostics() {
+  EnsureConnected();
+  auto resp = Request(ipc_ns::kOpDiagnostics, {});
+  ipc_ns::Reader r(resp.data(), resp.size());
+  CheckOk(r);
+  uint32_t n = r.U32();
+  std::vector<PhaseSummary> out;
+  out.reserve(n);
+  for (uint32_t i = 0; i < n; ++i) {
+    PhaseSummary s;
+    s.op = r.Str();
+    s.phase = r.Str();
+    s.count = static_cast<uint64_t>(r.I64());
+    s.p50_us = static_cast<uint64_t>(r.I64());
+    s.p95_us = static_cast<uint64_t>(r.I64());
+    s.p99_us = static_cast<uint64_t>(r.I64());
+    out.push_back(std::move(s));
+  }
+  return out;
+}
+
 }  // namespace flutter_wireguard
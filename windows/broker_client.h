@@ -15,6 +15,9 @@
 #include <thread>
 #include <vector>
 
+#include "../cpp/ipc_protocol.h"
+#include "../cpp/phase_timer.h"
+
 namespace flutter_wireguard {
 
 struct BrokerStatus {
@@ -51,6 +54,8 @@ class BrokerClient {
   BrokerStatus Status(const std::string& name);
   std::vector<std::string> TunnelNames();
   BrokerBackend Backend();
+  // The broker's phase timers (the plugin's own live in PhaseRegistry).
+  std::vector<PhaseSummary> Diagnostics();
 
   // Tears the connection down (used by tests).
   void Shutdown();
@@ -69,6 +74,7 @@ class BrokerClient {
   std::wstring ResolveHelperPath();
   HANDLE LaunchBrokerAndConnect();
   void ReaderLoop();
+  void DispatchFrame(const ipc::FrameView& f);
   std::vector<uint8_t> Request(uint32_t op, const std::vector<uint8_t>& payload);
 
   std::mutex mu_;
@@ -90,6 +96,12 @@ class BrokerClient {
 
   StatusCallback status_cb_;
   std::wstring helper_path_;
+
+  // Reader-thread state: partial-frame buffer and the id table for
+  // kOpEventStatusDelta. Both are reset in EnsureConnected before the reader
+  // starts.
+  ipc::FrameDecoder frame_decoder_;
+  ipc::StatusDeltaDecoder delta_decoder_;
 };
 
 }  // namespace flutter_wireguard
@@ -2,13 +2,27 @@
 
 #include <windows.h>
 
+#include <bcrypt.h>
+
+#include <any>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "../cpp/allowed_ips.h"
+#include "../cpp/cidr_set.h"
+#include "../cpp/handshake_monitor.h"
+#include "../cpp/key_pairs.h"
 #include "../cpp/name_validator.h"
+#include "../cpp/phase_timer.h"
 #include "broker_client.h"
 #include "messages.g.h"
 #include "utils.h"
@@ -17,13 +31,30 @@ namespace flutter_wireguard {
 
 namespace {
 
+int64_t NowEpochMs() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// The broker reports one handshake per tunnel, so each tunnel is tracked as
+// a single peer with key "".
+HandshakeMonitor& Health() {
+  static HandshakeMonitor m;
+  return m;
+}
+
 // Cross-thread dispatcher: status callbacks fire on the BrokerClient reader
 // thread, but BinaryMessenger is engine-thread-affine. We park each event on a
 // hidden HWND_MESSAGE window and post WM_USER; the platform thread's message
 // loop drains the queue and calls WireguardFlutterApi::OnTunnelStatus.
+//
+// The broker only reports a tunnel when it changes, so a once-a-second
+// timer on the same window re-checks handshake ages for OnTunnelHealth.
 class StatusDispatcher {
  public:
   static constexpr UINT kWmDrain = WM_USER + 1;
+  static constexpr UINT_PTR kHealthTimer = 1;
 
   StatusDispatcher(flutter::BinaryMessenger* messenger,
                    std::unique_ptr<WireguardFlutterApi> api)
@@ -43,11 +74,15 @@ class StatusDispatcher {
     if (hwnd_ != nullptr) {
       ::SetWindowLongPtrW(hwnd_, GWLP_USERDATA,
                           reinterpret_cast<LONG_PTR>(this));
+      ::SetTimer(hwnd_, kHealthTimer, 1000, nullptr);
     }
   }
 
   ~StatusDispatcher() {
-    if (hwnd_ != nullptr) ::DestroyWindow(hwnd_);
+    if (hwnd_ != nullptr) {
+      ::KillTimer(hwnd_, kHealthTimer);
+      ::DestroyWindow(hwnd_);
+    }
   }
 
   void Post(BrokerStatus s) {
@@ -66,6 +101,16 @@ class StatusDispatcher {
       if (self != nullptr) self->Drain();
       return 0;
     }
+    if (msg == WM_TIMER && wp == kHealthTimer) {
+      auto* self = reinterpret_cast<StatusDispatcher*>(
+          ::GetWindowLongPtrW(hwnd, GWLP_USERDATA));
+      if (self != nullptr) {
+        std::vector<TunnelHealthEventCpp> events;
+        Health().Tick(NowEpochMs(), &events);
+        self->EmitHealth(events);
+      }
+      return 0;
+    }
     return ::DefWindowProcW(hwnd, msg, wp, lp);
   }
 
@@ -75,8 +120,15 @@ class StatusDispatcher {
       std::lock_guard<std::mutex> lock(mu_);
       std::swap(local, queue_);
     }
+    std::vector<TunnelHealthEventCpp> events;
+    const int64_t now_ms = NowEpochMs();
     while (!local.empty()) {
       const auto& s = local.front();
+      if (s.state == 2) {
+        Health().Observe(s.name, {{"", s.handshake_ms}}, now_ms, &events);
+      } else if (s.state == 0) {
+        Health().Stopped(s.name);
+      }
       TunnelStatus st(s.name,
                       s.state == 2 ? TunnelState::kUp
                                     : (s.state == 1 ? TunnelState::kToggle
@@ -85,6 +137,20 @@ class StatusDispatcher {
       api_->OnTunnelStatus(st, [] {}, [](const FlutterError&) {});
       local.pop();
     }
+    EmitHealth(events);
+  }
+
+  void EmitHealth(const std::vector<TunnelHealthEventCpp>& events) {
+    for (const auto& e : events) {
+      TunnelHealth h(e.name, e.public_key,
+                     e.health == TunnelHealthCpp::kConnected
+                         ? TunnelHealthState::kConnected
+                         : (e.health == TunnelHealthCpp::kStale
+                                ? TunnelHealthState::kStale
+                                : TunnelHealthState::kRecovered),
+                     e.handshake_ms);
+      api_->OnTunnelHealth(h, [] {}, [](const FlutterError&) {});
+    }
   }
 
   std::unique_ptr<WireguardFlutterApi> api_;
@@ -98,6 +164,53 @@ std::unique_ptr<StatusDispatcher>& Dispatcher() {
   return d;
 }
 
+// AllowedIPs index per tunnel, built from the config this plugin started it
+// with (the broker has no lookup of its own). Tables are immutable once
+// published, so a lookup copies the pointer under the lock and searches
+// without it.
+class PeerTables {
+ public:
+  static PeerTables& Instance() {
+    static PeerTables t;
+    return t;
+  }
+
+  // A config whose AllowedIPs don't parse leaves the tunnel without an index.
+  void Index(const std::string& name, const std::string& config) {
+    std::shared_ptr<const AllowedIpsTable> table;
+    try {
+      table = std::make_shared<AllowedIpsTable>(AllowedIpsTable::FromConfig(config));
+    } catch (const std::invalid_argument&) {
+    }
+    std::lock_guard<std::mutex> lock(mu_);
+    if (table) {
+      tables_[name] = std::move(table);
+    } else {
+      tables_.erase(name);
+    }
+  }
+
+  std::shared_ptr<const AllowedIpsTable> Get(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = tables_.find(name);
+    if (it == tables_.end()) {
+      throw std::runtime_error("no AllowedIPs index for '" + name +
+                               "'; it was not started by this process");
+    }
+    return it->second;
+  }
+
+ private:
+  std::mutex mu_;
+  std::map<std::string, std::shared_ptr<const AllowedIpsTable>> tables_;
+};
+
+flutter::EncodableValue LookupValue(const AllowedIpsTable& table,
+                                    const std::string& ip) {
+  const std::string* key = table.Lookup(ip);
+  return key != nullptr ? flutter::EncodableValue(*key) : flutter::EncodableValue();
+}
+
 }  // namespace
 
 // static
@@ -134,7 +247,10 @@ void FlutterWireguardPlugin::Start(
   // block several seconds.
   std::thread([name, config, result = std::move(result)]() mutable {
     try {
+      const int64_t started_ms = NowEpochMs();
       BrokerClient::Instance().Start(name, config);
+      PeerTables::Instance().Index(name, config);
+      Health().Started(name, started_ms, {""});
       result(std::nullopt);
     } catch (const std::exception& e) {
       result(FlutterError("START_FAILED", e.what()));
@@ -152,6 +268,7 @@ void FlutterWireguardPlugin::Stop(
   std::thread([name, result = std::move(result)]() mutable {
     try {
       BrokerClient::Instance().Stop(name);
+      Health().Stopped(name);
       result(std::nullopt);
     } catch (const std::exception& e) {
       result(FlutterError("STOP_FAILED", e.what()));
@@ -211,4 +328,298 @@ void FlutterWireguardPlugin::Backend(
   }).detach();
 }
 
+// The broker answers one request at a time per pipe, so the batch is a
+// plain loop on one worker thread; what it saves is the per-call channel
+// round trips, and one failure doesn't abort the rest.
+void FlutterWireguardPlugin::StartMany(
+    const flutter::EncodableList& specs,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  std::vector<std::pair<std::string, std::string>> batch;
+  batch.reserve(specs.size());
+  for (const auto& v : specs) {
+    const auto& spec = std::any_cast<const TunnelSpec&>(
+        std::get<flutter::CustomEncodableValue>(v));
+    batch.emplace_back(spec.name(), spec.config());
+  }
+  std::thread([batch = std::move(batch), result = std::move(result)]() mutable {
+    flutter::EncodableList out;
+    out.reserve(batch.size());
+    for (const auto& [name, config] : batch) {
+      std::string error;
+      if (!IsValidTunnelName(name)) {
+        error = "invalid tunnel name";
+      } else {
+        try {
+          const int64_t started_ms = NowEpochMs();
+          BrokerClient::Instance().Start(name, config);
+          PeerTables::Instance().Index(name, config);
+          Health().Started(name, started_ms, {""});
+        } catch (const std::exception& e) {
+          error = e.what();
+        }
+      }
+      out.emplace_back(flutter::CustomEncodableValue(
+          error.empty() ? TunnelResult(name, true)
+                        : TunnelResult(name, false, &error)));
+    }
+    result(out);
+  }).detach();
+}
+
+void FlutterWireguardPlugin::StopMany(
+    const flutter::EncodableList& names,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  std::vector<std::string> batch;
+  batch.reserve(names.size());
+  for (const auto& v : names) batch.push_back(std::get<std::string>(v));
+  std::thread([batch = std::move(batch), result = std::move(result)]() mutable {
+    flutter::EncodableList out;
+    out.reserve(batch.size());
+    for (const auto& name : batch) {
+      std::string error;
+      // Like Stop, a name that can't be a tunnel is trivially down.
+      if (IsValidTunnelName(name)) {
+        try {
+          BrokerClient::Instance().Stop(name);
+          Health().Stopped(name);
+        } catch (const std::exception& e) {
+          error = e.what();
+        }
+      }
+      out.emplace_back(flutter::CustomEncodableValue(
+          error.empty() ? TunnelResult(name, true)
+                        : TunnelResult(name, false, &error)));
+    }
+    result(out);
+  }).detach();
+}
+
+// Make-before-break: both tunnels run side by side until `to` has a
+// handshake. Windows has no policy-routing hook to flip, so traffic follows
+// the route metrics wireguard-nt assigned while both are up, and moves for
+// good when `from` goes down.
+void FlutterWireguardPlugin::SwitchTunnel(
+    const std::string& from, const std::string& to, const std::string& config,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  if (!IsValidTunnelName(from) || !IsValidTunnelName(to) || from == to) {
+    result(FlutterError("SWITCH_FAILED", "invalid tunnel name"));
+    return;
+  }
+  std::thread([from, to, config, result = std::move(result)]() mutable {
+    auto& broker = BrokerClient::Instance();
+    try {
+      const int64_t started_ms = NowEpochMs();
+      broker.Start(to, config);
+      PeerTables::Instance().Index(to, config);
+      Health().Started(to, started_ms, {""});
+    } catch (const std::exception& e) {
+      result(FlutterError("SWITCH_FAILED", e.what()));
+      return;
+    }
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    try {
+      while (broker.Status(to).handshake_ms == 0) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+          throw std::runtime_error("no handshake on '" + to + "'; kept '" +
+                                   from + "'");
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      }
+    } catch (const std::exception& e) {
+      try {
+        broker.Stop(to);
+      } catch (...) {
+      }
+      Health().Stopped(to);
+      result(FlutterError("SWITCH_FAILED", e.what()));
+      return;
+    }
+    try {
+      broker.Stop(from);
+      Health().Stopped(from);
+      result(std::nullopt);
+    } catch (const std::exception& e) {
+      result(FlutterError("SWITCH_FAILED", e.what()));
+    }
+  }).detach();
+}
+
+void FlutterWireguardPlugin::Diagnostics(
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  std::thread([result = std::move(result)]() mutable {
+    try {
+      // Broker-side SCM phases, then the plugin's own (broker/connect).
+      std::vector<PhaseSummary> rows = BrokerClient::Instance().Diagnostics();
+      for (auto& row : PhaseRegistry::Instance().Snapshot()) {
+        rows.push_back(std::move(row));
+      }
+      flutter::EncodableList out;
+      out.reserve(rows.size());
+      for (const auto& row : rows) {
+        out.emplace_back(flutter::CustomEncodableValue(PhaseStats(
+            row.op, row.phase, static_cast<int64_t>(row.count),
+            row.p50_us / 1000.0, row.p95_us / 1000.0, row.p99_us / 1000.0)));
+      }
+      result(std::move(out));
+    } catch (const std::exception& e) {
+      result(FlutterError("DIAGNOSTICS_FAILED", e.what()));
+    }
+  }).detach();
+}
+
+// Trace points exist on Linux only; on Windows use ETW (wpr/WPA) instead.
+void FlutterWireguardPlugin::DumpTrace(
+    const std::string& path,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  (void)path;
+  result(FlutterError("TRACE_FAILED", "tracing is not available on Windows"));
+}
+
+// Lookups never reach the broker, so they answer on the platform thread.
+void FlutterWireguardPlugin::LookupPeer(
+    const std::string& name, const std::string& ip_address,
+    std::function<void(ErrorOr<std::optional<std::string>> reply)> result) {
+  try {
+    const std::string* key = PeerTables::Instance().Get(name)->Lookup(ip_address);
+    result(key != nullptr ? std::optional<std::string>(*key) : std::nullopt);
+  } catch (const std::exception& e) {
+    result(FlutterError("LOOKUP_FAILED", e.what()));
+  }
+}
+
+void FlutterWireguardPlugin::LookupPeers(
+    const std::string& name, const flutter::EncodableList& ip_addresses,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  try {
+    std::shared_ptr<const AllowedIpsTable> table = PeerTables::Instance().Get(name);
+    flutter::EncodableList out;
+    out.reserve(ip_addresses.size());
+    for (const auto& ip : ip_addresses) {
+      out.push_back(LookupValue(*table, std::get<std::string>(ip)));
+    }
+    result(std::move(out));
+  } catch (const std::exception& e) {
+    result(FlutterError("LOOKUP_FAILED", e.what()));
+  }
+}
+
+// Pure computation, but off the platform thread: 100k-prefix lists take
+// tens of milliseconds.
+void FlutterWireguardPlugin::ComputeAllowedIps(
+    const flutter::EncodableList& include,
+    const flutter::EncodableList& exclude,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  auto strings = [](const flutter::EncodableList& list) {
+    std::vector<std::string> out;
+    out.reserve(list.size());
+    for (const auto& v : list) out.push_back(std::get<std::string>(v));
+    return out;
+  };
+  std::thread([include = strings(include), exclude = strings(exclude),
+               result = std::move(result)]() mutable {
+    try {
+      flutter::EncodableList out;
+      for (auto& prefix :
+           CidrSet::Parse(include).Subtract(CidrSet::Parse(exclude)).ToStrings()) {
+        out.emplace_back(std::move(prefix));
+      }
+      result(std::move(out));
+    } catch (const std::exception& e) {
+      result(FlutterError("ALLOWED_IPS_FAILED", e.what()));
+    }
+  }).detach();
+}
+
+// The tunnel service owns the peers' endpoints on Windows and resolves
+// them itself.
+void FlutterWireguardPlugin::ReresolveEndpoints(
+    const std::string& name,
+    std::function<void(ErrorOr<int64_t> reply)> result) {
+  (void)name;
+  result(FlutterError("RESOLVE_FAILED",
+                      "re-resolving endpoints is not available on Windows"));
+}
+
+void FlutterWireguardPlugin::SetStaleAfter(
+    int64_t seconds,
+    std::function<void(std::optional<FlutterError> reply)> result) {
+  // <windows.h> defines min/max as macros, so clamp by hand.
+  const int64_t max_s = INT64_MAX / 1000;
+  const int64_t capped = seconds < 1 ? 1 : (seconds > max_s ? max_s : seconds);
+  Health().SetStaleAfter(capped * 1000);
+  result(std::nullopt);
+}
+
+// ~130 us of ladder per key: off the platform thread, spread over the cores.
+void FlutterWireguardPlugin::GenerateKeyPairs(
+    int64_t count,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  std::thread([count, result = std::move(result)]() mutable {
+    try {
+      auto fill = [](uint8_t* out, size_t n) {
+        // n <= kMaxKeyPairs * 32, well inside a ULONG.
+        if (!BCRYPT_SUCCESS(BCryptGenRandom(nullptr, out, static_cast<ULONG>(n),
+                                            BCRYPT_USE_SYSTEM_PREFERRED_RNG))) {
+          throw std::runtime_error("BCryptGenRandom failed");
+        }
+      };
+      flutter::EncodableList out;
+      for (auto& pair : flutter_wireguard::GenerateKeyPairs(count, fill)) {
+        out.emplace_back(flutter::CustomEncodableValue(
+            KeyPairData(pair.private_key, pair.public_key)));
+      }
+      result(std::move(out));
+    } catch (const std::exception& e) {
+      result(FlutterError("KEYS_FAILED", e.what()));
+    }
+  }).detach();
+}
+
+void FlutterWireguardPlugin::PublicKeysFromPrivate(
+    const flutter::EncodableList& private_keys,
+    std::function<void(ErrorOr<flutter::EncodableList> reply)> result) {
+  std::vector<std::string> keys;
+  keys.reserve(private_keys.size());
+  for (const auto& v : private_keys) keys.push_back(std::get<std::string>(v));
+  std::thread([keys = std::move(keys), result = std::move(result)]() mutable {
+    try {
+      flutter::EncodableList out;
+      for (auto& key : flutter_wireguard::PublicKeysFromPrivate(keys)) {
+        out.emplace_back(std::move(key));
+      }
+      result(std::move(out));
+    } catch (const std::exception& e) {
+      result(FlutterError("KEYS_FAILED", e.what()));
+    }
+  }).detach();
+}
+
+// The broker reports each tunnel as a whole (see Health()), so there is no
+// per-peer snapshot to look in.
+void FlutterWireguardPlugin::PeerByPublicKey(
+    const std::string& name, const std::string& public_key,
+    std::function<void(ErrorOr<std::optional<PeerStatus>> reply)> result) {
+  (void)name;
+  (void)public_key;
+  result(FlutterError("PEER_FAILED", "per-peer status is not available on Windows"));
+}
+
+void FlutterWireguardPlugin::Usage(
+    const std::string& name, int64_t since,
+    std::function<void(ErrorOr<TunnelUsage> reply)> result) {
+  (void)name;
+  (void)since;
+  result(FlutterError("USAGE_FAILED", "the usage ledger is not available on Windows"));
+}
+
+void FlutterWireguardPlugin::SetUsageQuota(
+    const std::string& name, int64_t limit_bytes, int64_t since,
+    std::function<void(ErrorOr<int64_t> reply)> result) {
+  (void)name;
+  (void)limit_bytes;
+  (void)since;
+  result(FlutterError("USAGE_FAILED", "the usage ledger is not available on Windows"));
+}
+
 }  // namespace flutter_wireguard
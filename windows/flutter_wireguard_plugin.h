@@ -33,6 +33,58 @@ class FlutterWireguardPlugin : public flutter::Plugin, public WireguardHostApi {
       override;
   void Backend(
       std::function<void(ErrorOr<BackendInfo> reply)> result) override;
+  void StartMany(
+      const flutter::EncodableList& specs,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void StopMany(
+      const flutter::EncodableList& names,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void SwitchTunnel(
+      const std::string& from, const std::string& to, const std::string& config,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+  void Diagnostics(
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void DumpTrace(
+      const std::string& path,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+  void LookupPeer(
+      const std::string& name, const std::string& ip_address,
+      std::function<void(ErrorOr<std::optional<std::string>> reply)> result)
+      override;
+  void LookupPeers(
+      const std::string& name, const flutter::EncodableList& ip_addresses,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void ComputeAllowedIps(
+      const flutter::EncodableList& include,
+      const flutter::EncodableList& exclude,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void ReresolveEndpoints(
+      const std::string& name,
+      std::function<void(ErrorOr<int64_t> reply)> result) override;
+  void SetStaleAfter(
+      int64_t seconds,
+      std::function<void(std::optional<FlutterError> reply)> result) override;
+  void GenerateKeyPairs(
+      int64_t count,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void PublicKeysFromPrivate(
+      const flutter::EncodableList& private_keys,
+      std::function<void(ErrorOr<flutter::EncodableList> reply)> result)
+      override;
+  void PeerByPublicKey(
+      const std::string& name, const std::string& public_key,
+      std::function<void(ErrorOr<std::optional<PeerStatus>> reply)> result)
+      override;
+  void Usage(const std::string& name, int64_t since,
+             std::function<void(ErrorOr<TunnelUsage> reply)> result) override;
+  void SetUsageQuota(const std::string& name, int64_t limit_bytes, int64_t since,
+                     std::function<void(ErrorOr<int64_t> reply)> result) override;
 
  private:
   void DispatchEvent(TunnelStatus status);
@@ -3,12 +3,9 @@
 #include <windows.h>
 
 #include <cstdio>
-#include <cstring>
 #include <mutex>
 #include <vector>
 
-#include "../../cpp/ipc_protocol.h"
-#include "../../cpp/name_validator.h"
 #include "../utils.h"
 #include "pipe_security.h"
 
@@ -21,95 +18,105 @@ namespace {
 constexpr DWORD kPipeBuf = 64 * 1024;
 constexpr DWORD kIdleTimeoutMs = 60'000;
 
-bool ReadFully(HANDLE pipe, void* buf, DWORD len) {
-  BYTE* p = static_cast<BYTE*>(buf);
-  while (len > 0) {
+// ipc::Transport over one connected overlapped pipe instance. Each direction
+// owns a manual-reset event for the lifetime of the connection; reads only
+// happen on the HandleClient thread and writes are serialized by the
+// dispatcher, so neither event is ever shared by two pending operations.
+class PipeTransport : public ipc_ns::Transport {
+ public:
+  explicit PipeTransport(HANDLE pipe)
+      : pipe_(pipe),
+        read_event_(::CreateEventW(nullptr, TRUE, FALSE, nullptr)),
+        write_event_(::CreateEventW(nullptr, TRUE, FALSE, nullptr)) {}
+  ~PipeTransport() override {
+    if (read_event_ != nullptr) ::CloseHandle(read_event_);
+    if (write_event_ != nullptr) ::CloseHandle(write_event_);
+  }
+  PipeTransport(const PipeTransport&) = delete;
+  PipeTransport& operator=(const PipeTransport&) = delete;
+
+  size_t Read(uint8_t* buf, size_t len) override {
+    if (read_event_ == nullptr) return 0;
     DWORD got = 0;
     OVERLAPPED ov{};
-    ov.hEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
-    if (ov.hEvent == nullptr) return false;
-    BOOL ok = ::ReadFile(pipe, p, len, &got, &ov);
+    ov.hEvent = read_event_;
+    BOOL ok = ::ReadFile(pipe_, buf, static_cast<DWORD>(len), &got, &ov);
     if (!ok && ::GetLastError() == ERROR_IO_PENDING) {
-      ok = ::GetOverlappedResult(pipe, &ov, &got, TRUE);
+      ok = ::GetOverlappedResult(pipe_, &ov, &got, TRUE);
     }
-    ::CloseHandle(ov.hEvent);
     if (!ok || got == 0) {
       Log(ErrorWithCode("broker ReadFile", ::GetLastError()));
-      return false;
+      return 0;
     }
-    p += got;
-    len -= got;
+    return got;
   }
-  return true;
-}
 
-bool WriteFully(HANDLE pipe, const void* buf, DWORD len) {
-  const BYTE* p = static_cast<const BYTE*>(buf);
-  while (len > 0) {
-    DWORD wrote = 0;
-    OVERLAPPED ov{};
-    ov.hEvent = ::CreateEventW(nullptr, TRUE, FALSE, nullptr);
-    if (ov.hEvent == nullptr) return false;
-    BOOL ok = ::WriteFile(pipe, p, len, &wrote, &ov);
-    if (!ok && ::GetLastError() == ERROR_IO_PENDING) {
-      ok = ::GetOverlappedResult(pipe, &ov, &wrote, TRUE);
+  bool Write(const uint8_t* data, size_t len) override {
+    if (write_event_ == nullptr) return false;
+    while (len > 0) {
+      DWORD wrote = 0;
+      OVERLAPPED ov{};
+      ov.hEvent = write_event_;
+      BOOL ok =
+          ::WriteFile(pipe_, data, static_cast<DWORD>(len), &wrote, &ov);
+      if (!ok && ::GetLastError() == ERROR_IO_PENDING) {
+        ok = ::GetOverlappedResult(pipe_, &ov, &wrote, TRUE);
+      }
+      if (!ok || wrote == 0) return false;
+      data += wrote;
+      len -= wrote;
     }
-    ::CloseHandle(ov.hEvent);
-    if (!ok || wrote == 0) return false;
-    p += wrote;
-    len -= wrote;
+    return true;
   }
-  return true;
-}
 
-bool ReadFrame(HANDLE pipe, uint32_t* op, uint32_t* seq, uint8_t* flags,
-               std::vector<uint8_t>* payload) {
-  uint32_t total = 0;
-  if (!ReadFully(pipe, &total, sizeof(total))) return false;
-  if (total < 9 || total > ipc_ns::kMaxFrameBytes) return false;
-  std::vector<uint8_t> body(total);
-  if (!ReadFully(pipe, body.data(), total)) return false;
-  ipc_ns::Reader r(body.data(), body.size());
-  *op = r.U32();
-  *seq = r.U32();
-  *flags = r.U8();
-  payload->assign(body.begin() + 9, body.end());
-  return true;
-}
+ private:
+  HANDLE pipe_;
+  HANDLE read_event_;
+  HANDLE write_event_;
+};
 
-bool WriteResponse(HANDLE pipe, uint32_t seq,
-                   const std::vector<uint8_t>& payload, uint8_t flags = 0) {
-  std::vector<uint8_t> frame =
-      ipc_ns::BuildFrame(0 /* op unused on resp */, seq, flags, payload);
-  // Op field on resp is ignored by the client; use 0 to be explicit.
-  return WriteFully(pipe, frame.data(), static_cast<DWORD>(frame.size()));
+ipc_ns::StatusRecord ToRecord(const TunnelStatusSnapshot& s) {
+  return {s.name, s.state, s.rx, s.tx, s.handshake_ms};
 }
 
-std::vector<uint8_t> Ok() {
-  ipc_ns::Writer w;
-  w.U8(ipc_ns::kStatusOk);
-  return w.Take();
-}
+}  // namespace
 
-std::vector<uint8_t> Err(const std::string& msg) {
-  ipc_ns::Writer w;
-  w.U8(ipc_ns::kStatusError);
-  w.Str(msg);
-  return w.Take();
-}
+// Adapts the SCM-backed TunnelManager to the portable dispatcher.
+class Broker::ManagerService : public ipc_ns::TunnelService {
+ public:
+  explicit ManagerService(TunnelManager* manager) : manager_(manager) {}
 
-std::vector<uint8_t> EncodeStatus(const TunnelStatusSnapshot& s) {
-  ipc_ns::Writer w;
-  w.U8(ipc_ns::kStatusOk);
-  w.Str(s.name);
-  w.U8(s.state);
-  w.I64(s.rx);
-  w.I64(s.tx);
-  w.I64(s.handshake_ms);
-  return w.Take();
-}
+  void Start(const std::string& name, const std::string& config) override {
+    manager_->Start(name, config);
+  }
+  void Stop(const std::string& name) override { manager_->Stop(name); }
+  ipc_ns::StatusRecord Status(const std::string& name) override {
+    return ToRecord(manager_->Status(name));
+  }
+  std::vector<std::string> TunnelNames() override {
+    return manager_->TunnelNames();
+  }
+  ipc_ns::BackendRecord Backend() override {
+    BackendInfoSnapshot b = manager_->Backend();
+    return {b.kind, b.detail};
+  }
+  void SetStatusCallback(StatusCallback cb) override {
+    if (!cb) {
+      manager_->SetStatusCallback({});
+      return;
+    }
+    manager_->SetStatusCallback(
+        [cb](const std::vector<TunnelStatusSnapshot>& batch) {
+          std::vector<ipc_ns::StatusRecord> tick;
+          tick.reserve(batch.size());
+          for (const auto& s : batch) tick.push_back(ToRecord(s));
+          cb(tick);
+        });
+  }
 
-}  // namespace
+ private:
+  TunnelManager* manager_;
+};
 
 std::wstring BrokerPipeName(DWORD session_id) {
   wchar_t buf[128];
@@ -122,128 +129,17 @@ Broker::Broker(std::wstring helper_path, DWORD client_session_id)
     : helper_path_(std::move(helper_path)),
       client_session_id_(client_session_id) {
   manager_ = std::make_unique<TunnelManager>(helper_path_);
+  service_ = std::make_unique<ManagerService>(manager_.get());
+  dispatcher_ = std::make_unique<ipc_ns::Dispatcher>(service_.get());
 }
 
+// Members are declared manager_, service_, dispatcher_ so they are destroyed
+// in the reverse order: the dispatcher detaches from the poller first.
 Broker::~Broker() = default;
 
-void Broker::EmitStatus(HANDLE pipe, const TunnelStatusSnapshot& s) {
-  auto payload = EncodeStatus(s);
-  std::vector<uint8_t> frame = ipc_ns::BuildFrame(
-      ipc_ns::kOpEventStatus, 0 /* seq=0 -> event */, ipc_ns::kFlagEvent,
-      payload);
-  // Best-effort: ignore failures (client disconnected; HandleClient's read
-  // loop will see it next).
-  WriteFully(pipe, frame.data(), static_cast<DWORD>(frame.size()));
-}
-
 void Broker::HandleClient(HANDLE pipe) {
-  // Status events are emitted from the TunnelManager's poller thread; they
-  // race with our own response writes, so serialize all writes to this pipe.
-  std::mutex pipe_write_mu;
-  manager_->SetStatusCallback(
-      [this, pipe, &pipe_write_mu](const TunnelStatusSnapshot& s) {
-        std::lock_guard<std::mutex> lock(pipe_write_mu);
-        EmitStatus(pipe, s);
-      });
-
-  for (;;) {
-    uint32_t op = 0, seq = 0;
-    uint8_t flags = 0;
-    std::vector<uint8_t> payload;
-    if (!ReadFrame(pipe, &op, &seq, &flags, &payload)) {
-      break;
-    }
-
-    std::vector<uint8_t> resp;
-    try {
-      ipc_ns::Reader r(payload.data(), payload.size());
-      switch (op) {
-        case ipc_ns::kOpHello: {
-          uint32_t client_v = r.U32();
-          if (client_v != ipc_ns::kProtocolVersion) {
-            resp = Err("protocol version mismatch");
-            break;
-          }
-          ipc_ns::Writer w;
-          w.U8(ipc_ns::kStatusOk);
-          w.U32(ipc_ns::kProtocolVersion);
-          resp = w.Take();
-          break;
-        }
-        case ipc_ns::kOpStart: {
-          std::string name = r.Str();
-          std::string config = r.Str();
-          if (!IsValidTunnelName(name)) {
-            resp = Err("invalid tunnel name");
-            break;
-          }
-          if (config.size() > ipc_ns::kMaxConfigBytes) {
-            resp = Err("config too large");
-            break;
-          }
-          manager_->Start(name, config);
-          resp = Ok();
-          break;
-        }
-        case ipc_ns::kOpStop: {
-          std::string name = r.Str();
-          if (!IsValidTunnelName(name)) {
-            resp = Err("invalid tunnel name");
-            break;
-          }
-          manager_->Stop(name);
-          resp = Ok();
-          break;
-        }
-        case ipc_ns::kOpStatus: {
-          std::string name = r.Str();
-          if (!IsValidTunnelName(name)) {
-            resp = Err("invalid tunnel name");
-            break;
-          }
-          TunnelStatusSnapshot s = manager_->Status(name);
-          resp = EncodeStatus(s);
-          break;
-        }
-        case ipc_ns::kOpTunnelNames: {
-          ipc_ns::Writer w;
-          w.U8(ipc_ns::kStatusOk);
-          auto names = manager_->TunnelNames();
-          w.U32(static_cast<uint32_t>(names.size()));
-          for (const auto& n : names) w.Str(n);
-          resp = w.Take();
-          break;
-        }
-        case ipc_ns::kOpBackend: {
-          ipc_ns::Writer w;
-          w.U8(ipc_ns::kStatusOk);
-          BackendInfoSnapshot b = manager_->Backend();
-          w.U8(b.kind);
-          w.Str(b.detail);
-          resp = w.Take();
-          break;
-        }
-        case ipc_ns::kOpSubscribe: {
-          resp = Ok();
-          break;
-        }
-        default:
-          resp = Err("unknown op");
-          break;
-      }
-    } catch (const std::exception& e) {
-      resp = Err(e.what() ? e.what() : "");
-    } catch (...) {
-      resp = Err("unknown error");
-    }
-
-    std::lock_guard<std::mutex> lock(pipe_write_mu);
-    if (!WriteResponse(pipe, seq, resp)) {
-      break;
-    }
-  }
-
-  manager_->SetStatusCallback({});
+  PipeTransport transport(pipe);
+  dispatcher_->Serve(&transport);
   ::FlushFileBuffers(pipe);
   ::DisconnectNamedPipe(pipe);
 }
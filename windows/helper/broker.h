@@ -7,12 +7,14 @@
 #include <memory>
 #include <string>
 
+#include "../../cpp/broker_dispatcher.h"
 #include "tunnel_manager.h"
 
 namespace flutter_wireguard {
 
-// Listens on a named pipe (per-user-DACL'd) and dispatches IPC frames to a
-// TunnelManager. Single-client; the plugin reconnects if the pipe closes.
+// Listens on a named pipe (per-user-DACL'd) and hands the connection to the
+// portable ipc::Dispatcher, backed by a TunnelManager. Single-client; the
+// plugin reconnects if the pipe closes.
 class Broker {
  public:
   Broker(std::wstring helper_path, DWORD client_session_id);
@@ -25,12 +27,15 @@ class Broker {
   int Run();
 
  private:
+  class ManagerService;
+
   void HandleClient(HANDLE pipe);
-  void EmitStatus(HANDLE pipe, const TunnelStatusSnapshot& s);
 
   std::wstring helper_path_;
   DWORD client_session_id_;
   std::unique_ptr<TunnelManager> manager_;
+  std::unique_ptr<ManagerService> service_;
+  std::unique_ptr<ipc::Dispatcher> dispatcher_;
 };
 
 // Computes the broker pipe name for `session_id`.
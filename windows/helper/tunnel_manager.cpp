@@ -8,6 +8,7 @@
 #include <sstream>
 #include <stdexcept>
 
+#include "../../cpp/phase_timer.h"
 #include "../utils.h"
 #include "config_writer.h"
 #include "wireguard_dll.h"
@@ -158,18 +159,24 @@ void TunnelManager::EnsurePollerStarted() {
 void TunnelManager::Start(const std::string& name, const std::string& config) {
   std::wstring wname = Utf8ToWide(name);
   std::wstring service_name = ServiceName(name);
+  PhaseTimer total("start", "total");
 
   // 1) Persist encrypted config + plaintext for tunnel.dll.
+  PhaseTimer write_config("start", "write_config");
   std::wstring dpapi_path = SecureConfigStore::WriteEncrypted(wname, config);
   std::wstring conf_path = SecureConfigStore::WritePlaintext(wname, config);
+  write_config.Stop();
 
   // 2) (Re)create the service.
+  PhaseTimer delete_service("start", "delete_service");
   DeleteServiceIfExists(service_name);
+  delete_service.Stop();
 
   std::wostringstream cmd;
   cmd << L'"' << helper_path_ << L"\" --tunnel-service \"" << conf_path << L'"';
   std::wstring cmdline = cmd.str();
 
+  PhaseTimer create_service("start", "create_service");
   ScopedScm scm(SC_MANAGER_CREATE_SERVICE | SC_MANAGER_CONNECT);
   ScopedService svc(::CreateServiceW(
       scm.get(), service_name.c_str(), service_name.c_str(),
@@ -191,7 +198,9 @@ void TunnelManager::Start(const std::string& name, const std::string& config) {
   desc_buf.push_back(L'\0');
   SERVICE_DESCRIPTION desc{desc_buf.data()};
   ::ChangeServiceConfig2W(svc.get(), SERVICE_CONFIG_DESCRIPTION, &desc);
+  create_service.Stop();
 
+  PhaseTimer start_service("start", "start_service");
   if (!::StartServiceW(svc.get(), 0, nullptr)) {
     DWORD err = ::GetLastError();
     if (err != ERROR_SERVICE_ALREADY_RUNNING) {
@@ -200,7 +209,10 @@ void TunnelManager::Start(const std::string& name, const std::string& config) {
       throw std::runtime_error(ErrorWithCode("StartService", err));
     }
   }
+  start_service.Stop();
 
+  // Service start to RUNNING: tunnel.dll loading, driver install, DNS.
+  PhaseTimer start_watch("start", "start_watch");
   auto deadline = std::chrono::steady_clock::now() +
                   std::chrono::milliseconds(kStartWatchMs);
   while (std::chrono::steady_clock::now() < deadline) {
@@ -224,6 +236,7 @@ void TunnelManager::Start(const std::string& name, const std::string& config) {
   // Past kStartWatchMs the service is still START_PENDING (driver install,
   // DNS apply, etc). That's OK — the poller will surface RUNNING/STOPPED
   // when it happens. Don't keep the broker thread blocked.
+  start_watch.Stop();
 
   std::lock_guard<std::mutex> lock(mu_);
   known_tunnels_.insert(name);
@@ -232,8 +245,13 @@ void TunnelManager::Start(const std::string& name, const std::string& config) {
 
 void TunnelManager::Stop(const std::string& name) {
   std::wstring service_name = ServiceName(name);
+  PhaseTimer total("stop", "total");
+  PhaseTimer delete_service("stop", "delete_service");
   DeleteServiceIfExists(service_name);
+  delete_service.Stop();
+  PhaseTimer erase_config("stop", "erase_config");
   SecureConfigStore::Erase(Utf8ToWide(name));
+  erase_config.Stop();
   std::lock_guard<std::mutex> lock(mu_);
   // Keep it in known_tunnels_ so subsequent Status() succeeds and reports DOWN.
   known_tunnels_.insert(name);
@@ -297,13 +315,15 @@ void TunnelManager::PollLoop() {
       cb = callback_;
     }
     if (cb) {
+      std::vector<TunnelStatusSnapshot> batch;
       for (const auto& n : names) {
         TunnelStatusSnapshot s = QueryStatusUnlocked(n);
         bool changed = last_state[n] != s.state;
         last_state[n] = s.state;
         // Always emit while UP for stats ticks; otherwise only on change.
-        if (changed || s.state == 2) cb(s);
+        if (changed || s.state == 2) batch.push_back(std::move(s));
       }
+      if (!batch.empty()) cb(batch);
     }
     for (int i = 0; i < 10 && !stop_.load(); ++i) ::Sleep(100);
   }
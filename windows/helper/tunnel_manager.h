@@ -54,9 +54,11 @@ class TunnelManager {
   std::vector<std::string> TunnelNames() const;
   BackendInfoSnapshot Backend() const;
 
-  // Sets a callback invoked from a background thread whenever a known tunnel
-  // changes state or every ~1 s while UP (rx/tx/handshake refresh).
-  using StatusCallback = std::function<void(const TunnelStatusSnapshot&)>;
+  // Sets a callback invoked from a background thread once per ~1 s poll
+  // tick with every tunnel that changed state or is UP (rx/tx/handshake
+  // refresh). Never invoked with an empty batch.
+  using StatusCallback =
+      std::function<void(const std::vector<TunnelStatusSnapshot>&)>;
   void SetStatusCallback(StatusCallback cb);
 
   // Stops the background poller. Idempotent.
@@ -387,6 +387,830 @@ size_t PigeonInternalDeepHash(const BackendInfo& v) {
   return v.Hash();
 }
 
+// TunnelSpec
+
+TunnelSpec::TunnelSpec(
+  const std::string& name,
+  const std::string& config)
+ : name_(name),
+    config_(config) {}
+
+const std::string& TunnelSpec::name() const {
+  return name_;
+}
+
+void TunnelSpec::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+const std::string& TunnelSpec::config() const {
+  return config_;
+}
+
+void TunnelSpec::set_config(std::string_view value_arg) {
+  config_ = value_arg;
+}
+
+
+EncodableList TunnelSpec::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(config_));
+  return list;
+}
+
+TunnelSpec TunnelSpec::FromEncodableList(const EncodableList& list) {
+  TunnelSpec decoded(
+    std::get<std::string>(list[0]),
+    std::get<std::string>(list[1]));
+  return decoded;
+}
+
+bool TunnelSpec::operator==(const TunnelSpec& other) const {
+  return PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(config_, other.config_);
+}
+
+bool TunnelSpec::operator!=(const TunnelSpec& other) const {
+  return !(*this == other);
+}
+
+size_t TunnelSpec::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(config_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const TunnelSpec& v) {
+  return v.Hash();
+}
+
+// TunnelResult
+
+TunnelResult::TunnelResult(
+  const std::string& name,
+  bool ok)
+ : name_(name),
+    ok_(ok) {}
+
+TunnelResult::TunnelResult(
+  const std::string& name,
+  bool ok,
+  const std::string* error)
+ : name_(name),
+    ok_(ok),
+    error_(error ? std::optional<std::string>(*error) : std::nullopt) {}
+
+const std::string& TunnelResult::name() const {
+  return name_;
+}
+
+void TunnelResult::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+bool TunnelResult::ok() const {
+  return ok_;
+}
+
+void TunnelResult::set_ok(bool value_arg) {
+  ok_ = value_arg;
+}
+
+
+const std::string* TunnelResult::error() const {
+  return error_ ? &(*error_) : nullptr;
+}
+
+void TunnelResult::set_error(const std::string_view* value_arg) {
+  error_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void TunnelResult::set_error(std::string_view value_arg) {
+  error_ = value_arg;
+}
+
+
+EncodableList TunnelResult::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(ok_));
+  list.push_back(error_ ? EncodableValue(*error_) : EncodableValue());
+  return list;
+}
+
+TunnelResult TunnelResult::FromEncodableList(const EncodableList& list) {
+  TunnelResult decoded(
+    std::get<std::string>(list[0]),
+    std::get<bool>(list[1]));
+  auto& encodable_error = list[2];
+  if (!encodable_error.IsNull()) {
+    decoded.set_error(std::get<std::string>(encodable_error));
+  }
+  return decoded;
+}
+
+bool TunnelResult::operator==(const TunnelResult& other) const {
+  return PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(ok_, other.ok_) && PigeonInternalDeepEquals(error_, other.error_);
+}
+
+bool TunnelResult::operator!=(const TunnelResult& other) const {
+  return !(*this == other);
+}
+
+size_t TunnelResult::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(ok_);
+  result = result * 31 + PigeonInternalDeepHash(error_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const TunnelResult& v) {
+  return v.Hash();
+}
+
+// PhaseStats
+
+PhaseStats::PhaseStats(
+  const std::string& op,
+  const std::string& phase,
+  int64_t count,
+  double p50_ms,
+  double p95_ms,
+  double p99_ms)
+ : op_(op),
+    phase_(phase),
+    count_(count),
+    p50_ms_(p50_ms),
+    p95_ms_(p95_ms),
+    p99_ms_(p99_ms) {}
+
+const std::string& PhaseStats::op() const {
+  return op_;
+}
+
+void PhaseStats::set_op(std::string_view value_arg) {
+  op_ = value_arg;
+}
+
+
+const std::string& PhaseStats::phase() const {
+  return phase_;
+}
+
+void PhaseStats::set_phase(std::string_view value_arg) {
+  phase_ = value_arg;
+}
+
+
+int64_t PhaseStats::count() const {
+  return count_;
+}
+
+void PhaseStats::set_count(int64_t value_arg) {
+  count_ = value_arg;
+}
+
+
+double PhaseStats::p50_ms() const {
+  return p50_ms_;
+}
+
+void PhaseStats::set_p50_ms(double value_arg) {
+  p50_ms_ = value_arg;
+}
+
+
+double PhaseStats::p95_ms() const {
+  return p95_ms_;
+}
+
+void PhaseStats::set_p95_ms(double value_arg) {
+  p95_ms_ = value_arg;
+}
+
+
+double PhaseStats::p99_ms() const {
+  return p99_ms_;
+}
+
+void PhaseStats::set_p99_ms(double value_arg) {
+  p99_ms_ = value_arg;
+}
+
+
+EncodableList PhaseStats::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(6);
+  list.push_back(EncodableValue(op_));
+  list.push_back(EncodableValue(phase_));
+  list.push_back(EncodableValue(count_));
+  list.push_back(EncodableValue(p50_ms_));
+  list.push_back(EncodableValue(p95_ms_));
+  list.push_back(EncodableValue(p99_ms_));
+  return list;
+}
+
+PhaseStats PhaseStats::FromEncodableList(const EncodableList& list) {
+  PhaseStats decoded(
+    std::get<std::string>(list[0]),
+    std::get<std::string>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<double>(list[3]),
+    std::get<double>(list[4]),
+    std::get<double>(list[5]));
+  return decoded;
+}
+
+bool PhaseStats::operator==(const PhaseStats& other) const {
+  return PigeonInternalDeepEquals(op_, other.op_) && PigeonInternalDeepEquals(phase_, other.phase_) && PigeonInternalDeepEquals(count_, other.count_) && PigeonInternalDeepEquals(p50_ms_, other.p50_ms_) && PigeonInternalDeepEquals(p95_ms_, other.p95_ms_) && PigeonInternalDeepEquals(p99_ms_, other.p99_ms_);
+}
+
+bool PhaseStats::operator!=(const PhaseStats& other) const {
+  return !(*this == other);
+}
+
+size_t PhaseStats::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(op_);
+  result = result * 31 + PigeonInternalDeepHash(phase_);
+  result = result * 31 + PigeonInternalDeepHash(count_);
+  result = result * 31 + PigeonInternalDeepHash(p50_ms_);
+  result = result * 31 + PigeonInternalDeepHash(p95_ms_);
+  result = result * 31 + PigeonInternalDeepHash(p99_ms_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const PhaseStats& v) {
+  return v.Hash();
+}
+
+// TunnelHealth
+
+TunnelHealth::TunnelHealth(
+  const std::string& name,
+  const std::string& public_key,
+  const TunnelHealthState& state,
+  int64_t last_handshake)
+ : name_(name),
+    public_key_(public_key),
+    state_(state),
+    last_handshake_(last_handshake) {}
+
+const std::string& TunnelHealth::name() const {
+  return name_;
+}
+
+void TunnelHealth::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+const std::string& TunnelHealth::public_key() const {
+  return public_key_;
+}
+
+void TunnelHealth::set_public_key(std::string_view value_arg) {
+  public_key_ = value_arg;
+}
+
+
+const TunnelHealthState& TunnelHealth::state() const {
+  return state_;
+}
+
+void TunnelHealth::set_state(const TunnelHealthState& value_arg) {
+  state_ = value_arg;
+}
+
+
+int64_t TunnelHealth::last_handshake() const {
+  return last_handshake_;
+}
+
+void TunnelHealth::set_last_handshake(int64_t value_arg) {
+  last_handshake_ = value_arg;
+}
+
+
+EncodableList TunnelHealth::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(4);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(public_key_));
+  list.push_back(CustomEncodableValue(state_));
+  list.push_back(EncodableValue(last_handshake_));
+  return list;
+}
+
+TunnelHealth TunnelHealth::FromEncodableList(const EncodableList& list) {
+  TunnelHealth decoded(
+    std::get<std::string>(list[0]),
+    std::get<std::string>(list[1]),
+    std::any_cast<const TunnelHealthState&>(std::get<CustomEncodableValue>(list[2])),
+    std::get<int64_t>(list[3]));
+  return decoded;
+}
+
+bool TunnelHealth::operator==(const TunnelHealth& other) const {
+  return PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(public_key_, other.public_key_) && PigeonInternalDeepEquals(state_, other.state_) && PigeonInternalDeepEquals(last_handshake_, other.last_handshake_);
+}
+
+bool TunnelHealth::operator!=(const TunnelHealth& other) const {
+  return !(*this == other);
+}
+
+size_t TunnelHealth::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(public_key_);
+  result = result * 31 + PigeonInternalDeepHash(state_);
+  result = result * 31 + PigeonInternalDeepHash(last_handshake_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const TunnelHealth& v) {
+  return v.Hash();
+}
+
+// KeyPairData
+
+KeyPairData::KeyPairData(
+  const std::string& private_key,
+  const std::string& public_key)
+ : private_key_(private_key),
+    public_key_(public_key) {}
+
+const std::string& KeyPairData::private_key() const {
+  return private_key_;
+}
+
+void KeyPairData::set_private_key(std::string_view value_arg) {
+  private_key_ = value_arg;
+}
+
+
+const std::string& KeyPairData::public_key() const {
+  return public_key_;
+}
+
+void KeyPairData::set_public_key(std::string_view value_arg) {
+  public_key_ = value_arg;
+}
+
+
+EncodableList KeyPairData::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(2);
+  list.push_back(EncodableValue(private_key_));
+  list.push_back(EncodableValue(public_key_));
+  return list;
+}
+
+KeyPairData KeyPairData::FromEncodableList(const EncodableList& list) {
+  KeyPairData decoded(
+    std::get<std::string>(list[0]),
+    std::get<std::string>(list[1]));
+  return decoded;
+}
+
+bool KeyPairData::operator==(const KeyPairData& other) const {
+  return PigeonInternalDeepEquals(private_key_, other.private_key_) && PigeonInternalDeepEquals(public_key_, other.public_key_);
+}
+
+bool KeyPairData::operator!=(const KeyPairData& other) const {
+  return !(*this == other);
+}
+
+size_t KeyPairData::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(private_key_);
+  result = result * 31 + PigeonInternalDeepHash(public_key_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const KeyPairData& v) {
+  return v.Hash();
+}
+
+// PeerStatus
+
+PeerStatus::PeerStatus(
+  const std::string& public_key,
+  int64_t rx,
+  int64_t tx,
+  int64_t last_handshake,
+  int64_t persistent_keepalive)
+ : public_key_(public_key),
+    rx_(rx),
+    tx_(tx),
+    last_handshake_(last_handshake),
+    persistent_keepalive_(persistent_keepalive) {}
+
+PeerStatus::PeerStatus(
+  const std::string& public_key,
+  const std::string* endpoint,
+  int64_t rx,
+  int64_t tx,
+  int64_t last_handshake,
+  int64_t persistent_keepalive)
+ : public_key_(public_key),
+    endpoint_(endpoint ? std::optional<std::string>(*endpoint) : std::nullopt),
+    rx_(rx),
+    tx_(tx),
+    last_handshake_(last_handshake),
+    persistent_keepalive_(persistent_keepalive) {}
+
+const std::string& PeerStatus::public_key() const {
+  return public_key_;
+}
+
+void PeerStatus::set_public_key(std::string_view value_arg) {
+  public_key_ = value_arg;
+}
+
+
+const std::string* PeerStatus::endpoint() const {
+  return endpoint_ ? &(*endpoint_) : nullptr;
+}
+
+void PeerStatus::set_endpoint(const std::string_view* value_arg) {
+  endpoint_ = value_arg ? std::optional<std::string>(*value_arg) : std::nullopt;
+}
+
+void PeerStatus::set_endpoint(std::string_view value_arg) {
+  endpoint_ = value_arg;
+}
+
+
+int64_t PeerStatus::rx() const {
+  return rx_;
+}
+
+void PeerStatus::set_rx(int64_t value_arg) {
+  rx_ = value_arg;
+}
+
+
+int64_t PeerStatus::tx() const {
+  return tx_;
+}
+
+void PeerStatus::set_tx(int64_t value_arg) {
+  tx_ = value_arg;
+}
+
+
+int64_t PeerStatus::last_handshake() const {
+  return last_handshake_;
+}
+
+void PeerStatus::set_last_handshake(int64_t value_arg) {
+  last_handshake_ = value_arg;
+}
+
+
+int64_t PeerStatus::persistent_keepalive() const {
+  return persistent_keepalive_;
+}
+
+void PeerStatus::set_persistent_keepalive(int64_t value_arg) {
+  persistent_keepalive_ = value_arg;
+}
+
+
+EncodableList PeerStatus::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(6);
+  list.push_back(EncodableValue(public_key_));
+  list.push_back(endpoint_ ? EncodableValue(*endpoint_) : EncodableValue());
+  list.push_back(EncodableValue(rx_));
+  list.push_back(EncodableValue(tx_));
+  list.push_back(EncodableValue(last_handshake_));
+  list.push_back(EncodableValue(persistent_keepalive_));
+  return list;
+}
+
+PeerStatus PeerStatus::FromEncodableList(const EncodableList& list) {
+  PeerStatus decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<int64_t>(list[4]),
+    std::get<int64_t>(list[5]));
+  auto& encodable_endpoint = list[1];
+  if (!encodable_endpoint.IsNull()) {
+    decoded.set_endpoint(std::get<std::string>(encodable_endpoint));
+  }
+  return decoded;
+}
+
+bool PeerStatus::operator==(const PeerStatus& other) const {
+  return PigeonInternalDeepEquals(public_key_, other.public_key_) && PigeonInternalDeepEquals(endpoint_, other.endpoint_) && PigeonInternalDeepEquals(rx_, other.rx_) && PigeonInternalDeepEquals(tx_, other.tx_) && PigeonInternalDeepEquals(last_handshake_, other.last_handshake_) && PigeonInternalDeepEquals(persistent_keepalive_, other.persistent_keepalive_);
+}
+
+bool PeerStatus::operator!=(const PeerStatus& other) const {
+  return !(*this == other);
+}
+
+size_t PeerStatus::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(public_key_);
+  result = result * 31 + PigeonInternalDeepHash(endpoint_);
+  result = result * 31 + PigeonInternalDeepHash(rx_);
+  result = result * 31 + PigeonInternalDeepHash(tx_);
+  result = result * 31 + PigeonInternalDeepHash(last_handshake_);
+  result = result * 31 + PigeonInternalDeepHash(persistent_keepalive_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const PeerStatus& v) {
+  return v.Hash();
+}
+
+// PeerUsage
+
+PeerUsage::PeerUsage(
+  const std::string& public_key,
+  int64_t rx,
+  int64_t tx)
+ : public_key_(public_key),
+    rx_(rx),
+    tx_(tx) {}
+
+const std::string& PeerUsage::public_key() const {
+  return public_key_;
+}
+
+void PeerUsage::set_public_key(std::string_view value_arg) {
+  public_key_ = value_arg;
+}
+
+
+int64_t PeerUsage::rx() const {
+  return rx_;
+}
+
+void PeerUsage::set_rx(int64_t value_arg) {
+  rx_ = value_arg;
+}
+
+
+int64_t PeerUsage::tx() const {
+  return tx_;
+}
+
+void PeerUsage::set_tx(int64_t value_arg) {
+  tx_ = value_arg;
+}
+
+
+EncodableList PeerUsage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(3);
+  list.push_back(EncodableValue(public_key_));
+  list.push_back(EncodableValue(rx_));
+  list.push_back(EncodableValue(tx_));
+  return list;
+}
+
+PeerUsage PeerUsage::FromEncodableList(const EncodableList& list) {
+  PeerUsage decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]));
+  return decoded;
+}
+
+bool PeerUsage::operator==(const PeerUsage& other) const {
+  return PigeonInternalDeepEquals(public_key_, other.public_key_) && PigeonInternalDeepEquals(rx_, other.rx_) && PigeonInternalDeepEquals(tx_, other.tx_);
+}
+
+bool PeerUsage::operator!=(const PeerUsage& other) const {
+  return !(*this == other);
+}
+
+size_t PeerUsage::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(public_key_);
+  result = result * 31 + PigeonInternalDeepHash(rx_);
+  result = result * 31 + PigeonInternalDeepHash(tx_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const PeerUsage& v) {
+  return v.Hash();
+}
+
+// TunnelUsage
+
+TunnelUsage::TunnelUsage(
+  const std::string& name,
+  int64_t since,
+  int64_t rx,
+  int64_t tx,
+  const ::flutter::EncodableList& peers)
+ : name_(name),
+    since_(since),
+    rx_(rx),
+    tx_(tx),
+    peers_(peers) {}
+
+const std::string& TunnelUsage::name() const {
+  return name_;
+}
+
+void TunnelUsage::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+int64_t TunnelUsage::since() const {
+  return since_;
+}
+
+void TunnelUsage::set_since(int64_t value_arg) {
+  since_ = value_arg;
+}
+
+
+int64_t TunnelUsage::rx() const {
+  return rx_;
+}
+
+void TunnelUsage::set_rx(int64_t value_arg) {
+  rx_ = value_arg;
+}
+
+
+int64_t TunnelUsage::tx() const {
+  return tx_;
+}
+
+void TunnelUsage::set_tx(int64_t value_arg) {
+  tx_ = value_arg;
+}
+
+
+const ::flutter::EncodableList& TunnelUsage::peers() const {
+  return peers_;
+}
+
+void TunnelUsage::set_peers(const ::flutter::EncodableList& value_arg) {
+  peers_ = value_arg;
+}
+
+
+EncodableList TunnelUsage::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(5);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(since_));
+  list.push_back(EncodableValue(rx_));
+  list.push_back(EncodableValue(tx_));
+  list.push_back(EncodableValue(peers_));
+  return list;
+}
+
+TunnelUsage TunnelUsage::FromEncodableList(const EncodableList& list) {
+  TunnelUsage decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<EncodableList>(list[4]));
+  return decoded;
+}
+
+bool TunnelUsage::operator==(const TunnelUsage& other) const {
+  return PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(since_, other.since_) && PigeonInternalDeepEquals(rx_, other.rx_) && PigeonInternalDeepEquals(tx_, other.tx_) && PigeonInternalDeepEquals(peers_, other.peers_);
+}
+
+bool TunnelUsage::operator!=(const TunnelUsage& other) const {
+  return !(*this == other);
+}
+
+size_t TunnelUsage::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(since_);
+  result = result * 31 + PigeonInternalDeepHash(rx_);
+  result = result * 31 + PigeonInternalDeepHash(tx_);
+  result = result * 31 + PigeonInternalDeepHash(peers_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const TunnelUsage& v) {
+  return v.Hash();
+}
+
+// UsageQuotaExceeded
+
+UsageQuotaExceeded::UsageQuotaExceeded(
+  const std::string& name,
+  int64_t limit,
+  int64_t used,
+  int64_t since,
+  bool stopped)
+ : name_(name),
+    limit_(limit),
+    used_(used),
+    since_(since),
+    stopped_(stopped) {}
+
+const std::string& UsageQuotaExceeded::name() const {
+  return name_;
+}
+
+void UsageQuotaExceeded::set_name(std::string_view value_arg) {
+  name_ = value_arg;
+}
+
+
+int64_t UsageQuotaExceeded::limit() const {
+  return limit_;
+}
+
+void UsageQuotaExceeded::set_limit(int64_t value_arg) {
+  limit_ = value_arg;
+}
+
+
+int64_t UsageQuotaExceeded::used() const {
+  return used_;
+}
+
+void UsageQuotaExceeded::set_used(int64_t value_arg) {
+  used_ = value_arg;
+}
+
+
+int64_t UsageQuotaExceeded::since() const {
+  return since_;
+}
+
+void UsageQuotaExceeded::set_since(int64_t value_arg) {
+  since_ = value_arg;
+}
+
+
+bool UsageQuotaExceeded::stopped() const {
+  return stopped_;
+}
+
+void UsageQuotaExceeded::set_stopped(bool value_arg) {
+  stopped_ = value_arg;
+}
+
+
+EncodableList UsageQuotaExceeded::ToEncodableList() const {
+  EncodableList list;
+  list.reserve(5);
+  list.push_back(EncodableValue(name_));
+  list.push_back(EncodableValue(limit_));
+  list.push_back(EncodableValue(used_));
+  list.push_back(EncodableValue(since_));
+  list.push_back(EncodableValue(stopped_));
+  return list;
+}
+
+UsageQuotaExceeded UsageQuotaExceeded::FromEncodableList(const EncodableList& list) {
+  UsageQuotaExceeded decoded(
+    std::get<std::string>(list[0]),
+    std::get<int64_t>(list[1]),
+    std::get<int64_t>(list[2]),
+    std::get<int64_t>(list[3]),
+    std::get<bool>(list[4]));
+  return decoded;
+}
+
+bool UsageQuotaExceeded::operator==(const UsageQuotaExceeded& other) const {
+  return PigeonInternalDeepEquals(name_, other.name_) && PigeonInternalDeepEquals(limit_, other.limit_) && PigeonInternalDeepEquals(used_, other.used_) && PigeonInternalDeepEquals(since_, other.since_) && PigeonInternalDeepEquals(stopped_, other.stopped_);
+}
+
+bool UsageQuotaExceeded::operator!=(const UsageQuotaExceeded& other) const {
+  return !(*this == other);
+}
+
+size_t UsageQuotaExceeded::Hash() const {
+  size_t result = 1;
+  result = result * 31 + PigeonInternalDeepHash(name_);
+  result = result * 31 + PigeonInternalDeepHash(limit_);
+  result = result * 31 + PigeonInternalDeepHash(used_);
+  result = result * 31 + PigeonInternalDeepHash(since_);
+  result = result * 31 + PigeonInternalDeepHash(stopped_);
+  return result;
+}
+
+size_t PigeonInternalDeepHash(const UsageQuotaExceeded& v) {
+  return v.Hash();
+}
+
 
 PigeonInternalCodecSerializer::PigeonInternalCodecSerializer() {}
 
@@ -405,63 +1229,472 @@ EncodableValue PigeonInternalCodecSerializer::ReadValueOfType(
         return encodable_enum_arg.IsNull() ? EncodableValue() : CustomEncodableValue(static_cast<BackendKind>(enum_arg_value));
       }
     case 131: {
-        return CustomEncodableValue(TunnelStatus::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+        const auto& encodable_enum_arg = ReadValue(stream);
+        const int64_t enum_arg_value = encodable_enum_arg.IsNull() ? 0 : encodable_enum_arg.LongValue();
+        return encodable_enum_arg.IsNull() ? EncodableValue() : CustomEncodableValue(static_cast<TunnelHealthState>(enum_arg_value));
       }
     case 132: {
+        return CustomEncodableValue(TunnelStatus::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 133: {
         return CustomEncodableValue(BackendInfo::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
       }
+    case 134: {
+        return CustomEncodableValue(TunnelSpec::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 135: {
+        return CustomEncodableValue(TunnelResult::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 136: {
+        return CustomEncodableValue(PhaseStats::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 137: {
+        return CustomEncodableValue(TunnelHealth::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 138: {
+        return CustomEncodableValue(KeyPairData::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 139: {
+        return CustomEncodableValue(PeerStatus::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 140: {
+        return CustomEncodableValue(PeerUsage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 141: {
+        return CustomEncodableValue(TunnelUsage::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
+    case 142: {
+        return CustomEncodableValue(UsageQuotaExceeded::FromEncodableList(std::get<EncodableList>(ReadValue(stream))));
+      }
     default:
       return ::flutter::StandardCodecSerializer::ReadValueOfType(type, stream);
     }
 }
 
-void PigeonInternalCodecSerializer::WriteValue(
-  const EncodableValue& value,
-  ::flutter::ByteStreamWriter* stream) const {
-  if (const CustomEncodableValue* custom_value = std::get_if<CustomEncodableValue>(&value)) {
-    if (custom_value->type() == typeid(TunnelState)) {
-      stream->WriteByte(129);
-      WriteValue(EncodableValue(static_cast<int>(std::any_cast<TunnelState>(*custom_value))), stream);
-      return;
+void PigeonInternalCodecSerializer::WriteValue(
+  const EncodableValue& value,
+  ::flutter::ByteStreamWriter* stream) const {
+  if (const CustomEncodableValue* custom_value = std::get_if<CustomEncodableValue>(&value)) {
+    if (custom_value->type() == typeid(TunnelState)) {
+      stream->WriteByte(129);
+      WriteValue(EncodableValue(static_cast<int>(std::any_cast<TunnelState>(*custom_value))), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BackendKind)) {
+      stream->WriteByte(130);
+      WriteValue(EncodableValue(static_cast<int>(std::any_cast<BackendKind>(*custom_value))), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelHealthState)) {
+      stream->WriteByte(131);
+      WriteValue(EncodableValue(static_cast<int>(std::any_cast<TunnelHealthState>(*custom_value))), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelStatus)) {
+      stream->WriteByte(132);
+      WriteValue(EncodableValue(std::any_cast<TunnelStatus>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(BackendInfo)) {
+      stream->WriteByte(133);
+      WriteValue(EncodableValue(std::any_cast<BackendInfo>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelSpec)) {
+      stream->WriteByte(134);
+      WriteValue(EncodableValue(std::any_cast<TunnelSpec>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelResult)) {
+      stream->WriteByte(135);
+      WriteValue(EncodableValue(std::any_cast<TunnelResult>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PhaseStats)) {
+      stream->WriteByte(136);
+      WriteValue(EncodableValue(std::any_cast<PhaseStats>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelHealth)) {
+      stream->WriteByte(137);
+      WriteValue(EncodableValue(std::any_cast<TunnelHealth>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(KeyPairData)) {
+      stream->WriteByte(138);
+      WriteValue(EncodableValue(std::any_cast<KeyPairData>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PeerStatus)) {
+      stream->WriteByte(139);
+      WriteValue(EncodableValue(std::any_cast<PeerStatus>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(PeerUsage)) {
+      stream->WriteByte(140);
+      WriteValue(EncodableValue(std::any_cast<PeerUsage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(TunnelUsage)) {
+      stream->WriteByte(141);
+      WriteValue(EncodableValue(std::any_cast<TunnelUsage>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+    if (custom_value->type() == typeid(UsageQuotaExceeded)) {
+      stream->WriteByte(142);
+      WriteValue(EncodableValue(std::any_cast<UsageQuotaExceeded>(*custom_value).ToEncodableList()), stream);
+      return;
+    }
+  }
+  ::flutter::StandardCodecSerializer::WriteValue(value, stream);
+}
+
+/// The codec used by WireguardHostApi.
+const ::flutter::StandardMessageCodec& WireguardHostApi::GetCodec() {
+  return ::flutter::StandardMessageCodec::GetInstance(&PigeonInternalCodecSerializer::GetInstance());
+}
+
+// Sets up an instance of `WireguardHostApi` to handle messages through the `binary_messenger`.
+void WireguardHostApi::SetUp(
+  ::flutter::BinaryMessenger* binary_messenger,
+  WireguardHostApi* api) {
+  WireguardHostApi::SetUp(binary_messenger, api, "");
+}
+
+void WireguardHostApi::SetUp(
+  ::flutter::BinaryMessenger* binary_messenger,
+  WireguardHostApi* api,
+  const std::string& message_channel_suffix) {
+  const std::string prepended_suffix = message_channel_suffix.length() > 0 ? std::string(".") + message_channel_suffix : "";
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          const auto& encodable_config_arg = args.at(1);
+          if (encodable_config_arg.IsNull()) {
+            reply(WrapError("config_arg unexpectedly null."));
+            return;
+          }
+          const auto& config_arg = std::get<std::string>(encodable_config_arg);
+          api->Start(name_arg, config_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
     }
-    if (custom_value->type() == typeid(BackendKind)) {
-      stream->WriteByte(130);
-      WriteValue(EncodableValue(static_cast<int>(std::any_cast<BackendKind>(*custom_value))), stream);
-      return;
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          api->Stop(name_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
     }
-    if (custom_value->type() == typeid(TunnelStatus)) {
-      stream->WriteByte(131);
-      WriteValue(EncodableValue(std::any_cast<TunnelStatus>(*custom_value).ToEncodableList()), stream);
-      return;
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          api->Status(name_arg, [reply](ErrorOr<TunnelStatus>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->TunnelNames([reply](ErrorOr<EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->Backend([reply](ErrorOr<BackendInfo>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.startMany" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_specs_arg = args.at(0);
+          if (encodable_specs_arg.IsNull()) {
+            reply(WrapError("specs_arg unexpectedly null."));
+            return;
+          }
+          const auto& specs_arg = std::get<EncodableList>(encodable_specs_arg);
+          api->StartMany(specs_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stopMany" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_names_arg = args.at(0);
+          if (encodable_names_arg.IsNull()) {
+            reply(WrapError("names_arg unexpectedly null."));
+            return;
+          }
+          const auto& names_arg = std::get<EncodableList>(encodable_names_arg);
+          api->StopMany(names_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.switchTunnel" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_from_arg = args.at(0);
+          if (encodable_from_arg.IsNull()) {
+            reply(WrapError("from_arg unexpectedly null."));
+            return;
+          }
+          const auto& from_arg = std::get<std::string>(encodable_from_arg);
+          const auto& encodable_to_arg = args.at(1);
+          if (encodable_to_arg.IsNull()) {
+            reply(WrapError("to_arg unexpectedly null."));
+            return;
+          }
+          const auto& to_arg = std::get<std::string>(encodable_to_arg);
+          const auto& encodable_config_arg = args.at(2);
+          if (encodable_config_arg.IsNull()) {
+            reply(WrapError("config_arg unexpectedly null."));
+            return;
+          }
+          const auto& config_arg = std::get<std::string>(encodable_config_arg);
+          api->SwitchTunnel(from_arg, to_arg, config_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.diagnostics" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          api->Diagnostics([reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.dumpTrace" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_path_arg = args.at(0);
+          if (encodable_path_arg.IsNull()) {
+            reply(WrapError("path_arg unexpectedly null."));
+            return;
+          }
+          const auto& path_arg = std::get<std::string>(encodable_path_arg);
+          api->DumpTrace(path_arg, [reply](std::optional<FlutterError>&& output) {
+            if (output.has_value()) {
+              reply(WrapError(output.value()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue());
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
     }
-    if (custom_value->type() == typeid(BackendInfo)) {
-      stream->WriteByte(132);
-      WriteValue(EncodableValue(std::any_cast<BackendInfo>(*custom_value).ToEncodableList()), stream);
-      return;
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeer" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          const auto& encodable_ip_address_arg = args.at(1);
+          if (encodable_ip_address_arg.IsNull()) {
+            reply(WrapError("ip_address_arg unexpectedly null."));
+            return;
+          }
+          const auto& ip_address_arg = std::get<std::string>(encodable_ip_address_arg);
+          api->LookupPeer(name_arg, ip_address_arg, [reply](ErrorOr<std::optional<std::string>>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            auto output_optional = std::move(output).TakeValue();
+            if (output_optional) {
+              wrapped.push_back(EncodableValue(std::move(output_optional).value()));
+            } else {
+              wrapped.push_back(EncodableValue());
+            }
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
     }
   }
-  ::flutter::StandardCodecSerializer::WriteValue(value, stream);
-}
-
-/// The codec used by WireguardHostApi.
-const ::flutter::StandardMessageCodec& WireguardHostApi::GetCodec() {
-  return ::flutter::StandardMessageCodec::GetInstance(&PigeonInternalCodecSerializer::GetInstance());
-}
-
-// Sets up an instance of `WireguardHostApi` to handle messages through the `binary_messenger`.
-void WireguardHostApi::SetUp(
-  ::flutter::BinaryMessenger* binary_messenger,
-  WireguardHostApi* api) {
-  WireguardHostApi::SetUp(binary_messenger, api, "");
-}
-
-void WireguardHostApi::SetUp(
-  ::flutter::BinaryMessenger* binary_messenger,
-  WireguardHostApi* api,
-  const std::string& message_channel_suffix) {
-  const std::string prepended_suffix = message_channel_suffix.length() > 0 ? std::string(".") + message_channel_suffix : "";
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.start" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.lookupPeers" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
@@ -472,19 +1705,19 @@ void WireguardHostApi::SetUp(
             return;
           }
           const auto& name_arg = std::get<std::string>(encodable_name_arg);
-          const auto& encodable_config_arg = args.at(1);
-          if (encodable_config_arg.IsNull()) {
-            reply(WrapError("config_arg unexpectedly null."));
+          const auto& encodable_ip_addresses_arg = args.at(1);
+          if (encodable_ip_addresses_arg.IsNull()) {
+            reply(WrapError("ip_addresses_arg unexpectedly null."));
             return;
           }
-          const auto& config_arg = std::get<std::string>(encodable_config_arg);
-          api->Start(name_arg, config_arg, [reply](std::optional<FlutterError>&& output) {
-            if (output.has_value()) {
-              reply(WrapError(output.value()));
+          const auto& ip_addresses_arg = std::get<EncodableList>(encodable_ip_addresses_arg);
+          api->LookupPeers(name_arg, ip_addresses_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(EncodableValue());
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -496,7 +1729,42 @@ void WireguardHostApi::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.stop" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.computeAllowedIps" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_include_arg = args.at(0);
+          if (encodable_include_arg.IsNull()) {
+            reply(WrapError("include_arg unexpectedly null."));
+            return;
+          }
+          const auto& include_arg = std::get<EncodableList>(encodable_include_arg);
+          const auto& encodable_exclude_arg = args.at(1);
+          if (encodable_exclude_arg.IsNull()) {
+            reply(WrapError("exclude_arg unexpectedly null."));
+            return;
+          }
+          const auto& exclude_arg = std::get<EncodableList>(encodable_exclude_arg);
+          api->ComputeAllowedIps(include_arg, exclude_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.reresolveEndpoints" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
@@ -507,7 +1775,36 @@ void WireguardHostApi::SetUp(
             return;
           }
           const auto& name_arg = std::get<std::string>(encodable_name_arg);
-          api->Stop(name_arg, [reply](std::optional<FlutterError>&& output) {
+          api->ReresolveEndpoints(name_arg, [reply](ErrorOr<int64_t>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setStaleAfter" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_seconds_arg = args.at(0);
+          if (encodable_seconds_arg.IsNull()) {
+            reply(WrapError("seconds_arg unexpectedly null."));
+            return;
+          }
+          const int64_t seconds_arg = encodable_seconds_arg.LongValue();
+          api->SetStaleAfter(seconds_arg, [reply](std::optional<FlutterError>&& output) {
             if (output.has_value()) {
               reply(WrapError(output.value()));
               return;
@@ -525,7 +1822,65 @@ void WireguardHostApi::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.status" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.generateKeyPairs" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_count_arg = args.at(0);
+          if (encodable_count_arg.IsNull()) {
+            reply(WrapError("count_arg unexpectedly null."));
+            return;
+          }
+          const int64_t count_arg = encodable_count_arg.LongValue();
+          api->GenerateKeyPairs(count_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.publicKeysFromPrivate" + prepended_suffix, &GetCodec());
+    if (api != nullptr) {
+      channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
+        try {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_private_keys_arg = args.at(0);
+          if (encodable_private_keys_arg.IsNull()) {
+            reply(WrapError("private_keys_arg unexpectedly null."));
+            return;
+          }
+          const auto& private_keys_arg = std::get<EncodableList>(encodable_private_keys_arg);
+          api->PublicKeysFromPrivate(private_keys_arg, [reply](ErrorOr<::flutter::EncodableList>&& output) {
+            if (output.has_error()) {
+              reply(WrapError(output.error()));
+              return;
+            }
+            EncodableList wrapped;
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            reply(EncodableValue(std::move(wrapped)));
+          });
+        } catch (const std::exception& exception) {
+          reply(WrapError(exception.what()));
+        }
+      });
+    } else {
+      channel.SetMessageHandler(nullptr);
+    }
+  }
+  {
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.peerByPublicKey" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
@@ -536,13 +1891,24 @@ void WireguardHostApi::SetUp(
             return;
           }
           const auto& name_arg = std::get<std::string>(encodable_name_arg);
-          api->Status(name_arg, [reply](ErrorOr<TunnelStatus>&& output) {
+          const auto& encodable_public_key_arg = args.at(1);
+          if (encodable_public_key_arg.IsNull()) {
+            reply(WrapError("public_key_arg unexpectedly null."));
+            return;
+          }
+          const auto& public_key_arg = std::get<std::string>(encodable_public_key_arg);
+          api->PeerByPublicKey(name_arg, public_key_arg, [reply](ErrorOr<std::optional<PeerStatus>>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            auto output_optional = std::move(output).TakeValue();
+            if (output_optional) {
+              wrapped.push_back(CustomEncodableValue(std::move(output_optional).value()));
+            } else {
+              wrapped.push_back(EncodableValue());
+            }
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -554,17 +1920,30 @@ void WireguardHostApi::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.tunnelNames" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.usage" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->TunnelNames([reply](ErrorOr<EncodableList>&& output) {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          const auto& encodable_since_arg = args.at(1);
+          if (encodable_since_arg.IsNull()) {
+            reply(WrapError("since_arg unexpectedly null."));
+            return;
+          }
+          const int64_t since_arg = encodable_since_arg.LongValue();
+          api->Usage(name_arg, since_arg, [reply](ErrorOr<TunnelUsage>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
+            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -576,17 +1955,36 @@ void WireguardHostApi::SetUp(
     }
   }
   {
-    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.backend" + prepended_suffix, &GetCodec());
+    BasicMessageChannel<> channel(binary_messenger, "dev.flutter.pigeon.flutter_wireguard.WireguardHostApi.setUsageQuota" + prepended_suffix, &GetCodec());
     if (api != nullptr) {
       channel.SetMessageHandler([api](const EncodableValue& message, const ::flutter::MessageReply<EncodableValue>& reply) {
         try {
-          api->Backend([reply](ErrorOr<BackendInfo>&& output) {
+          const auto& args = std::get<EncodableList>(message);
+          const auto& encodable_name_arg = args.at(0);
+          if (encodable_name_arg.IsNull()) {
+            reply(WrapError("name_arg unexpectedly null."));
+            return;
+          }
+          const auto& name_arg = std::get<std::string>(encodable_name_arg);
+          const auto& encodable_limit_bytes_arg = args.at(1);
+          if (encodable_limit_bytes_arg.IsNull()) {
+            reply(WrapError("limit_bytes_arg unexpectedly null."));
+            return;
+          }
+          const int64_t limit_bytes_arg = encodable_limit_bytes_arg.LongValue();
+          const auto& encodable_since_arg = args.at(2);
+          if (encodable_since_arg.IsNull()) {
+            reply(WrapError("since_arg unexpectedly null."));
+            return;
+          }
+          const int64_t since_arg = encodable_since_arg.LongValue();
+          api->SetUsageQuota(name_arg, limit_bytes_arg, since_arg, [reply](ErrorOr<int64_t>&& output) {
             if (output.has_error()) {
               reply(WrapError(output.error()));
               return;
             }
             EncodableList wrapped;
-            wrapped.push_back(CustomEncodableValue(std::move(output).TakeValue()));
+            wrapped.push_back(EncodableValue(std::move(output).TakeValue()));
             reply(EncodableValue(std::move(wrapped)));
           });
         } catch (const std::exception& exception) {
@@ -655,4 +2053,54 @@ void WireguardFlutterApi::OnTunnelStatus(
   });
 }
 
+void WireguardFlutterApi::OnUsageQuota(
+  const UsageQuotaExceeded& event_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onUsageQuota" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    CustomEncodableValue(event_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
+void WireguardFlutterApi::OnTunnelHealth(
+  const TunnelHealth& health_arg,
+  std::function<void(void)>&& on_success,
+  std::function<void(const FlutterError&)>&& on_error) {
+  const std::string channel_name = "dev.flutter.pigeon.flutter_wireguard.WireguardFlutterApi.onTunnelHealth" + message_channel_suffix_;
+  BasicMessageChannel<> channel(binary_messenger_, channel_name, &GetCodec());
+  EncodableValue encoded_api_arguments = EncodableValue(EncodableList{
+    CustomEncodableValue(health_arg),
+  });
+  channel.Send(encoded_api_arguments, [channel_name, on_success = std::move(on_success), on_error = std::move(on_error)](const uint8_t* reply, size_t reply_size) {
+    std::unique_ptr<EncodableValue> response = GetCodec().DecodeMessage(reply, reply_size);
+    const auto& encodable_return_value = *response;
+    const auto* list_return_value = std::get_if<EncodableList>(&encodable_return_value);
+    if (list_return_value) {
+      if (list_return_value->size() > 1) {
+        on_error(FlutterError(std::get<std::string>(list_return_value->at(0)), std::get<std::string>(list_return_value->at(1)), list_return_value->at(2)));
+      } else {
+        on_success();
+      }
+    } else {
+      on_error(CreateConnectionError(channel_name));
+    } 
+  });
+}
+
 }  // namespace flutter_wireguard
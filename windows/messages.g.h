@@ -75,6 +75,18 @@ enum class BackendKind {
   kUnknown = 2
 };
 
+// How a running tunnel's peer is doing, judged by the age of its last
+// handshake.
+enum class TunnelHealthState {
+  // First handshake since the tunnel was started.
+  kConnected = 0,
+  // No handshake for the stale-after age (180 s unless set with
+  // [WireguardHostApi.setStaleAfter]), or none that long after the start.
+  kStale = 1,
+  // A handshake again after [stale].
+  kRecovered = 2
+};
+
 
 // A snapshot of a tunnel's runtime status.
 //
@@ -158,6 +170,423 @@ class BackendInfo {
 };
 
 
+// One tunnel to bring up in a [WireguardHostApi.startMany] batch.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class TunnelSpec {
+ public:
+  // Constructs an object setting all fields.
+  explicit TunnelSpec(
+    const std::string& name,
+    const std::string& config);
+
+  // Tunnel/interface name (e.g. "wg0").
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  // wg-quick / wg-config string, as for [WireguardHostApi.start].
+  const std::string& config() const;
+  void set_config(std::string_view value_arg);
+
+  bool operator==(const TunnelSpec& other) const;
+  bool operator!=(const TunnelSpec& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static TunnelSpec FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string name_;
+  std::string config_;
+};
+
+
+// Per-tunnel outcome of a batch call.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class TunnelResult {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit TunnelResult(
+    const std::string& name,
+    bool ok);
+
+  // Constructs an object setting all fields.
+  explicit TunnelResult(
+    const std::string& name,
+    bool ok,
+    const std::string* error);
+
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  // True if the tunnel reached the requested state.
+  bool ok() const;
+  void set_ok(bool value_arg);
+
+  // Backend error message when [ok] is false.
+  const std::string* error() const;
+  void set_error(const std::string_view* value_arg);
+  void set_error(std::string_view value_arg);
+
+  bool operator==(const TunnelResult& other) const;
+  bool operator!=(const TunnelResult& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static TunnelResult FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string name_;
+  bool ok_;
+  std::optional<std::string> error_;
+};
+
+
+// Latency percentiles of one step of a tunnel operation.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PhaseStats {
+ public:
+  // Constructs an object setting all fields.
+  explicit PhaseStats(
+    const std::string& op,
+    const std::string& phase,
+    int64_t count,
+    double p50_ms,
+    double p95_ms,
+    double p99_ms);
+
+  // Operation the phase belongs to ("start", "stop", "switch", ...).
+  const std::string& op() const;
+  void set_op(std::string_view value_arg);
+
+  // Step within [op] ("wg_quick_up", "create_service", "total", ...).
+  const std::string& phase() const;
+  void set_phase(std::string_view value_arg);
+
+  // Number of samples recorded since the process started.
+  int64_t count() const;
+  void set_count(int64_t value_arg);
+
+  double p50_ms() const;
+  void set_p50_ms(double value_arg);
+
+  double p95_ms() const;
+  void set_p95_ms(double value_arg);
+
+  double p99_ms() const;
+  void set_p99_ms(double value_arg);
+
+  bool operator==(const PhaseStats& other) const;
+  bool operator!=(const PhaseStats& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static PhaseStats FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string op_;
+  std::string phase_;
+  int64_t count_;
+  double p50_ms_;
+  double p95_ms_;
+  double p99_ms_;
+};
+
+
+// A peer of a running tunnel crossing the handshake-age threshold.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class TunnelHealth {
+ public:
+  // Constructs an object setting all fields.
+  explicit TunnelHealth(
+    const std::string& name,
+    const std::string& public_key,
+    const TunnelHealthState& state,
+    int64_t last_handshake);
+
+  // Tunnel/interface name (e.g. "wg0").
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  // Base64 public key of the peer; "" where the platform only reports the
+  // tunnel as a whole (Windows).
+  const std::string& public_key() const;
+  void set_public_key(std::string_view value_arg);
+
+  const TunnelHealthState& state() const;
+  void set_state(const TunnelHealthState& value_arg);
+
+  // Epoch milliseconds of the handshake [state] was judged by (0 if none).
+  int64_t last_handshake() const;
+  void set_last_handshake(int64_t value_arg);
+
+  bool operator==(const TunnelHealth& other) const;
+  bool operator!=(const TunnelHealth& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static TunnelHealth FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string name_;
+  std::string public_key_;
+  TunnelHealthState state_;
+  int64_t last_handshake_;
+};
+
+
+// A WireGuard keypair generated natively.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class KeyPairData {
+ public:
+  // Constructs an object setting all fields.
+  explicit KeyPairData(
+    const std::string& private_key,
+    const std::string& public_key);
+
+  // Base64, as `wg genkey` prints it.
+  const std::string& private_key() const;
+  void set_private_key(std::string_view value_arg);
+
+  // Base64, as `wg pubkey` prints it.
+  const std::string& public_key() const;
+  void set_public_key(std::string_view value_arg);
+
+  bool operator==(const KeyPairData& other) const;
+  bool operator!=(const KeyPairData& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static KeyPairData FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string private_key_;
+  std::string public_key_;
+};
+
+
+// One peer of a running tunnel, as of the last status poll.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PeerStatus {
+ public:
+  // Constructs an object setting all non-nullable fields.
+  explicit PeerStatus(
+    const std::string& public_key,
+    int64_t rx,
+    int64_t tx,
+    int64_t last_handshake,
+    int64_t persistent_keepalive);
+
+  // Constructs an object setting all fields.
+  explicit PeerStatus(
+    const std::string& public_key,
+    const std::string* endpoint,
+    int64_t rx,
+    int64_t tx,
+    int64_t last_handshake,
+    int64_t persistent_keepalive);
+
+  // Base64 public key.
+  const std::string& public_key() const;
+  void set_public_key(std::string_view value_arg);
+
+  // "host:port" the peer was last heard from, null if none yet.
+  const std::string* endpoint() const;
+  void set_endpoint(const std::string_view* value_arg);
+  void set_endpoint(std::string_view value_arg);
+
+  // Bytes received from the peer.
+  int64_t rx() const;
+  void set_rx(int64_t value_arg);
+
+  // Bytes sent to the peer.
+  int64_t tx() const;
+  void set_tx(int64_t value_arg);
+
+  // Epoch milliseconds of the latest handshake, 0 if none.
+  int64_t last_handshake() const;
+  void set_last_handshake(int64_t value_arg);
+
+  // Seconds; 0 when off.
+  int64_t persistent_keepalive() const;
+  void set_persistent_keepalive(int64_t value_arg);
+
+  bool operator==(const PeerStatus& other) const;
+  bool operator!=(const PeerStatus& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static PeerStatus FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string public_key_;
+  std::optional<std::string> endpoint_;
+  int64_t rx_;
+  int64_t tx_;
+  int64_t last_handshake_;
+  int64_t persistent_keepalive_;
+};
+
+
+// One peer's share of a [TunnelUsage].
+//
+// Generated class from Pigeon that represents data sent in messages.
+class PeerUsage {
+ public:
+  // Constructs an object setting all fields.
+  explicit PeerUsage(
+    const std::string& public_key,
+    int64_t rx,
+    int64_t tx);
+
+  // Base64 public key.
+  const std::string& public_key() const;
+  void set_public_key(std::string_view value_arg);
+
+  // Bytes received from the peer.
+  int64_t rx() const;
+  void set_rx(int64_t value_arg);
+
+  // Bytes sent to the peer.
+  int64_t tx() const;
+  void set_tx(int64_t value_arg);
+
+  bool operator==(const PeerUsage& other) const;
+  bool operator!=(const PeerUsage& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static PeerUsage FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string public_key_;
+  int64_t rx_;
+  int64_t tx_;
+};
+
+
+// Data a tunnel used over a period, across restarts of the tunnel and of
+// the app.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class TunnelUsage {
+ public:
+  // Constructs an object setting all fields.
+  explicit TunnelUsage(
+    const std::string& name,
+    int64_t since,
+    int64_t rx,
+    int64_t tx,
+    const ::flutter::EncodableList& peers);
+
+  // Tunnel/interface name (e.g. "wg0").
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  // Epoch milliseconds the usage is counted from, as asked.
+  int64_t since() const;
+  void set_since(int64_t value_arg);
+
+  // Bytes received over the tunnel.
+  int64_t rx() const;
+  void set_rx(int64_t value_arg);
+
+  // Bytes sent over the tunnel.
+  int64_t tx() const;
+  void set_tx(int64_t value_arg);
+
+  // Peers that carried traffic in the period.
+  const ::flutter::EncodableList& peers() const;
+  void set_peers(const ::flutter::EncodableList& value_arg);
+
+  bool operator==(const TunnelUsage& other) const;
+  bool operator!=(const TunnelUsage& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static TunnelUsage FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string name_;
+  int64_t since_;
+  int64_t rx_;
+  int64_t tx_;
+  ::flutter::EncodableList peers_;
+};
+
+
+// A tunnel that reached its usage quota.
+//
+// Generated class from Pigeon that represents data sent in messages.
+class UsageQuotaExceeded {
+ public:
+  // Constructs an object setting all fields.
+  explicit UsageQuotaExceeded(
+    const std::string& name,
+    int64_t limit,
+    int64_t used,
+    int64_t since,
+    bool stopped);
+
+  // Tunnel/interface name (e.g. "wg0").
+  const std::string& name() const;
+  void set_name(std::string_view value_arg);
+
+  // The quota, in bytes of rx + tx.
+  int64_t limit() const;
+  void set_limit(int64_t value_arg);
+
+  // Bytes of rx + tx used since [since] when the quota was noticed.
+  int64_t used() const;
+  void set_used(int64_t value_arg);
+
+  // Epoch milliseconds the quota counts from.
+  int64_t since() const;
+  void set_since(int64_t value_arg);
+
+  // Whether the tunnel was stopped; false if stopping it failed.
+  bool stopped() const;
+  void set_stopped(bool value_arg);
+
+  bool operator==(const UsageQuotaExceeded& other) const;
+  bool operator!=(const UsageQuotaExceeded& other) const;
+  /// Returns a hash code value for the object. This method is supported for the benefit of hash tables.
+  size_t Hash() const;
+ private:
+  static UsageQuotaExceeded FromEncodableList(const ::flutter::EncodableList& list);
+  ::flutter::EncodableList ToEncodableList() const;
+  friend class WireguardHostApi;
+  friend class WireguardFlutterApi;
+  friend class PigeonInternalCodecSerializer;
+  std::string name_;
+  int64_t limit_;
+  int64_t used_;
+  int64_t since_;
+  bool stopped_;
+};
+
+
 class PigeonInternalCodecSerializer : public ::flutter::StandardCodecSerializer {
  public:
   PigeonInternalCodecSerializer();
@@ -203,6 +632,99 @@ class WireguardHostApi {
   virtual void TunnelNames(std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
   // Returns the active backend.
   virtual void Backend(std::function<void(ErrorOr<BackendInfo> reply)> result) = 0;
+  // Bring several tunnels up at once. Independent tunnels are brought up
+  // concurrently where the platform allows it; one failure does not abort
+  // the rest. Results come back in input order.
+  virtual void StartMany(
+    const ::flutter::EncodableList& specs,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // Bring several tunnels down at once. Unknown names count as success.
+  virtual void StopMany(
+    const ::flutter::EncodableList& names,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // Replace tunnel [from] with [to] (configured by [config]) without a
+  // connectivity gap: [to] comes up and completes a handshake before
+  // traffic moves over and [from] goes down. If [to] fails, [from] is left
+  // untouched and "SWITCH_FAILED" is thrown.
+  virtual void SwitchTunnel(
+    const std::string& from,
+    const std::string& to,
+    const std::string& config,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Per-phase timings of every Start/Stop since the backend started, for
+  // telling where a slow connect spent its time.
+  virtual void Diagnostics(std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // Write the native trace buffers to [path] as Chrome trace JSON. Only
+  // available in builds with trace points compiled in; throws
+  // "TRACE_FAILED" otherwise.
+  virtual void DumpTrace(
+    const std::string& path,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // Public key of the peer tunnel [name] would route [ipAddress] to: the
+  // longest AllowedIPs prefix containing it, as the kernel picks. Null if no
+  // peer covers it. Throws "LOOKUP_FAILED" for an unknown tunnel or a
+  // malformed address.
+  virtual void LookupPeer(
+    const std::string& name,
+    const std::string& ip_address,
+    std::function<void(ErrorOr<std::optional<std::string>> reply)> result) = 0;
+  // [lookupPeer] for many addresses at once; results match [ipAddresses] in
+  // order.
+  virtual void LookupPeers(
+    const std::string& name,
+    const ::flutter::EncodableList& ip_addresses,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // The addresses in [include] but not in [exclude], as the fewest CIDR
+  // prefixes (IPv4 first, each family in address order). Throws
+  // "ALLOWED_IPS_FAILED" for a malformed prefix.
+  virtual void ComputeAllowedIps(
+    const ::flutter::EncodableList& include,
+    const ::flutter::EncodableList& exclude,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // Looks up the hostnames in the peer Endpoints of tunnel [name] again and
+  // moves the peers whose address changed. Returns how many moved. Throws
+  // "RESOLVE_FAILED".
+  virtual void ReresolveEndpoints(
+    const std::string& name,
+    std::function<void(ErrorOr<int64_t> reply)> result) = 0;
+  // Handshake age, in seconds, after which a peer is reported
+  // [TunnelHealthState.stale]. Defaults to 180; values below 1 are raised to 1.
+  virtual void SetStaleAfter(
+    int64_t seconds,
+    std::function<void(std::optional<FlutterError> reply)> result) = 0;
+  // [count] fresh keypairs from the platform CSPRNG, derived off the platform
+  // thread. Throws "KEYS_FAILED" for a negative or too-large [count].
+  virtual void GenerateKeyPairs(
+    int64_t count,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // The public key of each of [privateKeys], in order. Throws "KEYS_FAILED"
+  // naming the first key that is not 32 bytes of base64.
+  virtual void PublicKeysFromPrivate(
+    const ::flutter::EncodableList& private_keys,
+    std::function<void(ErrorOr<::flutter::EncodableList> reply)> result) = 0;
+  // The peer of tunnel [name] with [publicKey], as of the last status poll;
+  // null if the tunnel has no such peer. Throws "PEER_FAILED" for an unknown
+  // tunnel or a malformed key.
+  virtual void PeerByPublicKey(
+    const std::string& name,
+    const std::string& public_key,
+    std::function<void(ErrorOr<std::optional<PeerStatus>> reply)> result) = 0;
+  // Data tunnel [name] used since [since] (epoch milliseconds), from the
+  // persistent usage ledger. Throws "USAGE_FAILED" for an invalid name or
+  // when the ledger is unavailable.
+  virtual void Usage(
+    const std::string& name,
+    int64_t since,
+    std::function<void(ErrorOr<TunnelUsage> reply)> result) = 0;
+  // Stops tunnel [name] once its rx + tx since [since] reaches [limitBytes],
+  // reporting it through [WireguardFlutterApi.onUsageQuota]; a [limitBytes] of
+  // 0 removes the quota. Returns the bytes already used. Throws
+  // "USAGE_FAILED" like [usage].
+  virtual void SetUsageQuota(
+    const std::string& name,
+    int64_t limit_bytes,
+    int64_t since,
+    std::function<void(ErrorOr<int64_t> reply)> result) = 0;
 
   // The codec used by WireguardHostApi.
   static const ::flutter::StandardMessageCodec& GetCodec();
@@ -234,6 +756,18 @@ class WireguardFlutterApi {
     const TunnelStatus& status,
     std::function<void(void)>&& on_success,
     std::function<void(const FlutterError&)>&& on_error);
+  // Pushed the moment a peer of a running tunnel connects, goes stale or
+  // recovers.
+  void OnTunnelHealth(
+    const TunnelHealth& health,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
+  // Pushed once when a tunnel reaches the quota set with
+  // [WireguardHostApi.setUsageQuota], after it was stopped.
+  void OnUsageQuota(
+    const UsageQuotaExceeded& event,
+    std::function<void(void)>&& on_success,
+    std::function<void(const FlutterError&)>&& on_error);
  private:
   ::flutter::BinaryMessenger* binary_messenger_;
   std::string message_channel_suffix_;